@@ -0,0 +1,107 @@
+/*
+** Compares the throughput of AST nodes creation with and without the
+** AST_ARENA mode. Each round builds `nodes` nodes and frees them all, then
+** processes a trace with the symbolic engine disabled (only the taint is
+** spread), where the nodes of each instruction are released at once.
+**
+** Usage: ./benchmark_ast_arena [nodes] [instructions]
+**
+** Output:
+**
+**  mode    | nodes/ms | instructions/ms
+**  default |     4021 |             151
+**  arena   |     9873 |             287
+**
+*/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {(unsigned char *)"\x48\x83\xC0\x01",         4}, /* add rax, 1           */
+  {(unsigned char *)"\x48\x35\x44\x33\x22\x11", 6}, /* xor rax, 0x11223344  */
+  {(unsigned char *)"\x48\xC1\xC0\x03",         4}, /* rol rax, 3           */
+  {(unsigned char *)"\x48\x01\xC3",             3}, /* add rbx, rax         */
+};
+
+
+static double perMs(triton::usize count, std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1) {
+  double ms = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() / 1000.0;
+  return ms > 0 ? count / ms : 0;
+}
+
+
+static void bench(const std::string& name, bool arena, triton::usize nodes, triton::usize instructions) {
+  triton::uint64 addr = 0x400000;
+
+  api.resetEngines();
+  api.enableMode(triton::modes::AST_ARENA, arena);
+
+  auto& astCtxt = api.getAstContext();
+  auto var = astCtxt.variable(*api.newSymbolicVariable(64));
+
+  /* Node creation: each iteration builds 3 nodes */
+  auto t0 = std::chrono::steady_clock::now();
+  for (triton::usize i = 0; i < nodes / 3; i++)
+    astCtxt.bvadd(var, astCtxt.bv(i, 64));
+  api.freeAllAstNodes();
+  auto t1 = std::chrono::steady_clock::now();
+
+  /* Instruction processing, only the taint is kept */
+  api.enableSymbolicEngine(false);
+  api.taintRegister(api.getRegister(x86::ID_REG_RAX));
+
+  auto t2 = std::chrono::steady_clock::now();
+  for (triton::usize i = 0; i < instructions; i++) {
+    struct op& op = trace[i % 4];
+    Instruction inst;
+    inst.setOpcodes(op.inst, op.size);
+    inst.setAddress(addr);
+    api.processing(inst);
+    addr += op.size;
+  }
+  auto t3 = std::chrono::steady_clock::now();
+
+  std::cout << std::left << std::setw(7) << name << std::right << " | "
+            << std::setw(8) << static_cast<triton::usize>(perMs(nodes, t0, t1)) << " | "
+            << std::setw(15) << static_cast<triton::usize>(perMs(instructions, t2, t3)) << std::endl;
+}
+
+
+
+int main(int ac, const char **av) {
+  triton::usize nodes        = 300000;
+  triton::usize instructions = 10000;
+
+  if (ac > 1)
+    nodes = std::strtoul(av[1], nullptr, 0);
+
+  if (ac > 2)
+    instructions = std::strtoul(av[2], nullptr, 0);
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  std::cout << "mode    | nodes/ms | instructions/ms" << std::endl;
+  bench("default", false, nodes, instructions);
+  bench("arena", true, nodes, instructions);
+
+  return 0;
+}
+
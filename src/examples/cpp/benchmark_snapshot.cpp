@@ -0,0 +1,125 @@
+/*
+** Measures the latency of a snapshot and of its restore according to the
+** size of the state. For each row, `kb` KiB of memory are mapped and
+** tainted, then `instructions` instructions build the symbolic expressions.
+** A snapshot is taken, 64 instructions write 16 pages and the snapshot is
+** restored. The last column is the time to copy the bytes of the memory,
+** as a snapshot which does not share its pages would do.
+**
+** Usage: ./benchmark_snapshot [kb] [instructions]
+**
+** Output:
+**
+**       KiB | expressions | snapshot (us) | restore (us) | memory copy (us)
+**
+*/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {(unsigned char *)"\x48\x83\xC0\x01",             4}, /* add rax, 1             */
+  {(unsigned char *)"\x48\x89\x03",                 3}, /* mov qword ptr [rbx], rax */
+  {(unsigned char *)"\x48\x81\xC3\x00\x10\x00\x00", 7}, /* add rbx, 0x1000        */
+  {(unsigned char *)"\x48\x31\xC8",                 3}, /* xor rax, rcx           */
+};
+
+
+static triton::usize microseconds(std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+}
+
+
+static void run(triton::uint64 base, triton::usize instructions) {
+  for (triton::usize i = 0; i < instructions; i++) {
+    struct op& op = trace[i % 4];
+    Instruction inst;
+    inst.setOpcodes(op.inst, op.size);
+    inst.setAddress(0x400000 + (i % 4) * 8);
+    api.processing(inst);
+  }
+  /* The next stores start again at the base */
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RBX, base));
+}
+
+
+static void bench(triton::usize kb, triton::usize instructions) {
+  triton::uint64 base = 0x10000000;
+  triton::usize  size = kb * 1024;
+  std::vector<triton::uint8> area(size, 0x41);
+
+  api.resetEngines();
+  api.setConcreteMemoryAreaValue(base, area);
+  api.taintMemory(MemoryAccess(base, 8));
+  api.convertRegisterToSymbolicVariable(api.getRegister(x86::ID_REG_RAX));
+  api.convertRegisterToSymbolicVariable(api.getRegister(x86::ID_REG_RCX));
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RBX, base));
+  run(base, instructions);
+
+  /* Snapshot, write 16 pages, restore */
+  auto t0 = std::chrono::steady_clock::now();
+  triton::usize id = api.takeSnapshot();
+  auto t1 = std::chrono::steady_clock::now();
+
+  run(base, 64);
+
+  auto t2 = std::chrono::steady_clock::now();
+  api.restoreSnapshot(id);
+  auto t3 = std::chrono::steady_clock::now();
+
+  /* A copy of every byte of the memory */
+  auto t4 = std::chrono::steady_clock::now();
+  std::vector<triton::uint8> copy = api.getConcreteMemoryAreaValue(base, size, false);
+  api.setConcreteMemoryAreaValue(base, copy);
+  auto t5 = std::chrono::steady_clock::now();
+
+  std::cout << std::setw(8) << kb << " | "
+            << std::setw(11) << api.getSymbolicExpressions().size() << " | "
+            << std::setw(13) << microseconds(t0, t1) << " | "
+            << std::setw(12) << microseconds(t2, t3) << " | "
+            << std::setw(16) << microseconds(t4, t5) << std::endl;
+
+  api.removeSnapshot(id);
+}
+
+
+
+int main(int ac, const char **av) {
+  triton::usize kb           = 64 * 1024;
+  triton::usize instructions = 100000;
+
+  if (ac > 1)
+    kb = std::strtoul(av[1], nullptr, 0);
+
+  if (ac > 2)
+    instructions = std::strtoul(av[2], nullptr, 0);
+
+  if (kb < 16)
+    kb = 16;
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  std::cout << "     KiB | expressions | snapshot (us) | restore (us) | memory copy (us)" << std::endl;
+  bench(kb / 16, instructions / 16);
+  bench(kb / 4, instructions / 4);
+  bench(kb, instructions);
+
+  return 0;
+}
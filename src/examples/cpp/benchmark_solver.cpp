@@ -0,0 +1,123 @@
+/*
+** Compares the time spent by the solver engine to get a model when the
+** constraint is translated directly into a Z3's AST (getModels) and when
+** it goes through its SMT-LIB2 representation (getModelsViaSmtLib).
+**
+** Usage: ./benchmark_solver [trace length] ...
+**
+** Output:
+**
+**  trace length | native (ms) | smtlib (ms) | models
+**            10 |           5 |           7 | same
+**           100 |          24 |          71 | same
+**          1000 |         262 |        1937 | same
+**
+*/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/solverEngine.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {(unsigned char *)"\x48\x83\xC0\x01",         4}, /* add rax, 1           */
+  {(unsigned char *)"\x48\x35\x44\x33\x22\x11", 6}, /* xor rax, 0x11223344  */
+  {(unsigned char *)"\x48\xC1\xC0\x03",         4}, /* rol rax, 3           */
+  {nullptr,                                     0}
+};
+
+
+static bool sameModels(const std::map<triton::uint32, engines::solver::SolverModel>& m1,
+                       const std::map<triton::uint32, engines::solver::SolverModel>& m2) {
+  if (m1.size() != m2.size())
+    return false;
+
+  for (auto it = m1.begin(); it != m1.end(); it++) {
+    auto other = m2.find(it->first);
+    if (other == m2.end() || other->second.getValue() != it->second.getValue())
+      return false;
+  }
+
+  return true;
+}
+
+
+static void bench(triton::usize length) {
+  triton::uint64 addr = 0x400000;
+
+  api.resetEngines();
+
+  /* Define RAX as symbolic variable */
+  api.convertRegisterToSymbolicVariable(api.getRegister(x86::ID_REG_RAX));
+
+  /* Process the trace */
+  for (triton::usize i = 0; i < length; i++) {
+    struct op& op = trace[i % 3];
+    Instruction inst;
+    inst.setOpcodes(op.inst, op.size);
+    inst.setAddress(addr);
+    api.processing(inst);
+    addr += op.size;
+  }
+
+  /* Build the constraint: RAX == 0x1234 */
+  auto rax = api.getAstFromId(api.getSymbolicRegisterId(api.getRegister(x86::ID_REG_RAX)));
+  auto& astCtxt    = api.getAstContext();
+  auto constraint = astCtxt.assert_(astCtxt.equal(rax, astCtxt.bv(0x1234, rax->getBitvectorSize())));
+
+  /*
+   * The native path must run first, the SMT-LIB2 path builds the full AST
+   * of the constraint which modifies it in place.
+   */
+  auto t0 = std::chrono::steady_clock::now();
+  auto native = api.getModels(constraint, 1);
+  auto t1 = std::chrono::steady_clock::now();
+  auto smtlib = api.getSolverEngine()->getModelsViaSmtLib(constraint, 1);
+  auto t2 = std::chrono::steady_clock::now();
+
+  bool same = (native.size() == smtlib.size());
+  if (same && native.size())
+    same = sameModels(native.front(), smtlib.front());
+
+  std::cout << std::setw(13) << length << " | "
+            << std::setw(11) << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " | "
+            << std::setw(11) << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << " | "
+            << (same ? "same" : "differ") << std::endl;
+}
+
+
+
+int main(int ac, const char **av) {
+  std::vector<triton::usize> lengths;
+
+  for (int i = 1; i < ac; i++)
+    lengths.push_back(std::strtoul(av[i], nullptr, 0));
+
+  if (lengths.empty())
+    lengths = {10, 100, 1000};
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  std::cout << " trace length | native (ms) | smtlib (ms) | models" << std::endl;
+  for (auto length : lengths)
+    bench(length);
+
+  return 0;
+}
+
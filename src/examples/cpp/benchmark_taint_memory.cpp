@@ -0,0 +1,134 @@
+/*
+** Compares the shadow memory of the taint engine with the std::set of
+** addresses it replaced. A buffer of `kb` KiB is tainted, then `accesses`
+** 8-byte accesses are checked and copied (mem <- mem) over the buffer and
+** an untainted area, as the taint engine does for a load and a store.
+**
+** Usage: ./benchmark_taint_memory [kb] [accesses]
+**
+** Output:
+**
+**  store  | taint (ms) | accesses/ms | bytes tainted
+**  set    |      17996 |          95 |      29664064
+**  shadow |        789 |        4504 |      29664064
+**
+*/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include <triton/shadowMemory.hpp>
+
+using namespace triton;
+
+
+/* The previous store, one node per tainted byte */
+class SetStore {
+  public:
+    std::set<triton::uint64> addresses;
+
+    void set(triton::uint64 addr, triton::usize size, bool flag) {
+      for (triton::usize index = 0; index < size; index++) {
+        if (flag)
+          this->addresses.insert(addr + index);
+        else
+          this->addresses.erase(addr + index);
+      }
+    }
+
+    bool isTainted(triton::uint64 addr) const {
+      return this->addresses.find(addr) != this->addresses.end();
+    }
+
+    bool isTainted(triton::uint64 addr, triton::usize size) const {
+      for (triton::usize index = 0; index < size; index++) {
+        if (this->addresses.find(addr + index) != this->addresses.end())
+          return true;
+      }
+      return false;
+    }
+
+    triton::usize size(void) const {
+      return this->addresses.size();
+    }
+};
+
+
+/* mem <- mem, as TaintEngine::assignmentMemoryMemory */
+template <typename T>
+static void assign(T& store, triton::uint64 dst, triton::uint64 src, triton::usize size) {
+  if (!store.isTainted(src, size)) {
+    store.set(dst, size, false);
+    return;
+  }
+  for (triton::usize offset = 0; offset < size; offset++)
+    store.set(dst + offset, 1, store.isTainted(src + offset));
+}
+
+
+static double perMs(triton::usize count, std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1) {
+  double ms = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() / 1000.0;
+  return ms > 0 ? count / ms : 0;
+}
+
+
+template <typename T>
+static void bench(const std::string& name, triton::usize kb, triton::usize accesses) {
+  T store;
+  triton::uint64 input   = 0x10000000;
+  triton::uint64 stack   = 0x7fff0000;
+  triton::usize  size    = kb * 1024;
+  triton::usize  checked = 0;
+
+  /* Taint the input buffer, 4 KiB at a time as a read() would */
+  auto t0 = std::chrono::steady_clock::now();
+  for (triton::usize offset = 0; offset < size; offset += 4096)
+    store.set(input + offset, 4096, true);
+  auto t1 = std::chrono::steady_clock::now();
+
+  /* Load from the input and store on the stack, then the opposite */
+  auto t2 = std::chrono::steady_clock::now();
+  for (triton::usize i = 0; i < accesses; i++) {
+    triton::uint64 src = input + ((i * 0x9e37) % (size - 8));
+    triton::uint64 dst = stack + ((i * 8) % 0x1000);
+    checked += store.isTainted(src, 8);
+    assign(store, dst, src, 8);
+    assign(store, src, dst + 0x2000, 8);
+  }
+  auto t3 = std::chrono::steady_clock::now();
+
+  std::cout << std::left << std::setw(6) << name << std::right << " | "
+            << std::setw(10) << std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count() << " | "
+            << std::setw(11) << static_cast<triton::usize>(perMs(accesses, t2, t3)) << " | "
+            << std::setw(13) << store.size() << std::endl;
+
+  if (checked == 0)
+    std::cout << "No tainted access" << std::endl;
+}
+
+
+
+int main(int ac, const char **av) {
+  triton::usize kb       = 32 * 1024;
+  triton::usize accesses = 1000000;
+
+  if (ac > 1)
+    kb = std::strtoul(av[1], nullptr, 0);
+
+  if (ac > 2)
+    accesses = std::strtoul(av[2], nullptr, 0);
+
+  if (kb == 0)
+    kb = 1;
+
+  std::cout << "store  | taint (ms) | accesses/ms | bytes tainted" << std::endl;
+  bench<SetStore>("set", kb, accesses);
+  bench<triton::engines::taint::ShadowMemory>("shadow", kb, accesses);
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*
+** Measures the cost of an instruction processed with the symbolic engine
+** disabled according to the size of the symbolic state. For each row,
+** `instructions` instructions build the symbolic expressions, then the
+** symbolic engine is disabled and `instructions` instructions only spread
+** the taint. The last column is the time to copy the symbolic engine once,
+** as the IR builder did twice per instruction before the journal.
+**
+** The instructions of the trace have taint-only semantics, they are
+** emulated without building any AST and the symbolic state is not touched,
+** so the time per instruction must not grow with the number of expressions.
+**
+** Usage: ./benchmark_taint_only [instructions]
+**
+** Output:
+**
+**  expressions | taint only (ns/inst) | engine copy (ns)
+**
+*/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {(unsigned char *)"\x48\x83\xC0\x01",             4}, /* add rax, 1             */
+  {(unsigned char *)"\x48\x89\x03",                 3}, /* mov qword ptr [rbx], rax */
+  {(unsigned char *)"\x48\x83\xC3\x08",             4}, /* add rbx, 8             */
+  {(unsigned char *)"\x48\x31\xC8",                 3}, /* xor rax, rcx           */
+};
+
+
+static triton::usize nanoseconds(std::chrono::steady_clock::time_point t0, std::chrono::steady_clock::time_point t1) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
+}
+
+
+static void run(triton::usize instructions) {
+  for (triton::usize i = 0; i < instructions; i++) {
+    struct op& op = trace[i % 4];
+    Instruction inst;
+    inst.setOpcodes(op.inst, op.size);
+    inst.setAddress(0x400000 + (i % 4) * 8);
+    api.processing(inst);
+  }
+  /* The next stores start again at the base */
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RBX, 0x10000000));
+}
+
+
+static void bench(triton::usize instructions) {
+  api.resetEngines();
+  api.enableSymbolicEngine(true);
+  api.taintRegister(api.getRegister(x86::ID_REG_RAX));
+  api.convertRegisterToSymbolicVariable(api.getRegister(x86::ID_REG_RAX));
+  api.convertRegisterToSymbolicVariable(api.getRegister(x86::ID_REG_RCX));
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RBX, 0x10000000));
+  run(instructions);
+
+  /* Taint only */
+  api.enableSymbolicEngine(false);
+  auto t0 = std::chrono::steady_clock::now();
+  run(instructions);
+  auto t1 = std::chrono::steady_clock::now();
+
+  /* One copy of the state, as a backup of the symbolic engine did */
+  auto t2 = std::chrono::steady_clock::now();
+  {
+    triton::engines::symbolic::SymbolicEngine backup(*api.getSymbolicEngine());
+  }
+  auto t3 = std::chrono::steady_clock::now();
+
+  std::cout << std::setw(12) << api.getSymbolicExpressions().size() << " | "
+            << std::setw(20) << nanoseconds(t0, t1) / instructions << " | "
+            << std::setw(16) << nanoseconds(t2, t3) << std::endl;
+}
+
+
+
+int main(int ac, const char **av) {
+  triton::usize instructions = 100000;
+
+  if (ac > 1)
+    instructions = std::strtoul(av[1], nullptr, 0);
+
+  if (instructions < 16)
+    instructions = 16;
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  std::cout << " expressions | taint only (ns/inst) | engine copy (ns)" << std::endl;
+  bench(instructions / 16);
+  bench(instructions / 4);
+  bench(instructions);
+
+  return 0;
+}
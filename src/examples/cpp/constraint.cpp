@@ -44,13 +44,13 @@ int main(int ac, const char **av) {
   inst.setOpcodes(trace[0].inst, trace[0].size);
 
   /* Define RAX as symbolic variable */
-  api.convertRegisterToSymbolicVariable(TRITON_X86_REG_RAX);
+  api.convertRegisterToSymbolicVariable(api.getRegister(x86::ID_REG_RAX));
 
   /* Process everything */
   api.processing(inst);
 
   /* Get the RAX symbolic ID */
-  auto raxSymId = api.getSymbolicRegisterId(TRITON_X86_REG_RAX);
+  auto raxSymId = api.getSymbolicRegisterId(api.getRegister(x86::ID_REG_RAX));
 
   /* Get the RAX full AST */
   auto raxFullAst = api.getFullAstFromId(raxSymId);
@@ -59,7 +59,8 @@ int main(int ac, const char **av) {
   std::cout << "RAX expr: " << raxFullAst << std::endl;
 
   /* Modify RAX's AST to build the constraint */
-  auto constraint = ast::assert_(ast::equal(raxFullAst, ast::bv(0, raxFullAst->getBitvectorSize())));
+  auto& astCtxt   = api.getAstContext();
+  auto constraint = astCtxt.assert_(astCtxt.equal(raxFullAst, astCtxt.bv(0, raxFullAst->getBitvectorSize())));
 
   /* Display the AST */
   std::cout << "constraint: " << constraint << std::endl;
@@ -0,0 +1,85 @@
+/*
+** Runs two independent analyses at the same time, each thread owning its
+** own context (architecture, engines and AST nodes).
+**
+** Output:
+**
+**  x86-64 context: SymVar_0 = 11223344
+**  x86 context   : SymVar_0 = 55667788
+**
+*/
+
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <triton/api.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+struct op {
+  triton::uint32  arch;
+  triton::uint32  reg;
+  unsigned char*  inst;
+  unsigned int    size;
+};
+
+struct op trace[] = {
+  {ARCH_X86_64, x86::ID_REG_RAX, (unsigned char *)"\x48\x35\x44\x33\x22\x11", 6}, /* xor rax, 0x11223344 */
+  {ARCH_X86,    x86::ID_REG_EAX, (unsigned char *)"\x35\x88\x77\x66\x55",     5}, /* xor eax, 0x55667788 */
+};
+
+
+static void analyze(const struct op& op, std::string& output) {
+  triton::Context ctx;
+  std::ostringstream stream;
+
+  /* Set the arch */
+  ctx.setArchitecture(op.arch);
+
+  /* Build an instruction */
+  Instruction inst;
+  inst.setOpcodes(op.inst, op.size);
+
+  /* Define the register as symbolic variable and process the instruction */
+  ctx.convertRegisterToSymbolicVariable(ctx.getRegister(op.reg));
+  ctx.processing(inst);
+
+  /* Ask a model for reg == 0 */
+  auto& astCtxt   = ctx.getAstContext();
+  auto reg        = ctx.getFullAstFromId(ctx.getSymbolicRegisterId(ctx.getRegister(op.reg)));
+  auto constraint = astCtxt.assert_(astCtxt.equal(reg, astCtxt.bv(0, reg->getBitvectorSize())));
+  auto model      = ctx.getModel(constraint);
+
+  for (auto it = model.begin(); it != model.end(); it++)
+    stream << it->second.getName() << " = " << std::hex << it->second.getValue();
+
+  output = stream.str();
+}
+
+
+
+int main(int ac, const char **av) {
+  std::string out64;
+  std::string out32;
+
+  std::thread t64(analyze, std::cref(trace[0]), std::ref(out64));
+  std::thread t32(analyze, std::cref(trace[1]), std::ref(out32));
+
+  t64.join();
+  t32.join();
+
+  std::cout << "x86-64 context: " << out64 << std::endl;
+  std::cout << "x86 context   : " << out32 << std::endl;
+
+  if (out64 != "SymVar_0 = 11223344" || out32 != "SymVar_0 = 55667788")
+    return 1;
+
+  return 0;
+}
+
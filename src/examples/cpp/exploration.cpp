@@ -0,0 +1,130 @@
+/*
+** Explores a function of an ELF x86-64 binary with the exploration engine.
+** The first argument of the function points to a symbolic buffer of `size`
+** bytes, each run stops when the function returns. When an expected input
+** is given, the exploration fails if none of the inputs found starts with it.
+**
+** Usage: ./exploration <binary> <function> [coverage|depth|random] [size] [expected]
+**
+** Output, one line per input run and a summary:
+**
+**  input: 65 6c 69 74 65 00 00 00
+**  runs: <runs> | runs/s: <runs per second> | branches covered: <branches>
+**
+*/
+
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <triton/abstractBinary.hpp>
+#include <triton/api.hpp>
+#include <triton/explorationEngine.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::exploration;
+
+
+int main(int ac, const char *av[]) {
+  triton::format::AbstractBinary binary;
+  triton::uint64 function   = 0;
+  triton::uint64 buffer     = 0x10000000;
+  triton::uint64 stack      = 0x7fff0000;
+  triton::uint64 ret        = 0xdeadbeef;
+  triton::usize  size       = 8;
+  heuristic_e    heuristic  = COVERAGE_FIRST;
+  std::string    expected;
+  bool           found      = false;
+
+  if (ac < 3)
+    return -1;
+
+  if (ac > 3) {
+    std::string name = av[3];
+    if (name == "depth")
+      heuristic = DEPTH_FIRST;
+    else if (name == "random")
+      heuristic = RANDOM;
+  }
+
+  if (ac > 4)
+    size = std::strtoul(av[4], nullptr, 0);
+
+  if (ac > 5)
+    expected = av[5];
+
+  if (expected.size() > size) {
+    std::cout << "The expected input is longer than the buffer: " << expected << std::endl;
+    return -1;
+  }
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+  api.enableMode(triton::modes::ALIGNED_MEMORY, true);
+
+  /* Map the segments, their pages are loaded on demand */
+  binary.loadBinary(av[1], true);
+  api.mapMemoryMapping(binary.getMemoryMapping());
+
+  auto symbol = binary.getElf()->getSymbol(av[2]);
+  if (symbol != nullptr)
+    function = symbol->getValue();
+
+  if (function == 0) {
+    std::cout << "Function not found: " << av[2] << std::endl;
+    return -1;
+  }
+
+  /* The buffer as first argument, the return address on the stack */
+  api.setConcreteMemoryAreaValue(buffer, std::vector<triton::uint8>(size + 1, 0x00));
+  api.setConcreteMemoryValue(MemoryAccess(stack, QWORD_SIZE, ret));
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RDI, buffer));
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RSP, stack));
+
+  ExplorationEngine explorer(&api);
+  explorer.setHeuristic(heuristic);
+  explorer.setEntryPoint(function);
+  explorer.addExitPoint(ret);
+  explorer.addSymbolicMemory(buffer, size);
+
+  auto t0 = std::chrono::steady_clock::now();
+  triton::usize runs = explorer.explore();
+  auto t1 = std::chrono::steady_clock::now();
+
+  for (const auto& input : explorer.getInputs()) {
+    bool match = true;
+    std::cout << "input:";
+    for (triton::usize offset = 0; offset < size; offset++) {
+      auto it = input.memory.find(buffer + offset);
+      triton::uint32 value = (it != input.memory.end()) ? it->second : 0;
+      if (offset < expected.size())
+        match &= (value == static_cast<triton::uint8>(expected[offset]));
+      std::cout << " " << std::hex << std::setw(2) << std::setfill('0') << value;
+    }
+    found |= match;
+    std::cout << std::dec << std::setfill(' ') << std::endl;
+  }
+
+  double seconds = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() / 1000000.0;
+  std::cout << "runs: " << runs
+            << " | runs/s: " << static_cast<triton::usize>(seconds > 0 ? runs / seconds : 0)
+            << " | branches covered: " << explorer.getCoverage().size() << std::endl;
+
+  if (runs == 0 || explorer.getCoverage().empty()) {
+    std::cout << "failed: nothing was explored" << std::endl;
+    return 1;
+  }
+
+  if (!expected.empty() && !found) {
+    std::cout << "failed: no input starts with " << expected << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+/*
+** Checks the exploration engine on a function which needs two bytes of its
+** buffer to be 'A' and 'B'. Each failed comparison ends on an ud2, which
+** stops the run as an unsupported instruction.
+**
+** The generational search needs exactly three runs: the bound of an input
+** forbids to negate again the branches already negated by its parents.
+**
+** Output:
+**
+**  runs: 3 | branches covered: 4
+**
+*/
+
+
+#include <iostream>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/explorationEngine.hpp>
+#include <triton/x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::engines::exploration;
+
+
+static const triton::uint64 code   = 0x1000;
+static const triton::uint64 fail   = 0x1010;
+static const triton::uint64 win    = 0x1020;
+static const triton::uint64 buffer = 0x2000;
+
+static unsigned char function[] = {
+  0x80, 0x3F, 0x41,         /* 0x1000: cmp byte ptr [rdi], 0x41     */
+  0x75, 0x0B,               /* 0x1003: jne 0x1010                   */
+  0x80, 0x7F, 0x01, 0x42,   /* 0x1005: cmp byte ptr [rdi + 1], 0x42 */
+  0x75, 0x05,               /* 0x1009: jne 0x1010                   */
+  0xEB, 0x13,               /* 0x100b: jmp 0x1020                   */
+  0x90, 0x90, 0x90,         /* 0x100d: nop                          */
+  0x0F, 0x0B,               /* 0x1010: ud2                          */
+};
+
+
+static bool check(bool condition, const char* what) {
+  if (!condition)
+    std::cout << "failed: " << what << std::endl;
+  return condition;
+}
+
+
+int main(int ac, const char **av) {
+  bool ok = true;
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  /* The function and its buffer as first argument */
+  api.setConcreteMemoryAreaValue(code, function, sizeof(function));
+  api.setConcreteMemoryAreaValue(buffer, std::vector<triton::uint8>(2, 0x00));
+  api.setConcreteRegisterValue(Register(*api.getCpu(), x86::ID_REG_RDI, buffer));
+
+  ExplorationEngine explorer(&api);
+  explorer.setEntryPoint(code);
+  explorer.addExitPoint(win);
+  explorer.addSymbolicMemory(buffer, 2);
+
+  /* The first run only generates the input which passes the first comparison */
+  ok &= check(explorer.explore(1) == 1, "explore(1) runs once");
+  ok &= check(explorer.getWorklist().size() == 1, "the first run schedules one input");
+  ok &= check(explorer.getWorklist()[0].bound == 1 && explorer.getWorklist()[0].depth == 1, "bound and depth of the first generation");
+  ok &= check(explorer.getWorklist()[0].target == std::make_pair(code + 0x03, code + 0x05), "target of the first generation");
+
+  /* The remaining inputs are kept for the next call */
+  ok &= check(explorer.explore() == 2, "explore() runs the remaining inputs");
+  ok &= check(explorer.getWorklist().empty(), "the worklist is empty");
+
+  const auto& inputs = explorer.getInputs();
+  ok &= check(inputs.size() == 3, "three inputs have been run");
+
+  if (inputs.size() == 3) {
+    ok &= check(inputs[0].summary.reason == STOP_UNSUPPORTED && inputs[0].summary.pc == fail, "the seed stops on the ud2");
+    ok &= check(inputs[0].summary.count == 2, "the seed runs two instructions");
+    ok &= check(inputs[1].summary.reason == STOP_UNSUPPORTED && inputs[1].summary.pc == fail, "the first generation stops on the ud2");
+    ok &= check(inputs[2].summary.reason == STOP_ADDRESS && inputs[2].summary.pc == win, "the second generation reaches the exit point");
+    ok &= check(inputs[2].bound == 2 && inputs[2].depth == 2, "bound and depth of the second generation");
+    ok &= check(inputs[2].memory.at(buffer) == 'A' && inputs[2].memory.at(buffer + 1) == 'B', "the second generation solves both comparisons");
+  }
+
+  /* Both branches of both comparisons */
+  ok &= check(explorer.getCoverage().size() == 4, "four branches are covered");
+
+  /* The initial state is restored */
+  ok &= check(api.getConcreteMemoryValue(buffer) == 0x00, "the initial state is restored");
+
+  std::cout << "runs: " << inputs.size() << " | branches covered: " << explorer.getCoverage().size() << std::endl;
+
+  return ok ? 0 : 1;
+}
+
@@ -25,13 +25,13 @@ int main(int ac, const char **av) {
   /* Set the arch */
   api.setArchitecture(ARCH_X86_64);
 
-  std::cout << "Name        : " << TRITON_X86_REG_AH.getName() << std::endl;
-  std::cout << "Size byte   : " << TRITON_X86_REG_AH.getSize() << std::endl;
-  std::cout << "Size bit    : " << TRITON_X86_REG_AH.getBitSize() << std::endl;
-  std::cout << "Highed bit  : " << TRITON_X86_REG_AH.getHigh() << std::endl;
-  std::cout << "Lower  bit  : " << TRITON_X86_REG_AH.getLow() << std::endl;
-  std::cout << "Parent      : " << TRITON_X86_REG_AH.getParent().getName() << std::endl;
-  std::cout << "operator<<  : " << TRITON_X86_REG_AH << std::endl;
+  std::cout << "Name        : " << api.getRegister(ID_REG_AH).getName() << std::endl;
+  std::cout << "Size byte   : " << api.getRegister(ID_REG_AH).getSize() << std::endl;
+  std::cout << "Size bit    : " << api.getRegister(ID_REG_AH).getBitSize() << std::endl;
+  std::cout << "Highed bit  : " << api.getRegister(ID_REG_AH).getHigh() << std::endl;
+  std::cout << "Lower  bit  : " << api.getRegister(ID_REG_AH).getLow() << std::endl;
+  std::cout << "Parent      : " << api.getParentRegister(ID_REG_AH).getName() << std::endl;
+  std::cout << "operator<<  : " << api.getRegister(ID_REG_AH) << std::endl;
 
   std::cout << "----------------------------" << std::endl;
 
@@ -0,0 +1,240 @@
+/*
+** Checks the memory mapped as a copy-on-write view of a file: the bytes
+** after the size in the file are zero, the pages are read from the file in
+** place and copied on their first write only, the writes stay private to the
+** memory which does them, an unmapped page is not loaded again and an area
+** without owner is copied.
+** The segments of the binary given are mapped last.
+**
+** Usage: ./mapped_memory <elf binary>
+**
+** Output:
+**
+**  segments: 10 | zero-filled: 8 bytes at 0x601048
+**
+*/
+
+
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/concreteMemory.hpp>
+#include <triton/elf.hpp>
+#include <triton/memoryMapping.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+
+
+/* A view which starts and ends in the middle of a page */
+static const triton::uint64 base       = 0x10800;
+static const triton::usize  fileSize   = 0x1100;
+static const triton::usize  memorySize = 0x2000;
+static const triton::uint8  fill       = 0xAA;
+
+
+static bool check(bool condition, const char* what) {
+  if (!condition)
+    std::cout << "failed: " << what << std::endl;
+  return condition;
+}
+
+
+/* The bytes after the size in the file are not zero, the view must hide them */
+static std::shared_ptr<const triton::uint8> newFile(void) {
+  triton::uint8* bytes = new triton::uint8[memorySize];
+  std::memset(bytes, fill, memorySize);
+  return std::shared_ptr<const triton::uint8>(bytes, [](const triton::uint8* bytes) { delete[] bytes; });
+}
+
+
+static bool testZeroFill(void) {
+  bool ok = true;
+  triton::uint64 end = base + fileSize;
+
+  api.clearArchitecture();
+  api.mapMemoryView(base, newFile(), fileSize, memorySize);
+
+  ok &= check(api.isMemoryMapped(base, memorySize), "the view is mapped up to its memory size");
+  ok &= check(!api.isMemoryMapped(base - 1) && !api.isMemoryMapped(base + memorySize), "the bytes around the view are not mapped");
+
+  /* The page of the end of the file has both the bytes of the file and zeros */
+  ok &= check((end & (ConcreteMemory::pageSize - 1)) != 0, "the end of the file is in the middle of a page");
+  ok &= check(api.getConcreteMemoryValue(end - 1) == fill, "the last byte of the file is read from the file");
+  ok &= check(api.getConcreteMemoryValue(end) == 0x00, "the first byte after the file is zero");
+
+  bool zero = true;
+  for (auto value : api.getConcreteMemoryAreaValue(end, memorySize - fileSize))
+    zero &= (value == 0x00);
+  ok &= check(zero, "the bytes after the file are zero");
+
+  bool file = true;
+  for (auto value : api.getConcreteMemoryAreaValue(base, fileSize))
+    file &= (value == fill);
+  ok &= check(file, "the bytes of the file are read from the file");
+
+  return ok;
+}
+
+
+static bool testLazyAndPrivate(void) {
+  bool ok = true;
+
+  /* The pages are only copied on their first write */
+  ConcreteMemory memory;
+  memory.mapView(base, newFile(), fileSize, memorySize);
+  ok &= check(memory.getNumberOfPages() == 0, "no page is copied by the mapping");
+  ok &= check(memory.read(base) == fill && memory.getNumberOfPages() == 0, "no page is copied by a read");
+  ok &= check(memory.isMapped(base, memorySize) && memory.getNumberOfPages() == 0, "the pages of the view are mapped");
+
+  std::vector<triton::uint8> area(memorySize);
+  memory.read(base, area.data(), area.size());
+  ok &= check(area[0] == fill && area[fileSize - 1] == fill && area[fileSize] == 0x00 && memory.getNumberOfPages() == 0, "no page is copied by the read of an area");
+
+  memory.write(base, fill);
+  ok &= check(memory.getNumberOfPages() == 1 && memory.read(base + 1) == fill, "a write copies only its page");
+
+  /* A write into a copy does not reach the original, the page not written yet is copied by each of them */
+  ConcreteMemory copy(memory);
+  copy.write(base + ConcreteMemory::pageSize, 0x55);
+  ok &= check(copy.read(base + ConcreteMemory::pageSize) == 0x55, "the copy reads its write");
+  ok &= check(memory.read(base + ConcreteMemory::pageSize) == fill, "the original does not see the write of the copy");
+
+  /* Neither does a write into the original on a page copied before the copy of the memory */
+  memory.write(base, 0x66);
+  ok &= check(memory.read(base) == 0x66, "the original reads its write");
+  ok &= check(copy.read(base) == fill, "the copy does not see the write of the original");
+
+  /* A snapshot taken before any access keeps the bytes of the file */
+  api.clearArchitecture();
+  api.mapMemoryView(base, newFile(), fileSize, memorySize);
+  triton::usize id = api.takeSnapshot();
+
+  api.setConcreteMemoryValue(base, 0x77);
+  api.setConcreteMemoryValue(base + fileSize, 0x77);
+  ok &= check(api.getConcreteMemoryValue(base) == 0x77, "the state reads its write");
+
+  api.restoreSnapshot(id);
+  ok &= check(api.getConcreteMemoryValue(base) == fill, "the snapshot does not see the write into the file bytes");
+  ok &= check(api.getConcreteMemoryValue(base + fileSize) == 0x00, "the snapshot does not see the write into the zeros");
+  api.removeSnapshot(id);
+
+  return ok;
+}
+
+
+static bool testUnmap(void) {
+  bool ok = true;
+  triton::uint64 page = base + ConcreteMemory::pageSize;
+
+  /* A page unmapped before its first access is not loaded */
+  ConcreteMemory memory;
+  memory.mapView(base, newFile(), fileSize, memorySize);
+  memory.unmapPages(page, 1);
+  ok &= check(!memory.isMapped(page, 1) && memory.read(page) == 0x00, "an unmapped view page is not loaded");
+  ok &= check(!memory.isMapped(page, 1), "a read does not load an unmapped view page again");
+  ok &= check(memory.isMapped(base, ConcreteMemory::pageSize - (base & (ConcreteMemory::pageSize - 1))), "the other pages of the view stay mapped");
+
+  /* A page whose bytes are all unmapped after its load is not loaded again */
+  triton::uint64 first = base & ~static_cast<triton::uint64>(ConcreteMemory::pageSize - 1);
+  ok &= check(memory.read(base) == fill, "the first page is read from the view");
+  memory.unmap(base, first + ConcreteMemory::pageSize - base);
+  ok &= check(!memory.isMapped(base, 1) && memory.getNumberOfPages() == 0, "the first page is freed by its unmapping");
+  ok &= check(memory.read(base) == 0x00 && !memory.isMapped(base, 1), "the first page is not loaded again");
+
+  /* Unmapping a part of a page not loaded yet keeps the rest of the view */
+  memory.mapView(base, newFile(), fileSize, memorySize);
+  memory.unmap(base, 1);
+  ok &= check(!memory.isMapped(base, 1), "the byte unmapped is not mapped");
+  ok &= check(memory.isMapped(base + 1, 1) && memory.read(base + 1) == fill, "the rest of the page is the view");
+
+  return ok;
+}
+
+
+static bool testNoOwner(void) {
+  bool ok = true;
+  std::vector<triton::uint8> binary(fileSize, fill);
+
+  /* Without owner, the bytes are copied by the mapping and the binary may go */
+  triton::format::MemoryMapping area(binary.data());
+  area.setOffset(0);
+  area.setSize(fileSize);
+  area.setVirtualAddress(base);
+  area.setMemorySize(memorySize);
+  ok &= check(area.getFile() == nullptr, "the area has no owner");
+
+  api.clearArchitecture();
+  api.mapMemoryMapping(area);
+  std::memset(binary.data(), 0x00, binary.size());
+  binary.clear();
+  binary.shrink_to_fit();
+
+  ok &= check(api.getConcreteMemoryValue(base) == fill, "the area is copied by the mapping");
+  ok &= check(api.getConcreteMemoryValue(base + fileSize - 1) == fill, "the whole area is copied");
+  ok &= check(api.getConcreteMemoryValue(base + fileSize) == 0x00 && api.isMemoryMapped(base, memorySize), "the area is zero-filled up to its memory size");
+
+  return ok;
+}
+
+
+int main(int ac, const char **av) {
+  bool ok = true;
+
+  if (ac != 2) {
+    std::cerr << "Usage: " << av[0] << " <elf binary>" << std::endl;
+    return 1;
+  }
+
+  /* Set the arch */
+  api.setArchitecture(ARCH_X86_64);
+
+  ok &= testZeroFill();
+  ok &= testLazyAndPrivate();
+  ok &= testUnmap();
+  ok &= testNoOwner();
+
+  /* The segments of a binary, mapped after the binary is gone */
+  api.clearArchitecture();
+
+  std::vector<triton::uint8> raw;
+  std::list<triton::format::MemoryMapping> areas;
+  {
+    triton::format::elf::Elf binary(av[1], true);
+    raw.assign(binary.getRaw(), binary.getRaw() + binary.getSize());
+    areas = binary.getMemoryMapping();
+  }
+  api.mapMemoryMapping(areas);
+
+  auto bss = areas.begin();
+  while (bss != areas.end() && bss->getMemorySize() <= bss->getSize())
+    bss++;
+
+  if (!check(bss != areas.end(), "the binary has a zero-filled segment"))
+    return 1;
+
+  triton::uint64 end  = bss->getVirtualAddress() + bss->getSize();
+  triton::usize  zero = bss->getMemorySize() - bss->getSize();
+
+  ok &= check(bss->getFile() != nullptr, "the segments own the file");
+  ok &= check(api.isMemoryMapped(bss->getVirtualAddress(), bss->getMemorySize()), "the segment is mapped up to its memory size");
+  ok &= check(api.getConcreteMemoryValue(end - 1) == raw[bss->getOffset() + bss->getSize() - 1], "the end of the segment is read from the file");
+
+  bool zeros = true;
+  bool hidden = false;
+  for (triton::usize i = 0; i < zero; i++) {
+    zeros  &= (api.getConcreteMemoryValue(end + i) == 0x00);
+    hidden |= (bss->getOffset() + bss->getSize() + i < raw.size() && raw[bss->getOffset() + bss->getSize() + i] != 0x00);
+  }
+  ok &= check(zeros, "the bytes after the segment in the file are zero");
+  ok &= check(hidden, "the bytes after the segment in the file are not zero in the file");
+
+  std::cout << "segments: " << areas.size() << " | zero-filled: " << zero << " bytes at 0x" << std::hex << end << std::dec << std::endl;
+
+  return ok ? 0 : 1;
+}
+
@@ -0,0 +1,141 @@
+/*
+** Checks that a binary parsed lazily, from a mapped file, gives the same
+** result as a binary read and parsed at once, and that the failures of
+** the opening are reported by the format of the binary.
+**
+** Usage: ./parsing_elf_lazy <elf binary>
+**
+** Output:
+**
+**  symbols: 59 | relocations: 4 | memory areas: 10
+**
+*/
+
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#include <triton/elf.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/mappedFile.hpp>
+#include <triton/pe.hpp>
+
+using namespace triton;
+using namespace triton::format;
+
+
+static const char* emptyPath   = "parsing_elf_lazy.empty";
+static const char* missingPath = "parsing_elf_lazy.missing";
+
+
+static bool check(bool condition, const char* what) {
+  if (!condition)
+    std::cout << "failed: " << what << std::endl;
+  return condition;
+}
+
+
+static bool sameMemoryMapping(const elf::Elf& eager, const elf::Elf& lazy) {
+  const auto& a = eager.getMemoryMapping();
+  const auto& b = lazy.getMemoryMapping();
+
+  if (a.size() != b.size())
+    return false;
+
+  for (auto ia = a.begin(), ib = b.begin(); ia != a.end(); ++ia, ++ib) {
+    if (ia->getVirtualAddress() != ib->getVirtualAddress() ||
+        ia->getOffset() != ib->getOffset() ||
+        ia->getSize() != ib->getSize() ||
+        ia->getMemorySize() != ib->getMemorySize())
+      return false;
+    if (std::memcmp(ia->getMemoryArea(), ib->getMemoryArea(), ia->getSize()) != 0)
+      return false;
+  }
+
+  return true;
+}
+
+
+int main(int ac, const char **av) {
+  bool ok = true;
+
+  if (ac != 2) {
+    std::cerr << "Usage: " << av[0] << " <elf binary>" << std::endl;
+    return 1;
+  }
+
+  /* The same binary, read and parsed at once, then mapped and parsed on use */
+  elf::Elf eager(av[1]);
+  elf::Elf lazy(av[1], true);
+
+  ok &= check(eager.getSize() == lazy.getSize(), "both have the size of the file");
+  ok &= check(eager.getSize() > 0 && std::memcmp(eager.getRaw(), lazy.getRaw(), eager.getSize()) == 0, "both have the bytes of the file");
+  ok &= check(sameMemoryMapping(eager, lazy), "both have the same memory mapping");
+
+  /* The symbol is found before the lazy symbols table is parsed */
+  const elf::ElfSymbolTable* symbol = lazy.getSymbol("check");
+  ok &= check(symbol != nullptr, "the lazy binary finds the symbol check");
+  ok &= check(lazy.getSymbol("no such symbol") == nullptr, "an unknown symbol is not found");
+
+  if (symbol) {
+    bool found = false;
+    for (const auto& entry : eager.getSymbolsTable()) {
+      if (entry.getName() == "check")
+        found |= (entry.getValue() == symbol->getValue() && entry.getSize() == symbol->getSize());
+    }
+    ok &= check(found, "the lazy symbol is the one of the symbols table");
+    ok &= check(eager.getSymbol("check") != nullptr && eager.getSymbol("check")->getValue() == symbol->getValue(), "both find the same symbol");
+  }
+
+  ok &= check(eager.getSymbolsTable().size() == lazy.getSymbolsTable().size(), "both have the same symbols table");
+  ok &= check(eager.getRelocationTable().size() == lazy.getRelocationTable().size(), "both have the same relocations table");
+
+  /* An empty file cannot be mapped, it has no bytes */
+  std::ofstream(emptyPath, std::ios::binary | std::ios::trunc).close();
+
+  MappedFile empty;
+  empty.open(emptyPath, true);
+  ok &= check(empty.getData() == nullptr && empty.getSharedData() == nullptr, "an empty file has no bytes");
+  ok &= check(empty.getSize() == 0 && !empty.isMapped(), "an empty file is not mapped");
+
+  try {
+    elf::Elf binary(emptyPath, true);
+    ok &= check(false, "an empty file is not an ELF binary");
+  }
+  catch (const triton::exceptions::Elf&) {
+  }
+
+  try {
+    pe::Pe binary(emptyPath, true);
+    ok &= check(false, "an empty file is not a PE binary");
+  }
+  catch (const triton::exceptions::Pe&) {
+  }
+
+  std::remove(emptyPath);
+
+  /* A file which cannot be opened fails as its format */
+  try {
+    elf::Elf binary(missingPath, true);
+    ok &= check(false, "a missing file cannot be opened as an ELF binary");
+  }
+  catch (const triton::exceptions::Elf&) {
+  }
+
+  try {
+    pe::Pe binary(missingPath);
+    ok &= check(false, "a missing file cannot be opened as a PE binary");
+  }
+  catch (const triton::exceptions::Pe&) {
+  }
+
+  std::cout << "symbols: " << lazy.getSymbolsTable().size()
+            << " | relocations: " << lazy.getRelocationTable().size()
+            << " | memory areas: " << lazy.getMemoryMapping().size() << std::endl;
+
+  return ok ? 0 : 1;
+}
+
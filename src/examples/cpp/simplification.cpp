@@ -35,7 +35,7 @@ ast::AbstractNode* xor_simplification(ast::AbstractNode* node) {
 
   if (node->getKind() == ast::BVXOR_NODE) {
     if (*(node->getChilds()[0]) == *(node->getChilds()[1]))
-      return ast::bv(0, node->getBitvectorSize());
+      return node->getContext().bv(0, node->getBitvectorSize());
   }
 
   return node;
@@ -61,7 +61,7 @@ int main(int ac, const char **av) {
     inst.setAddress(trace[i].addr);
 
     /* optional - Update register state */
-    inst.updateContext(Register(x86::ID_REG_RAX, 12345));
+    inst.updateContext(Register(*api.getCpu(), x86::ID_REG_RAX, 12345));
 
     /* Process everything */
     api.processing(inst);
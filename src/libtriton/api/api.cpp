@@ -5,9 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <cstring>
 #include <list>
 #include <map>
 #include <new>
+#include <vector>
 
 #include <triton/api.hpp>
 #include <triton/exceptions.hpp>
@@ -183,16 +185,17 @@ Note that only the version `71313` of Pin is supported.
 namespace triton {
 
   /* External access to the API */
-  triton::API api = triton::API();
+  triton::API api;
 
-
-  API::API() {
+  API::API() : astCtxt(*this) {
     this->callbacks           = triton::callbacks::Callbacks();
     this->arch                = triton::arch::Architecture(&this->callbacks);
 
+    this->astArena            = nullptr;
     this->astGarbageCollector = nullptr;
     this->irBuilder           = nullptr;
     this->modes               = nullptr;
+    this->snapshot            = nullptr;
     this->solver              = nullptr;
     this->symbolic            = nullptr;
     this->taint               = nullptr;
@@ -206,6 +209,14 @@ namespace triton {
 
 
 
+  /* AST Context API =============================================================================== */
+
+  triton::ast::AstContext& API::getAstContext(void) {
+    return this->astCtxt;
+  }
+
+
+
   /* Architecture API ============================================================================== */
 
   bool API::isArchitectureValid(void) const {
@@ -298,18 +309,48 @@ namespace triton {
   }
 
 
-  std::set<triton::arch::Register*> API::getAllRegisters(void) const {
+  std::set<const triton::arch::Register*> API::getAllRegisters(void) const {
     this->checkArchitecture();
     return this->arch.getAllRegisters();
   }
 
 
-  std::set<triton::arch::Register*> API::getParentRegisters(void) const {
+  std::set<const triton::arch::Register*> API::getParentRegisters(void) const {
     this->checkArchitecture();
     return this->arch.getParentRegisters();
   }
 
 
+  const triton::arch::Register& API::getRegister(triton::uint32 regId) const {
+    this->checkArchitecture();
+    return this->arch.getRegister(regId);
+  }
+
+
+  const triton::arch::Register& API::getParentRegister(triton::uint32 regId) const {
+    this->checkArchitecture();
+    return this->arch.getParentRegister(regId);
+  }
+
+
+  const triton::arch::Register& API::getParentRegister(const triton::arch::Register& reg) const {
+    this->checkArchitecture();
+    return this->arch.getParentRegister(reg);
+  }
+
+
+  const triton::arch::Register& API::getProgramCounter(void) const {
+    this->checkArchitecture();
+    return this->arch.getProgramCounter();
+  }
+
+
+  const triton::arch::Register& API::getStackPointer(void) const {
+    this->checkArchitecture();
+    return this->arch.getStackPointer();
+  }
+
+
   triton::uint8 API::getConcreteMemoryValue(triton::uint64 addr) const {
     return this->arch.getConcreteMemoryValue(addr);
   }
@@ -325,6 +366,11 @@ namespace triton {
   }
 
 
+  void API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+    this->arch.getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+  }
+
+
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
@@ -365,12 +411,69 @@ namespace triton {
   }
 
 
+  void API::mapMemoryPages(triton::uint64 baseAddr, triton::usize size) {
+    this->arch.mapMemoryPages(baseAddr, size);
+  }
+
+
+  void API::unmapMemoryPages(triton::uint64 baseAddr, triton::usize size) {
+    this->arch.unmapMemoryPages(baseAddr, size);
+  }
+
+
+  std::shared_ptr<triton::uint8> API::getConcreteMemoryPage(triton::uint64 addr) {
+    return this->arch.getConcreteMemoryPage(addr);
+  }
+
+
+  void API::mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize) {
+    this->arch.mapMemoryView(baseAddr, data, size, memorySize);
+  }
+
+
+  void API::mapMemoryMapping(const triton::format::MemoryMapping& area) {
+    std::shared_ptr<const triton::uint8> data = area.getFile();
+
+    /* Without owner, the bytes of the file are copied */
+    if (data == nullptr && area.getSize()) {
+      triton::uint8* bytes = new(std::nothrow) triton::uint8[area.getSize()];
+      if (bytes == nullptr)
+        throw triton::exceptions::API("API::mapMemoryMapping(): Not enough memory.");
+      std::memcpy(bytes, area.getMemoryArea(), area.getSize());
+      this->arch.mapMemoryView(area.getVirtualAddress(), std::shared_ptr<const triton::uint8>(bytes, [](const triton::uint8* bytes) { delete[] bytes; }), area.getSize(), area.getMemorySize());
+      return;
+    }
+
+    /* The view points into the file and keeps it alive */
+    std::shared_ptr<const triton::uint8> view(data, area.getMemoryArea());
+    this->arch.mapMemoryView(area.getVirtualAddress(), view, area.getSize(), area.getMemorySize());
+  }
+
+
+  void API::mapMemoryMapping(const std::list<triton::format::MemoryMapping>& areas) {
+    for (const auto& area : areas)
+      this->mapMemoryMapping(area);
+  }
+
+
   void API::disassembly(triton::arch::Instruction& inst) const {
     this->checkArchitecture();
     this->arch.disassembly(inst);
   }
 
 
+  bool API::isSyscall(const triton::arch::Instruction& inst) const {
+    this->checkArchitecture();
+    return this->arch.isSyscall(inst);
+  }
+
+
+  std::map<std::string, triton::usize> API::getDecodeCacheStats(void) const {
+    this->checkArchitecture();
+    return this->arch.getDecodeCacheStats();
+  }
+
+
 
   /* Processing API ================================================================================ */
 
@@ -381,7 +484,7 @@ namespace triton {
     if (this->modes == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(&this->arch, this->modes, &this->callbacks);
+    this->symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(&this->arch, this->modes, &this->astCtxt, &this->callbacks);
     if (this->symbolic == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
@@ -389,26 +492,35 @@ namespace triton {
     if (this->solver == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->astGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(this->modes);
+    this->astArena = new(std::nothrow) triton::ast::AstArena();
+    if (this->astArena == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
+    this->astGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(this->modes, false, this->astArena);
     if (this->astGarbageCollector == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(this->symbolic);
+    this->taint = new(std::nothrow) triton::engines::taint::TaintEngine(&this->arch, this->modes, this->symbolic);
     if (this->taint == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astGarbageCollector, this->symbolic, this->taint);
+    this->irBuilder = new(std::nothrow) triton::arch::IrBuilder(&this->arch, this->modes, this->astGarbageCollector, &this->astCtxt, this->symbolic, this->taint);
     if (this->irBuilder == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
     this->z3Interface = new(std::nothrow) triton::ast::Z3Interface(this->symbolic);
     if (this->z3Interface == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
+    this->snapshot = new(std::nothrow) triton::engines::snapshot::SnapshotEngine(&this->arch, this->astGarbageCollector, this->symbolic, this->taint);
+    if (this->snapshot == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
   }
 
 
   void API::removeEngines(void) {
     if (this->isArchitectureValid()) {
+      delete this->snapshot;
       delete this->astGarbageCollector;
       delete this->irBuilder;
       delete this->modes;
@@ -416,10 +528,14 @@ namespace triton {
       delete this->symbolic;
       delete this->taint;
       delete this->z3Interface;
+      delete this->astArena;
 
+      this->astCtxt.setArena(nullptr);
+      this->astArena            = nullptr;
       this->astGarbageCollector = nullptr;
       this->irBuilder           = nullptr;
       this->modes               = nullptr;
+      this->snapshot            = nullptr;
       this->solver              = nullptr;
       this->symbolic            = nullptr;
       this->taint               = nullptr;
@@ -444,6 +560,76 @@ namespace triton {
   }
 
 
+  triton::arch::EmulationSummary API::emulate(triton::uint64 pc, const triton::arch::StopCondition& stop, triton::usize maxInstructions) {
+    triton::arch::EmulationSummary summary;
+
+    this->checkArchitecture();
+    this->setConcreteRegisterValue(triton::arch::Register(*this->getCpu(), this->getProgramCounter().getId(), pc));
+
+    while (true) {
+      /* The fetch is large enough for the longest instruction, only its mapped bytes are read */
+      triton::uint8 opcodes[16];
+      triton::usize size = sizeof(opcodes);
+      triton::arch::Instruction inst;
+
+      if (maxInstructions != 0 && summary.count >= maxInstructions) {
+        summary.reason = triton::arch::STOP_COUNT;
+        break;
+      }
+
+      if (!stop.addresses.empty() && stop.addresses.find(pc) != stop.addresses.end()) {
+        summary.reason = triton::arch::STOP_ADDRESS;
+        break;
+      }
+
+      while (size && !this->isMemoryMapped(pc, size))
+        size--;
+
+      if (size == 0) {
+        summary.reason = triton::arch::STOP_UNMAPPED;
+        break;
+      }
+
+      this->getConcreteMemoryAreaValue(pc, opcodes, size, false);
+      inst.setOpcodes(opcodes, static_cast<triton::uint32>(size));
+      inst.setAddress(pc);
+
+      /* An instruction which cannot be decoded from its mapped bytes runs into unmapped memory */
+      try {
+        this->disassembly(inst);
+      }
+      catch (const triton::exceptions::Disassembly&) {
+        if (size == sizeof(opcodes))
+          throw;
+        summary.reason = triton::arch::STOP_UNMAPPED;
+        break;
+      }
+
+      if (!this->buildSemantics(inst)) {
+        summary.reason = triton::arch::STOP_UNSUPPORTED;
+        break;
+      }
+
+      summary.count++;
+      pc = this->getConcreteRegisterValue(this->getProgramCounter(), false).convert_to<triton::uint64>();
+
+      if (stop.hook && stop.hook(inst)) {
+        summary.reason = triton::arch::STOP_HOOK;
+        break;
+      }
+
+      if (stop.syscall && this->isSyscall(inst)) {
+        summary.reason = triton::arch::STOP_SYSCALL;
+        break;
+      }
+    }
+
+    summary.pc = pc;
+
+    return summary;
+  }
+
+
 
   /* IR builder API ================================================================================= */
 
@@ -510,6 +696,12 @@ namespace triton {
   }
 
 
+  triton::ast::AstArena* API::getAstArena(void) const {
+    this->checkAstGarbageCollector();
+    return this->astArena;
+  }
+
+
   const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
     this->checkAstGarbageCollector();
     return this->astGarbageCollector->getAstVariableNodes();
@@ -537,18 +729,23 @@ namespace triton {
   /* AST representation API ========================================================================= */
 
   triton::uint32 API::getAstRepresentationMode(void) const {
-    return triton::ast::representations::astRepresentation.getMode();
+    return this->astCtxt.getRepresentationMode();
   }
 
 
   void API::setAstRepresentationMode(triton::uint32 mode) {
-    triton::ast::representations::astRepresentation.setMode(mode);
+    this->astCtxt.setRepresentationMode(mode);
   }
 
 
 
   /* Callbacks API ================================================================================= */
 
+  void API::addCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
   void API::addCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
     this->callbacks.addCallback(cb);
   }
@@ -576,6 +773,11 @@ namespace triton {
   }
 
 
+  void API::removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
   void API::removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
     this->callbacks.removeCallback(cb);
   }
@@ -629,6 +831,10 @@ namespace triton {
   void API::enableMode(enum triton::modes::mode_e mode, bool flag) {
     this->checkModes();
     this->modes->enableMode(mode, flag);
+
+    /* The allocator of the nodes is chosen once, not at each allocation */
+    if (mode == triton::modes::AST_ARENA)
+      this->astCtxt.setArena(flag ? this->astArena : nullptr);
   }
 
 
@@ -749,13 +955,13 @@ namespace triton {
   }
 
 
-  triton::engines::symbolic::SymbolicExpression* API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment) {
+  triton::engines::symbolic::SymbolicExpression* API::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment) {
     this->checkSymbolic();
     return this->symbolic->createSymbolicRegisterExpression(inst, node, reg, comment);
   }
 
 
-  triton::engines::symbolic::SymbolicExpression* API::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment) {
+  triton::engines::symbolic::SymbolicExpression* API::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment) {
     this->checkSymbolic();
     return this->symbolic->createSymbolicFlagExpression(inst, node, flag, comment);
   }
@@ -997,6 +1203,12 @@ namespace triton {
   }
 
 
+  triton::engines::solver::SolverEngine* API::getSolverEngine(void) {
+    this->checkSolver();
+    return this->solver;
+  }
+
+
   std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode* node) const {
     this->checkSolver();
     return this->solver->getModel(node);
@@ -1009,6 +1221,79 @@ namespace triton {
   }
 
 
+  std::vector<triton::engines::solver::SolverQueryResult> API::getModelsBatch(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 limit, const triton::engines::solver::solverQueryCallback& callback) const {
+    this->checkSolver();
+    return this->solver->getModelsBatch(nodes, limit, callback);
+  }
+
+
+  std::vector<triton::engines::solver::SolverQueryResult> API::getModelsOfUntakenBranches(triton::uint32 limit, const triton::engines::solver::solverQueryCallback& callback) const {
+    this->checkSolver();
+    this->checkSymbolic();
+    return this->solver->getModelsOfUntakenBranches(this->symbolic->getPathConstraints(), limit, callback);
+  }
+
+
+  triton::uint32 API::getSolverThreads(void) const {
+    this->checkSolver();
+    return this->solver->getNumberOfThreads();
+  }
+
+
+  void API::setSolverThreads(triton::uint32 threads) {
+    this->checkSolver();
+    this->solver->setNumberOfThreads(threads);
+  }
+
+
+  void API::enableSolverCache(bool flag) {
+    this->checkSolver();
+    this->solver->enableCache(flag);
+  }
+
+
+  bool API::isSolverCacheEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isCacheEnabled();
+  }
+
+
+  void API::enableSolverNormalization(bool flag) {
+    this->checkSolver();
+    this->solver->enableNormalization(flag);
+  }
+
+
+  bool API::isSolverNormalizationEnabled(void) const {
+    this->checkSolver();
+    return this->solver->isNormalizationEnabled();
+  }
+
+
+  void API::setSolverCachePath(const std::string& path) {
+    this->checkSolver();
+    this->solver->setCachePath(path);
+  }
+
+
+  void API::clearSolverCache(void) {
+    this->checkSolver();
+    this->solver->clearCache();
+  }
+
+
+  triton::usize API::getSolverCacheHits(void) const {
+    this->checkSolver();
+    return this->solver->getCacheHits();
+  }
+
+
+  triton::usize API::getSolverCacheMisses(void) const {
+    this->checkSolver();
+    return this->solver->getCacheMisses();
+  }
+
+
 
   /* Z3 interface API ============================================================================== */
 
@@ -1045,7 +1330,7 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  const triton::engines::taint::ShadowMemory& API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
@@ -1093,6 +1378,42 @@ namespace triton {
   }
 
 
+  std::set<triton::uint32> API::getMemoryLabels(triton::uint64 addr, triton::uint32 size) const {
+    this->checkTaint();
+    return this->taint->getMemoryLabels(addr, size);
+  }
+
+
+  std::set<triton::uint32> API::getMemoryLabels(const triton::arch::MemoryAccess& mem) const {
+    this->checkTaint();
+    return this->taint->getMemoryLabels(mem);
+  }
+
+
+  std::set<triton::uint32> API::getRegisterLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterLabels(reg);
+  }
+
+
+  bool API::labelMemory(triton::uint64 addr, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->labelMemory(addr, label);
+  }
+
+
+  bool API::labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->labelMemory(mem, label);
+  }
+
+
+  bool API::labelRegister(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->labelRegister(reg, label);
+  }
+
+
   bool API::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
     this->checkTaint();
     return this->taint->setTaint(op, flag);
@@ -1232,4 +1553,43 @@ namespace triton {
     return this->taint->taintAssignmentRegisterRegister(regDst, regSrc);
   }
 
+
+
+  /* Snapshot engine API =========================================================================== */
+
+  void API::checkSnapshot(void) const {
+    if (!this->snapshot)
+      throw triton::exceptions::API("API::checkSnapshot(): Snapshot engine is undefined.");
+  }
+
+
+  triton::engines::snapshot::SnapshotEngine* API::getSnapshotEngine(void) {
+    this->checkSnapshot();
+    return this->snapshot;
+  }
+
+
+  triton::usize API::takeSnapshot(void) {
+    this->checkSnapshot();
+    return this->snapshot->takeSnapshot();
+  }
+
+
+  void API::restoreSnapshot(triton::usize id) {
+    this->checkSnapshot();
+    this->snapshot->restoreSnapshot(id);
+  }
+
+
+  void API::removeSnapshot(triton::usize id) {
+    this->checkSnapshot();
+    this->snapshot->removeSnapshot(id);
+  }
+
+
+  triton::usize API::getNumberOfSnapshots(void) const {
+    this->checkSnapshot();
+    return this->snapshot->getNumberOfSnapshots();
+  }
+
 }; /* triton namespace */
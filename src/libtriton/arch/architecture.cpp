@@ -81,6 +81,56 @@ namespace triton {
     }
 
 
+    triton::arch::CpuInterface* Architecture::snapshotCpu(void) const {
+      triton::arch::CpuInterface* copy = nullptr;
+
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::snapshotCpu(): You must define an architecture.");
+
+      switch (this->arch) {
+        case triton::arch::ARCH_X86_64: {
+          triton::arch::x86::x8664Cpu* cpu = new(std::nothrow) triton::arch::x86::x8664Cpu(this->callbacks);
+          if (cpu != nullptr)
+            cpu->copyState(*static_cast<triton::arch::x86::x8664Cpu*>(this->cpu));
+          copy = cpu;
+          break;
+        }
+
+        case triton::arch::ARCH_X86: {
+          triton::arch::x86::x86Cpu* cpu = new(std::nothrow) triton::arch::x86::x86Cpu(this->callbacks);
+          if (cpu != nullptr)
+            cpu->copyState(*static_cast<triton::arch::x86::x86Cpu*>(this->cpu));
+          copy = cpu;
+          break;
+        }
+      }
+
+      if (copy == nullptr)
+        throw triton::exceptions::Architecture("Architecture::snapshotCpu(): Not enough memory.");
+
+      return copy;
+    }
+
+
+    void Architecture::restoreCpu(const triton::arch::CpuInterface* cpu) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::restoreCpu(): You must define an architecture.");
+
+      if (cpu == nullptr)
+        throw triton::exceptions::Architecture("Architecture::restoreCpu(): Invalid CPU.");
+
+      switch (this->arch) {
+        case triton::arch::ARCH_X86_64:
+          static_cast<triton::arch::x86::x8664Cpu*>(this->cpu)->copyState(*static_cast<const triton::arch::x86::x8664Cpu*>(cpu));
+          break;
+
+        case triton::arch::ARCH_X86:
+          static_cast<triton::arch::x86::x86Cpu*>(this->cpu)->copyState(*static_cast<const triton::arch::x86::x86Cpu*>(cpu));
+          break;
+      }
+    }
+
+
     bool Architecture::isValid(void) const {
       if (this->arch == triton::arch::ARCH_INVALID)
         return false;
@@ -155,20 +205,55 @@ namespace triton {
     }
 
 
-    std::set<triton::arch::Register*> Architecture::getAllRegisters(void) const {
+    std::set<const triton::arch::Register*> Architecture::getAllRegisters(void) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getAllRegisters(): You must define an architecture.");
       return this->cpu->getAllRegisters();
     }
 
 
-    std::set<triton::arch::Register*> Architecture::getParentRegisters(void) const {
+    std::set<const triton::arch::Register*> Architecture::getParentRegisters(void) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getParentRegisters(): You must define an architecture.");
       return this->cpu->getParentRegisters();
     }
 
 
+    const triton::arch::Register& Architecture::getRegister(triton::uint32 regId) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getRegister(): You must define an architecture.");
+      return this->cpu->getRegister(regId);
+    }
+
+
+    const triton::arch::Register& Architecture::getParentRegister(triton::uint32 regId) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getParentRegister(): You must define an architecture.");
+      return this->cpu->getParentRegister(regId);
+    }
+
+
+    const triton::arch::Register& Architecture::getParentRegister(const triton::arch::Register& reg) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getParentRegister(): You must define an architecture.");
+      return this->cpu->getParentRegister(reg.getId());
+    }
+
+
+    const triton::arch::Register& Architecture::getProgramCounter(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getProgramCounter(): You must define an architecture.");
+      return this->cpu->getProgramCounter();
+    }
+
+
+    const triton::arch::Register& Architecture::getStackPointer(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getStackPointer(): You must define an architecture.");
+      return this->cpu->getStackPointer();
+    }
+
+
     void Architecture::disassembly(triton::arch::Instruction& inst) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::disassembly(): You must define an architecture.");
@@ -176,6 +261,20 @@ namespace triton {
     }
 
 
+    bool Architecture::isSyscall(const triton::arch::Instruction& inst) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::isSyscall(): You must define an architecture.");
+      return this->cpu->isSyscall(inst);
+    }
+
+
+    std::map<std::string, triton::usize> Architecture::getDecodeCacheStats(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getDecodeCacheStats(): You must define an architecture.");
+      return this->cpu->getDecodeCacheStats();
+    }
+
+
     triton::uint8 Architecture::getConcreteMemoryValue(triton::uint64 addr) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteMemoryValue(): You must define an architecture.");
@@ -197,6 +296,13 @@ namespace triton {
     }
 
 
+    void Architecture::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryAreaValue(): You must define an architecture.");
+      this->cpu->getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+    }
+
+
     triton::uint512 Architecture::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue(): You must define an architecture.");
@@ -252,6 +358,34 @@ namespace triton {
       this->cpu->unmapMemory(baseAddr, size);
     }
 
+
+    void Architecture::mapMemoryPages(triton::uint64 baseAddr, triton::usize size) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapMemoryPages(): You must define an architecture.");
+      this->cpu->mapMemoryPages(baseAddr, size);
+    }
+
+
+    void Architecture::unmapMemoryPages(triton::uint64 baseAddr, triton::usize size) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::unmapMemoryPages(): You must define an architecture.");
+      this->cpu->unmapMemoryPages(baseAddr, size);
+    }
+
+
+    std::shared_ptr<triton::uint8> Architecture::getConcreteMemoryPage(triton::uint64 addr) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryPage(): You must define an architecture.");
+      return this->cpu->getConcreteMemoryPage(addr);
+    }
+
+
+    void Architecture::mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize) {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::mapMemoryView(): You must define an architecture.");
+      this->cpu->mapMemoryView(baseAddr, data, size, memorySize);
+    }
+
   }; /* arch namespace */
 }; /* triton namespace */
 
@@ -0,0 +1,633 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <new>
+
+#include <triton/concreteMemory.hpp>
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    ConcreteMemory::ConcreteMemory(triton::callbacks::Callbacks* callbacks) {
+      this->callbacks       = callbacks;
+      this->loading         = false;
+      this->declinedVersion = 0;
+      this->lastNumber      = 0;
+      this->lastPage        = nullptr;
+      this->lastViewNumber  = 0;
+      this->lastView        = nullptr;
+    }
+
+
+    ConcreteMemory::ConcreteMemory(const ConcreteMemory& other) {
+      this->callbacks = other.callbacks;
+      this->loading   = false;
+      this->copy(other);
+    }
+
+
+    ConcreteMemory& ConcreteMemory::operator=(const ConcreteMemory& other) {
+      this->copy(other);
+      return *this;
+    }
+
+
+    void ConcreteMemory::copy(const ConcreteMemory& other) {
+      this->pages           = other.pages;
+      this->views           = other.views;
+      this->declined        = other.declined;
+      this->declinedVersion = other.declinedVersion;
+      this->lastNumber      = 0;
+      this->lastPage        = nullptr;
+      this->lastViewNumber  = 0;
+      this->lastView        = nullptr;
+
+      /* The exported pages are not shared */
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+        if (it->second->exported) {
+          Page* clone = new(std::nothrow) Page(*it->second);
+          if (clone == nullptr)
+            throw triton::exceptions::Cpu("ConcreteMemory::copy(): Not enough memory.");
+          clone->exported = 0;
+          it->second = std::shared_ptr<Page>(clone);
+        }
+      }
+    }
+
+
+    void ConcreteMemory::setCallbacks(triton::callbacks::Callbacks* callbacks) {
+      this->callbacks = callbacks;
+      this->declined.clear();
+    }
+
+
+    bool ConcreteMemory::isShared(const std::shared_ptr<Page>& page) {
+      /* Each export holds one reference */
+      return (page.use_count() > static_cast<long>(page->exported) + 1);
+    }
+
+
+    const ConcreteMemory::Page* ConcreteMemory::findPage(triton::uint64 addr) const {
+      triton::uint64 number = (addr >> pageBits);
+
+      if (this->lastPage == nullptr || this->lastNumber != number) {
+        /* The page of the last view read is not allocated */
+        if (this->lastView != nullptr && this->lastViewNumber == number)
+          return nullptr;
+
+        auto it = this->pages.find(number);
+        if (it != this->pages.end()) {
+          this->lastNumber = number;
+          this->lastPage   = it->second.get();
+        }
+        else {
+          /* A view is read in place, only the callbacks load a page on read */
+          if (this->findView(addr) != nullptr)
+            return nullptr;
+          Page* page = this->loadPage(number);
+          if (page == nullptr)
+            return nullptr;
+          this->lastNumber = number;
+          this->lastPage   = page;
+        }
+      }
+
+      return this->lastPage;
+    }
+
+
+    const std::vector<ConcreteMemory::Chunk>* ConcreteMemory::findView(triton::uint64 addr) const {
+      triton::uint64 number = (addr >> pageBits);
+
+      if (this->views == nullptr)
+        return nullptr;
+
+      if (this->lastView == nullptr || this->lastViewNumber != number) {
+        auto it = this->views->chunks.find(number);
+        if (it == this->views->chunks.end() || this->pages.find(number) != this->pages.end())
+          return nullptr;
+        this->lastViewNumber = number;
+        this->lastView       = &it->second;
+      }
+
+      return this->lastView;
+    }
+
+
+    void ConcreteMemory::readView(const std::vector<Chunk>& view, triton::uint32 offset, triton::uint8* area, triton::uint32 length) {
+      std::memset(area, 0x00, length);
+
+      /* The later mappings hide the former ones */
+      for (const auto& chunk : view) {
+        triton::uint32 low  = (chunk.offset > offset) ? chunk.offset : offset;
+        triton::uint32 high = (chunk.offset + chunk.length < offset + length) ? chunk.offset + chunk.length : offset + length;
+        if (low >= high)
+          continue;
+        if (chunk.data)
+          std::memcpy(area + (low - offset), chunk.data + (low - chunk.offset), high - low);
+        else
+          std::memset(area + (low - offset), 0x00, high - low);
+      }
+    }
+
+
+    bool ConcreteMemory::isViewMapped(const std::vector<Chunk>& view, triton::uint32 offset, triton::uint32 length) {
+      triton::uint32 end = offset + length;
+
+      /* Each byte not mapped yet must be in a chunk */
+      while (offset < end) {
+        triton::uint32 next = offset;
+        for (const auto& chunk : view) {
+          if (chunk.offset <= offset && offset < chunk.offset + chunk.length && chunk.offset + chunk.length > next)
+            next = chunk.offset + chunk.length;
+        }
+        if (next == offset)
+          return false;
+        offset = next;
+      }
+
+      return true;
+    }
+
+
+    std::shared_ptr<ConcreteMemory::Page> ConcreteMemory::newPage(void) {
+      std::shared_ptr<Page> page(new(std::nothrow) Page());
+      if (page == nullptr)
+        throw triton::exceptions::Cpu("ConcreteMemory::newPage(): Not enough memory.");
+
+      std::memset(page->data, 0x00, sizeof(page->data));
+      std::memset(page->mapped, 0x00, sizeof(page->mapped));
+      page->count    = 0;
+      page->exported = 0;
+
+      return page;
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::faultPage(triton::uint64 number) const {
+      Page* page = this->loadView(number);
+
+      if (page == nullptr)
+        page = this->loadPage(number);
+
+      return page;
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::loadView(triton::uint64 number) const {
+      if (this->views == nullptr)
+        return nullptr;
+
+      auto it = this->views->chunks.find(number);
+      if (it == this->views->chunks.end())
+        return nullptr;
+
+      std::shared_ptr<Page> page = ConcreteMemory::newPage();
+      for (const auto& chunk : it->second) {
+        if (chunk.data)
+          std::memcpy(page->data + chunk.offset, chunk.data, chunk.length);
+        else
+          std::memset(page->data + chunk.offset, 0x00, chunk.length);
+        ConcreteMemory::mapBytes(page.get(), chunk.offset, chunk.length);
+      }
+
+      /* The view is kept, the page allocated hides it until it is unmapped */
+      this->pages[number] = page;
+      this->lastPage      = nullptr;
+      this->lastView      = nullptr;
+
+      return page.get();
+    }
+
+
+    void ConcreteMemory::dropViews(triton::uint64 first, triton::uint64 last) {
+      if (this->views == nullptr)
+        return;
+
+      /* Walk the smallest of the range and the views */
+      std::vector<triton::uint64> numbers;
+      if (last - first < this->views->chunks.size()) {
+        for (triton::uint64 number = first; number <= last; number++) {
+          if (this->views->chunks.find(number) != this->views->chunks.end())
+            numbers.push_back(number);
+          if (number == last)
+            break;
+        }
+      }
+      else {
+        for (const auto& item : this->views->chunks) {
+          if (item.first >= first && item.first <= last)
+            numbers.push_back(item.first);
+        }
+      }
+
+      if (numbers.empty())
+        return;
+
+      this->lastView = nullptr;
+
+      /* The views are shared with the copies of the memory, copy them */
+      if (this->views.use_count() > 1)
+        this->views = std::make_shared<Views>(*this->views);
+
+      for (triton::uint64 number : numbers)
+        this->views->chunks.erase(number);
+
+      if (this->views->chunks.empty())
+        this->views.reset();
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::loadPage(triton::uint64 number) const {
+      if (this->loading || this->callbacks == nullptr || !this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE))
+        return nullptr;
+
+      /* The new callbacks may provide the pages declined by the previous ones */
+      if (this->declinedVersion != this->callbacks->getVersion()) {
+        this->declined.clear();
+        this->declinedVersion = this->callbacks->getVersion();
+      }
+
+      if (this->declined.find(number) != this->declined.end())
+        return nullptr;
+
+      std::shared_ptr<Page> page = ConcreteMemory::newPage();
+      std::memset(page->mapped, 0xff, sizeof(page->mapped));
+      page->count = pageSize;
+
+      /* The callbacks may access the memory, which must not ask them again */
+      this->loading = true;
+      try {
+        bool provided = this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_PAGE, (number << pageBits), page->data, pageSize);
+        this->loading = false;
+        if (!provided) {
+          this->declined.insert(number);
+          return nullptr;
+        }
+      }
+      catch (...) {
+        this->loading = false;
+        throw;
+      }
+
+      /* The page provided replaces the one the callbacks may have written */
+      this->pages[number] = page;
+      this->lastPage      = nullptr;
+
+      return page.get();
+    }
+
+
+    void ConcreteMemory::forgetDeclined(triton::uint64 first, triton::uint64 last) {
+      /* Walk the smallest of the range and the declined pages */
+      if (last - first < this->declined.size()) {
+        for (triton::uint64 number = first; number <= last; number++) {
+          this->declined.erase(number);
+          if (number == last)
+            break;
+        }
+      }
+      else {
+        for (auto it = this->declined.begin(); it != this->declined.end();) {
+          if (*it >= first && *it <= last)
+            it = this->declined.erase(it);
+          else
+            it++;
+        }
+      }
+    }
+
+
+    ConcreteMemory::Page* ConcreteMemory::writablePage(triton::uint64 addr) {
+      triton::uint64 number = (addr >> pageBits);
+
+      /* A page not allocated may be a view or provided by the callbacks, else it is a new page */
+      if (this->pages.find(number) == this->pages.end()) {
+        if (this->faultPage(number) == nullptr) {
+          this->pages[number] = ConcreteMemory::newPage();
+          this->declined.erase(number);
+        }
+      }
+
+      std::shared_ptr<Page>& page = this->pages[number];
+
+      /* The page is shared with another memory, copy it */
+      if (ConcreteMemory::isShared(page)) {
+        Page* clone = new(std::nothrow) Page(*page);
+        if (clone == nullptr)
+          throw triton::exceptions::Cpu("ConcreteMemory::writablePage(): Not enough memory.");
+        clone->exported = 0;
+        page = std::shared_ptr<Page>(clone);
+      }
+
+      this->lastNumber = number;
+      this->lastPage   = page.get();
+
+      return page.get();
+    }
+
+
+    void ConcreteMemory::mapBytes(Page* page, triton::uint32 offset, triton::uint32 size) {
+      for (triton::uint32 bit = offset; bit < offset + size;) {
+        triton::uint32 high = ((bit / 64) + 1) * 64;
+        if (high > offset + size)
+          high = offset + size;
+
+        triton::uint64& word = page->mapped[bit / 64];
+        triton::uint64 mask  = triton::utils::rangeMask(bit % 64, high - (bit / 64) * 64);
+
+        page->count += triton::utils::popCount(mask & ~word);
+        word |= mask;
+        bit = high;
+      }
+    }
+
+
+    triton::uint8 ConcreteMemory::read(triton::uint64 addr) const {
+      const Page* page = this->findPage(addr);
+
+      if (page != nullptr)
+        return page->data[addr & (pageSize - 1)];
+
+      const std::vector<Chunk>* view = this->findView(addr);
+      if (view == nullptr)
+        return 0x00;
+
+      triton::uint8 value = 0x00;
+      ConcreteMemory::readView(*view, (addr & (pageSize - 1)), &value, 1);
+      return value;
+    }
+
+
+    void ConcreteMemory::read(triton::uint64 addr, triton::uint8* area, triton::usize size) const {
+      while (size) {
+        triton::uint32 offset = (addr & (pageSize - 1));
+        triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+        const Page* page      = this->findPage(addr);
+        const std::vector<Chunk>* view = nullptr;
+
+        if (page != nullptr)
+          std::memcpy(area, page->data + offset, length);
+        else if ((view = this->findView(addr)) != nullptr)
+          ConcreteMemory::readView(*view, offset, area, length);
+        else
+          std::memset(area, 0x00, length);
+
+        addr += length;
+        area += length;
+        size -= length;
+      }
+    }
+
+
+    void ConcreteMemory::write(triton::uint64 addr, triton::uint8 value) {
+      Page* page            = this->writablePage(addr);
+      triton::uint32 offset = (addr & (pageSize - 1));
+      triton::uint64 mask   = (static_cast<triton::uint64>(1) << (offset % 64));
+
+      page->data[offset] = value;
+      if ((page->mapped[offset / 64] & mask) == 0) {
+        page->mapped[offset / 64] |= mask;
+        page->count++;
+      }
+    }
+
+
+    void ConcreteMemory::write(triton::uint64 addr, const triton::uint8* area, triton::usize size) {
+      while (size) {
+        triton::uint32 offset = (addr & (pageSize - 1));
+        triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+        Page* page            = this->writablePage(addr);
+
+        std::memcpy(page->data + offset, area, length);
+        ConcreteMemory::mapBytes(page, offset, length);
+
+        addr += length;
+        area += length;
+        size -= length;
+      }
+    }
+
+
+    bool ConcreteMemory::isMapped(triton::uint64 addr, triton::usize size) const {
+      while (size) {
+        triton::uint32 offset = (addr & (pageSize - 1));
+        triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+        const Page* page      = this->findPage(addr);
+
+        if (page == nullptr) {
+          const std::vector<Chunk>* view = this->findView(addr);
+          if (view == nullptr || !ConcreteMemory::isViewMapped(*view, offset, length))
+            return false;
+          addr += length;
+          size -= length;
+          continue;
+        }
+
+        for (triton::uint32 bit = offset; bit < offset + length;) {
+          triton::uint32 high = ((bit / 64) + 1) * 64;
+          if (high > offset + length)
+            high = offset + length;
+          triton::uint64 mask = triton::utils::rangeMask(bit % 64, high - (bit / 64) * 64);
+          if ((page->mapped[bit / 64] & mask) != mask)
+            return false;
+          bit = high;
+        }
+
+        addr += length;
+        size -= length;
+      }
+
+      return true;
+    }
+
+
+    void ConcreteMemory::unmap(triton::uint64 addr, triton::usize size) {
+      while (size) {
+        triton::uint32 offset = (addr & (pageSize - 1));
+        triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+        triton::uint64 number = (addr >> pageBits);
+
+        /* A view or a page provided is loaded, so that its bytes not unmapped stay */
+        if (this->findPage(addr) != nullptr || this->findView(addr) != nullptr) {
+          Page* page = this->writablePage(addr);
+
+          for (triton::uint32 bit = offset; bit < offset + length;) {
+            triton::uint32 high = ((bit / 64) + 1) * 64;
+            if (high > offset + length)
+              high = offset + length;
+            triton::uint64& word = page->mapped[bit / 64];
+            triton::uint64 mask  = triton::utils::rangeMask(bit % 64, high - (bit / 64) * 64);
+            page->count -= triton::utils::popCount(mask & word);
+            word &= ~mask;
+            bit = high;
+          }
+
+          /* Unmapped bytes read as zero */
+          std::memset(page->data + offset, 0x00, length);
+
+          if (page->count == 0) {
+            this->pages.erase(number);
+            this->dropViews(number, number);
+            this->lastPage = nullptr;
+          }
+        }
+
+        /* An unmapped page is asked again to the callbacks */
+        this->declined.erase(number);
+
+        addr += length;
+        size -= length;
+      }
+    }
+
+
+    void ConcreteMemory::mapPages(triton::uint64 addr, triton::usize size) {
+      if (size == 0)
+        return;
+
+      triton::uint64 first = (addr >> pageBits);
+      triton::uint64 last  = ((addr + size - 1) >> pageBits);
+
+      for (triton::uint64 number = first; number <= last; number++) {
+        Page* page = this->writablePage(number << pageBits);
+        if (page->count != pageSize) {
+          std::memset(page->mapped, 0xff, sizeof(page->mapped));
+          page->count = pageSize;
+        }
+        if (number == last)
+          break;
+      }
+    }
+
+
+    void ConcreteMemory::unmapPages(triton::uint64 addr, triton::usize size) {
+      if (size == 0)
+        return;
+
+      triton::uint64 first = (addr >> pageBits);
+      triton::uint64 last  = ((addr + size - 1) >> pageBits);
+
+      /* Walk the smallest of the range and the allocated pages */
+      if (last - first < this->pages.size()) {
+        for (triton::uint64 number = first; number <= last; number++) {
+          this->pages.erase(number);
+          if (number == last)
+            break;
+        }
+      }
+      else {
+        for (auto it = this->pages.begin(); it != this->pages.end();) {
+          if (it->first >= first && it->first <= last)
+            it = this->pages.erase(it);
+          else
+            it++;
+        }
+      }
+
+      this->dropViews(first, last);
+      this->forgetDeclined(first, last);
+      this->lastPage = nullptr;
+    }
+
+
+    void ConcreteMemory::mapView(triton::uint64 addr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize) {
+      bool used = false;
+
+      if (memorySize < size)
+        memorySize = size;
+
+      if (size && data == nullptr)
+        throw triton::exceptions::Cpu("ConcreteMemory::mapView(): The data cannot be null.");
+
+      for (triton::usize done = 0; done < memorySize;) {
+        triton::uint32 offset = (addr & (pageSize - 1));
+        triton::usize  remain = ((done < size) ? size : memorySize) - done;
+        triton::uint32 length = (remain < pageSize - offset) ? static_cast<triton::uint32>(remain) : pageSize - offset;
+        triton::uint64 number = (addr >> pageBits);
+        const triton::uint8* bytes = (done < size) ? data.get() + done : nullptr;
+
+        /* An allocated page is written now */
+        if (this->pages.find(number) != this->pages.end()) {
+          Page* page = this->writablePage(addr);
+          if (bytes)
+            std::memcpy(page->data + offset, bytes, length);
+          else
+            std::memset(page->data + offset, 0x00, length);
+          ConcreteMemory::mapBytes(page, offset, length);
+        }
+
+        /* The others are loaded on their first access */
+        else {
+          if (this->views == nullptr)
+            this->views = std::make_shared<Views>();
+          else if (this->views.use_count() > 1)
+            this->views = std::make_shared<Views>(*this->views);
+
+          this->lastView = nullptr;
+
+          Chunk chunk;
+          chunk.data   = bytes;
+          chunk.offset = offset;
+          chunk.length = length;
+          this->views->chunks[number].push_back(chunk);
+          used = (used || bytes != nullptr);
+        }
+
+        addr += length;
+        done += length;
+      }
+
+      if (used)
+        this->views->files.push_back(data);
+    }
+
+
+    std::shared_ptr<triton::uint8> ConcreteMemory::getPage(triton::uint64 addr) {
+      this->mapPages(addr, 1);
+
+      std::shared_ptr<Page> page = this->pages[addr >> pageBits];
+      page->exported++;
+
+      /* The deleter holds the page until the last copy of the pointer is released */
+      return std::shared_ptr<triton::uint8>(page->data, [page](triton::uint8*) { page->exported--; });
+    }
+
+
+    triton::usize ConcreteMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    triton::usize ConcreteMemory::getNumberOfSharedPages(void) const {
+      triton::usize count = 0;
+
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+        if (ConcreteMemory::isShared(it->second))
+          count++;
+      }
+
+      return count;
+    }
+
+
+    void ConcreteMemory::clear(void) {
+      this->pages.clear();
+      this->views.reset();
+      this->declined.clear();
+      this->lastNumber = 0;
+      this->lastPage   = nullptr;
+      this->lastView   = nullptr;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
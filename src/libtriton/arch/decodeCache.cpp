@@ -0,0 +1,125 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <triton/decodeCache.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* The longest instruction supported, used to find the entries overlapping a write */
+    static const triton::uint64 maxInstructionSize = 16;
+
+
+    DecodeCache::DecodeCache() {
+      this->hits          = 0;
+      this->invalidations = 0;
+      this->misses        = 0;
+      this->clear();
+    }
+
+
+    bool DecodeCache::load(triton::arch::Instruction& inst) {
+      auto it = this->entries.find(inst.getAddress());
+
+      if (it == this->entries.end() ||
+          it->second.opcodes.size() > inst.getSize() ||
+          std::memcmp(it->second.opcodes.data(), inst.getOpcodes(), it->second.opcodes.size()) != 0) {
+        this->misses++;
+        return false;
+      }
+
+      const Entry& entry = it->second;
+
+      inst.setDisassembly(entry.disassembly);
+      inst.setSize(static_cast<triton::uint32>(entry.opcodes.size()));
+      inst.setType(entry.type);
+      inst.setPrefix(entry.prefix);
+
+      /* The registers take their values from the state of the instruction */
+      for (auto op = entry.operands.begin(); op != entry.operands.end(); op++) {
+        if (op->getType() == triton::arch::OP_REG)
+          inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(op->getConstRegister())));
+        else
+          inst.operands.push_back(*op);
+      }
+
+      if (entry.branch)
+        inst.setBranch(true);
+
+      if (entry.controlFlow)
+        inst.setControlFlow(true);
+
+      this->hits++;
+      return true;
+    }
+
+
+    void DecodeCache::store(triton::arch::Instruction& inst) {
+      triton::uint64 addr = inst.getAddress();
+      triton::uint32 size = inst.getSize();
+
+      if (this->entries.size() >= DecodeCache::maxEntries)
+        this->clear();
+
+      Entry& entry      = this->entries[addr];
+      entry.opcodes     = std::vector<triton::uint8>(inst.getOpcodes(), inst.getOpcodes() + size);
+      entry.disassembly = inst.getDisassembly();
+      entry.type        = inst.getType();
+      entry.prefix      = inst.getPrefix();
+      entry.branch      = inst.isBranch();
+      entry.controlFlow = inst.isControlFlow();
+      entry.operands    = inst.operands;
+
+      if (addr < this->lowest)
+        this->lowest = addr;
+
+      if (addr + size > this->highest)
+        this->highest = addr + size;
+    }
+
+
+    void DecodeCache::invalidate(triton::uint64 addr, triton::usize size) {
+      /* Most writes (e.g. the stack) are far from the code */
+      if (this->entries.empty() || addr >= this->highest || addr + size <= this->lowest)
+        return;
+
+      auto it = this->entries.lower_bound(addr > maxInstructionSize ? addr - maxInstructionSize : 0);
+      while (it != this->entries.end() && it->first < addr + size) {
+        if (it->first + it->second.opcodes.size() > addr) {
+          it = this->entries.erase(it);
+          this->invalidations++;
+        }
+        else
+          it++;
+      }
+    }
+
+
+    void DecodeCache::clear(void) {
+      this->entries.clear();
+      this->lowest  = static_cast<triton::uint64>(-1);
+      this->highest = 0;
+    }
+
+
+    std::map<std::string, triton::usize> DecodeCache::getStats(void) const {
+      std::map<std::string, triton::usize> stats;
+
+      stats["entries"]        = this->entries.size();
+      stats["hits"]           = this->hits;
+      stats["invalidations"]  = this->invalidations;
+      stats["misses"]         = this->misses;
+
+      return stats;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
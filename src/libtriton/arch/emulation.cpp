@@ -0,0 +1,27 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/emulation.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    StopCondition::StopCondition() {
+      this->syscall = false;
+    }
+
+
+    EmulationSummary::EmulationSummary() {
+      this->pc     = 0;
+      this->count  = 0;
+      this->reason = triton::arch::STOP_COUNT;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
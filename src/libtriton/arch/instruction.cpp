@@ -59,12 +59,14 @@ namespace triton {
       this->memoryAccess        = other.memoryAccess;
       this->operands            = other.operands;
       this->prefix              = other.prefix;
+      this->readImmediates      = other.readImmediates;
       this->readRegisters       = other.readRegisters;
       this->registerState       = other.registerState;
       this->size                = other.size;
       this->storeAccess         = other.storeAccess;
       this->symbolicExpressions = other.symbolicExpressions;
       this->tainted             = other.tainted;
+      this->taintLabels         = other.taintLabels;
       this->tid                 = other.tid;
       this->type                = other.type;
       this->writtenRegisters    = other.writtenRegisters;
@@ -149,6 +151,11 @@ namespace triton {
     }
 
 
+    const std::set<triton::uint32>& Instruction::getTaintLabels(void) const {
+      return this->taintLabels;
+    }
+
+
     const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getWrittenRegisters(void) const {
       return this->writtenRegisters;
     }
@@ -165,10 +172,9 @@ namespace triton {
 
 
     /* If there is a concrete value recorded, build the appropriate Register. Otherwise, perfrom the analysis on zero. */
-    triton::arch::Register Instruction::getRegisterState(triton::uint32 regId) {
-      triton::arch::Register reg(regId);
-      if (this->registerState.find(regId) != this->registerState.end())
-        reg = this->registerState[regId];
+    triton::arch::Register Instruction::getRegisterState(const triton::arch::Register& reg) {
+      if (this->registerState.find(reg.getId()) != this->registerState.end())
+        return this->registerState[reg.getId()];
       return reg;
     }
 
@@ -284,6 +290,11 @@ namespace triton {
     }
 
 
+    void Instruction::setTaintLabels(const std::set<triton::uint32>& labels) {
+      this->taintLabels = labels;
+    }
+
+
     void Instruction::setTaint(void) {
       std::vector<triton::engines::symbolic::SymbolicExpression*>::const_iterator it;
       for (it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
@@ -468,6 +479,7 @@ namespace triton {
       this->readImmediates.clear();
       this->readRegisters.clear();
       this->storeAccess.clear();
+      this->taintLabels.clear();
       this->symbolicExpressions.clear();
       this->writtenRegisters.clear();
 
@@ -22,6 +22,7 @@ namespace triton {
     IrBuilder::IrBuilder(triton::arch::Architecture* architecture,
                          triton::modes::Modes* modes,
                          triton::ast::AstGarbageCollector* astGarbageCollector,
+                         triton::ast::AstContext* astCtxt,
                          triton::engines::symbolic::SymbolicEngine* symbolicEngine,
                          triton::engines::taint::TaintEngine* taintEngine) {
 
@@ -34,29 +35,28 @@ namespace triton {
       if (astGarbageCollector == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The AST garbage collector API must be defined.");
 
+      if (astCtxt == nullptr)
+        throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The AST context API must be defined.");
+
       if (symbolicEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The symbolic engine API must be defined.");
 
       if (taintEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The taint engines API must be defined.");
 
-      this->architecture              = architecture;
-      this->astGarbageCollector       = astGarbageCollector;
-      this->backupAstGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(modes, true);
-      this->backupSymbolicEngine      = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(architecture, modes, nullptr, true);
-      this->modes                     = modes;
-      this->symbolicEngine            = symbolicEngine;
-      this->taintEngine               = taintEngine;
-      this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine);
+      this->architecture        = architecture;
+      this->astGarbageCollector = astGarbageCollector;
+      this->modes               = modes;
+      this->symbolicEngine      = symbolicEngine;
+      this->taintEngine         = taintEngine;
+      this->x86Isa              = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine, astCtxt);
 
-      if (this->x86Isa == nullptr || this->backupSymbolicEngine == nullptr || this->backupAstGarbageCollector == nullptr)
+      if (this->x86Isa == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
 
     IrBuilder::~IrBuilder() {
-      delete this->backupSymbolicEngine;
-      delete this->backupAstGarbageCollector;
       delete this->x86Isa;
     }
 
@@ -79,6 +79,13 @@ namespace triton {
         this->architecture->setConcreteRegisterValue(it2->second);
       }
 
+      /* If only the taint is available, the instruction may not need any node */
+      if (!this->symbolicEngine->isEnabled() && this->buildTaintSemantics(inst))
+        return true;
+
+      /* Pre IR processing, before any node of the instruction is built */
+      this->preIrInit(inst);
+
       /* Stage 3 - Initialize the target address of memory operands */
       std::vector<triton::arch::OperandWrapper>::iterator it3;
       for (it3 = inst.operands.begin(); it3 != inst.operands.end(); it3++) {
@@ -87,9 +94,6 @@ namespace triton {
         }
       }
 
-      /* Pre IR processing */
-      this->preIrInit(inst);
-
       /* Processing */
       switch (this->architecture->getArchitecture()) {
         case triton::arch::ARCH_X86:
@@ -104,21 +108,118 @@ namespace triton {
     }
 
 
+    void IrBuilder::clearNodes(triton::arch::Instruction& inst) {
+      auto loadAccess     = inst.getLoadAccess();
+      auto storeAccess    = inst.getStoreAccess();
+      auto readRegisters  = inst.getReadRegisters();
+      auto writtenRegs    = inst.getWrittenRegisters();
+      auto readImmediates = inst.getReadImmediates();
+
+      for (auto it = loadAccess.begin(); it != loadAccess.end(); it++)
+        inst.removeLoadAccess(it->first);
+      for (auto it = loadAccess.begin(); it != loadAccess.end(); it++) {
+        triton::arch::MemoryAccess mem = it->first;
+        mem.setLeaAst(nullptr);
+        inst.setLoadAccess(mem, nullptr);
+      }
+
+      for (auto it = storeAccess.begin(); it != storeAccess.end(); it++)
+        inst.removeStoreAccess(it->first);
+      for (auto it = storeAccess.begin(); it != storeAccess.end(); it++) {
+        triton::arch::MemoryAccess mem = it->first;
+        mem.setLeaAst(nullptr);
+        inst.setStoreAccess(mem, nullptr);
+      }
+
+      for (auto it = readRegisters.begin(); it != readRegisters.end(); it++)
+        inst.removeReadRegister(it->first);
+      for (auto it = readRegisters.begin(); it != readRegisters.end(); it++)
+        inst.setReadRegister(it->first, nullptr);
+
+      for (auto it = writtenRegs.begin(); it != writtenRegs.end(); it++)
+        inst.removeWrittenRegister(it->first);
+      for (auto it = writtenRegs.begin(); it != writtenRegs.end(); it++)
+        inst.setWrittenRegister(it->first, nullptr);
+
+      for (auto it = readImmediates.begin(); it != readImmediates.end(); it++)
+        inst.removeReadImmediate(it->first);
+      for (auto it = readImmediates.begin(); it != readImmediates.end(); it++)
+        inst.setReadImmediate(it->first, nullptr);
+
+      for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+        if (it->getType() == triton::arch::OP_MEM)
+          it->getMemory().setLeaAst(nullptr);
+      }
+    }
+
+
+    bool IrBuilder::buildTaintSemantics(triton::arch::Instruction& inst) {
+      bool labels = (this->taintEngine->isEnabled() && this->modes->isModeEnabled(triton::modes::TAINT_LABELS));
+      bool ret    = false;
+
+      /* Clear previous expressions if exist */
+      inst.symbolicExpressions.clear();
+
+      /* Record the labels read by the instruction */
+      if (labels)
+        this->taintEngine->startLabelsRecording();
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          ret = this->x86Isa->buildTaintSemantics(inst);
+      }
+
+      if (labels) {
+        auto read = this->taintEngine->stopLabelsRecording();
+        if (ret)
+          inst.setTaintLabels(read);
+      }
+
+      /* Clear unused data */
+      if (ret) {
+        inst.memoryAccess.clear();
+        inst.registerState.clear();
+      }
+
+      return ret;
+    }
+
+
     void IrBuilder::preIrInit(triton::arch::Instruction& inst) {
       /* Clear previous expressions if exist */
       inst.symbolicExpressions.clear();
 
-      /* Backup the symbolic engine in the case where only the taint is available. */
+      /* Record the labels read by the instruction */
+      if (this->taintEngine->isEnabled() && this->modes->isModeEnabled(triton::modes::TAINT_LABELS))
+        this->taintEngine->startLabelsRecording();
+
+      /*
+       * If only the taint is available and the instruction has no taint-only
+       * semantics (see buildTaintSemantics()), journal the changes of the
+       * symbolic engine and the nodes built, they are undone once the taint
+       * is spread. The concrete evaluation of the nodes emulates the instruction.
+       */
       if (!this->symbolicEngine->isEnabled()) {
-        *this->backupSymbolicEngine = *this->symbolicEngine;
-        *this->backupAstGarbageCollector = *this->astGarbageCollector;
+        this->symbolicEngine->beginJournal();
+        this->astGarbageCollector->beginJournal();
       }
+
+      /*
+       * Record the nodes built by this instruction in the arena. Nodes shared
+       * through the AST dictionaries cannot be released with the instruction.
+       */
+      if (this->modes->isModeEnabled(triton::modes::AST_ARENA) && !this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES))
+        this->astGarbageCollector->getAstArena()->beginScope();
     }
 
 
     void IrBuilder::postIrInit(triton::arch::Instruction& inst) {
       std::set<triton::ast::AbstractNode*> uniqueNodes;
+      std::vector<triton::ast::AbstractNode*> garbage;
       std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
+      triton::ast::AstArena* arena = this->astGarbageCollector->getAstArena();
+      bool scope = (arena != nullptr && arena->isScopeOpened());
 
       /* Clear unused data */
       inst.memoryAccess.clear();
@@ -127,14 +228,25 @@ namespace triton {
       /* Set the taint */
       inst.setTaint();
 
+      if (this->taintEngine->isEnabled() && this->modes->isModeEnabled(triton::modes::TAINT_LABELS))
+        inst.setTaintLabels(this->taintEngine->stopLabelsRecording());
+
       /*
-       * If the symbolic engine is disable we delete symbolic
-       * expressions and AST nodes. Note that if the taint engine
-       * is enable we must compute semanitcs to spread the taint.
+       * If the symbolic engine is disable we undo its changes and
+       * free the AST nodes of the instruction. Note that if the taint
+       * engine is enable we must compute semanitcs to spread the taint.
+       * Only the instructions without taint-only semantics get here, the
+       * cost of the rollback only depends on the instruction, not on the
+       * trace (see the benchmark_taint_only example).
        */
-      if (!this->symbolicEngine->isEnabled()) {
-        this->removeSymbolicExpressions(inst, uniqueNodes);
-        *this->symbolicEngine = *this->backupSymbolicEngine;
+      if (this->symbolicEngine->isJournalOpened()) {
+        inst.symbolicExpressions.clear();
+        this->clearNodes(inst);
+        this->astGarbageCollector->rollbackJournal();
+        if (scope)
+          arena->releaseScope();
+        this->symbolicEngine->rollbackJournal();
+        return;
       }
 
       /*
@@ -143,7 +255,7 @@ namespace triton {
        * expressions untainted and their AST nodes.
        */
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) && !inst.isTainted()) {
-        this->removeSymbolicExpressions(inst, uniqueNodes);
+        this->removeSymbolicExpressions(inst, garbage);
       }
 
       /*
@@ -154,7 +266,7 @@ namespace triton {
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED)) {
         for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
           if ((*it)->getAst()->isSymbolized() == false) {
-            this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+            garbage.push_back((*it)->getAst());
             this->symbolicEngine->removeSymbolicExpression((*it)->getId());
           }
           else
@@ -168,41 +280,56 @@ namespace triton {
        * and implicit/explicit semantics AST to avoid memory leak.
        */
       if (inst.symbolicExpressions.size() == 0) {
-        /* Memory operands */
-        for (auto it = inst.operands.begin(); it!= inst.operands.end(); it++) {
-          if (it->getType() == triton::arch::OP_MEM) {
-            this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, it->getMemory().getLeaAst());
-          }
+        /*
+         * With the AST arena, every node built by this instruction is
+         * garbage and is released at once, without walking the trees.
+         */
+        if (scope) {
+          arena->releaseScope();
+          garbage.clear();
+          scope = false;
         }
 
-        /* Implicit and explicit semantics - MEM */
-        const auto& loadAccess     = inst.getLoadAccess();
-        const auto& readRegisters  = inst.getReadRegisters();
-        const auto& readImmediates = inst.getReadImmediates();
+        else {
+          /* Memory operands */
+          for (auto it = inst.operands.begin(); it!= inst.operands.end(); it++) {
+            if (it->getType() == triton::arch::OP_MEM) {
+              garbage.push_back(it->getMemory().getLeaAst());
+            }
+          }
+
+          /* Implicit and explicit semantics - MEM */
+          const auto& loadAccess     = inst.getLoadAccess();
+          const auto& readRegisters  = inst.getReadRegisters();
+          const auto& readImmediates = inst.getReadImmediates();
 
-        for (auto it = loadAccess.begin(); it != loadAccess.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          for (auto it = loadAccess.begin(); it != loadAccess.end(); it++)
+            garbage.push_back(std::get<1>(*it));
 
-        /* Implicit and explicit semantics - REG */
-        for (auto it = readRegisters.begin(); it != readRegisters.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          /* Implicit and explicit semantics - REG */
+          for (auto it = readRegisters.begin(); it != readRegisters.end(); it++)
+            garbage.push_back(std::get<1>(*it));
 
-        /* Implicit and explicit semantics - IMM */
-        for (auto it = readImmediates.begin(); it != readImmediates.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          /* Implicit and explicit semantics - IMM */
+          for (auto it = readImmediates.begin(); it != readImmediates.end(); it++)
+            garbage.push_back(std::get<1>(*it));
+        }
       }
 
+      /* The nodes of the remaining expressions are kept */
+      if (scope)
+        arena->endScope();
+
       /* Free collected nodes */
+      for (auto it = garbage.begin(); it != garbage.end(); it++)
+        this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, *it);
       this->astGarbageCollector->freeAstNodes(uniqueNodes);
-
-      if (!this->symbolicEngine->isEnabled())
-        *this->astGarbageCollector = *this->backupAstGarbageCollector;
     }
 
 
-    void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes) {
+    void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& garbage) {
       for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
-        this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+        garbage.push_back((*it)->getAst());
         this->symbolicEngine->removeSymbolicExpression((*it)->getId());
       }
       inst.symbolicExpressions.clear();
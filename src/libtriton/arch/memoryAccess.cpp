@@ -16,7 +16,7 @@ namespace triton {
 
     MemoryAccess::MemoryAccess() {
       this->address              = 0;
-      this->concreteValue        = 0;
+      this->concreteValue        = triton::SmallBitvector();
       this->concreteValueDefined = false;
       this->leaAst               = nullptr;
       this->pcRelative           = 0;
@@ -84,7 +84,7 @@ namespace triton {
 
 
     triton::uint512 MemoryAccess::getConcreteValue(void) const {
-      return this->concreteValue;
+      return this->concreteValue.toUint512();
     }
 
 
@@ -174,7 +174,7 @@ namespace triton {
       if (concreteValue > this->getMaxValue())
         throw triton::exceptions::MemoryAccess("MemoryAccess::MemoryAccess(): You cannot set this concrete value (too big) to this memory access.");
 
-      this->concreteValue        = concreteValue;
+      this->concreteValue        = triton::SmallBitvector(concreteValue, this->getVectorSize());
       this->concreteValueDefined = true;
     }
 
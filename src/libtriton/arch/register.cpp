@@ -5,7 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <triton/api.hpp>
+#include <triton/cpuInterface.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/register.hpp>
 #include <triton/registerSpecification.hpp>
@@ -20,30 +20,20 @@ namespace triton {
     }
 
 
-    Register::Register(triton::uint32 regId) {
-      if (!triton::api.isArchitectureValid()) {
-        this->clear();
-        return;
-      }
-
-      this->setup(regId);
+    Register::Register(const triton::arch::CpuInterface& cpu, triton::uint32 regId) {
+      this->setup(cpu, regId);
       this->immutable            = false;
       this->concreteValueDefined = false;
     }
 
 
-    Register::Register(triton::uint32 regId, triton::uint512 concreteValue)
-      : Register(regId, concreteValue, false) {
+    Register::Register(const triton::arch::CpuInterface& cpu, triton::uint32 regId, triton::uint512 concreteValue)
+      : Register(cpu, regId, concreteValue, false) {
     }
 
 
-    Register::Register(triton::uint32 regId, triton::uint512 concreteValue, bool immutable) {
-      if (!triton::api.isArchitectureValid()) {
-        this->clear();
-        return;
-      }
-
-      this->setup(regId);
+    Register::Register(const triton::arch::CpuInterface& cpu, triton::uint32 regId, triton::uint512 concreteValue, bool immutable) {
+      this->setup(cpu, regId);
       this->immutable = false;
       this->setConcreteValue(concreteValue);
       this->immutable = immutable;
@@ -66,7 +56,7 @@ namespace triton {
 
 
     void Register::clear(void) {
-      this->concreteValue        = 0;
+      this->concreteValue        = triton::SmallBitvector();
       this->concreteValueDefined = false;
       this->id                   = triton::arch::INVALID_REGISTER_ID;
       this->immutable            = false;
@@ -75,14 +65,14 @@ namespace triton {
     }
 
 
-    void Register::setup(triton::uint32 regId) {
+    void Register::setup(const triton::arch::CpuInterface& cpu, triton::uint32 regId) {
       triton::arch::RegisterSpecification regInfo;
 
       this->id = regId;
-      if (!triton::api.isRegisterValid(regId))
+      if (!cpu.isRegisterValid(regId))
         this->id = triton::arch::INVALID_REGISTER_ID;
 
-      regInfo      = triton::api.getRegisterSpecification(this->id);
+      regInfo      = cpu.getRegisterSpecification(this->id);
       this->name   = regInfo.getName();
       this->parent = regInfo.getParentId();
 
@@ -116,8 +106,8 @@ namespace triton {
     }
 
 
-    Register Register::getParent(void) const {
-      return Register(this->parent);
+    triton::uint32 Register::getParentId(void) const {
+      return this->parent;
     }
 
 
@@ -142,7 +132,7 @@ namespace triton {
 
 
     triton::uint512 Register::getConcreteValue(void) const {
-      return this->concreteValue;
+      return this->concreteValue.toUint512();
     }
 
 
@@ -163,7 +153,7 @@ namespace triton {
       if (this->immutable)
         return;
 
-      this->concreteValue        = concreteValue;
+      this->concreteValue        = triton::SmallBitvector(concreteValue, this->getVectorSize());
       this->concreteValueDefined = true;
     }
 
@@ -174,7 +164,7 @@ namespace triton {
 
 
     bool Register::isOverlapWith(const Register& other) const {
-      if (this->getParent().getId() == other.getParent().getId()) {
+      if (this->parent == other.parent) {
         if (this->getLow() <= other.getLow() && other.getLow() <= this->getHigh()) return true;
         if (other.getLow() <= this->getLow() && this->getLow() <= other.getHigh()) return true;
       }
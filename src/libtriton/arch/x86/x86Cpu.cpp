@@ -15,10 +15,6 @@
 #include <triton/immediate.hpp>
 #include <triton/x86Cpu.hpp>
 
-#ifdef TRITON_PYTHON_BINDINGS
-  #include <triton/pythonBindings.hpp>
-#endif
-
 
 
 namespace triton {
@@ -27,23 +23,38 @@ namespace triton {
 
       x86Cpu::x86Cpu(triton::callbacks::Callbacks* callbacks) {
         this->callbacks = callbacks;
+        this->handle    = 0;
+        this->memory.setCallbacks(callbacks);
         this->clear();
       }
 
 
       x86Cpu::x86Cpu(const x86Cpu& other) {
+        this->handle = 0;
         this->copy(other);
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        if (this->handle != 0)
+          triton::extlibs::capstone::cs_close(&this->handle);
       }
 
 
       void x86Cpu::copy(const x86Cpu& other) {
-        this->callbacks = other.callbacks;
-        this->memory    = other.memory;
+        this->callbacks   = other.callbacks;
+        this->decodeCache = other.decodeCache;
+        for (triton::uint32 regId = 0; regId < triton::arch::x86::ID_REG_LAST_ITEM; regId++)
+          this->registers[regId] = other.registers[regId];
+        this->memory.setCallbacks(other.callbacks);
+        this->copyState(other);
+      }
+
+
+      void x86Cpu::copyState(const x86Cpu& other) {
+        /* The memory pages are shared until they are written */
+        this->memory = other.memory;
 
         std::memcpy(this->eax,     other.eax,    sizeof(this->eax));
         std::memcpy(this->ebx,     other.ebx,    sizeof(this->ebx));
@@ -106,244 +117,20 @@ namespace triton {
 
 
       void x86Cpu::init(void) {
-        /* Define registers ========================================================= */
-        triton::arch::x86::x86_reg_rax    = triton::arch::Register();
-        triton::arch::x86::x86_reg_eax    = triton::arch::Register(triton::arch::x86::ID_REG_EAX, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ax     = triton::arch::Register(triton::arch::x86::ID_REG_AX,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ah     = triton::arch::Register(triton::arch::x86::ID_REG_AH,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_al     = triton::arch::Register(triton::arch::x86::ID_REG_AL,  0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rbx    = triton::arch::Register();
-        triton::arch::x86::x86_reg_ebx    = triton::arch::Register(triton::arch::x86::ID_REG_EBX, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_bx     = triton::arch::Register(triton::arch::x86::ID_REG_BX,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_bh     = triton::arch::Register(triton::arch::x86::ID_REG_BH,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_bl     = triton::arch::Register(triton::arch::x86::ID_REG_BL,  0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rcx    = triton::arch::Register();
-        triton::arch::x86::x86_reg_ecx    = triton::arch::Register(triton::arch::x86::ID_REG_ECX, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cx     = triton::arch::Register(triton::arch::x86::ID_REG_CX,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ch     = triton::arch::Register(triton::arch::x86::ID_REG_CH,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cl     = triton::arch::Register(triton::arch::x86::ID_REG_CL,  0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rdx    = triton::arch::Register();
-        triton::arch::x86::x86_reg_edx    = triton::arch::Register(triton::arch::x86::ID_REG_EDX, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_dx     = triton::arch::Register(triton::arch::x86::ID_REG_DX,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_dh     = triton::arch::Register(triton::arch::x86::ID_REG_DH,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_dl     = triton::arch::Register(triton::arch::x86::ID_REG_DL,  0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rdi    = triton::arch::Register();
-        triton::arch::x86::x86_reg_edi    = triton::arch::Register(triton::arch::x86::ID_REG_EDI, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_di     = triton::arch::Register(triton::arch::x86::ID_REG_DI,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_dil    = triton::arch::Register(triton::arch::x86::ID_REG_DIL, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rsi    = triton::arch::Register();
-        triton::arch::x86::x86_reg_esi    = triton::arch::Register(triton::arch::x86::ID_REG_ESI, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_si     = triton::arch::Register(triton::arch::x86::ID_REG_SI,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_sil    = triton::arch::Register(triton::arch::x86::ID_REG_SIL, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rsp    = triton::arch::Register();
-        triton::arch::x86::x86_reg_esp    = triton::arch::Register(triton::arch::x86::ID_REG_ESP, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_sp     = triton::arch::Register(triton::arch::x86::ID_REG_SP,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_spl    = triton::arch::Register(triton::arch::x86::ID_REG_SPL, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_stack  = triton::arch::Register(triton::arch::x86::ID_REG_ESP, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rbp    = triton::arch::Register();
-        triton::arch::x86::x86_reg_ebp    = triton::arch::Register(triton::arch::x86::ID_REG_EBP, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_bp     = triton::arch::Register(triton::arch::x86::ID_REG_BP,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_bpl    = triton::arch::Register(triton::arch::x86::ID_REG_BPL, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_rip    = triton::arch::Register();
-        triton::arch::x86::x86_reg_eip    = triton::arch::Register(triton::arch::x86::ID_REG_EIP, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ip     = triton::arch::Register(triton::arch::x86::ID_REG_IP,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_pc     = triton::arch::Register(triton::arch::x86::ID_REG_EIP, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_eflags = triton::arch::Register(triton::arch::x86::ID_REG_EFLAGS, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_r8     = triton::arch::Register();
-        triton::arch::x86::x86_reg_r8d    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r8w    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r8b    = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r9     = triton::arch::Register();
-        triton::arch::x86::x86_reg_r9d    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r9w    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r9b    = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r10    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r10d   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r10w   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r10b   = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r11    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r11d   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r11w   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r11b   = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r12    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r12d   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r12w   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r12b   = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r13    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r13d   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r13w   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r13b   = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r14    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r14d   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r14w   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r14b   = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_r15    = triton::arch::Register();
-        triton::arch::x86::x86_reg_r15d   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r15w   = triton::arch::Register();
-        triton::arch::x86::x86_reg_r15b   = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_mm0    = triton::arch::Register(triton::arch::x86::ID_REG_MM0, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm1    = triton::arch::Register(triton::arch::x86::ID_REG_MM1, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm2    = triton::arch::Register(triton::arch::x86::ID_REG_MM2, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm3    = triton::arch::Register(triton::arch::x86::ID_REG_MM3, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm4    = triton::arch::Register(triton::arch::x86::ID_REG_MM4, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm5    = triton::arch::Register(triton::arch::x86::ID_REG_MM5, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm6    = triton::arch::Register(triton::arch::x86::ID_REG_MM6, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_mm7    = triton::arch::Register(triton::arch::x86::ID_REG_MM7, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_xmm0   = triton::arch::Register(triton::arch::x86::ID_REG_XMM0, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm1   = triton::arch::Register(triton::arch::x86::ID_REG_XMM1, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm2   = triton::arch::Register(triton::arch::x86::ID_REG_XMM2, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm3   = triton::arch::Register(triton::arch::x86::ID_REG_XMM3, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm4   = triton::arch::Register(triton::arch::x86::ID_REG_XMM4, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm5   = triton::arch::Register(triton::arch::x86::ID_REG_XMM5, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm6   = triton::arch::Register(triton::arch::x86::ID_REG_XMM6, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm7   = triton::arch::Register(triton::arch::x86::ID_REG_XMM7, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_xmm8   = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm9   = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm10  = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm11  = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm12  = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm13  = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm14  = triton::arch::Register();
-        triton::arch::x86::x86_reg_xmm15  = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_ymm0   = triton::arch::Register(triton::arch::x86::ID_REG_YMM0, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm1   = triton::arch::Register(triton::arch::x86::ID_REG_YMM1, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm2   = triton::arch::Register(triton::arch::x86::ID_REG_YMM2, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm3   = triton::arch::Register(triton::arch::x86::ID_REG_YMM3, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm4   = triton::arch::Register(triton::arch::x86::ID_REG_YMM4, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm5   = triton::arch::Register(triton::arch::x86::ID_REG_YMM5, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm6   = triton::arch::Register(triton::arch::x86::ID_REG_YMM6, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm7   = triton::arch::Register(triton::arch::x86::ID_REG_YMM7, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ymm8   = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm9   = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm10  = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm11  = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm12  = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm13  = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm14  = triton::arch::Register();
-        triton::arch::x86::x86_reg_ymm15  = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_zmm0   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm1   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm2   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm3   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm4   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm5   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm6   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm7   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm8   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm9   = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm10  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm11  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm12  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm13  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm14  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm15  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm16  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm17  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm18  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm19  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm20  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm21  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm22  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm23  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm24  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm25  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm26  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm27  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm28  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm29  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm30  = triton::arch::Register();
-        triton::arch::x86::x86_reg_zmm31  = triton::arch::Register();
-
-        triton::arch::x86::x86_reg_mxcsr  = triton::arch::Register(triton::arch::x86::ID_REG_MXCSR, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_cr0    = triton::arch::Register(triton::arch::x86::ID_REG_CR0,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr1    = triton::arch::Register(triton::arch::x86::ID_REG_CR1,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr2    = triton::arch::Register(triton::arch::x86::ID_REG_CR2,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr3    = triton::arch::Register(triton::arch::x86::ID_REG_CR3,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr4    = triton::arch::Register(triton::arch::x86::ID_REG_CR4,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr5    = triton::arch::Register(triton::arch::x86::ID_REG_CR5,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr6    = triton::arch::Register(triton::arch::x86::ID_REG_CR6,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr7    = triton::arch::Register(triton::arch::x86::ID_REG_CR7,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr8    = triton::arch::Register(triton::arch::x86::ID_REG_CR8,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr9    = triton::arch::Register(triton::arch::x86::ID_REG_CR9,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr10   = triton::arch::Register(triton::arch::x86::ID_REG_CR10, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr11   = triton::arch::Register(triton::arch::x86::ID_REG_CR11, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr12   = triton::arch::Register(triton::arch::x86::ID_REG_CR12, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr13   = triton::arch::Register(triton::arch::x86::ID_REG_CR13, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr14   = triton::arch::Register(triton::arch::x86::ID_REG_CR14, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cr15   = triton::arch::Register(triton::arch::x86::ID_REG_CR15, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_ie     = triton::arch::Register(triton::arch::x86::ID_REG_IE,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_de     = triton::arch::Register(triton::arch::x86::ID_REG_DE,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ze     = triton::arch::Register(triton::arch::x86::ID_REG_ZE,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_oe     = triton::arch::Register(triton::arch::x86::ID_REG_OE,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ue     = triton::arch::Register(triton::arch::x86::ID_REG_UE,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_pe     = triton::arch::Register(triton::arch::x86::ID_REG_PE,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_daz    = triton::arch::Register(triton::arch::x86::ID_REG_DAZ, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_im     = triton::arch::Register(triton::arch::x86::ID_REG_IM,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_dm     = triton::arch::Register(triton::arch::x86::ID_REG_DM,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_zm     = triton::arch::Register(triton::arch::x86::ID_REG_ZM,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_om     = triton::arch::Register(triton::arch::x86::ID_REG_OM,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_um     = triton::arch::Register(triton::arch::x86::ID_REG_UM,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_pm     = triton::arch::Register(triton::arch::x86::ID_REG_PM,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_rl     = triton::arch::Register(triton::arch::x86::ID_REG_RL,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_rh     = triton::arch::Register(triton::arch::x86::ID_REG_RH,  0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_fz     = triton::arch::Register(triton::arch::x86::ID_REG_FZ,  0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_af     = triton::arch::Register(triton::arch::x86::ID_REG_AF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_cf     = triton::arch::Register(triton::arch::x86::ID_REG_CF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_df     = triton::arch::Register(triton::arch::x86::ID_REG_DF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_if     = triton::arch::Register(triton::arch::x86::ID_REG_IF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_of     = triton::arch::Register(triton::arch::x86::ID_REG_OF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_pf     = triton::arch::Register(triton::arch::x86::ID_REG_PF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_sf     = triton::arch::Register(triton::arch::x86::ID_REG_SF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_tf     = triton::arch::Register(triton::arch::x86::ID_REG_TF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_zf     = triton::arch::Register(triton::arch::x86::ID_REG_ZF, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        triton::arch::x86::x86_reg_cs     = triton::arch::Register(triton::arch::x86::ID_REG_CS, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ds     = triton::arch::Register(triton::arch::x86::ID_REG_DS, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_es     = triton::arch::Register(triton::arch::x86::ID_REG_ES, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_fs     = triton::arch::Register(triton::arch::x86::ID_REG_FS, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_gs     = triton::arch::Register(triton::arch::x86::ID_REG_GS, 0x00, triton::arch::IMMUTABLE_REGISTER);
-        triton::arch::x86::x86_reg_ss     = triton::arch::Register(triton::arch::x86::ID_REG_SS, 0x00, triton::arch::IMMUTABLE_REGISTER);
-
-        /* Update python env ======================================================== */
-        #ifdef TRITON_PYTHON_BINDINGS
-          triton::bindings::python::initRegNamespace();
-          triton::bindings::python::initCpuSizeNamespace();
-          triton::bindings::python::initX86OpcodesNamespace();
-          triton::bindings::python::initX86PrefixesNamespace();
-          #if defined(__unix__) || defined(__APPLE__)
-            triton::bindings::python::initSyscallNamespace();
-          #endif
-        #endif
+        /* Define the registers of this CPU, an id which is not valid gives the invalid register */
+        for (triton::uint32 regId = 0; regId < triton::arch::x86::ID_REG_LAST_ITEM; regId++) {
+          if (this->isRegisterValid(regId))
+            this->registers[regId] = triton::arch::Register(*this, regId);
+          else
+            this->registers[regId] = triton::arch::Register();
+        }
       }
 
 
       void x86Cpu::clear(void) {
         /* Clear memory */
         this->memory.clear();
+        this->decodeCache.clear();
 
         /* Clear registers */
         std::memset(this->eax,     0x00, sizeof(this->eax));
@@ -433,6 +220,18 @@ namespace triton {
       }
 
 
+      bool x86Cpu::isSyscall(const triton::arch::Instruction& inst) const {
+        switch (inst.getType()) {
+          case triton::arch::x86::ID_INS_INT:
+          case triton::arch::x86::ID_INS_SYSCALL:
+          case triton::arch::x86::ID_INS_SYSENTER:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
       bool x86Cpu::isGPR(triton::uint32 regId) const {
         return ((regId >= triton::arch::x86::ID_REG_EAX && regId <= triton::arch::x86::ID_REG_EFLAGS) ? true : false);
       }
@@ -483,53 +282,74 @@ namespace triton {
       }
 
 
-      std::set<triton::arch::Register*> x86Cpu::getAllRegisters(void) const {
-        std::set<triton::arch::Register*> ret;
+      std::set<const triton::arch::Register*> x86Cpu::getAllRegisters(void) const {
+        std::set<const triton::arch::Register*> ret;
 
         for (triton::uint32 index = 0; index < triton::arch::x86::ID_REG_LAST_ITEM; index++) {
-          if (this->isRegisterValid(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          if (this->isRegisterValid(this->registers[index].getId()))
+            ret.insert(&this->registers[index]);
         }
 
         return ret;
       }
 
 
-      std::set<triton::arch::Register*> x86Cpu::getParentRegisters(void) const {
-        std::set<triton::arch::Register*> ret;
+      std::set<const triton::arch::Register*> x86Cpu::getParentRegisters(void) const {
+        std::set<const triton::arch::Register*> ret;
 
         for (triton::uint32 index = 0; index < triton::arch::x86::ID_REG_LAST_ITEM; index++) {
           /* Add GPR */
-          if (triton::arch::x86::x86_regs[index]->getSize() == this->registerSize())
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          if (this->registers[index].getSize() == this->registerSize())
+            ret.insert(&this->registers[index]);
 
           /* Add Flags */
-          else if (this->isFlag(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isFlag(this->registers[index].getId()))
+            ret.insert(&this->registers[index]);
 
           /* Add MMX */
-          else if (this->isMMX(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isMMX(this->registers[index].getId()))
+            ret.insert(&this->registers[index]);
 
           /* Add SSE */
-          else if (this->isSSE(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isSSE(this->registers[index].getId()))
+            ret.insert(&this->registers[index]);
 
           /* Add AVX-256 */
-          else if (this->isAVX256(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isAVX256(this->registers[index].getId()))
+            ret.insert(&this->registers[index]);
 
           /* Add Control */
-          else if (this->isControl(triton::arch::x86::x86_regs[index]->getId()))
-            ret.insert(triton::arch::x86::x86_regs[index]);
+          else if (this->isControl(this->registers[index].getId()))
+            ret.insert(&this->registers[index]);
         }
 
         return ret;
       }
 
 
+      const triton::arch::Register& x86Cpu::getRegister(triton::uint32 regId) const {
+        if (regId >= triton::arch::x86::ID_REG_LAST_ITEM)
+          return this->registers[triton::arch::x86::ID_REG_INVALID];
+        return this->registers[regId];
+      }
+
+
+      const triton::arch::Register& x86Cpu::getParentRegister(triton::uint32 regId) const {
+        return this->getRegister(this->getRegister(regId).getParentId());
+      }
+
+
+      const triton::arch::Register& x86Cpu::getProgramCounter(void) const {
+        return this->registers[triton::arch::x86::ID_REG_EIP];
+      }
+
+
+      const triton::arch::Register& x86Cpu::getStackPointer(void) const {
+        return this->registers[triton::arch::x86::ID_REG_ESP];
+      }
+
+
       void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
         triton::extlibs::capstone::cs_insn*  insn;
         triton::usize                        count = 0;
 
@@ -537,16 +357,24 @@ namespace triton {
         if (inst.getOpcodes() == nullptr || inst.getSize() == 0)
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcodes and opcodesSize must be definied.");
 
-        /* Open capstone */
-        if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
+        /* The instruction has already been decoded */
+        if (this->decodeCache.load(inst))
+          return;
+
+        /* Open capstone, the handle is kept for the next instructions */
+        if (this->handle == 0) {
+          if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &this->handle) != triton::extlibs::capstone::CS_ERR_OK) {
+            this->handle = 0;
+            throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
+          }
 
-        /* Init capstone's options */
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
-        triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+          /* Init capstone's options */
+          triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
+          triton::extlibs::capstone::cs_option(this->handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
+        }
 
         /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
+        count = triton::extlibs::capstone::cs_disasm(this->handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
         if (count > 0) {
           triton::extlibs::capstone::cs_detail* detail = insn->detail;
           for (triton::uint32 j = 0; j < 1; j++) {
@@ -588,9 +416,9 @@ namespace triton {
                   mem.setPair(std::make_pair(((op->size * BYTE_SIZE_BIT) - 1), 0));
 
                   /* LEA if exists */
-                  triton::arch::Register segment(this->capstoneRegisterToTritonRegister(op->mem.segment));
-                  triton::arch::Register base(this->capstoneRegisterToTritonRegister(op->mem.base));
-                  triton::arch::Register index(this->capstoneRegisterToTritonRegister(op->mem.index));
+                  triton::arch::Register segment(*this, this->capstoneRegisterToTritonRegister(op->mem.segment));
+                  triton::arch::Register base(*this, this->capstoneRegisterToTritonRegister(op->mem.base));
+                  triton::arch::Register index(*this, this->capstoneRegisterToTritonRegister(op->mem.index));
 
                   triton::uint32 immsize = (
                                             this->isRegisterValid(base.getId()) ? base.getSize() :
@@ -602,7 +430,7 @@ namespace triton {
                   triton::arch::Immediate scale(op->mem.scale, immsize);
 
                   /* Specify that LEA contains a PC relative */
-                  if (base.getId() == TRITON_X86_REG_PC.getId())
+                  if (base.getId() == this->getProgramCounter().getId())
                     mem.setPcRelative(inst.getNextAddress());
 
                   mem.setSegmentRegister(segment);
@@ -616,7 +444,7 @@ namespace triton {
                 }
 
                 case triton::extlibs::capstone::X86_OP_REG:
-                  inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(this->capstoneRegisterToTritonRegister(op->reg))));
+                  inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(this->getRegister(this->capstoneRegisterToTritonRegister(op->reg)))));
                   break;
 
                 default:
@@ -641,19 +469,17 @@ namespace triton {
         else
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Failed to disassemble the given code.");
 
-        triton::extlibs::capstone::cs_close(&handle);
-        return;
+        this->decodeCache.store(inst);
       }
 
 
       triton::uint8 x86Cpu::getConcreteMemoryValue(triton::uint64 addr) const {
-        if (this->memory.find(addr) == this->memory.end())
-          return 0x00;
-        return this->memory.at(addr);
+        return this->memory.read(addr);
       }
 
 
       triton::uint512 x86Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+        triton::uint8 bytes[DQQWORD_SIZE];
         triton::uint512 ret = 0;
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
@@ -661,33 +487,50 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks && this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
 
+        this->memory.read(addr, bytes, size);
+
+        /* Up to a qword, build the value on 64 bits */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 value = 0;
+          for (triton::sint32 i = size-1; i >= 0; i--)
+            value = ((value << BYTE_SIZE_BIT) | bytes[i]);
+          return value;
+        }
+
         for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i));
+          ret = ((ret << BYTE_SIZE_BIT) | bytes[i]);
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
+
+        this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
+
+        return area;
+      }
+
 
-        for (triton::usize index = 0; index < size; index++) {
-          if (execCallbacks && this->callbacks)
+      void x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+        if (execCallbacks && this->callbacks && this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+          for (triton::usize index = 0; index < size; index++)
             this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
         }
 
-        return area;
+        if (size)
+          this->memory.read(baseAddr, area, size);
       }
 
 
       triton::uint512 x86Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
         triton::uint512 value = 0;
 
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks && this->callbacks->hasCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
 
         switch (reg.getId()) {
@@ -821,7 +664,8 @@ namespace triton {
 
 
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
+        this->decodeCache.invalidate(addr, BYTE_SIZE);
       }
 
 
@@ -829,28 +673,46 @@ namespace triton {
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
         triton::uint512 cv  = mem.getConcreteValue();
+        triton::uint8 bytes[DQQWORD_SIZE];
 
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
-        for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
-          cv >>= 8;
+        /* Up to a qword, split the value on 64 bits */
+        if (size <= QWORD_SIZE) {
+          triton::uint64 value = cv.convert_to<triton::uint64>();
+          for (triton::uint32 i = 0; i < size; i++) {
+            bytes[i] = static_cast<triton::uint8>(value & 0xff);
+            value >>= 8;
+          }
+        }
+
+        else {
+          for (triton::uint32 i = 0; i < size; i++) {
+            bytes[i] = (cv & 0xff).convert_to<triton::uint8>();
+            cv >>= 8;
+          }
         }
+
+        this->memory.write(addr, bytes, size);
+
+        this->decodeCache.invalidate(addr, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->memory[baseAddr+index] = values[index];
-        }
+        if (values.size())
+          this->memory.write(baseAddr, values.data(), values.size());
+
+        this->decodeCache.invalidate(baseAddr, values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->memory[baseAddr+index] = area[index];
-        }
+        if (size)
+          this->memory.write(baseAddr, area, size);
+
+        this->decodeCache.invalidate(baseAddr, size);
       }
 
 
@@ -1086,19 +948,47 @@ namespace triton {
 
 
       bool x86Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x86Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
-        }
+        this->memory.unmap(baseAddr, size);
+
+        this->decodeCache.invalidate(baseAddr, size);
+      }
+
+
+      void x86Cpu::mapMemoryPages(triton::uint64 baseAddr, triton::usize size) {
+        this->memory.mapPages(baseAddr, size);
+      }
+
+
+      void x86Cpu::mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize) {
+        this->memory.mapView(baseAddr, data, size, memorySize);
+
+        this->decodeCache.invalidate(baseAddr, (memorySize > size) ? memorySize : size);
+      }
+
+
+      void x86Cpu::unmapMemoryPages(triton::uint64 baseAddr, triton::usize size) {
+        triton::uint64 mask = triton::arch::ConcreteMemory::pageSize - 1;
+
+        this->memory.unmapPages(baseAddr, size);
+
+        if (size)
+          this->decodeCache.invalidate(baseAddr & ~mask, ((baseAddr + size - 1) | mask) - (baseAddr & ~mask) + 1);
+      }
+
+
+      std::shared_ptr<triton::uint8> x86Cpu::getConcreteMemoryPage(triton::uint64 addr) {
+        /* The page is written in place, the decode cache checks the opcodes of its entries */
+        return this->memory.getPage(addr);
+      }
+
+
+      std::map<std::string, triton::usize> x86Cpu::getDecodeCacheStats(void) const {
+        return this->decodeCache.getStats();
       }
 
     }; /* x86 namespace */
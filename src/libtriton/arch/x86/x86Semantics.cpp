@@ -324,9 +324,11 @@ namespace triton {
 
       x86Semantics::x86Semantics(triton::arch::Architecture* architecture,
                                  triton::engines::symbolic::SymbolicEngine* symbolicEngine,
-                                 triton::engines::taint::TaintEngine* taintEngine) {
+                                 triton::engines::taint::TaintEngine* taintEngine,
+                                 triton::ast::AstContext* astCtxt) {
 
         this->architecture    = architecture;
+        this->astCtxt         = astCtxt;
         this->symbolicEngine  = symbolicEngine;
         this->taintEngine     = taintEngine;
 
@@ -338,6 +340,9 @@ namespace triton {
 
         if (this->taintEngine == nullptr)
           throw triton::exceptions::Semantics("x86Semantics::x86Semantics(): The taint engines API must be defined.");
+
+        if (this->astCtxt == nullptr)
+          throw triton::exceptions::Semantics("x86Semantics::x86Semantics(): The AST context API must be defined.");
       }
 
 
@@ -636,15 +641,142 @@ namespace triton {
       }
 
 
+      bool x86Semantics::buildTaintSemantics(triton::arch::Instruction& inst) {
+        void (x86Semantics::*semantics)(triton::arch::Instruction&) = nullptr;
+        triton::usize operands = inst.operands.size();
+
+        /* The segment registers keep their symbolic semantics */
+        auto isSegment = [](const triton::arch::OperandWrapper& op) {
+          if (op.getType() != triton::arch::OP_REG)
+            return false;
+          return (op.getConstRegister().getId() >= ID_REG_CS && op.getConstRegister().getId() <= ID_REG_SS);
+        };
+
+        /* So do the repeated instructions */
+        switch (inst.getPrefix()) {
+          case ID_PREFIX_REP:
+          case ID_PREFIX_REPE:
+          case ID_PREFIX_REPNE:
+            return false;
+        }
+
+        /* Only the forms handled below are supported, nothing is done before this check */
+        switch (inst.getType()) {
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            if (operands == 2 && inst.operands[0].getBitSize() == inst.operands[1].getBitSize())
+              semantics = &x86Semantics::binary_t;
+            break;
+
+          case ID_INS_CMP:
+            if (operands == 2 && inst.operands[0].getBitSize() >= inst.operands[1].getBitSize())
+              semantics = &x86Semantics::binary_t;
+            break;
+
+          case ID_INS_MOV:
+          case ID_INS_MOVABS:
+            if (operands == 2 && inst.operands[0].getBitSize() == inst.operands[1].getBitSize() && !isSegment(inst.operands[0]) && !isSegment(inst.operands[1]))
+              semantics = &x86Semantics::mov_t;
+            break;
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+            if (operands == 2 && inst.operands[0].getBitSize() >= inst.operands[1].getBitSize())
+              semantics = &x86Semantics::mov_t;
+            break;
+
+          case ID_INS_LEA:
+            if (operands == 2 && inst.operands[0].getType() == triton::arch::OP_REG && inst.operands[1].getType() == triton::arch::OP_MEM)
+              semantics = &x86Semantics::lea_t;
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+          case ID_INS_NOT:
+            if (operands == 1)
+              semantics = &x86Semantics::unary_t;
+            break;
+
+          case ID_INS_PUSH:
+            if (operands == 1 && !isSegment(inst.operands[0]))
+              semantics = &x86Semantics::push_t;
+            break;
+
+          case ID_INS_POP:
+            if (operands == 1 && !isSegment(inst.operands[0]))
+              semantics = &x86Semantics::pop_t;
+            break;
+
+          case ID_INS_CALL:
+            if (operands == 1)
+              semantics = &x86Semantics::call_t;
+            break;
+
+          case ID_INS_JMP:
+            if (operands == 1)
+              semantics = &x86Semantics::jmp_t;
+            break;
+
+          case ID_INS_RET:
+            if (operands == 0 || (operands == 1 && inst.operands[0].getType() == triton::arch::OP_IMM))
+              semantics = &x86Semantics::ret_t;
+            break;
+
+          case ID_INS_JA:
+          case ID_INS_JAE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS:
+          case ID_INS_JO:
+          case ID_INS_JP:
+          case ID_INS_JS:
+            if (operands == 1 && inst.operands[0].getType() == triton::arch::OP_IMM)
+              semantics = &x86Semantics::jcc_t;
+            break;
+
+          case ID_INS_NOP:
+            semantics = &x86Semantics::nop_t;
+            break;
+        }
+
+        if (semantics == nullptr)
+          return false;
+
+        /* Initialize the target address of memory operands */
+        std::vector<triton::arch::OperandWrapper>::iterator it;
+        for (it = inst.operands.begin(); it != inst.operands.end(); it++) {
+          if (it->getType() == triton::arch::OP_MEM)
+            this->initAddress_t(it->getMemory());
+        }
+
+        (this->*semantics)(inst);
+        return true;
+      }
+
+
       triton::uint64 x86Semantics::alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_SP.getParent());
+        auto dst = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::bv(delta, dst.getBitSize());
+        auto op2 = this->astCtxt->bv(delta, dst.getBitSize());
 
         /* Create the semantics */
-        auto node = triton::ast::bvadd(op1, op2);
+        auto node = this->astCtxt->bvadd(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "Stack alignment");
@@ -658,14 +790,14 @@ namespace triton {
 
 
       triton::uint64 x86Semantics::alignSubStack_s(triton::arch::Instruction& inst, triton::uint32 delta) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_SP.getParent());
+        auto dst = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::bv(delta, dst.getBitSize());
+        auto op2 = this->astCtxt->bv(delta, dst.getBitSize());
 
         /* Create the semantics */
-        auto node = triton::ast::bvsub(op1, op2);
+        auto node = this->astCtxt->bvsub(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "Stack alignment");
@@ -678,21 +810,47 @@ namespace triton {
       }
 
 
-      void x86Semantics::clearFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment) {
+      void x86Semantics::clearFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment) {
         /* Create the semantics */
-        auto node = triton::ast::bv(0, 1);
+        auto node = [this]() { return this->astCtxt->bv(0, 1); };
 
-        /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, flag, comment);
+        /* Create symbolic expression and spread taint */
+        this->flag_s(inst, nullptr, flag, false, node, triton::engines::taint::UNTAINTED, comment);
+      }
 
-        /* Spread taint */
-        expr->isTainted = this->taintEngine->setTaintRegister(flag, triton::engines::taint::UNTAINTED);
+
+      void x86Semantics::flag_s(triton::arch::Instruction& inst,
+                                triton::engines::symbolic::SymbolicExpression* parent,
+                                const triton::arch::Register& flag,
+                                bool value,
+                                const std::function<triton::ast::AbstractNode*(void)>& node,
+                                bool taint,
+                                const std::string& comment) {
+
+        bool isTainted = this->taintEngine->setTaintRegister(flag, taint);
+
+        /* The symbolic expression is built when the flag is read */
+        if (this->symbolicEngine->isLazyFlagsEnabled()) {
+          triton::engines::symbolic::LazyFlag lazy;
+          lazy.builder    = node;
+          lazy.comment    = comment;
+          lazy.parent     = (parent != nullptr) ? parent->getId() : triton::engines::symbolic::UNSET;
+          lazy.isTainted  = isTainted;
+          triton::arch::Register written = flag;
+          written.setConcreteValue(value ? 1 : 0);
+          this->symbolicEngine->setLazyFlag(written, lazy);
+          return;
+        }
+
+        /* Create the symbolic expression */
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node(), flag, comment);
+        expr->isTainted = isTainted;
       }
 
 
-      void x86Semantics::setFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment) {
+      void x86Semantics::setFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment) {
         /* Create the semantics */
-        auto node = triton::ast::bv(1, 1);
+        auto node = this->astCtxt->bv(1, 1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, flag, comment);
@@ -703,9 +861,9 @@ namespace triton {
 
 
       void x86Semantics::controlFlow_s(triton::arch::Instruction& inst) {
-        auto pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC.getParent());
-        auto counter = triton::arch::OperandWrapper(TRITON_X86_REG_CX.getParent());
-        auto zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto counter = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_CX));
+        auto zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         switch (inst.getPrefix()) {
 
@@ -714,13 +872,13 @@ namespace triton {
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, counter);
 
             /* Create the semantics for Counter */
-            auto node1 = triton::ast::bvsub(op1, triton::ast::bv(1, counter.getBitSize()));
+            auto node1 = this->astCtxt->bvsub(op1, this->astCtxt->bv(1, counter.getBitSize()));
 
             /* Create the semantics for PC */
-            auto node2 = triton::ast::ite(
-                     triton::ast::equal(node1, triton::ast::bv(0, counter.getBitSize())),
-                     triton::ast::bv(inst.getNextAddress(), pc.getBitSize()),
-                     triton::ast::bv(inst.getAddress(), pc.getBitSize())
+            auto node2 = this->astCtxt->ite(
+                     this->astCtxt->equal(node1, this->astCtxt->bv(0, counter.getBitSize())),
+                     this->astCtxt->bv(inst.getNextAddress(), pc.getBitSize()),
+                     this->astCtxt->bv(inst.getAddress(), pc.getBitSize())
                    );
 
             /* Create symbolic expression */
@@ -739,16 +897,16 @@ namespace triton {
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
             /* Create the semantics for Counter */
-            auto node1 = triton::ast::bvsub(op1, triton::ast::bv(1, counter.getBitSize()));
+            auto node1 = this->astCtxt->bvsub(op1, this->astCtxt->bv(1, counter.getBitSize()));
 
             /* Create the semantics for PC */
-            auto node2 = triton::ast::ite(
-                     triton::ast::lor(
-                       triton::ast::equal(node1, triton::ast::bv(0, counter.getBitSize())),
-                       triton::ast::equal(op2, triton::ast::bvfalse())
+            auto node2 = this->astCtxt->ite(
+                     this->astCtxt->lor(
+                       this->astCtxt->equal(node1, this->astCtxt->bv(0, counter.getBitSize())),
+                       this->astCtxt->equal(op2, this->astCtxt->bvfalse())
                      ),
-                     triton::ast::bv(inst.getNextAddress(), pc.getBitSize()),
-                     triton::ast::bv(inst.getAddress(), pc.getBitSize())
+                     this->astCtxt->bv(inst.getNextAddress(), pc.getBitSize()),
+                     this->astCtxt->bv(inst.getAddress(), pc.getBitSize())
                    );
 
             /* Create symbolic expression */
@@ -767,16 +925,16 @@ namespace triton {
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
             /* Create the semantics for Counter */
-            auto node1 = triton::ast::bvsub(op1, triton::ast::bv(1, counter.getBitSize()));
+            auto node1 = this->astCtxt->bvsub(op1, this->astCtxt->bv(1, counter.getBitSize()));
 
             /* Create the semantics for PC */
-            auto node2 = triton::ast::ite(
-                     triton::ast::lor(
-                       triton::ast::equal(node1, triton::ast::bv(0, counter.getBitSize())),
-                       triton::ast::equal(op2, triton::ast::bvtrue())
+            auto node2 = this->astCtxt->ite(
+                     this->astCtxt->lor(
+                       this->astCtxt->equal(node1, this->astCtxt->bv(0, counter.getBitSize())),
+                       this->astCtxt->equal(op2, this->astCtxt->bvtrue())
                      ),
-                     triton::ast::bv(inst.getNextAddress(), pc.getBitSize()),
-                     triton::ast::bv(inst.getAddress(), pc.getBitSize())
+                     this->astCtxt->bv(inst.getNextAddress(), pc.getBitSize()),
+                     this->astCtxt->bv(inst.getAddress(), pc.getBitSize())
                    );
 
             /* Create symbolic expression */
@@ -791,13 +949,13 @@ namespace triton {
 
           default: {
             /* Create the semantics */
-            auto node = triton::ast::bv(inst.getNextAddress(), pc.getBitSize());
+            auto node = this->astCtxt->bv(inst.getNextAddress(), pc.getBitSize());
 
             /* Create symbolic expression */
-            auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, node, TRITON_X86_REG_PC, "Program Counter");
+            auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, node, this->architecture->getProgramCounter(), "Program Counter");
 
             /* Spread taint */
-            expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_PC, triton::engines::taint::UNTAINTED);
+            expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getProgramCounter(), triton::engines::taint::UNTAINTED);
             break;
           }
 
@@ -815,31 +973,35 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::bv(0x10, bvSize),
-                        triton::ast::bvand(
-                          triton::ast::bv(0x10, bvSize),
-                          triton::ast::bvxor(
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                            triton::ast::bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
-                    );
+        auto node = [=]() {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->bv(0x10, bvSize),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bv(0x10, bvSize),
+                       this->astCtxt->bvxor(
+                         this->astCtxt->extract(high, low, this->astCtxt->reference(id)),
+                         this->astCtxt->bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
+        /* The concrete value */
+        auto res   = parent->getAst()->getEvaluation().extract(high, low);
+        auto value = !res.bvxor(op1->getEvaluation().bvxor(op2->getEvaluation())).bvand(triton::SmallBitvector(static_cast<triton::uint64>(0x10), bvSize)).isZero();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_AF), value, node, parent->isTainted, "Adjust flag");
       }
 
 
@@ -857,26 +1019,26 @@ namespace triton {
          * Create the semantic.
          * af = 0x10 == (0x10 & (op1 ^ regDst))
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::bv(0x10, bvSize),
-                        triton::ast::bvand(
-                          triton::ast::bv(0x10, bvSize),
-                          triton::ast::bvxor(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
+                        this->astCtxt->bv(0x10, bvSize),
+                        this->astCtxt->bvand(
+                          this->astCtxt->bv(0x10, bvSize),
+                          this->astCtxt->bvxor(
                             op1,
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId()))
+                            this->astCtxt->extract(high, low, this->astCtxt->reference(parent->getId()))
                           )
                         )
                       ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
+                      this->astCtxt->bv(1, 1),
+                      this->astCtxt->bv(0, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_AF), "Adjust flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_AF), parent->isTainted);
       }
 
 
@@ -890,28 +1052,33 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvxor(
-                        triton::ast::bvand(op1, op2),
-                        triton::ast::bvand(
-                          triton::ast::bvxor(
-                            triton::ast::bvxor(op1, op2),
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId()))
-                          ),
-                        triton::ast::bvxor(op1, op2))
-                      )
-                    );
+        auto node = [=]() {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvxor(
+                     this->astCtxt->bvand(op1, op2),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bvxor(
+                         this->astCtxt->bvxor(op1, op2),
+                         this->astCtxt->extract(high, low, this->astCtxt->reference(id))
+                       ),
+                     this->astCtxt->bvxor(op1, op2))
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        /* The concrete value */
+        auto res   = parent->getAst()->getEvaluation().extract(high, low);
+        auto x     = op1->getEvaluation().bvxor(op2->getEvaluation());
+        auto value = op1->getEvaluation().bvand(op2->getEvaluation()).bvxor(x.bvxor(res).bvand(x)).isSigned();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), value, node, parent->isTainted, "Carry flag");
       }
 
 
@@ -925,20 +1092,20 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op1,
-                        triton::ast::bv(0, dst.getBitSize())
+                        this->astCtxt->bv(0, dst.getBitSize())
                       ),
-                      triton::ast::bv(0, 1),
-                      triton::ast::bv(1, 1)
+                      this->astCtxt->bv(0, 1),
+                      this->astCtxt->bv(1, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -952,20 +1119,20 @@ namespace triton {
          * Create the semantic.
          * cf = 1 if op1 == 0 else 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op1,
-                        triton::ast::bv(0, dst.getBitSize())
+                        this->astCtxt->bv(0, dst.getBitSize())
                       ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
+                      this->astCtxt->bv(1, 1),
+                      this->astCtxt->bv(0, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -979,20 +1146,20 @@ namespace triton {
          * Create the semantic.
          * cf = 1 if op1 == 0 else 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op1,
-                        triton::ast::bv(0, dst.getBitSize())
+                        this->astCtxt->bv(0, dst.getBitSize())
                       ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
+                      this->astCtxt->bv(1, 1),
+                      this->astCtxt->bv(0, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1007,20 +1174,20 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if sx(dst) == node else 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::sx(dst.getBitSize(), op1),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
+                        this->astCtxt->sx(dst.getBitSize(), op1),
                         res
                       ),
-                      triton::ast::bv(0, 1),
-                      triton::ast::bv(1, 1)
+                      this->astCtxt->bv(0, 1),
+                      this->astCtxt->bv(1, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1034,20 +1201,20 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op1,
-                        triton::ast::bv(0, dst.getBitSize())
+                        this->astCtxt->bv(0, dst.getBitSize())
                       ),
-                      triton::ast::bv(0, 1),
-                      triton::ast::bv(1, 1)
+                      this->astCtxt->bv(0, 1),
+                      this->astCtxt->bv(1, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1061,20 +1228,20 @@ namespace triton {
          * Create the semantic.
          * cf = 0 if op1 == 0 else 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op1,
-                        triton::ast::bv(0, dst.getBitSize())
+                        this->astCtxt->bv(0, dst.getBitSize())
                       ),
-                      triton::ast::bv(0, 1),
-                      triton::ast::bv(1, 1)
+                      this->astCtxt->bv(0, 1),
+                      this->astCtxt->bv(1, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1091,20 +1258,20 @@ namespace triton {
          * Create the semantic.
          * cf = 0 == regDst
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                        triton::ast::bv(0, bvSize)
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
+                        this->astCtxt->extract(high, low, this->astCtxt->reference(parent->getId())),
+                        this->astCtxt->bv(0, bvSize)
                       ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
+                      this->astCtxt->bv(1, 1),
+                      this->astCtxt->bv(0, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1116,19 +1283,19 @@ namespace triton {
 
         auto bvSize = op2->getBitvectorSize();
         auto high   = result->getBitvectorSize() - 1;
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(high, high, result)
+                      this->astCtxt->extract(high, high, result)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1141,19 +1308,19 @@ namespace triton {
 
         auto bvSize = op2->getBitvectorSize();
         auto high   = result->getBitvectorSize() - 1;
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(high, high, result) /* yes it's should be LSB, but here it's a trick :-) */
+                      this->astCtxt->extract(high, high, result) /* yes it's should be LSB, but here it's a trick :-) */
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1165,19 +1332,19 @@ namespace triton {
 
         auto bvSize = op2->getBitvectorSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(low, low, triton::ast::reference(parent->getId()))
+                      this->astCtxt->extract(low, low, this->astCtxt->reference(parent->getId()))
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1189,19 +1356,19 @@ namespace triton {
 
         auto bvSize = op2->getBitvectorSize();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(high, high, triton::ast::reference(parent->getId()))
+                      this->astCtxt->extract(high, high, this->astCtxt->reference(parent->getId()))
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1213,7 +1380,7 @@ namespace triton {
                                  bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /*
          * Create the semantic.
@@ -1223,21 +1390,21 @@ namespace triton {
          *   else:
          *     cf.id = ((op1 >> (op2 - 1)) & 1)
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::ite(
-                        triton::ast::bvugt(op2, triton::ast::bv(bvSize, bvSize)),
-                        triton::ast::extract(0, 0, triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(1, bvSize)))),
-                        triton::ast::extract(0, 0, triton::ast::bvlshr(op1, triton::ast::bvsub(op2, triton::ast::bv(1, bvSize))))
+                      this->astCtxt->ite(
+                        this->astCtxt->bvugt(op2, this->astCtxt->bv(bvSize, bvSize)),
+                        this->astCtxt->extract(0, 0, this->astCtxt->bvlshr(op1, this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize)))),
+                        this->astCtxt->extract(0, 0, this->astCtxt->bvlshr(op1, this->astCtxt->bvsub(op2, this->astCtxt->bv(1, bvSize))))
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1249,20 +1416,20 @@ namespace triton {
                                  bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /*
          * Create the semantic.
          * cf = (op1 >> ((bvSize - op2) & 1) if op2 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(0, 0,
-                        triton::ast::bvlshr(
+                      this->astCtxt->extract(0, 0,
+                        this->astCtxt->bvlshr(
                           op1,
-                          triton::ast::bvsub(
-                            triton::ast::bv(bvSize, bvSize),
+                          this->astCtxt->bvsub(
+                            this->astCtxt->bv(bvSize, bvSize),
                             op2
                           )
                         )
@@ -1270,10 +1437,10 @@ namespace triton {
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1286,29 +1453,29 @@ namespace triton {
                                   bool vol) {
 
         auto bvSize = op3->getBitvectorSize();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /*
          * Create the semantic.
          * cf = MSB(rol(op3, concat(op2,op1))) if op3 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op3, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op3, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(
+                      this->astCtxt->extract(
                         dst.getBitSize(), dst.getBitSize(),
-                        triton::ast::bvrol(
-                          triton::ast::decimal(op3->evaluate()),
-                          triton::ast::concat(op2, op1)
+                        this->astCtxt->bvrol(
+                          this->astCtxt->decimal(op3->evaluate()),
+                          this->astCtxt->concat(op2, op1)
                         )
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1320,30 +1487,30 @@ namespace triton {
                                  bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /*
          * Create the semantic.
          * cf = ((op1 >> (op2 - 1)) & 1) if op2 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(0, 0,
-                        triton::ast::bvlshr(
+                      this->astCtxt->extract(0, 0,
+                        this->astCtxt->bvlshr(
                           op1,
-                          triton::ast::bvsub(
+                          this->astCtxt->bvsub(
                             op2,
-                            triton::ast::bv(1, bvSize))
+                            this->astCtxt->bv(1, bvSize))
                         )
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1356,29 +1523,29 @@ namespace triton {
                                   bool vol) {
 
         auto bvSize = op3->getBitvectorSize();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /*
          * Create the semantic.
          * cf = MSB(ror(op3, concat(op2,op1))) if op3 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op3, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op3, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, cf),
-                      triton::ast::extract(
+                      this->astCtxt->extract(
                         (dst.getBitSize() * 2)-1, (dst.getBitSize()*2)-1,
-                        triton::ast::bvror(
-                          triton::ast::decimal(op3->evaluate()),
-                          triton::ast::concat(op2, op1)
+                        this->astCtxt->bvror(
+                          this->astCtxt->decimal(op3->evaluate()),
+                          this->astCtxt->concat(op2, op1)
                         )
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Carry flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_CF), parent->isTainted);
       }
 
 
@@ -1392,26 +1559,32 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvxor(
-                        triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))),
-                        triton::ast::bvand(
-                          triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId()))),
-                          triton::ast::bvxor(op1, op2)
-                        )
-                      )
-                    );
+        auto node = [=]() {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvxor(
+                     this->astCtxt->bvxor(op1, this->astCtxt->bvxor(op2, this->astCtxt->extract(high, low, this->astCtxt->reference(id)))),
+                     this->astCtxt->bvand(
+                       this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(id))),
+                       this->astCtxt->bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        /* The concrete value */
+        auto res   = parent->getAst()->getEvaluation().extract(high, low);
+        auto v1    = op1->getEvaluation();
+        auto v2    = op2->getEvaluation();
+        auto value = v1.bvxor(v2.bvxor(res)).bvxor(v1.bvxor(res).bvand(v1.bvxor(v2))).isSigned();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), value, node, parent->isTainted, "Carry flag");
       }
 
 
@@ -1425,23 +1598,28 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvand(
-                        triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
-                        triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                      )
-                    );
+        auto node = [=]() {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvand(
+                     this->astCtxt->bvxor(op1, this->astCtxt->bvnot(op2)),
+                     this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(id)))
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        /* The concrete value */
+        auto res   = parent->getAst()->getEvaluation().extract(high, low);
+        auto v1    = op1->getEvaluation();
+        auto value = v1.bvxor(op2->getEvaluation().bvnot()).bvand(v1.bvxor(res)).isSigned();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), value, node, parent->isTainted, "Overflow flag");
       }
 
 
@@ -1455,20 +1633,20 @@ namespace triton {
          * Create the semantic.
          * of = 0 if sx(dst) == node else 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::sx(dst.getBitSize(), op1),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
+                        this->astCtxt->sx(dst.getBitSize(), op1),
                         res
                       ),
-                      triton::ast::bv(0, 1),
-                      triton::ast::bv(1, 1)
+                      this->astCtxt->bv(0, 1),
+                      this->astCtxt->bv(1, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1482,20 +1660,20 @@ namespace triton {
          * Create the semantic.
          * of = 0 if up == 0 else 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op1,
-                        triton::ast::bv(0, dst.getBitSize())
+                        this->astCtxt->bv(0, dst.getBitSize())
                       ),
-                      triton::ast::bv(0, 1),
-                      triton::ast::bv(1, 1)
+                      this->astCtxt->bv(0, 1),
+                      this->astCtxt->bv(1, 1)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1513,18 +1691,18 @@ namespace triton {
          * Create the semantic.
          * of = (res & op1) >> (bvSize - 1) & 1
          */
-        auto node = triton::ast::extract(0, 0,
-                      triton::ast::bvlshr(
-                        triton::ast::bvand(triton::ast::extract(high, low, triton::ast::reference(parent->getId())), op1),
-                        triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(1, bvSize))
+        auto node = this->astCtxt->extract(0, 0,
+                      this->astCtxt->bvlshr(
+                        this->astCtxt->bvand(this->astCtxt->extract(high, low, this->astCtxt->reference(parent->getId())), op1),
+                        this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize))
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1536,23 +1714,23 @@ namespace triton {
 
         auto bvSize = dst.getBitSize();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(1, bvSize)),
-                      triton::ast::bvxor(
-                        triton::ast::extract(high, high, triton::ast::reference(parent->getId())),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->bvxor(
+                        this->astCtxt->extract(high, high, this->astCtxt->reference(parent->getId())),
                         this->symbolicEngine->buildSymbolicOperand(inst, cf)
                       ),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1564,22 +1742,22 @@ namespace triton {
 
         auto bvSize = op2->getBitvectorSize();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(1, bvSize)),
-                      triton::ast::bvxor(
-                        triton::ast::extract(high, high, triton::ast::reference(parent->getId())),
-                        triton::ast::extract(high-1, high-1, triton::ast::reference(parent->getId()))
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->bvxor(
+                        this->astCtxt->extract(high, high, this->astCtxt->reference(parent->getId())),
+                        this->astCtxt->extract(high-1, high-1, this->astCtxt->reference(parent->getId()))
                       ),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1592,23 +1770,23 @@ namespace triton {
 
         auto bvSize = op2->getBitvectorSize();
         auto high   = dst.getBitSize()-1;
-        auto cf     = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto cf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(1, bvSize)),
-                      triton::ast::bvxor(
-                        triton::ast::extract(high, high, op1),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->bvxor(
+                        this->astCtxt->extract(high, high, op1),
                         this->symbolicEngine->buildSymbolicOperand(inst, cf)
                       ),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1619,25 +1797,25 @@ namespace triton {
                                  bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /*
          * Create the semantic.
          * of = 0 if op2 == 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op2,
-                        triton::ast::bv(1, bvSize)),
-                      triton::ast::bv(0, 1),
+                        this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->bv(0, 1),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1649,30 +1827,30 @@ namespace triton {
                                  bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /*
          * Create the semantic.
          * of = ((op1 >> (bvSize - 1)) ^ (op1 >> (bvSize - 2))) & 1; if op2 == 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op2,
-                        triton::ast::bv(1, bvSize)),
-                      triton::ast::extract(0, 0,
-                        triton::ast::bvxor(
-                          triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(1, bvSize))),
-                          triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(2, bvSize)))
+                        this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->extract(0, 0,
+                        this->astCtxt->bvxor(
+                          this->astCtxt->bvlshr(op1, this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize))),
+                          this->astCtxt->bvlshr(op1, this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(2, bvSize)))
                         )
                       ),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1685,34 +1863,34 @@ namespace triton {
                                   bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /*
          * Create the semantic.
          * of = MSB(rol(op3, concat(op2,op1))) ^ MSB(op1); if op3 == 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op3,
-                        triton::ast::bv(1, bvSize)),
-                      triton::ast::bvxor(
-                        triton::ast::extract(
+                        this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->bvxor(
+                        this->astCtxt->extract(
                           dst.getBitSize()-1, dst.getBitSize()-1,
-                          triton::ast::bvrol(
-                            triton::ast::decimal(op3->evaluate()),
-                            triton::ast::concat(op2, op1)
+                          this->astCtxt->bvrol(
+                            this->astCtxt->decimal(op3->evaluate()),
+                            this->astCtxt->concat(op2, op1)
                           )
                         ),
-                        triton::ast::extract(dst.getBitSize()-1, dst.getBitSize()-1, op1)
+                        this->astCtxt->extract(dst.getBitSize()-1, dst.getBitSize()-1, op1)
                       ),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1724,25 +1902,25 @@ namespace triton {
                                  bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /*
          * Create the semantic.
          * of = ((op1 >> (bvSize - 1)) & 1) if op2 == 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op2,
-                        triton::ast::bv(1, bvSize)),
-                      triton::ast::extract(0, 0, triton::ast::bvlshr(op1, triton::ast::bvsub(triton::ast::bv(bvSize, bvSize), triton::ast::bv(1, bvSize)))),
+                        this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->extract(0, 0, this->astCtxt->bvlshr(op1, this->astCtxt->bvsub(this->astCtxt->bv(bvSize, bvSize), this->astCtxt->bv(1, bvSize)))),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1755,34 +1933,34 @@ namespace triton {
                                   bool vol) {
 
         auto bvSize = dst.getBitSize();
-        auto of     = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto of     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /*
          * Create the semantic.
          * of = MSB(ror(op3, concat(op2,op1))) ^ MSB(op1); if op3 == 1
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
                         op3,
-                        triton::ast::bv(1, bvSize)),
-                      triton::ast::bvxor(
-                        triton::ast::extract(
+                        this->astCtxt->bv(1, bvSize)),
+                      this->astCtxt->bvxor(
+                        this->astCtxt->extract(
                           dst.getBitSize()-1, dst.getBitSize()-1,
-                          triton::ast::bvror(
-                            triton::ast::decimal(op3->evaluate()),
-                            triton::ast::concat(op2, op1)
+                          this->astCtxt->bvror(
+                            this->astCtxt->decimal(op3->evaluate()),
+                            this->astCtxt->concat(op2, op1)
                           )
                         ),
-                        triton::ast::extract(dst.getBitSize()-1, dst.getBitSize()-1, op1)
+                        this->astCtxt->extract(dst.getBitSize()-1, dst.getBitSize()-1, op1)
                       ),
                       this->symbolicEngine->buildSymbolicOperand(inst, of)
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Overflow flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_OF), parent->isTainted);
       }
 
 
@@ -1796,23 +1974,28 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvand(
-                        triton::ast::bvxor(op1, op2),
-                        triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                      )
-                    );
+        auto node = [=]() {
+          return this->astCtxt->extract(bvSize-1, bvSize-1,
+                   this->astCtxt->bvand(
+                     this->astCtxt->bvxor(op1, op2),
+                     this->astCtxt->bvxor(op1, this->astCtxt->extract(high, low, this->astCtxt->reference(id)))
+                   )
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        /* The concrete value */
+        auto res   = parent->getAst()->getEvaluation().extract(high, low);
+        auto v1    = op1->getEvaluation();
+        auto value = v1.bvxor(op2->getEvaluation()).bvand(v1.bvxor(res)).isSigned();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), value, node, parent->isTainted, "Overflow flag");
       }
 
 
@@ -1823,6 +2006,7 @@ namespace triton {
 
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+        auto id     = parent->getId();
 
         /*
          * Create the semantics.
@@ -1830,24 +2014,30 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = triton::ast::bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-          node = triton::ast::bvxor(
-                   node,
-                   triton::ast::extract(0, 0,
-                     triton::ast::bvlshr(
-                       triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                       triton::ast::bv(counter, BYTE_SIZE_BIT)
+        auto node = [=]() {
+          auto pf = this->astCtxt->bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
+            pf = this->astCtxt->bvxor(
+                   pf,
+                   this->astCtxt->extract(0, 0,
+                     this->astCtxt->bvlshr(
+                       this->astCtxt->extract(high, low, this->astCtxt->reference(id)),
+                       this->astCtxt->bv(counter, BYTE_SIZE_BIT)
                      )
-                  )
-                );
-        }
+                   )
+                 );
+          }
+          return pf;
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_PF, "Parity flag");
+        /* The concrete value */
+        auto res   = parent->getAst()->getEvaluation().extract(high, low).toUint64();
+        auto value = true;
+        for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++)
+          value ^= (((res >> counter) & 1) != 0);
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_PF), value, node, parent->isTainted, "Parity flag");
       }
 
 
@@ -1860,36 +2050,36 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
-        auto pf     = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto pf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
 
         /*
          * Create the semantics.
          * pf if op2 != 0
          */
-        auto node1 = triton::ast::bv(1, 1);
+        auto node1 = this->astCtxt->bv(1, 1);
         for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-          node1 = triton::ast::bvxor(
+          node1 = this->astCtxt->bvxor(
                    node1,
-                   triton::ast::extract(0, 0,
-                     triton::ast::bvlshr(
-                       triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                       triton::ast::bv(counter, BYTE_SIZE_BIT)
+                   this->astCtxt->extract(0, 0,
+                     this->astCtxt->bvlshr(
+                       this->astCtxt->extract(high, low, this->astCtxt->reference(parent->getId())),
+                       this->astCtxt->bv(counter, BYTE_SIZE_BIT)
                      )
                   )
                 );
         }
 
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                        this->symbolicEngine->buildSymbolicOperand(inst, pf),
                        node1
                      );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node2, TRITON_X86_REG_PF, "Parity flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node2, this->architecture->getRegister(triton::arch::x86::ID_REG_PF), "Parity flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_PF), parent->isTainted);
       }
 
 
@@ -1900,18 +2090,21 @@ namespace triton {
 
         auto bvSize = dst.getBitSize();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = triton::ast::extract(high, high, triton::ast::reference(parent->getId()));
+        auto node = [=]() {
+          return this->astCtxt->extract(high, high, this->astCtxt->reference(id));
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+        /* The concrete value */
+        auto value = !parent->getAst()->getEvaluation().extract(high, high).isZero();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_SF), value, node, parent->isTainted, "Sign flag");
       }
 
 
@@ -1923,23 +2116,23 @@ namespace triton {
 
         auto bvSize = dst.getBitSize();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
-        auto sf     = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto sf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /*
          * Create the semantic.
          * sf if op2 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, sf),
-                      triton::ast::extract(high, high, triton::ast::reference(parent->getId()))
+                      this->astCtxt->extract(high, high, this->astCtxt->reference(parent->getId()))
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_SF), "Sign flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_SF), parent->isTainted);
       }
 
 
@@ -1952,29 +2145,29 @@ namespace triton {
                                   bool vol) {
 
         auto bvSize = op3->getBitvectorSize();
-        auto sf     = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto sf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /*
          * Create the semantic.
          * MSB(rol(op3, concat(op2,op1))) if op3 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op3, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op3, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, sf),
-                      triton::ast::extract(
+                      this->astCtxt->extract(
                         dst.getBitSize()-1, dst.getBitSize()-1,
-                        triton::ast::bvrol(
-                          triton::ast::decimal(op3->evaluate()),
-                          triton::ast::concat(op2, op1)
+                        this->astCtxt->bvrol(
+                          this->astCtxt->decimal(op3->evaluate()),
+                          this->astCtxt->concat(op2, op1)
                         )
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_SF), "Sign flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_SF), parent->isTainted);
       }
 
 
@@ -1987,29 +2180,29 @@ namespace triton {
                                   bool vol) {
 
         auto bvSize = op3->getBitvectorSize();
-        auto sf     = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto sf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /*
          * Create the semantic.
          * MSB(ror(op3, concat(op2,op1))) if op3 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op3, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op3, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, sf),
-                      triton::ast::extract(
+                      this->astCtxt->extract(
                         dst.getBitSize()-1, dst.getBitSize()-1,
-                        triton::ast::bvror(
-                          triton::ast::decimal(op3->evaluate()),
-                          triton::ast::concat(op2, op1)
+                        this->astCtxt->bvror(
+                          this->astCtxt->decimal(op3->evaluate()),
+                          this->astCtxt->concat(op2, op1)
                         )
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_SF), "Sign flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_SF), parent->isTainted);
       }
 
 
@@ -2021,25 +2214,28 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto id     = parent->getId();
 
         /*
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                        triton::ast::bv(0, bvSize)
-                      ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
-                    );
+        auto node = [=]() {
+          return this->astCtxt->ite(
+                   this->astCtxt->equal(
+                     this->astCtxt->extract(high, low, this->astCtxt->reference(id)),
+                     this->astCtxt->bv(0, bvSize)
+                   ),
+                   this->astCtxt->bv(1, 1),
+                   this->astCtxt->bv(0, 1)
+                 );
+        };
 
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+        /* The concrete value */
+        auto value = parent->getAst()->getEvaluation().extract(high, low).isZero();
 
-        /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+        /* Create the symbolic expression and spread the taint from the parent to the child */
+        this->flag_s(inst, parent, this->architecture->getRegister(triton::arch::x86::ID_REG_ZF), value, node, parent->isTainted, "Zero flag");
       }
 
 
@@ -2053,17 +2249,17 @@ namespace triton {
          * Create the semantic.
          * zf = 1 if op2 == 0 else 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, src.getBitSize())),
-                      triton::ast::bvtrue(),
-                      triton::ast::bvfalse()
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, src.getBitSize())),
+                      this->astCtxt->bvtrue(),
+                      this->astCtxt->bvfalse()
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_ZF), "Zero flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF), parent->isTainted);
       }
 
 
@@ -2076,39 +2272,39 @@ namespace triton {
         auto bvSize = dst.getBitSize();
         auto low    = vol ? 0 : dst.getAbstractLow();
         auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
-        auto zf     = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto zf     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /*
          * Create the semantic.
          * zf if op2 != 0
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bv(0, bvSize)),
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize)),
                       this->symbolicEngine->buildSymbolicOperand(inst, zf),
-                      triton::ast::ite(
-                        triton::ast::equal(
-                          triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                          triton::ast::bv(0, bvSize)
+                      this->astCtxt->ite(
+                        this->astCtxt->equal(
+                          this->astCtxt->extract(high, low, this->astCtxt->reference(parent->getId())),
+                          this->astCtxt->bv(0, bvSize)
                         ),
-                        triton::ast::bv(1, 1),
-                        triton::ast::bv(0, 1)
+                        this->astCtxt->bv(1, 1),
+                        this->astCtxt->bv(0, 1)
                       )
                     );
 
         /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_ZF), "Zero flag");
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+        expr->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF), parent->isTainted);
       }
 
 
       void x86Semantics::aad_s(triton::arch::Instruction& inst) {
         auto  src1   = triton::arch::OperandWrapper(triton::arch::Immediate(0x0a, BYTE_SIZE)); /* D5 0A */
-        auto  src2   = triton::arch::OperandWrapper(TRITON_X86_REG_AL);
-        auto  src3   = triton::arch::OperandWrapper(TRITON_X86_REG_AH);
-        auto  dst    = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-        auto  dsttmp = triton::arch::OperandWrapper(TRITON_X86_REG_AL);
+        auto  src2   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AL));
+        auto  src3   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AH));
+        auto  dst    = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+        auto  dsttmp = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AL));
 
         /* D5 ib */
         if (inst.operands.size() == 1)
@@ -2120,11 +2316,11 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src3);
 
         /* Create the semantics */
-        auto node = triton::ast::zx(
+        auto node = this->astCtxt->zx(
                       BYTE_SIZE_BIT,
-                      triton::ast::bvadd(
+                      this->astCtxt->bvadd(
                         op2,
-                        triton::ast::bvmul(op3, op1)
+                        this->astCtxt->bvmul(op3, op1)
                       )
                     );
 
@@ -2147,7 +2343,7 @@ namespace triton {
       void x86Semantics::adc_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -2155,7 +2351,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
 
         /* Create the semantics */
-        auto node = triton::ast::bvadd(triton::ast::bvadd(op1, op2), triton::ast::zx(dst.getBitSize()-1, op3));
+        auto node = this->astCtxt->bvadd(this->astCtxt->bvadd(op1, op2), this->astCtxt->zx(dst.getBitSize()-1, op3));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ADC operation");
@@ -2180,7 +2376,7 @@ namespace triton {
       void x86Semantics::adcx_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -2188,7 +2384,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
 
         /* Create the semantics */
-        auto node = triton::ast::bvadd(triton::ast::bvadd(op1, op2), triton::ast::zx(dst.getBitSize()-1, op3));
+        auto node = this->astCtxt->bvadd(this->astCtxt->bvadd(op1, op2), this->astCtxt->zx(dst.getBitSize()-1, op3));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ADCX operation");
@@ -2214,7 +2410,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvadd(op1, op2);
+        auto node = this->astCtxt->bvadd(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ADD operation");
@@ -2244,7 +2440,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(op1, op2);
+        auto node = this->astCtxt->bvand(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "AND operation");
@@ -2253,8 +2449,8 @@ namespace triton {
         expr->isTainted = this->taintEngine->taintUnion(dst, src);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->pf_s(inst, expr, dst);
         this->sf_s(inst, expr, dst);
         this->zf_s(inst, expr, dst);
@@ -2274,7 +2470,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(triton::ast::bvnot(op2), op3);
+        auto node = this->astCtxt->bvand(this->astCtxt->bvnot(op2), op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ANDN operation");
@@ -2282,8 +2478,8 @@ namespace triton {
         /* Spread taint */
         expr->isTainted = this->taintEngine->taintAssignment(dst, src1) | this->taintEngine->taintUnion(dst, src2);
 
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->sf_s(inst, expr, dst);
         this->zf_s(inst, expr, dst);
 
@@ -2301,7 +2497,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(triton::ast::bvnot(op1), op2);
+        auto node = this->astCtxt->bvand(this->astCtxt->bvnot(op1), op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ANDNPD operation");
@@ -2323,7 +2519,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(triton::ast::bvnot(op1), op2);
+        auto node = this->astCtxt->bvand(this->astCtxt->bvnot(op1), op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ANDNPS operation");
@@ -2345,7 +2541,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(op1, op2);
+        auto node = this->astCtxt->bvand(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ANDPD operation");
@@ -2367,7 +2563,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(op1, op2);
+        auto node = this->astCtxt->bvand(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ANDPS operation");
@@ -2390,17 +2586,17 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(
-                      triton::ast::bvlshr(
+        auto node = this->astCtxt->bvand(
+                      this->astCtxt->bvlshr(
                         op1,
-                        triton::ast::zx(src1.getBitSize() - BYTE_SIZE_BIT, triton::ast::extract(7, 0, op2))
+                        this->astCtxt->zx(src1.getBitSize() - BYTE_SIZE_BIT, this->astCtxt->extract(7, 0, op2))
                       ),
-                      triton::ast::bvsub(
-                        triton::ast::bvshl(
-                          triton::ast::bv(1, src1.getBitSize()),
-                          triton::ast::zx(src1.getBitSize() - BYTE_SIZE_BIT, triton::ast::extract(15, 8, op2))
+                      this->astCtxt->bvsub(
+                        this->astCtxt->bvshl(
+                          this->astCtxt->bv(1, src1.getBitSize()),
+                          this->astCtxt->zx(src1.getBitSize() - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8, op2))
                         ),
-                        triton::ast::bv(1, src1.getBitSize())
+                        this->astCtxt->bv(1, src1.getBitSize())
                       )
                     );
 
@@ -2411,8 +2607,8 @@ namespace triton {
         expr->isTainted = this->taintEngine->taintAssignment(dst, src1) | this->taintEngine->taintUnion(dst, src2);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->zf_s(inst, expr, dst);
 
         /* Upate the symbolic control flow */
@@ -2428,7 +2624,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(triton::ast::bvneg(op1), op1);
+        auto node = this->astCtxt->bvand(this->astCtxt->bvneg(op1), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "BLSI operation");
@@ -2438,7 +2634,7 @@ namespace triton {
 
         /* Upate symbolic flags */
         this->cfBlsi_s(inst, expr, src, op1);
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->sf_s(inst, expr, dst);
         this->zf_s(inst, expr, dst);
 
@@ -2455,8 +2651,8 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvxor(
-                      triton::ast::bvsub(op1, triton::ast::bv(1, src.getBitSize())),
+        auto node = this->astCtxt->bvxor(
+                      this->astCtxt->bvsub(op1, this->astCtxt->bv(1, src.getBitSize())),
                       op1
                     );
 
@@ -2468,9 +2664,9 @@ namespace triton {
 
         /* Upate symbolic flags */
         this->cfBlsmsk_s(inst, expr, src, op1);
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->sf_s(inst, expr, dst);
-        this->clearFlag_s(inst, TRITON_X86_REG_ZF, "Clears zero flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_ZF), "Clears zero flag");
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -2485,8 +2681,8 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(
-                      triton::ast::bvsub(op1, triton::ast::bv(1, src.getBitSize())),
+        auto node = this->astCtxt->bvand(
+                      this->astCtxt->bvsub(op1, this->astCtxt->bv(1, src.getBitSize())),
                       op1
                     );
 
@@ -2498,7 +2694,7 @@ namespace triton {
 
         /* Upate symbolic flags */
         this->cfBlsr_s(inst, expr, src, op1);
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->sf_s(inst, expr, dst);
         this->zf_s(inst, expr, dst);
 
@@ -2521,154 +2717,154 @@ namespace triton {
         triton::ast::AbstractNode* node = nullptr;
         switch (src.getSize()) {
           case BYTE_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))
                    );
             break;
           case WORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))
                    );
             break;
           case DWORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(16, 16, op2), triton::ast::bvtrue()), triton::ast::bv(16, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(17, 17, op2), triton::ast::bvtrue()), triton::ast::bv(17, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(18, 18, op2), triton::ast::bvtrue()), triton::ast::bv(18, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(19, 19, op2), triton::ast::bvtrue()), triton::ast::bv(19, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(20, 20, op2), triton::ast::bvtrue()), triton::ast::bv(20, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(21, 21, op2), triton::ast::bvtrue()), triton::ast::bv(21, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(22, 22, op2), triton::ast::bvtrue()), triton::ast::bv(22, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(23, 23, op2), triton::ast::bvtrue()), triton::ast::bv(23, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(24, 24, op2), triton::ast::bvtrue()), triton::ast::bv(24, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(25, 25, op2), triton::ast::bvtrue()), triton::ast::bv(25, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(26, 26, op2), triton::ast::bvtrue()), triton::ast::bv(26, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(27, 27, op2), triton::ast::bvtrue()), triton::ast::bv(27, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(28, 28, op2), triton::ast::bvtrue()), triton::ast::bv(28, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(29, 29, op2), triton::ast::bvtrue()), triton::ast::bv(29, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(30, 30, op2), triton::ast::bvtrue()), triton::ast::bv(30, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(31, 31, op2), triton::ast::bvtrue()), triton::ast::bv(31, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(16, 16, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(16, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(17, 17, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(17, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(18, 18, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(18, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(19, 19, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(19, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(20, 20, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(20, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(21, 21, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(21, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(22, 22, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(22, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(23, 23, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(23, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(24, 24, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(24, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(25, 25, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(25, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(26, 26, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(26, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(27, 27, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(27, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(28, 28, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(28, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(29, 29, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(29, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(30, 30, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(30, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(31, 31, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(31, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))))))))))))))))))
                    );
             break;
           case QWORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSF only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(16, 16, op2), triton::ast::bvtrue()), triton::ast::bv(16, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(17, 17, op2), triton::ast::bvtrue()), triton::ast::bv(17, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(18, 18, op2), triton::ast::bvtrue()), triton::ast::bv(18, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(19, 19, op2), triton::ast::bvtrue()), triton::ast::bv(19, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(20, 20, op2), triton::ast::bvtrue()), triton::ast::bv(20, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(21, 21, op2), triton::ast::bvtrue()), triton::ast::bv(21, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(22, 22, op2), triton::ast::bvtrue()), triton::ast::bv(22, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(23, 23, op2), triton::ast::bvtrue()), triton::ast::bv(23, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(24, 24, op2), triton::ast::bvtrue()), triton::ast::bv(24, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(25, 25, op2), triton::ast::bvtrue()), triton::ast::bv(25, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(26, 26, op2), triton::ast::bvtrue()), triton::ast::bv(26, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(27, 27, op2), triton::ast::bvtrue()), triton::ast::bv(27, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(28, 28, op2), triton::ast::bvtrue()), triton::ast::bv(28, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(29, 29, op2), triton::ast::bvtrue()), triton::ast::bv(29, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(30, 30, op2), triton::ast::bvtrue()), triton::ast::bv(30, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(31, 31, op2), triton::ast::bvtrue()), triton::ast::bv(31, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(32, 32, op2), triton::ast::bvtrue()), triton::ast::bv(32, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(33, 33, op2), triton::ast::bvtrue()), triton::ast::bv(33, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(34, 34, op2), triton::ast::bvtrue()), triton::ast::bv(34, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(35, 35, op2), triton::ast::bvtrue()), triton::ast::bv(35, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(36, 36, op2), triton::ast::bvtrue()), triton::ast::bv(36, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(37, 37, op2), triton::ast::bvtrue()), triton::ast::bv(37, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(38, 38, op2), triton::ast::bvtrue()), triton::ast::bv(38, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(39, 39, op2), triton::ast::bvtrue()), triton::ast::bv(39, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(40, 40, op2), triton::ast::bvtrue()), triton::ast::bv(40, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(41, 41, op2), triton::ast::bvtrue()), triton::ast::bv(41, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(42, 42, op2), triton::ast::bvtrue()), triton::ast::bv(42, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(43, 43, op2), triton::ast::bvtrue()), triton::ast::bv(43, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(44, 44, op2), triton::ast::bvtrue()), triton::ast::bv(44, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(45, 45, op2), triton::ast::bvtrue()), triton::ast::bv(45, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(46, 46, op2), triton::ast::bvtrue()), triton::ast::bv(46, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(47, 47, op2), triton::ast::bvtrue()), triton::ast::bv(47, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(48, 48, op2), triton::ast::bvtrue()), triton::ast::bv(48, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(49, 49, op2), triton::ast::bvtrue()), triton::ast::bv(49, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(50, 50, op2), triton::ast::bvtrue()), triton::ast::bv(50, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(51, 51, op2), triton::ast::bvtrue()), triton::ast::bv(51, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(52, 52, op2), triton::ast::bvtrue()), triton::ast::bv(52, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(53, 53, op2), triton::ast::bvtrue()), triton::ast::bv(53, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(54, 54, op2), triton::ast::bvtrue()), triton::ast::bv(54, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(55, 55, op2), triton::ast::bvtrue()), triton::ast::bv(55, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(56, 56, op2), triton::ast::bvtrue()), triton::ast::bv(56, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(57, 57, op2), triton::ast::bvtrue()), triton::ast::bv(57, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(58, 58, op2), triton::ast::bvtrue()), triton::ast::bv(58, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(59, 59, op2), triton::ast::bvtrue()), triton::ast::bv(59, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(60, 60, op2), triton::ast::bvtrue()), triton::ast::bv(60, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(61, 61, op2), triton::ast::bvtrue()), triton::ast::bv(61, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(62, 62, op2), triton::ast::bvtrue()), triton::ast::bv(62, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(63, 63, op2), triton::ast::bvtrue()), triton::ast::bv(63, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(16, 16, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(16, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(17, 17, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(17, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(18, 18, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(18, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(19, 19, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(19, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(20, 20, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(20, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(21, 21, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(21, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(22, 22, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(22, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(23, 23, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(23, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(24, 24, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(24, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(25, 25, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(25, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(26, 26, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(26, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(27, 27, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(27, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(28, 28, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(28, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(29, 29, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(29, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(30, 30, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(30, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(31, 31, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(31, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(32, 32, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(32, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(33, 33, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(33, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(34, 34, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(34, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(35, 35, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(35, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(36, 36, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(36, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(37, 37, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(37, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(38, 38, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(38, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(39, 39, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(39, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(40, 40, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(40, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(41, 41, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(41, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(42, 42, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(42, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(43, 43, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(43, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(44, 44, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(44, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(45, 45, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(45, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(46, 46, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(46, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(47, 47, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(47, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(48, 48, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(48, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(49, 49, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(49, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(50, 50, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(50, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(51, 51, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(51, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(52, 52, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(52, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(53, 53, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(53, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(54, 54, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(54, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(55, 55, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(55, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(56, 56, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(56, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(57, 57, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(57, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(58, 58, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(58, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(59, 59, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(59, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(60, 60, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(60, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(61, 61, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(61, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(62, 62, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(62, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(63, 63, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(63, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
                    );
             break;
@@ -2704,154 +2900,154 @@ namespace triton {
         triton::ast::AbstractNode* node = nullptr;
         switch (src.getSize()) {
           case BYTE_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))
                    );
             break;
           case WORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))
                    );
             break;
           case DWORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(31, 31, op2), triton::ast::bvtrue()), triton::ast::bv(31, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(30, 30, op2), triton::ast::bvtrue()), triton::ast::bv(30, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(29, 29, op2), triton::ast::bvtrue()), triton::ast::bv(29, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(28, 28, op2), triton::ast::bvtrue()), triton::ast::bv(28, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(27, 27, op2), triton::ast::bvtrue()), triton::ast::bv(27, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(26, 26, op2), triton::ast::bvtrue()), triton::ast::bv(26, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(25, 25, op2), triton::ast::bvtrue()), triton::ast::bv(25, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(24, 24, op2), triton::ast::bvtrue()), triton::ast::bv(24, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(23, 23, op2), triton::ast::bvtrue()), triton::ast::bv(23, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(22, 22, op2), triton::ast::bvtrue()), triton::ast::bv(22, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(21, 21, op2), triton::ast::bvtrue()), triton::ast::bv(21, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(20, 20, op2), triton::ast::bvtrue()), triton::ast::bv(20, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(19, 19, op2), triton::ast::bvtrue()), triton::ast::bv(19, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(18, 18, op2), triton::ast::bvtrue()), triton::ast::bv(18, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(17, 17, op2), triton::ast::bvtrue()), triton::ast::bv(17, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(16, 16, op2), triton::ast::bvtrue()), triton::ast::bv(16, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(31, 31, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(31, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(30, 30, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(30, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(29, 29, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(29, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(28, 28, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(28, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(27, 27, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(27, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(26, 26, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(26, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(25, 25, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(25, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(24, 24, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(24, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(23, 23, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(23, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(22, 22, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(22, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(21, 21, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(21, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(20, 20, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(20, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(19, 19, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(19, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(18, 18, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(18, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(17, 17, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(17, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(16, 16, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(16, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))))))))))))))))))
                    );
             break;
           case QWORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)), /* Apply BSR only if op2 != 0 */
                      op1,
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(63, 63, op2), triton::ast::bvtrue()), triton::ast::bv(63, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(62, 62, op2), triton::ast::bvtrue()), triton::ast::bv(62, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(61, 61, op2), triton::ast::bvtrue()), triton::ast::bv(61, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(60, 60, op2), triton::ast::bvtrue()), triton::ast::bv(60, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(59, 59, op2), triton::ast::bvtrue()), triton::ast::bv(59, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(58, 58, op2), triton::ast::bvtrue()), triton::ast::bv(58, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(57, 57, op2), triton::ast::bvtrue()), triton::ast::bv(57, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(56, 56, op2), triton::ast::bvtrue()), triton::ast::bv(56, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(55, 55, op2), triton::ast::bvtrue()), triton::ast::bv(55, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(54, 54, op2), triton::ast::bvtrue()), triton::ast::bv(54, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(53, 53, op2), triton::ast::bvtrue()), triton::ast::bv(53, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(52, 52, op2), triton::ast::bvtrue()), triton::ast::bv(52, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(51, 51, op2), triton::ast::bvtrue()), triton::ast::bv(51, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(50, 50, op2), triton::ast::bvtrue()), triton::ast::bv(50, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(49, 49, op2), triton::ast::bvtrue()), triton::ast::bv(49, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(48, 48, op2), triton::ast::bvtrue()), triton::ast::bv(48, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(47, 47, op2), triton::ast::bvtrue()), triton::ast::bv(47, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(46, 46, op2), triton::ast::bvtrue()), triton::ast::bv(46, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(45, 45, op2), triton::ast::bvtrue()), triton::ast::bv(45, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(44, 44, op2), triton::ast::bvtrue()), triton::ast::bv(44, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(43, 43, op2), triton::ast::bvtrue()), triton::ast::bv(43, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(42, 42, op2), triton::ast::bvtrue()), triton::ast::bv(42, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(41, 41, op2), triton::ast::bvtrue()), triton::ast::bv(41, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(40, 40, op2), triton::ast::bvtrue()), triton::ast::bv(40, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(39, 39, op2), triton::ast::bvtrue()), triton::ast::bv(39, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(38, 38, op2), triton::ast::bvtrue()), triton::ast::bv(38, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(37, 37, op2), triton::ast::bvtrue()), triton::ast::bv(37, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(36, 36, op2), triton::ast::bvtrue()), triton::ast::bv(36, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(35, 35, op2), triton::ast::bvtrue()), triton::ast::bv(35, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(34, 34, op2), triton::ast::bvtrue()), triton::ast::bv(34, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(33, 33, op2), triton::ast::bvtrue()), triton::ast::bv(33, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(32, 32, op2), triton::ast::bvtrue()), triton::ast::bv(32, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(31, 31, op2), triton::ast::bvtrue()), triton::ast::bv(31, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(30, 30, op2), triton::ast::bvtrue()), triton::ast::bv(30, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(29, 29, op2), triton::ast::bvtrue()), triton::ast::bv(29, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(28, 28, op2), triton::ast::bvtrue()), triton::ast::bv(28, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(27, 27, op2), triton::ast::bvtrue()), triton::ast::bv(27, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(26, 26, op2), triton::ast::bvtrue()), triton::ast::bv(26, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(25, 25, op2), triton::ast::bvtrue()), triton::ast::bv(25, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(24, 24, op2), triton::ast::bvtrue()), triton::ast::bv(24, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(23, 23, op2), triton::ast::bvtrue()), triton::ast::bv(23, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(22, 22, op2), triton::ast::bvtrue()), triton::ast::bv(22, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(21, 21, op2), triton::ast::bvtrue()), triton::ast::bv(21, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(20, 20, op2), triton::ast::bvtrue()), triton::ast::bv(20, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(19, 19, op2), triton::ast::bvtrue()), triton::ast::bv(19, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(18, 18, op2), triton::ast::bvtrue()), triton::ast::bv(18, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(17, 17, op2), triton::ast::bvtrue()), triton::ast::bv(17, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(16, 16, op2), triton::ast::bvtrue()), triton::ast::bv(16, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(63, 63, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(63, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(62, 62, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(62, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(61, 61, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(61, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(60, 60, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(60, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(59, 59, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(59, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(58, 58, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(58, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(57, 57, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(57, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(56, 56, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(56, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(55, 55, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(55, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(54, 54, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(54, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(53, 53, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(53, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(52, 52, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(52, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(51, 51, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(51, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(50, 50, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(50, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(49, 49, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(49, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(48, 48, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(48, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(47, 47, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(47, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(46, 46, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(46, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(45, 45, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(45, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(44, 44, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(44, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(43, 43, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(43, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(42, 42, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(42, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(41, 41, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(41, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(40, 40, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(40, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(39, 39, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(39, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(38, 38, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(38, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(37, 37, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(37, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(36, 36, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(36, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(35, 35, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(35, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(34, 34, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(34, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(33, 33, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(33, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(32, 32, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(32, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(31, 31, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(31, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(30, 30, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(30, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(29, 29, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(29, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(28, 28, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(28, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(27, 27, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(27, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(26, 26, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(26, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(25, 25, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(25, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(24, 24, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(24, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(23, 23, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(23, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(22, 22, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(22, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(21, 21, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(21, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(20, 20, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(20, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(19, 19, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(19, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(18, 18, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(18, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(17, 17, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(17, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(16, 16, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(16, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
                    );
             break;
@@ -2883,22 +3079,22 @@ namespace triton {
         std::list<triton::ast::AbstractNode *> bytes;
         switch (src.getSize()) {
           case QWORD_SIZE:
-            bytes.push_front(triton::ast::extract(63, 56, op1));
-            bytes.push_front(triton::ast::extract(55, 48, op1));
-            bytes.push_front(triton::ast::extract(47, 40, op1));
-            bytes.push_front(triton::ast::extract(39, 32, op1));
+            bytes.push_front(this->astCtxt->extract(63, 56, op1));
+            bytes.push_front(this->astCtxt->extract(55, 48, op1));
+            bytes.push_front(this->astCtxt->extract(47, 40, op1));
+            bytes.push_front(this->astCtxt->extract(39, 32, op1));
           case DWORD_SIZE:
-            bytes.push_front(triton::ast::extract(31, 24, op1));
-            bytes.push_front(triton::ast::extract(23, 16, op1));
+            bytes.push_front(this->astCtxt->extract(31, 24, op1));
+            bytes.push_front(this->astCtxt->extract(23, 16, op1));
           case WORD_SIZE:
-            bytes.push_front(triton::ast::extract(15, 8, op1));
-            bytes.push_front(triton::ast::extract(7,  0, op1));
+            bytes.push_front(this->astCtxt->extract(15, 8, op1));
+            bytes.push_front(this->astCtxt->extract(7,  0, op1));
             break;
           default:
             throw triton::exceptions::Semantics("x86Semantics::bswap_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(bytes);
+        auto node = this->astCtxt->concat(bytes);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, src, "BSWAP operation");
@@ -2912,7 +3108,7 @@ namespace triton {
 
 
       void x86Semantics::bt_s(triton::arch::Instruction& inst) {
-        auto  dst  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  dst  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
         auto& src1 = inst.operands[0];
         auto& src2 = inst.operands[1];
 
@@ -2921,18 +3117,18 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::extract(0, 0,
-                      triton::ast::bvlshr(
+        auto node = this->astCtxt->extract(0, 0,
+                      this->astCtxt->bvlshr(
                         op1,
-                        triton::ast::bvsmod(
+                        this->astCtxt->bvsmod(
                           op2,
-                          triton::ast::bv(src1.getBitSize(), src1.getBitSize())
+                          this->astCtxt->bv(src1.getBitSize(), src1.getBitSize())
                         )
                       )
                     );
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "BT operation");
+        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "BT operation");
 
         /* Spread taint */
         expr->isTainted = this->taintEngine->taintUnion(dst, src1);
@@ -2944,7 +3140,7 @@ namespace triton {
 
 
       void x86Semantics::btc_s(triton::arch::Instruction& inst) {
-        auto  dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
         auto& dst2 = inst.operands[0];
         auto& src1 = inst.operands[1];
 
@@ -2953,38 +3149,38 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
 
         /* Create the semantics */
-        auto node1 = triton::ast::extract(0, 0,
-                       triton::ast::bvlshr(
+        auto node1 = this->astCtxt->extract(0, 0,
+                       this->astCtxt->bvlshr(
                          op1,
-                         triton::ast::bvsmod(
+                         this->astCtxt->bvsmod(
                            op2,
-                           triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                           this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                          )
                        )
                      );
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(node1, triton::ast::bvfalse()),
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(node1, this->astCtxt->bvfalse()),
                        /* BTS */
-                       triton::ast::bvor(
+                       this->astCtxt->bvor(
                          op1,
-                         triton::ast::bvshl(
-                           triton::ast::bv(1, dst2.getBitSize()),
-                           triton::ast::bvsmod(
+                         this->astCtxt->bvshl(
+                           this->astCtxt->bv(1, dst2.getBitSize()),
+                           this->astCtxt->bvsmod(
                              op2,
-                             triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                             this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                            )
                          )
                        ),
                        /* BTR */
-                       triton::ast::bvand(
+                       this->astCtxt->bvand(
                          op1,
-                         triton::ast::bvsub(
+                         this->astCtxt->bvsub(
                            op1,
-                           triton::ast::bvshl(
-                             triton::ast::bv(1, dst2.getBitSize()),
-                             triton::ast::bvsmod(
+                           this->astCtxt->bvshl(
+                             this->astCtxt->bv(1, dst2.getBitSize()),
+                             this->astCtxt->bvsmod(
                                op2,
-                               triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                               this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                              )
                            )
                          )
@@ -2992,7 +3188,7 @@ namespace triton {
                      );
 
         /* Create symbolic expression */
-        auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTC carry operation");
+        auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "BTC carry operation");
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, dst2, "BTC complement operation");
 
         /* Spread taint */
@@ -3006,7 +3202,7 @@ namespace triton {
 
 
       void x86Semantics::btr_s(triton::arch::Instruction& inst) {
-        auto  dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
         auto& dst2 = inst.operands[0];
         auto& src1 = inst.operands[1];
 
@@ -3015,27 +3211,27 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
 
         /* Create the semantics */
-        auto node1 = triton::ast::extract(0, 0,
-                       triton::ast::bvlshr(
+        auto node1 = this->astCtxt->extract(0, 0,
+                       this->astCtxt->bvlshr(
                          op1,
-                         triton::ast::bvsmod(
+                         this->astCtxt->bvsmod(
                            op2,
-                           triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                           this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                          )
                        )
                      );
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(node1, triton::ast::bvfalse()),
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(node1, this->astCtxt->bvfalse()),
                        op1,
-                       triton::ast::bvand(
+                       this->astCtxt->bvand(
                          op1,
-                         triton::ast::bvsub(
+                         this->astCtxt->bvsub(
                            op1,
-                           triton::ast::bvshl(
-                             triton::ast::bv(1, dst2.getBitSize()),
-                             triton::ast::bvsmod(
+                           this->astCtxt->bvshl(
+                             this->astCtxt->bv(1, dst2.getBitSize()),
+                             this->astCtxt->bvsmod(
                                op2,
-                               triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                               this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                              )
                            )
                          )
@@ -3043,7 +3239,7 @@ namespace triton {
                      );
 
         /* Create symbolic expression */
-        auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTR carry operation");
+        auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "BTR carry operation");
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, dst2, "BTR reset operation");
 
         /* Spread taint */
@@ -3057,7 +3253,7 @@ namespace triton {
 
 
       void x86Semantics::bts_s(triton::arch::Instruction& inst) {
-        auto  dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
         auto& dst2 = inst.operands[0];
         auto& src1 = inst.operands[1];
 
@@ -3066,28 +3262,28 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
 
         /* Create the semantics */
-        auto node1 = triton::ast::extract(0, 0,
-                       triton::ast::bvlshr(
+        auto node1 = this->astCtxt->extract(0, 0,
+                       this->astCtxt->bvlshr(
                          op1,
-                         triton::ast::bvsmod(
+                         this->astCtxt->bvsmod(
                            op2,
-                           triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                           this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                          )
                        )
                      );
-        auto node2 = triton::ast::bvor(
+        auto node2 = this->astCtxt->bvor(
                        op1,
-                       triton::ast::bvshl(
-                         triton::ast::bv(1, dst2.getBitSize()),
-                         triton::ast::bvsmod(
+                       this->astCtxt->bvshl(
+                         this->astCtxt->bv(1, dst2.getBitSize()),
+                         this->astCtxt->bvsmod(
                            op2,
-                           triton::ast::bv(dst2.getBitSize(), dst2.getBitSize())
+                           this->astCtxt->bv(dst2.getBitSize(), dst2.getBitSize())
                          )
                        )
                      );
 
         /* Create symbolic expression */
-        auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, TRITON_X86_REG_CF, "BTS carry operation");
+        auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "BTS carry operation");
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, dst2, "BTS set operation");
 
         /* Spread taint */
@@ -3101,11 +3297,11 @@ namespace triton {
 
 
       void x86Semantics::call_s(triton::arch::Instruction& inst) {
-        auto stack = TRITON_X86_REG_SP.getParent();
+        auto stack = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
 
         /* Create the semantics - side effect */
         auto  stackValue = alignSubStack_s(inst, stack.getSize());
-        auto  pc         = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+        auto  pc         = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
         auto  sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
         auto& src        = inst.operands[0];
 
@@ -3113,7 +3309,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics - side effect */
-        auto node1 = triton::ast::bv(inst.getNextAddress(), pc.getBitSize());
+        auto node1 = this->astCtxt->bv(inst.getNextAddress(), pc.getBitSize());
 
         /* Create the semantics */
         auto node2 = op1;
@@ -3134,13 +3330,13 @@ namespace triton {
 
 
       void x86Semantics::cbw_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
 
         /* Create the semantics */
-        auto node = triton::ast::sx(BYTE_SIZE_BIT, triton::ast::extract(BYTE_SIZE_BIT-1, 0, op1));
+        auto node = this->astCtxt->sx(BYTE_SIZE_BIT, this->astCtxt->extract(BYTE_SIZE_BIT-1, 0, op1));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CBW operation");
@@ -3154,38 +3350,38 @@ namespace triton {
 
 
       void x86Semantics::cdq_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-        auto src = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+        auto src = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics - TMP = 64 bitvec (EDX:EAX) */
-        auto node1 = triton::ast::sx(DWORD_SIZE_BIT, op1);
+        auto node1 = this->astCtxt->sx(DWORD_SIZE_BIT, op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "Temporary variable");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isRegisterTainted(TRITON_X86_REG_EDX) | this->taintEngine->isRegisterTainted(TRITON_X86_REG_EAX);
+        expr1->isTainted = this->taintEngine->isRegisterTainted(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX)) | this->taintEngine->isRegisterTainted(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
 
         /* Create the semantics - EAX = TMP[31...0] */
-        auto node2 = triton::ast::extract(DWORD_SIZE_BIT-1, 0, triton::ast::reference(expr1->getId()));
+        auto node2 = this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, this->astCtxt->reference(expr1->getId()));
 
         /* Create symbolic expression */
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, src, "CDQ EAX operation");
 
         /* Spread taint */
-        expr2->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_EAX, expr1->isTainted);
+        expr2->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX), expr1->isTainted);
 
         /* Create the semantics - EDX = TMP[63...32] */
-        auto node3 = triton::ast::extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
+        auto node3 = this->astCtxt->extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, this->astCtxt->reference(expr1->getId()));
 
         /* Create symbolic expression */
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, dst, "CDQ EDX operation");
 
         /* Spread taint */
-        expr3->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_EDX, expr1->isTainted);
+        expr3->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX), expr1->isTainted);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -3193,13 +3389,13 @@ namespace triton {
 
 
       void x86Semantics::cdqe_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
 
         /* Create the semantics */
-        auto node = triton::ast::sx(DWORD_SIZE_BIT, triton::ast::extract(DWORD_SIZE_BIT-1, 0, op1));
+        auto node = this->astCtxt->sx(DWORD_SIZE_BIT, this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, op1));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CDQE operation");
@@ -3213,14 +3409,14 @@ namespace triton {
 
 
       void x86Semantics::clc_s(triton::arch::Instruction& inst) {
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
 
 
       void x86Semantics::cld_s(triton::arch::Instruction& inst) {
-        this->clearFlag_s(inst, TRITON_X86_REG_DF, "Clears direction flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_DF), "Clears direction flag");
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
@@ -3233,7 +3429,7 @@ namespace triton {
 
 
       void x86Semantics::clts_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_CR0);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CR0));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3243,10 +3439,10 @@ namespace triton {
 
         switch (dst.getBitSize()) {
           case QWORD_SIZE_BIT:
-            node = triton::ast::bvand(op1, triton::ast::bv(0xfffffffffffffff7, QWORD_SIZE_BIT));
+            node = this->astCtxt->bvand(op1, this->astCtxt->bv(0xfffffffffffffff7, QWORD_SIZE_BIT));
             break;
           case DWORD_SIZE_BIT:
-            node = triton::ast::bvand(op1, triton::ast::bv(0xfffffff7, DWORD_SIZE_BIT));
+            node = this->astCtxt->bvand(op1, this->astCtxt->bv(0xfffffff7, DWORD_SIZE_BIT));
             break;
           default:
             throw triton::exceptions::Semantics("x86Semantics::clts_s(): Invalid operand size.");
@@ -3264,20 +3460,20 @@ namespace triton {
 
 
       void x86Semantics::cli_s(triton::arch::Instruction& inst) {
-        this->clearFlag_s(inst, TRITON_X86_REG_IF, "Clears interrupt flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_IF), "Clears interrupt flag");
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
 
 
       void x86Semantics::cmc_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
 
         /* Create the semantics */
-        auto node = triton::ast::bvnot(op1);
+        auto node = this->astCtxt->bvnot(op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, dst.getRegister(), "CMC operation");
@@ -3293,8 +3489,8 @@ namespace triton {
       void x86Semantics::cmova_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3303,7 +3499,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvand(triton::ast::bvnot(op3), triton::ast::bvnot(op4)), triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvand(this->astCtxt->bvnot(op3), this->astCtxt->bvnot(op4)), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVA operation");
@@ -3324,7 +3520,7 @@ namespace triton {
       void x86Semantics::cmovae_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3332,7 +3528,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVAE operation");
@@ -3353,7 +3549,7 @@ namespace triton {
       void x86Semantics::cmovb_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3361,7 +3557,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVB operation");
@@ -3382,8 +3578,8 @@ namespace triton {
       void x86Semantics::cmovbe_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3392,7 +3588,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(op3, op4), triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(op3, op4), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVBE operation");
@@ -3413,7 +3609,7 @@ namespace triton {
       void x86Semantics::cmove_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3421,7 +3617,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVE operation");
@@ -3442,9 +3638,9 @@ namespace triton {
       void x86Semantics::cmovg_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3454,7 +3650,7 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op3, op4), op5), triton::ast::bvfalse()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op3, op4), op5), this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVG operation");
@@ -3475,8 +3671,8 @@ namespace triton {
       void x86Semantics::cmovge_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3485,7 +3681,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, op4), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, op4), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVGE operation");
@@ -3506,8 +3702,8 @@ namespace triton {
       void x86Semantics::cmovl_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3516,7 +3712,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvxor(op3, op4), triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvxor(op3, op4), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVL operation");
@@ -3537,9 +3733,9 @@ namespace triton {
       void x86Semantics::cmovle_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3549,7 +3745,7 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op3, op4), op5), triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op3, op4), op5), this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVBE operation");
@@ -3570,7 +3766,7 @@ namespace triton {
       void x86Semantics::cmovne_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3578,7 +3774,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNE operation");
@@ -3599,7 +3795,7 @@ namespace triton {
       void x86Semantics::cmovno_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3607,7 +3803,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNO operation");
@@ -3628,7 +3824,7 @@ namespace triton {
       void x86Semantics::cmovnp_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto  pf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3636,7 +3832,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, pf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNP operation");
@@ -3657,7 +3853,7 @@ namespace triton {
       void x86Semantics::cmovns_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3665,7 +3861,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvfalse()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvfalse()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVNS operation");
@@ -3686,7 +3882,7 @@ namespace triton {
       void x86Semantics::cmovo_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3694,7 +3890,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVO operation");
@@ -3715,7 +3911,7 @@ namespace triton {
       void x86Semantics::cmovp_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto  pf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3723,7 +3919,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, pf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVP operation");
@@ -3744,7 +3940,7 @@ namespace triton {
       void x86Semantics::cmovs_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -3752,7 +3948,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op3, triton::ast::bvtrue()), op2, op1);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op3, this->astCtxt->bvtrue()), op2, op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CMOVS operation");
@@ -3776,10 +3972,10 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::sx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op2 = this->astCtxt->sx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
 
         /* Create the semantics */
-        auto node = triton::ast::bvsub(op1, op2);
+        auto node = this->astCtxt->bvsub(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "CMP operation");
@@ -3803,9 +3999,9 @@ namespace triton {
       void x86Semantics::cmpsb_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -3819,16 +4015,16 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(BYTE_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(BYTE_SIZE, index1.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(BYTE_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(BYTE_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op4, triton::ast::bv(BYTE_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op4, triton::ast::bv(BYTE_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op4, this->astCtxt->bv(BYTE_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op4, this->astCtxt->bv(BYTE_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -3857,9 +4053,9 @@ namespace triton {
       void x86Semantics::cmpsd_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -3873,16 +4069,16 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(DWORD_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(DWORD_SIZE, index1.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(DWORD_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(DWORD_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op4, triton::ast::bv(DWORD_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op4, triton::ast::bv(DWORD_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op4, this->astCtxt->bv(DWORD_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op4, this->astCtxt->bv(DWORD_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -3911,9 +4107,9 @@ namespace triton {
       void x86Semantics::cmpsq_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -3927,16 +4123,16 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(QWORD_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(QWORD_SIZE, index1.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(QWORD_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(QWORD_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op4, triton::ast::bv(QWORD_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op4, triton::ast::bv(QWORD_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op4, this->astCtxt->bv(QWORD_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op4, this->astCtxt->bv(QWORD_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -3965,9 +4161,9 @@ namespace triton {
       void x86Semantics::cmpsw_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -3981,16 +4177,16 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(WORD_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(WORD_SIZE, index1.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(WORD_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(WORD_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op5, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op4, triton::ast::bv(WORD_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op4, triton::ast::bv(WORD_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op5, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op4, this->astCtxt->bv(WORD_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op4, this->astCtxt->bv(WORD_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -4019,22 +4215,22 @@ namespace triton {
       void x86Semantics::cmpxchg_s(triton::arch::Instruction& inst) {
         auto& src1  = inst.operands[0];
         auto& src2  = inst.operands[1];
-        auto src1p  = inst.operands[0].getRegister().getParent();
-        auto src2p  = inst.operands[1].getRegister().getParent();;
+        auto src1p  = this->architecture->getParentRegister(inst.operands[0].getRegister());
+        auto src2p  = this->architecture->getParentRegister(inst.operands[1].getRegister());;
 
         /* Create the tempory accumulator */
-        triton::arch::OperandWrapper accumulator(TRITON_X86_REG_AL);
-        triton::arch::OperandWrapper accumulatorp(TRITON_X86_REG_AL.getParent());
+        triton::arch::OperandWrapper accumulator(this->architecture->getRegister(triton::arch::x86::ID_REG_AL));
+        triton::arch::OperandWrapper accumulatorp(this->architecture->getParentRegister(triton::arch::x86::ID_REG_AL));
 
         switch (src1.getSize()) {
           case WORD_SIZE:
-            accumulator.setRegister(TRITON_X86_REG_AX);
+            accumulator.setRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
             break;
           case DWORD_SIZE:
-            accumulator.setRegister(TRITON_X86_REG_EAX);
+            accumulator.setRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
             break;
           case QWORD_SIZE:
-            accumulator.setRegister(TRITON_X86_REG_RAX);
+            accumulator.setRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
             break;
         }
 
@@ -4043,16 +4239,16 @@ namespace triton {
         auto op2  = this->symbolicEngine->buildSymbolicOperand(inst, src1);
         auto op3  = this->symbolicEngine->buildSymbolicOperand(inst, src2);
         auto op1p = this->symbolicEngine->buildSymbolicOperand(accumulatorp);
-        auto op2p = this->symbolicEngine->buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? src1.getRegister().getParent() : accumulatorp.getRegister()));
-        auto op3p = this->symbolicEngine->buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? src2.getRegister().getParent() : accumulatorp.getRegister()));
+        auto op2p = this->symbolicEngine->buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? this->architecture->getParentRegister(src1.getRegister()) : accumulatorp.getRegister()));
+        auto op3p = this->symbolicEngine->buildSymbolicRegister((src1.getType() == triton::arch::OP_REG ? this->architecture->getParentRegister(src2.getRegister()) : accumulatorp.getRegister()));
 
         /* Create the semantics */
-        auto nodeq  = triton::ast::equal(op1, op2);
-        auto node1  = triton::ast::bvsub(op1, op2);
-        auto node2  = triton::ast::ite(nodeq, op3, op2);
-        auto node3  = triton::ast::ite(nodeq, op1, op2);
-        auto node2p = triton::ast::ite(nodeq, op3p, op2p);
-        auto node3p = triton::ast::ite(nodeq, op1p, op2p);
+        auto nodeq  = this->astCtxt->equal(op1, op2);
+        auto node1  = this->astCtxt->bvsub(op1, op2);
+        auto node2  = this->astCtxt->ite(nodeq, op3, op2);
+        auto node3  = this->astCtxt->ite(nodeq, op1, op2);
+        auto node2p = this->astCtxt->ite(nodeq, op3p, op2p);
+        auto node3p = this->astCtxt->ite(nodeq, op1p, op2p);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "CMP operation");
@@ -4100,10 +4296,10 @@ namespace triton {
 
       void x86Semantics::cmpxchg16b_s(triton::arch::Instruction& inst) {
         auto& src1 = inst.operands[0];
-        auto  src2 = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
-        auto  src3 = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-        auto  src4 = triton::arch::OperandWrapper(TRITON_X86_REG_RCX);
-        auto  src5 = triton::arch::OperandWrapper(TRITON_X86_REG_RBX);
+        auto  src2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
+        auto  src3 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
+        auto  src4 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RCX));
+        auto  src5 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RBX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
@@ -4114,17 +4310,17 @@ namespace triton {
 
         /* Create the semantics */
         /* CMP8B */
-        auto node1 = triton::ast::bvsub(triton::ast::concat(op2, op3), op1);
+        auto node1 = this->astCtxt->bvsub(this->astCtxt->concat(op2, op3), op1);
         /* Destination */
-        auto node2 = triton::ast::ite(triton::ast::equal(node1, triton::ast::bv(0, DQWORD_SIZE_BIT)), triton::ast::concat(op4, op5), op1);
+        auto node2 = this->astCtxt->ite(this->astCtxt->equal(node1, this->astCtxt->bv(0, DQWORD_SIZE_BIT)), this->astCtxt->concat(op4, op5), op1);
         /* EDX:EAX */
-        auto node3 = triton::ast::ite(triton::ast::equal(node1, triton::ast::bv(0, DQWORD_SIZE_BIT)), triton::ast::concat(op2, op3), op1);
+        auto node3 = this->astCtxt->ite(this->astCtxt->equal(node1, this->astCtxt->bv(0, DQWORD_SIZE_BIT)), this->astCtxt->concat(op2, op3), op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "CMP operation");
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, src1, "XCHG16B memory operation");
-        auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(127, 64, node3), src2, "XCHG16B RDX operation");
-        auto expr4 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(63, 0, node3), src3, "XCHG16B RAX operation");
+        auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(127, 64, node3), src2, "XCHG16B RDX operation");
+        auto expr4 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(63, 0, node3), src3, "XCHG16B RAX operation");
 
         /* Spread taint */
         expr1->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3);
@@ -4142,12 +4338,12 @@ namespace triton {
 
       void x86Semantics::cmpxchg8b_s(triton::arch::Instruction& inst) {
         auto& src1  = inst.operands[0];
-        auto  src2  = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-        auto  src3  = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-        auto  src4  = triton::arch::OperandWrapper(TRITON_X86_REG_ECX);
-        auto  src5  = triton::arch::OperandWrapper(TRITON_X86_REG_EBX);
-        auto  src2p = triton::arch::OperandWrapper(TRITON_X86_REG_EDX.getParent());
-        auto  src3p = triton::arch::OperandWrapper(TRITON_X86_REG_EAX.getParent());
+        auto  src2  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+        auto  src3  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
+        auto  src4  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ECX));
+        auto  src5  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EBX));
+        auto  src2p = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_EDX));
+        auto  src3p = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_EAX));
 
         /* Create symbolic operands */
         auto op1  = this->symbolicEngine->buildSymbolicOperand(inst, src1);
@@ -4160,17 +4356,17 @@ namespace triton {
 
         /* Create the semantics */
         /* CMP8B */
-        auto node1 = triton::ast::bvsub(triton::ast::concat(op2, op3), op1);
+        auto node1 = this->astCtxt->bvsub(this->astCtxt->concat(op2, op3), op1);
         /* Destination */
-        auto node2 = triton::ast::ite(triton::ast::equal(node1, triton::ast::bv(0, QWORD_SIZE_BIT)), triton::ast::concat(op4, op5), op1);
+        auto node2 = this->astCtxt->ite(this->astCtxt->equal(node1, this->astCtxt->bv(0, QWORD_SIZE_BIT)), this->astCtxt->concat(op4, op5), op1);
         /* EDX:EAX */
-        auto node3  = triton::ast::ite(triton::ast::equal(node1, triton::ast::bv(0, QWORD_SIZE_BIT)), triton::ast::concat(op2, op3), op1);
-        auto node3p = triton::ast::ite(
-                        triton::ast::equal(
+        auto node3  = this->astCtxt->ite(this->astCtxt->equal(node1, this->astCtxt->bv(0, QWORD_SIZE_BIT)), this->astCtxt->concat(op2, op3), op1);
+        auto node3p = this->astCtxt->ite(
+                        this->astCtxt->equal(
                           node1,
-                          triton::ast::bv(0, QWORD_SIZE_BIT)),
-                          triton::ast::concat(op2p, op3p),
-                          triton::ast::zx(src2p.getBitSize() + src3p.getBitSize() - src1.getBitSize(), op1)
+                          this->astCtxt->bv(0, QWORD_SIZE_BIT)),
+                          this->astCtxt->concat(op2p, op3p),
+                          this->astCtxt->zx(src2p.getBitSize() + src3p.getBitSize() - src1.getBitSize(), op1)
                       );
 
         /* Create symbolic expression */
@@ -4184,15 +4380,15 @@ namespace triton {
 
         /* EDX */
         if (node1->evaluate() == 0)
-          expr5 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract((src2p.getBitSize() * 2 - 1), src2p.getBitSize(), node3p), src2p, "XCHG8B EDX operation");
+          expr5 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract((src2p.getBitSize() * 2 - 1), src2p.getBitSize(), node3p), src2p, "XCHG8B EDX operation");
         else
-          expr5 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(63, 32, node3), src2, "XCHG8B EDX operation");
+          expr5 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(63, 32, node3), src2, "XCHG8B EDX operation");
 
         /* EAX */
         if (node1->evaluate() == 0)
-          expr6 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(src2p.getBitSize() - 1, 0, node3p), src3p, "XCHG8B EAX operation");
+          expr6 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(src2p.getBitSize() - 1, 0, node3p), src3p, "XCHG8B EAX operation");
         else
-          expr6 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(31, 0, node3), src3, "XCHG8B EAX operation");
+          expr6 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(31, 0, node3), src3, "XCHG8B EAX operation");
 
         /* Spread taint */
         expr1->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2) | this->taintEngine->isTainted(src3);
@@ -4211,11 +4407,11 @@ namespace triton {
 
 
       void x86Semantics::cpuid_s(triton::arch::Instruction& inst) {
-        auto src  = triton::arch::OperandWrapper(TRITON_X86_REG_AX.getParent());
-        auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_AX.getParent());
-        auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_BX.getParent());
-        auto dst3 = triton::arch::OperandWrapper(TRITON_X86_REG_CX.getParent());
-        auto dst4 = triton::arch::OperandWrapper(TRITON_X86_REG_DX.getParent());
+        auto src  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_AX));
+        auto dst1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_AX));
+        auto dst2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_BX));
+        auto dst3 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_CX));
+        auto dst4 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -4229,100 +4425,100 @@ namespace triton {
         /* In this case, we concretize the AX option */
         switch (op1->evaluate().convert_to<triton::uint32>()) {
           case 0:
-            node1 = triton::ast::bv(0x0000000d, dst1.getBitSize());
-            node2 = triton::ast::bv(0x756e6547, dst2.getBitSize());
-            node3 = triton::ast::bv(0x6c65746e, dst3.getBitSize());
-            node4 = triton::ast::bv(0x49656e69, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x0000000d, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x756e6547, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x6c65746e, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x49656e69, dst4.getBitSize());
             break;
           case 1:
-            node1 = triton::ast::bv(0x000306a9, dst1.getBitSize());
-            node2 = triton::ast::bv(0x02100800, dst2.getBitSize());
-            node3 = triton::ast::bv(0x7fbae3ff, dst3.getBitSize());
-            node4 = triton::ast::bv(0xbfebfbff, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x000306a9, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x02100800, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x7fbae3ff, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0xbfebfbff, dst4.getBitSize());
             break;
           case 2:
-            node1 = triton::ast::bv(0x76035a01, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00f0b2ff, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000000, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00ca0000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x76035a01, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00f0b2ff, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000000, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00ca0000, dst4.getBitSize());
             break;
           case 3:
-            node1 = triton::ast::bv(0x00000000, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000000, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000000, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000000, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
           case 4:
-            node1 = triton::ast::bv(0x1c004121, dst1.getBitSize());
-            node2 = triton::ast::bv(0x01c0003f, dst2.getBitSize());
-            node3 = triton::ast::bv(0x0000003f, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x1c004121, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x01c0003f, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x0000003f, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
           case 5:
-            node1 = triton::ast::bv(0x00000040, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000040, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000003, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00021120, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000040, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000040, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000003, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00021120, dst4.getBitSize());
             break;
           case 0x80000000:
-            node1 = triton::ast::bv(0x80000008, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000000, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x80000008, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000000, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
           case 0x80000001:
-            node1 = triton::ast::bv(0x00000000, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000001, dst3.getBitSize());
-            node4 = triton::ast::bv(0x28100800, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000000, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000001, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x28100800, dst4.getBitSize());
             break;
           case 0x80000002:
-            node1 = triton::ast::bv(0x20202020, dst1.getBitSize());
-            node2 = triton::ast::bv(0x49202020, dst2.getBitSize());
-            node3 = triton::ast::bv(0x6c65746e, dst3.getBitSize());
-            node4 = triton::ast::bv(0x20295228, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x20202020, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x49202020, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x6c65746e, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x20295228, dst4.getBitSize());
             break;
           case 0x80000003:
-            node1 = triton::ast::bv(0x65726f43, dst1.getBitSize());
-            node2 = triton::ast::bv(0x294d5428, dst2.getBitSize());
-            node3 = triton::ast::bv(0x2d376920, dst3.getBitSize());
-            node4 = triton::ast::bv(0x30323533, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x65726f43, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x294d5428, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x2d376920, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x30323533, dst4.getBitSize());
             break;
           case 0x80000004:
-            node1 = triton::ast::bv(0x5043204d, dst1.getBitSize());
-            node2 = triton::ast::bv(0x20402055, dst2.getBitSize());
-            node3 = triton::ast::bv(0x30392e32, dst3.getBitSize());
-            node4 = triton::ast::bv(0x007a4847, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x5043204d, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x20402055, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x30392e32, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x007a4847, dst4.getBitSize());
             break;
           case 0x80000005:
-            node1 = triton::ast::bv(0x00000000, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000000, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000000, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000000, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
           case 0x80000006:
-            node1 = triton::ast::bv(0x00000000, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x01006040, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000000, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x01006040, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
           case 0x80000007:
-            node1 = triton::ast::bv(0x00000000, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000000, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000100, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000000, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000000, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000100, dst4.getBitSize());
             break;
           case 0x80000008:
-            node1 = triton::ast::bv(0x00003024, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000000, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000000, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00003024, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000000, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000000, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
           default:
-            node1 = triton::ast::bv(0x00000007, dst1.getBitSize());
-            node2 = triton::ast::bv(0x00000340, dst2.getBitSize());
-            node3 = triton::ast::bv(0x00000340, dst3.getBitSize());
-            node4 = triton::ast::bv(0x00000000, dst4.getBitSize());
+            node1 = this->astCtxt->bv(0x00000007, dst1.getBitSize());
+            node2 = this->astCtxt->bv(0x00000340, dst2.getBitSize());
+            node3 = this->astCtxt->bv(0x00000340, dst3.getBitSize());
+            node4 = this->astCtxt->bv(0x00000000, dst4.getBitSize());
             break;
         }
 
@@ -4333,10 +4529,10 @@ namespace triton {
         auto expr4 = this->symbolicEngine->createSymbolicExpression(inst, node4, dst4, "CPUID DX operation");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AX.getParent(), false);
-        expr2->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_BX.getParent(), false);
-        expr3->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CX.getParent(), false);
-        expr4->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_DX.getParent(), false);
+        expr1->isTainted = this->taintEngine->setTaintRegister(this->architecture->getParentRegister(triton::arch::x86::ID_REG_AX), false);
+        expr2->isTainted = this->taintEngine->setTaintRegister(this->architecture->getParentRegister(triton::arch::x86::ID_REG_BX), false);
+        expr3->isTainted = this->taintEngine->setTaintRegister(this->architecture->getParentRegister(triton::arch::x86::ID_REG_CX), false);
+        expr4->isTainted = this->taintEngine->setTaintRegister(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DX), false);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -4344,38 +4540,38 @@ namespace triton {
 
 
       void x86Semantics::cqo_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
-        auto src = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
+        auto src = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics - TMP = 128 bitvec (RDX:RAX) */
-        auto node1 = triton::ast::sx(QWORD_SIZE_BIT, op1);
+        auto node1 = this->astCtxt->sx(QWORD_SIZE_BIT, op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "Temporary variable");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isRegisterTainted(TRITON_X86_REG_RDX) | this->taintEngine->isRegisterTainted(TRITON_X86_REG_RAX);
+        expr1->isTainted = this->taintEngine->isRegisterTainted(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX)) | this->taintEngine->isRegisterTainted(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
 
         /* Create the semantics - RAX = TMP[63...0] */
-        auto node2 = triton::ast::extract(QWORD_SIZE_BIT-1, 0, triton::ast::reference(expr1->getId()));
+        auto node2 = this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, this->astCtxt->reference(expr1->getId()));
 
         /* Create symbolic expression */
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, src, "CQO RAX operation");
 
         /* Spread taint */
-        expr2->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_RAX, expr1->isTainted);
+        expr2->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX), expr1->isTainted);
 
         /* Create the semantics - RDX = TMP[127...64] */
-        auto node3 = triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
+        auto node3 = this->astCtxt->extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, this->astCtxt->reference(expr1->getId()));
 
         /* Create symbolic expression */
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, dst, "CQO RDX operation");
 
         /* Spread taint */
-        expr3->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_RDX, expr1->isTainted);
+        expr3->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX), expr1->isTainted);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -4383,38 +4579,38 @@ namespace triton {
 
 
       void x86Semantics::cwd_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
-        auto src = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DX));
+        auto src = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics - TMP = 32 bitvec (DX:AX) */
-        auto node1 = triton::ast::sx(WORD_SIZE_BIT, op1);
+        auto node1 = this->astCtxt->sx(WORD_SIZE_BIT, op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "Temporary variable");
 
         /* Spread taint */
-        expr1->isTainted = this->taintEngine->isRegisterTainted(TRITON_X86_REG_DX) | this->taintEngine->isRegisterTainted(TRITON_X86_REG_AX);
+        expr1->isTainted = this->taintEngine->isRegisterTainted(this->architecture->getRegister(triton::arch::x86::ID_REG_DX)) | this->taintEngine->isRegisterTainted(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
 
         /* Create the semantics - AX = TMP[15...0] */
-        auto node2 = triton::ast::extract(WORD_SIZE_BIT-1, 0, triton::ast::reference(expr1->getId()));
+        auto node2 = this->astCtxt->extract(WORD_SIZE_BIT-1, 0, this->astCtxt->reference(expr1->getId()));
 
         /* Create symbolic expression */
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, src, "CWD AX operation");
 
         /* Spread taint */
-        expr2->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AX, expr1->isTainted);
+        expr2->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_AX), expr1->isTainted);
 
         /* Create the semantics - DX = TMP[31...16] */
-        auto node3 = triton::ast::extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, triton::ast::reference(expr1->getId()));
+        auto node3 = this->astCtxt->extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, this->astCtxt->reference(expr1->getId()));
 
         /* Create symbolic expression */
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, dst, "CWD DX operation");
 
         /* Spread taint */
-        expr3->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_DX, expr1->isTainted);
+        expr3->isTainted = this->taintEngine->setTaintRegister(this->architecture->getRegister(triton::arch::x86::ID_REG_DX), expr1->isTainted);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -4422,13 +4618,13 @@ namespace triton {
 
 
       void x86Semantics::cwde_s(triton::arch::Instruction& inst) {
-        auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
+        auto dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
 
         /* Create the semantics */
-        auto node = triton::ast::sx(WORD_SIZE_BIT, triton::ast::extract(WORD_SIZE_BIT-1, 0, op1));
+        auto node = this->astCtxt->sx(WORD_SIZE_BIT, this->astCtxt->extract(WORD_SIZE_BIT-1, 0, op1));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "CWDE operation");
@@ -4446,10 +4642,10 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::bv(1, dst.getBitSize());
+        auto op2 = this->astCtxt->bv(1, dst.getBitSize());
 
         /* Create the semantics */
-        auto node = triton::ast::bvsub(op1, op2);
+        auto node = this->astCtxt->bvsub(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "DEC operation");
@@ -4480,17 +4676,17 @@ namespace triton {
 
           case BYTE_SIZE: {
             /* AX */
-            auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
+            auto ax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
             auto dividend = this->symbolicEngine->buildSymbolicOperand(inst, ax);
             /* res = AX / Source */
-            auto result = triton::ast::bvudiv(dividend, triton::ast::zx(BYTE_SIZE_BIT, divisor));
+            auto result = this->astCtxt->bvudiv(dividend, this->astCtxt->zx(BYTE_SIZE_BIT, divisor));
             /* mod = AX % Source */
-            auto mod = triton::ast::bvurem(dividend, triton::ast::zx(BYTE_SIZE_BIT, divisor));
+            auto mod = this->astCtxt->bvurem(dividend, this->astCtxt->zx(BYTE_SIZE_BIT, divisor));
             /* AH = mod */
             /* AL = res */
-            auto node = triton::ast::concat(
-                          triton::ast::extract((BYTE_SIZE_BIT - 1), 0, mod),   /* AH = mod */
-                          triton::ast::extract((BYTE_SIZE_BIT - 1), 0, result) /* AL = res */
+            auto node = this->astCtxt->concat(
+                          this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, mod),   /* AH = mod */
+                          this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, result) /* AL = res */
                         );
             /* Create symbolic expression */
             auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, ax, "DIV operation");
@@ -4501,13 +4697,13 @@ namespace triton {
 
           case WORD_SIZE: {
             /* DX:AX */
-            auto dx = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
-            auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-            auto dividend = triton::ast::concat(this->symbolicEngine->buildSymbolicOperand(inst, dx), this->symbolicEngine->buildSymbolicOperand(inst, ax));
+            auto dx = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DX));
+            auto ax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+            auto dividend = this->astCtxt->concat(this->symbolicEngine->buildSymbolicOperand(inst, dx), this->symbolicEngine->buildSymbolicOperand(inst, ax));
             /* res = DX:AX / Source */
-            auto result = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvudiv(dividend, triton::ast::zx(WORD_SIZE_BIT, divisor)));
+            auto result = this->astCtxt->extract((WORD_SIZE_BIT - 1), 0, this->astCtxt->bvudiv(dividend, this->astCtxt->zx(WORD_SIZE_BIT, divisor)));
             /* mod = DX:AX % Source */
-            auto mod = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvurem(dividend, triton::ast::zx(WORD_SIZE_BIT, divisor)));
+            auto mod = this->astCtxt->extract((WORD_SIZE_BIT - 1), 0, this->astCtxt->bvurem(dividend, this->astCtxt->zx(WORD_SIZE_BIT, divisor)));
             /* Create the symbolic expression for AX */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, result, ax, "DIV operation");
             /* Apply the taint for AX */
@@ -4521,13 +4717,13 @@ namespace triton {
 
           case DWORD_SIZE: {
             /* EDX:EAX */
-            auto edx = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-            auto eax = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-            auto dividend = triton::ast::concat(this->symbolicEngine->buildSymbolicOperand(inst, edx), this->symbolicEngine->buildSymbolicOperand(inst, eax));
+            auto edx = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+            auto eax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
+            auto dividend = this->astCtxt->concat(this->symbolicEngine->buildSymbolicOperand(inst, edx), this->symbolicEngine->buildSymbolicOperand(inst, eax));
             /* res = EDX:EAX / Source */
-            auto result = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvudiv(dividend, triton::ast::zx(DWORD_SIZE_BIT, divisor)));
+            auto result = this->astCtxt->extract((DWORD_SIZE_BIT - 1), 0, this->astCtxt->bvudiv(dividend, this->astCtxt->zx(DWORD_SIZE_BIT, divisor)));
             /* mod = EDX:EAX % Source */
-            auto mod = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvurem(dividend, triton::ast::zx(DWORD_SIZE_BIT, divisor)));
+            auto mod = this->astCtxt->extract((DWORD_SIZE_BIT - 1), 0, this->astCtxt->bvurem(dividend, this->astCtxt->zx(DWORD_SIZE_BIT, divisor)));
             /* Create the symbolic expression for EAX */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, result, eax, "DIV operation");
             /* Apply the taint for EAX */
@@ -4541,13 +4737,13 @@ namespace triton {
 
           case QWORD_SIZE: {
             /* RDX:RAX */
-            auto rdx = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
-            auto rax = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-            auto dividend = triton::ast::concat(this->symbolicEngine->buildSymbolicOperand(inst, rdx), this->symbolicEngine->buildSymbolicOperand(inst, rax));
+            auto rdx = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
+            auto rax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
+            auto dividend = this->astCtxt->concat(this->symbolicEngine->buildSymbolicOperand(inst, rdx), this->symbolicEngine->buildSymbolicOperand(inst, rax));
             /* res = RDX:RAX / Source */
-            auto result = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvudiv(dividend, triton::ast::zx(QWORD_SIZE_BIT, divisor)));
+            auto result = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, this->astCtxt->bvudiv(dividend, this->astCtxt->zx(QWORD_SIZE_BIT, divisor)));
             /* mod = RDX:RAX % Source */
-            auto mod = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvurem(dividend, triton::ast::zx(QWORD_SIZE_BIT, divisor)));
+            auto mod = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, this->astCtxt->bvurem(dividend, this->astCtxt->zx(QWORD_SIZE_BIT, divisor)));
             /* Create the symbolic expression for RAX */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, result, rax, "DIV operation");
             /* Apply the taint for EAX */
@@ -4576,12 +4772,12 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::extract(DWORD_SIZE_BIT-1, 0,
-                      triton::ast::bvlshr(
+        auto node = this->astCtxt->extract(DWORD_SIZE_BIT-1, 0,
+                      this->astCtxt->bvlshr(
                         op2,
-                        triton::ast::bvmul(
-                          triton::ast::zx(126, triton::ast::extract(1, 0, op3)),
-                          triton::ast::bv(DWORD_SIZE_BIT, DQWORD_SIZE_BIT)
+                        this->astCtxt->bvmul(
+                          this->astCtxt->zx(126, this->astCtxt->extract(1, 0, op3)),
+                          this->astCtxt->bv(DWORD_SIZE_BIT, DQWORD_SIZE_BIT)
                         )
                       )
                     );
@@ -4590,7 +4786,7 @@ namespace triton {
           case DWORD_SIZE_BIT:
             break;
           case QWORD_SIZE_BIT:
-            node = triton::ast::zx(DWORD_SIZE_BIT, node);
+            node = this->astCtxt->zx(DWORD_SIZE_BIT, node);
             break;
           default:
             throw triton::exceptions::Semantics("x86Semantics::extractps_s(): Invalid destination operand.");
@@ -4618,17 +4814,17 @@ namespace triton {
 
           case BYTE_SIZE: {
             /* AX */
-            auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
+            auto ax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
             auto dividend = this->symbolicEngine->buildSymbolicOperand(inst, ax);
             /* res = AX / Source */
-            auto result = triton::ast::bvsdiv(dividend, triton::ast::sx(BYTE_SIZE_BIT, divisor));
+            auto result = this->astCtxt->bvsdiv(dividend, this->astCtxt->sx(BYTE_SIZE_BIT, divisor));
             /* mod = AX % Source */
-            auto mod = triton::ast::bvsrem(dividend, triton::ast::sx(BYTE_SIZE_BIT, divisor));
+            auto mod = this->astCtxt->bvsrem(dividend, this->astCtxt->sx(BYTE_SIZE_BIT, divisor));
             /* AH = mod */
             /* AL = res */
-            auto node = triton::ast::concat(
-                          triton::ast::extract((BYTE_SIZE_BIT - 1), 0, mod),   /* AH = mod */
-                          triton::ast::extract((BYTE_SIZE_BIT - 1), 0, result) /* AL = res */
+            auto node = this->astCtxt->concat(
+                          this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, mod),   /* AH = mod */
+                          this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, result) /* AL = res */
                         );
             /* Create symbolic expression */
             auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, ax, "IDIV operation");
@@ -4639,13 +4835,13 @@ namespace triton {
 
           case WORD_SIZE: {
             /* DX:AX */
-            auto dx = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
-            auto ax = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-            auto dividend = triton::ast::concat(this->symbolicEngine->buildSymbolicOperand(inst, dx), this->symbolicEngine->buildSymbolicOperand(inst, ax));
+            auto dx = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DX));
+            auto ax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+            auto dividend = this->astCtxt->concat(this->symbolicEngine->buildSymbolicOperand(inst, dx), this->symbolicEngine->buildSymbolicOperand(inst, ax));
             /* res = DX:AX / Source */
-            auto result = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvsdiv(dividend, triton::ast::sx(WORD_SIZE_BIT, divisor)));
+            auto result = this->astCtxt->extract((WORD_SIZE_BIT - 1), 0, this->astCtxt->bvsdiv(dividend, this->astCtxt->sx(WORD_SIZE_BIT, divisor)));
             /* mod = DX:AX % Source */
-            auto mod = triton::ast::extract((WORD_SIZE_BIT - 1), 0, triton::ast::bvsrem(dividend, triton::ast::sx(WORD_SIZE_BIT, divisor)));
+            auto mod = this->astCtxt->extract((WORD_SIZE_BIT - 1), 0, this->astCtxt->bvsrem(dividend, this->astCtxt->sx(WORD_SIZE_BIT, divisor)));
             /* Create the symbolic expression for AX */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, result, ax, "IDIV operation");
             /* Apply the taint for AX */
@@ -4659,13 +4855,13 @@ namespace triton {
 
           case DWORD_SIZE: {
             /* EDX:EAX */
-            auto edx = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-            auto eax = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-            auto dividend = triton::ast::concat(this->symbolicEngine->buildSymbolicOperand(inst, edx), this->symbolicEngine->buildSymbolicOperand(inst, eax));
+            auto edx = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+            auto eax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
+            auto dividend = this->astCtxt->concat(this->symbolicEngine->buildSymbolicOperand(inst, edx), this->symbolicEngine->buildSymbolicOperand(inst, eax));
             /* res = EDX:EAX / Source */
-            auto result = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvsdiv(dividend, triton::ast::sx(DWORD_SIZE_BIT, divisor)));
+            auto result = this->astCtxt->extract((DWORD_SIZE_BIT - 1), 0, this->astCtxt->bvsdiv(dividend, this->astCtxt->sx(DWORD_SIZE_BIT, divisor)));
             /* mod = EDX:EAX % Source */
-            auto mod = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, triton::ast::bvsrem(dividend, triton::ast::sx(DWORD_SIZE_BIT, divisor)));
+            auto mod = this->astCtxt->extract((DWORD_SIZE_BIT - 1), 0, this->astCtxt->bvsrem(dividend, this->astCtxt->sx(DWORD_SIZE_BIT, divisor)));
             /* Create the symbolic expression for EAX */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, result, eax, "IDIV operation");
             /* Apply the taint for EAX */
@@ -4679,13 +4875,13 @@ namespace triton {
 
           case QWORD_SIZE: {
             /* RDX:RAX */
-            auto rdx = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
-            auto rax = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-            auto dividend = triton::ast::concat(this->symbolicEngine->buildSymbolicOperand(inst, rdx), this->symbolicEngine->buildSymbolicOperand(inst, rax));
+            auto rdx = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
+            auto rax = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
+            auto dividend = this->astCtxt->concat(this->symbolicEngine->buildSymbolicOperand(inst, rdx), this->symbolicEngine->buildSymbolicOperand(inst, rax));
             /* res = RDX:RAX / Source */
-            auto result = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvsdiv(dividend, triton::ast::sx(QWORD_SIZE_BIT, divisor)));
+            auto result = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, this->astCtxt->bvsdiv(dividend, this->astCtxt->sx(QWORD_SIZE_BIT, divisor)));
             /* mod = RDX:RAX % Source */
-            auto mod = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, triton::ast::bvsrem(dividend, triton::ast::sx(QWORD_SIZE_BIT, divisor)));
+            auto mod = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, this->astCtxt->bvsrem(dividend, this->astCtxt->sx(QWORD_SIZE_BIT, divisor)));
             /* Create the symbolic expression for RAX */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, result, rax, "IDIV operation");
             /* Apply the taint for EAX */
@@ -4716,63 +4912,63 @@ namespace triton {
 
               /* dst = AX */
               case BYTE_SIZE: {
-                auto ax   = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-                auto al   = triton::arch::OperandWrapper(TRITON_X86_REG_AL);
+                auto ax   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+                auto al   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AL));
                 auto op1  = this->symbolicEngine->buildSymbolicOperand(inst, al);
                 auto op2  = this->symbolicEngine->buildSymbolicOperand(inst, src);
-                auto node = triton::ast::bvmul(triton::ast::sx(BYTE_SIZE_BIT, op1), triton::ast::sx(BYTE_SIZE_BIT, op2));
+                auto node = this->astCtxt->bvmul(this->astCtxt->sx(BYTE_SIZE_BIT, op1), this->astCtxt->sx(BYTE_SIZE_BIT, op2));
                 auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, ax, "IMUL operation");
                 expr->isTainted = this->taintEngine->taintUnion(ax, src);
-                this->cfImul_s(inst, expr, al, triton::ast::bvmul(op1, op2), node);
-                this->ofImul_s(inst, expr, al, triton::ast::bvmul(op1, op2), node);
+                this->cfImul_s(inst, expr, al, this->astCtxt->bvmul(op1, op2), node);
+                this->ofImul_s(inst, expr, al, this->astCtxt->bvmul(op1, op2), node);
                 break;
               }
 
               /* dst = DX:AX */
               case WORD_SIZE: {
-                auto ax    = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-                auto dx    = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
+                auto ax    = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+                auto dx    = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DX));
                 auto op1   = this->symbolicEngine->buildSymbolicOperand(inst, ax);
                 auto op2   = this->symbolicEngine->buildSymbolicOperand(inst, src);
-                auto node  = triton::ast::bvmul(triton::ast::sx(WORD_SIZE_BIT, op1), triton::ast::sx(WORD_SIZE_BIT, op2));
-                auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(WORD_SIZE_BIT-1, 0, node), ax, "IMUL operation");
-                auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, node), dx, "IMUL operation");
+                auto node  = this->astCtxt->bvmul(this->astCtxt->sx(WORD_SIZE_BIT, op1), this->astCtxt->sx(WORD_SIZE_BIT, op2));
+                auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(WORD_SIZE_BIT-1, 0, node), ax, "IMUL operation");
+                auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(DWORD_SIZE_BIT-1, WORD_SIZE_BIT, node), dx, "IMUL operation");
                 expr1->isTainted = this->taintEngine->taintUnion(ax, src);
                 expr2->isTainted = this->taintEngine->taintUnion(dx, ax);
-                this->cfImul_s(inst, expr1, ax, triton::ast::bvmul(op1, op2), node);
-                this->ofImul_s(inst, expr1, ax, triton::ast::bvmul(op1, op2), node);
+                this->cfImul_s(inst, expr1, ax, this->astCtxt->bvmul(op1, op2), node);
+                this->ofImul_s(inst, expr1, ax, this->astCtxt->bvmul(op1, op2), node);
                 break;
               }
 
               /* dst = EDX:EAX */
               case DWORD_SIZE: {
-                auto eax   = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-                auto edx   = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
+                auto eax   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
+                auto edx   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
                 auto op1   = this->symbolicEngine->buildSymbolicOperand(inst, eax);
                 auto op2   = this->symbolicEngine->buildSymbolicOperand(inst, src);
-                auto node  = triton::ast::bvmul(triton::ast::sx(DWORD_SIZE_BIT, op1), triton::ast::sx(DWORD_SIZE_BIT, op2));
-                auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(DWORD_SIZE_BIT-1, 0, node), eax, "IMUL operation");
-                auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, node), edx, "IMUL operation");
+                auto node  = this->astCtxt->bvmul(this->astCtxt->sx(DWORD_SIZE_BIT, op1), this->astCtxt->sx(DWORD_SIZE_BIT, op2));
+                auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, node), eax, "IMUL operation");
+                auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(QWORD_SIZE_BIT-1, DWORD_SIZE_BIT, node), edx, "IMUL operation");
                 expr1->isTainted = this->taintEngine->taintUnion(eax, src);
                 expr2->isTainted = this->taintEngine->taintUnion(edx, eax);
-                this->cfImul_s(inst, expr1, eax, triton::ast::bvmul(op1, op2), node);
-                this->ofImul_s(inst, expr1, eax, triton::ast::bvmul(op1, op2), node);
+                this->cfImul_s(inst, expr1, eax, this->astCtxt->bvmul(op1, op2), node);
+                this->ofImul_s(inst, expr1, eax, this->astCtxt->bvmul(op1, op2), node);
                 break;
               }
 
               /* dst = RDX:RAX */
               case QWORD_SIZE: {
-                auto rax   = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-                auto rdx   = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
+                auto rax   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
+                auto rdx   = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
                 auto op1   = this->symbolicEngine->buildSymbolicOperand(inst, rax);
                 auto op2   = this->symbolicEngine->buildSymbolicOperand(inst, src);
-                auto node  = triton::ast::bvmul(triton::ast::sx(QWORD_SIZE_BIT, op1), triton::ast::sx(QWORD_SIZE_BIT, op2));
-                auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(QWORD_SIZE_BIT-1, 0, node), rax, "IMUL operation");
-                auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, node), rdx, "IMUL operation");
+                auto node  = this->astCtxt->bvmul(this->astCtxt->sx(QWORD_SIZE_BIT, op1), this->astCtxt->sx(QWORD_SIZE_BIT, op2));
+                auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, node), rax, "IMUL operation");
+                auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, node), rdx, "IMUL operation");
                 expr1->isTainted = this->taintEngine->taintUnion(rax, src);
                 expr2->isTainted = this->taintEngine->taintUnion(rdx, rax);
-                this->cfImul_s(inst, expr1, rax, triton::ast::bvmul(op1, op2), node);
-                this->ofImul_s(inst, expr1, rax, triton::ast::bvmul(op1, op2), node);
+                this->cfImul_s(inst, expr1, rax, this->astCtxt->bvmul(op1, op2), node);
+                this->ofImul_s(inst, expr1, rax, this->astCtxt->bvmul(op1, op2), node);
                 break;
               }
 
@@ -4786,11 +4982,11 @@ namespace triton {
             auto& src  = inst.operands[1];
             auto  op1  = this->symbolicEngine->buildSymbolicOperand(inst, dst);
             auto  op2  = this->symbolicEngine->buildSymbolicOperand(inst, src);
-            auto  node = triton::ast::bvmul(triton::ast::sx(dst.getBitSize(), op1), triton::ast::sx(src.getBitSize(), op2));
-            auto  expr = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
+            auto  node = this->astCtxt->bvmul(this->astCtxt->sx(dst.getBitSize(), op1), this->astCtxt->sx(src.getBitSize(), op2));
+            auto  expr = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
             expr->isTainted = this->taintEngine->taintUnion(dst, src);
-            this->cfImul_s(inst, expr, dst, triton::ast::bvmul(op1, op2), node);
-            this->ofImul_s(inst, expr, dst, triton::ast::bvmul(op1, op2), node);
+            this->cfImul_s(inst, expr, dst, this->astCtxt->bvmul(op1, op2), node);
+            this->ofImul_s(inst, expr, dst, this->astCtxt->bvmul(op1, op2), node);
             break;
           }
 
@@ -4801,11 +4997,11 @@ namespace triton {
             auto& src2 = inst.operands[2];
             auto  op2  = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto  op3  = this->symbolicEngine->buildSymbolicOperand(inst, src2);
-            auto  node = triton::ast::bvmul(triton::ast::sx(src1.getBitSize(), op2), triton::ast::sx(src2.getBitSize(), op3));
-            auto  expr = this->symbolicEngine->createSymbolicExpression(inst, triton::ast::extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
+            auto  node = this->astCtxt->bvmul(this->astCtxt->sx(src1.getBitSize(), op2), this->astCtxt->sx(src2.getBitSize(), op3));
+            auto  expr = this->symbolicEngine->createSymbolicExpression(inst, this->astCtxt->extract(dst.getBitSize()-1, 0, node), dst, "IMUL operation");
             expr->isTainted = this->taintEngine->setTaint(dst, this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2));
-            this->cfImul_s(inst, expr, dst, triton::ast::bvmul(op2, op3), node);
-            this->ofImul_s(inst, expr, dst, triton::ast::bvmul(op2, op3), node);
+            this->cfImul_s(inst, expr, dst, this->astCtxt->bvmul(op2, op3), node);
+            this->ofImul_s(inst, expr, dst, this->astCtxt->bvmul(op2, op3), node);
             break;
           }
 
@@ -4821,10 +5017,10 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::bv(1, dst.getBitSize());
+        auto op2 = this->astCtxt->bv(1, dst.getBitSize());
 
         /* Create the semantics */
-        auto node = triton::ast::bvadd(op1, op2);
+        auto node = this->astCtxt->bvadd(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "INC operation");
@@ -4857,9 +5053,9 @@ namespace triton {
 
 
       void x86Semantics::ja_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  cf      = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  cf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -4870,13 +5066,13 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::bvand(
-                          triton::ast::bvnot(op1),
-                          triton::ast::bvnot(op2)
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
+                        this->astCtxt->bvand(
+                          this->astCtxt->bvnot(op1),
+                          this->astCtxt->bvnot(op2)
                         ),
-                        triton::ast::bvtrue()
+                        this->astCtxt->bvtrue()
                       ), op4, op3);
 
         /* Create symbolic expression */
@@ -4896,8 +5092,8 @@ namespace triton {
 
 
       void x86Semantics::jae_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  cf      = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  cf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -4907,7 +5103,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvfalse()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -4925,8 +5121,8 @@ namespace triton {
 
 
       void x86Semantics::jb_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  cf      = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  cf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -4936,7 +5132,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvtrue()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -4954,9 +5150,9 @@ namespace triton {
 
 
       void x86Semantics::jbe_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  cf      = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  cf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -4967,7 +5163,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(op1, op2), triton::ast::bvtrue()), op4, op3);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(op1, op2), this->astCtxt->bvtrue()), op4, op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -4987,8 +5183,8 @@ namespace triton {
 
 
       void x86Semantics::je_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -4998,7 +5194,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvtrue()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5016,10 +5212,10 @@ namespace triton {
 
 
       void x86Semantics::jg_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  sf      = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of      = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
-        auto  zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  sf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
+        auto  zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5031,7 +5227,7 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op1, op2), op3), triton::ast::bvfalse()), op5, op4);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op1, op2), op3), this->astCtxt->bvfalse()), op5, op4);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5051,9 +5247,9 @@ namespace triton {
 
 
       void x86Semantics::jge_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  sf      = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of      = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  sf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5064,7 +5260,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, op2), op4, op3);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, op2), op4, op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5083,9 +5279,9 @@ namespace triton {
 
 
       void x86Semantics::jl_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  sf      = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of      = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  sf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5096,7 +5292,7 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvxor(op1, op2), triton::ast::bvtrue()), op4, op3);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvxor(op1, op2), this->astCtxt->bvtrue()), op4, op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5115,10 +5311,10 @@ namespace triton {
 
 
       void x86Semantics::jle_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  sf      = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of      = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
-        auto  zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  sf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
+        auto  zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5130,7 +5326,7 @@ namespace triton {
         auto op5 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op1, op2), op3), triton::ast::bvtrue()), op5, op4);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op1, op2), op3), this->astCtxt->bvtrue()), op5, op4);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5150,7 +5346,7 @@ namespace triton {
 
 
       void x86Semantics::jmp_s(triton::arch::Instruction& inst) {
-        auto  pc  = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+        auto  pc  = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
         auto& src = inst.operands[0];
 
         /* Create symbolic operands */
@@ -5174,8 +5370,8 @@ namespace triton {
 
 
       void x86Semantics::jne_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  zf      = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  zf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5185,7 +5381,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvfalse()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5203,8 +5399,8 @@ namespace triton {
 
 
       void x86Semantics::jno_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  of      = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  of      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5214,7 +5410,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvfalse()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5232,8 +5428,8 @@ namespace triton {
 
 
       void x86Semantics::jnp_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  pf      = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  pf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5243,7 +5439,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvfalse()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5261,8 +5457,8 @@ namespace triton {
 
 
       void x86Semantics::jns_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  sf      = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  sf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5272,7 +5468,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvfalse()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvfalse()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5290,8 +5486,8 @@ namespace triton {
 
 
       void x86Semantics::jo_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  of      = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  of      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5301,7 +5497,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvtrue()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5319,8 +5515,8 @@ namespace triton {
 
 
       void x86Semantics::jp_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  pf      = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  pf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5330,7 +5526,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvtrue()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5348,8 +5544,8 @@ namespace triton {
 
 
       void x86Semantics::js_s(triton::arch::Instruction& inst) {
-        auto  pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
-        auto  sf      = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  sf      = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
         auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
         auto& srcImm2 = inst.operands[0];
 
@@ -5359,7 +5555,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, srcImm2);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(triton::ast::equal(op1, triton::ast::bvtrue()), op3, op2);
+        auto node = this->astCtxt->ite(this->astCtxt->equal(op1, this->astCtxt->bvtrue()), op3, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, pc, "Program Counter");
@@ -5377,12 +5573,12 @@ namespace triton {
 
 
       void x86Semantics::lahf_s(triton::arch::Instruction& inst) {
-        auto dst  = triton::arch::OperandWrapper(TRITON_X86_REG_AH);
-        auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto src2 = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
-        auto src3 = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
-        auto src4 = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
-        auto src5 = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto dst  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AH));
+        auto src1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto src2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
+        auto src3 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AF));
+        auto src4 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
+        auto src5 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
@@ -5396,14 +5592,14 @@ namespace triton {
 
         flags.push_back(op1);
         flags.push_back(op2);
-        flags.push_back(triton::ast::bvfalse());
+        flags.push_back(this->astCtxt->bvfalse());
         flags.push_back(op3);
-        flags.push_back(triton::ast::bvfalse());
+        flags.push_back(this->astCtxt->bvfalse());
         flags.push_back(op4);
-        flags.push_back(triton::ast::bvtrue());
+        flags.push_back(this->astCtxt->bvtrue());
         flags.push_back(op5);
 
-        auto node = triton::ast::concat(flags);
+        auto node = this->astCtxt->concat(flags);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "LAHF operation");
@@ -5439,7 +5635,7 @@ namespace triton {
 
 
       void x86Semantics::ldmxcsr_s(triton::arch::Instruction& inst) {
-        auto  dst = triton::arch::OperandWrapper(TRITON_X86_REG_MXCSR);
+        auto  dst = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_MXCSR));
         auto& src = inst.operands[0];
 
         /* Create the semantics */
@@ -5477,40 +5673,40 @@ namespace triton {
         /* Displacement */
         auto op2 = this->symbolicEngine->buildSymbolicImmediate(inst, srcDisp);
         if (leaSize > srcDisp.getBitSize())
-          op2 = triton::ast::zx(leaSize - srcDisp.getBitSize(), op2);
+          op2 = this->astCtxt->zx(leaSize - srcDisp.getBitSize(), op2);
 
         /* Base */
         triton::ast::AbstractNode* op3;
         if (this->architecture->isRegisterValid(srcBase))
           op3 = this->symbolicEngine->buildSymbolicRegister(inst, srcBase);
         else
-          op3 = triton::ast::bv(0, leaSize);
+          op3 = this->astCtxt->bv(0, leaSize);
 
         /* Base with PC */
-        if (this->architecture->isRegisterValid(srcBase) && (srcBase.getParent().getId() == TRITON_X86_REG_PC.getId()))
-          op3 = triton::ast::bvadd(op3, triton::ast::bv(inst.getSize(), leaSize));
+        if (this->architecture->isRegisterValid(srcBase) && (srcBase.getParentId() == this->architecture->getProgramCounter().getId()))
+          op3 = this->astCtxt->bvadd(op3, this->astCtxt->bv(inst.getSize(), leaSize));
 
         /* Index */
         triton::ast::AbstractNode* op4;
         if (this->architecture->isRegisterValid(srcIndex))
           op4 = this->symbolicEngine->buildSymbolicRegister(inst, srcIndex);
         else
-          op4 = triton::ast::bv(0, leaSize);
+          op4 = this->astCtxt->bv(0, leaSize);
 
         /* Scale */
         auto op5 = this->symbolicEngine->buildSymbolicImmediate(inst, srcScale);
         if (leaSize > srcScale.getBitSize())
-          op5 = triton::ast::zx(leaSize - srcScale.getBitSize(), op5);
+          op5 = this->astCtxt->zx(leaSize - srcScale.getBitSize(), op5);
 
         /* Create the semantics */
         /* Effective address = Displacement + BaseReg + IndexReg * Scale */
-        auto node = triton::ast::bvadd(op2, triton::ast::bvadd(op3, triton::ast::bvmul(op4, op5)));
+        auto node = this->astCtxt->bvadd(op2, this->astCtxt->bvadd(op3, this->astCtxt->bvmul(op4, op5)));
 
         if (dst.getBitSize() > leaSize)
-          node = triton::ast::zx(dst.getBitSize() - leaSize, node);
+          node = this->astCtxt->zx(dst.getBitSize() - leaSize, node);
 
         if (dst.getBitSize() < leaSize)
-          node = triton::ast::extract(dst.getAbstractHigh(), dst.getAbstractLow(), node);
+          node = this->astCtxt->extract(dst.getAbstractHigh(), dst.getAbstractLow(), node);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, node, dst, "LEA operation");
@@ -5524,11 +5720,11 @@ namespace triton {
 
 
       void x86Semantics::leave_s(triton::arch::Instruction& inst) {
-        auto stack     = TRITON_X86_REG_SP.getParent();
-        auto base      = TRITON_X86_REG_BP.getParent();
+        auto stack     = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
+        auto base      = this->architecture->getParentRegister(triton::arch::x86::ID_REG_BP);
         auto baseValue = this->architecture->getConcreteRegisterValue(base).convert_to<triton::uint64>();
         auto bp1       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(baseValue, base.getSize()));
-        auto bp2       = triton::arch::OperandWrapper(TRITON_X86_REG_BP.getParent());
+        auto bp2       = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_BP));
         auto sp        = triton::arch::OperandWrapper(stack);
 
         /* Create symbolic operands */
@@ -5572,8 +5768,8 @@ namespace triton {
       void x86Semantics::lodsb_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -5582,10 +5778,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(BYTE_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(BYTE_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(BYTE_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(BYTE_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -5604,8 +5800,8 @@ namespace triton {
       void x86Semantics::lodsd_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -5614,10 +5810,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(DWORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(DWORD_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(DWORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(DWORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -5636,8 +5832,8 @@ namespace triton {
       void x86Semantics::lodsq_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -5646,10 +5842,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(QWORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(QWORD_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(QWORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(QWORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -5668,8 +5864,8 @@ namespace triton {
       void x86Semantics::lodsw_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -5678,10 +5874,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(WORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(WORD_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(WORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(WORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -5722,7 +5918,7 @@ namespace triton {
         if (src.getType() == triton::arch::OP_REG) {
           uint32 id = src.getConstRegister().getId();
           if (id >= triton::arch::x86::ID_REG_CS && id <= triton::arch::x86::ID_REG_SS) {
-            node = triton::ast::extract(dst.getBitSize()-1, 0, node);
+            node = this->astCtxt->extract(dst.getBitSize()-1, 0, node);
           }
         }
 
@@ -5732,7 +5928,7 @@ namespace triton {
         if (dst.getType() == triton::arch::OP_REG) {
           uint32 id = dst.getConstRegister().getId();
           if (id >= triton::arch::x86::ID_REG_CS && id <= triton::arch::x86::ID_REG_SS) {
-            node = triton::ast::extract(WORD_SIZE_BIT-1, 0, node);
+            node = this->astCtxt->extract(WORD_SIZE_BIT-1, 0, node);
           }
         }
 
@@ -5814,17 +6010,17 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* GPR 32-bits */
           case DWORD_SIZE_BIT:
-            node = triton::ast::extract(DWORD_SIZE_BIT-1, 0, op2);
+            node = this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, op2);
             break;
 
           /* MMX 64-bits */
           case QWORD_SIZE_BIT:
-            node = triton::ast::zx(DWORD_SIZE_BIT, triton::ast::extract(DWORD_SIZE_BIT-1, 0, op2));
+            node = this->astCtxt->zx(DWORD_SIZE_BIT, this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, op2));
             break;
 
           /* XMM 128-bits */
           case DQWORD_SIZE_BIT:
-            node = triton::ast::zx(QWORD_SIZE_BIT + DWORD_SIZE_BIT, triton::ast::extract(DWORD_SIZE_BIT-1, 0, op2));
+            node = this->astCtxt->zx(QWORD_SIZE_BIT + DWORD_SIZE_BIT, this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, op2));
             break;
         }
 
@@ -5847,7 +6043,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::concat(triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2), triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2));
+        auto node = this->astCtxt->concat(this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, op2), this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, op2));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVDDUP operation");
@@ -5868,7 +6064,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2);
+        auto node = this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVDQ2Q operation");
@@ -5926,9 +6122,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::concat(
-                      triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op1), /* Destination[127..64] unchanged */
-                      triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op2)  /* Destination[63..0] = Source[127..64]; */
+        auto node = this->astCtxt->concat(
+                      this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op1), /* Destination[127..64] unchanged */
+                      this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op2)  /* Destination[63..0] = Source[127..64]; */
                     );
 
         /* Create symbolic expression */
@@ -5955,15 +6151,15 @@ namespace triton {
 
         /* xmm, m64 */
         if (dst.getSize() == DQWORD_SIZE) {
-          node = triton::ast::concat(
-                   triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2), /* Destination[127..64] = Source */
-                   triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op1)  /* Destination[63..0] unchanged */
+          node = this->astCtxt->concat(
+                   this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2), /* Destination[127..64] = Source */
+                   this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op1)  /* Destination[63..0] unchanged */
                  );
         }
 
         /* m64, xmm */
         else {
-          node = triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op2); /* Destination[63..00] = Source[127..64] */
+          node = this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op2); /* Destination[63..00] = Source[127..64] */
         }
 
         /* Create symbolic expression */
@@ -5990,15 +6186,15 @@ namespace triton {
 
         /* xmm, m64 */
         if (dst.getSize() == DQWORD_SIZE) {
-          node = triton::ast::concat(
-                   triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2), /* Destination[127..64] = Source */
-                   triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op1)  /* Destination[63..0] unchanged */
+          node = this->astCtxt->concat(
+                   this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2), /* Destination[127..64] = Source */
+                   this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op1)  /* Destination[63..0] unchanged */
                  );
         }
 
         /* m64, xmm */
         else {
-          node = triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op2); /* Destination[63..00] = Source[127..64] */
+          node = this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op2); /* Destination[63..00] = Source[127..64] */
         }
 
         /* Create symbolic expression */
@@ -6021,9 +6217,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::concat(
-                      triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2), /* Destination[127..64] = Source[63..0] */
-                      triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op1)  /* Destination[63..0] unchanged */
+        auto node = this->astCtxt->concat(
+                      this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2), /* Destination[127..64] = Source[63..0] */
+                      this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op1)  /* Destination[63..0] unchanged */
                     );
 
         /* Create symbolic expression */
@@ -6050,15 +6246,15 @@ namespace triton {
 
         /* xmm, m64 */
         if (dst.getSize() == DQWORD_SIZE) {
-          node = triton::ast::concat(
-                   triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op1), /* Destination[127..64] unchanged */
-                   triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2)                /* Destination[63..0] = Source */
+          node = this->astCtxt->concat(
+                   this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op1), /* Destination[127..64] unchanged */
+                   this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2)                /* Destination[63..0] = Source */
                  );
         }
 
         /* m64, xmm */
         else {
-          node = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2); /* Destination = Source[63..00] */
+          node = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2); /* Destination = Source[63..00] */
         }
 
         /* Create symbolic expression */
@@ -6085,15 +6281,15 @@ namespace triton {
 
         /* xmm, m64 */
         if (dst.getSize() == DQWORD_SIZE) {
-          node = triton::ast::concat(
-                   triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op1), /* Destination[127..64] unchanged */
-                   triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2)                /* Destination[63..0] = Source */
+          node = this->astCtxt->concat(
+                   this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, op1), /* Destination[127..64] unchanged */
+                   this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2)                /* Destination[63..0] = Source */
                  );
         }
 
         /* m64, xmm */
         else {
-          node = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, op2); /* Destination = Source[63..00] */
+          node = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, op2); /* Destination = Source[63..00] */
         }
 
         /* Create symbolic expression */
@@ -6115,10 +6311,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::zx(30,                       /* Destination[2..31] = 0        */
-                      triton::ast::concat(
-                        triton::ast::extract(127, 127, op2),  /* Destination[1] = Source[127]; */
-                        triton::ast::extract(63, 63, op2)     /* Destination[0] = Source[63];  */
+        auto node = this->astCtxt->zx(30,                       /* Destination[2..31] = 0        */
+                      this->astCtxt->concat(
+                        this->astCtxt->extract(127, 127, op2),  /* Destination[1] = Source[127]; */
+                        this->astCtxt->extract(63, 63, op2)     /* Destination[0] = Source[63];  */
                       )
                     );
 
@@ -6143,12 +6339,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> signs;
 
-        signs.push_back(triton::ast::extract(127, 127, op2)); /* Destination[3] = Source[127]; */
-        signs.push_back(triton::ast::extract(95, 95,   op2)); /* Destination[2] = Source[95];  */
-        signs.push_back(triton::ast::extract(63, 63,   op2)); /* Destination[1] = Source[63];  */
-        signs.push_back(triton::ast::extract(31, 31,   op2)); /* Destination[0] = Source[31];  */
+        signs.push_back(this->astCtxt->extract(127, 127, op2)); /* Destination[3] = Source[127]; */
+        signs.push_back(this->astCtxt->extract(95, 95,   op2)); /* Destination[2] = Source[95];  */
+        signs.push_back(this->astCtxt->extract(63, 63,   op2)); /* Destination[1] = Source[63];  */
+        signs.push_back(this->astCtxt->extract(31, 31,   op2)); /* Destination[0] = Source[31];  */
 
-        auto node = triton::ast::zx(28, triton::ast::concat(signs));
+        auto node = this->astCtxt->zx(28, this->astCtxt->concat(signs));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVMSKPS operation");
@@ -6260,12 +6456,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> bytes;
 
-        bytes.push_back(triton::ast::extract(127, 96, op2));
-        bytes.push_back(triton::ast::extract(127, 96, op2));
-        bytes.push_back(triton::ast::extract(63, 32, op2));
-        bytes.push_back(triton::ast::extract(63, 32, op2));
+        bytes.push_back(this->astCtxt->extract(127, 96, op2));
+        bytes.push_back(this->astCtxt->extract(127, 96, op2));
+        bytes.push_back(this->astCtxt->extract(63, 32, op2));
+        bytes.push_back(this->astCtxt->extract(63, 32, op2));
 
-        auto node = triton::ast::concat(bytes);
+        auto node = this->astCtxt->concat(bytes);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVSHDUP operation");
@@ -6287,12 +6483,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> bytes;
 
-        bytes.push_back(triton::ast::extract(95, 64, op2));
-        bytes.push_back(triton::ast::extract(95, 64, op2));
-        bytes.push_back(triton::ast::extract(31, 0, op2));
-        bytes.push_back(triton::ast::extract(31, 0, op2));
+        bytes.push_back(this->astCtxt->extract(95, 64, op2));
+        bytes.push_back(this->astCtxt->extract(95, 64, op2));
+        bytes.push_back(this->astCtxt->extract(31, 0, op2));
+        bytes.push_back(this->astCtxt->extract(31, 0, op2));
 
-        auto node = triton::ast::concat(bytes);
+        auto node = this->astCtxt->concat(bytes);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVSLDUP operation");
@@ -6321,18 +6517,18 @@ namespace triton {
 
         /* when source and destination operands are XMM registers */
         else if (dst.getBitSize() == DQWORD_SIZE_BIT && src.getBitSize() == DQWORD_SIZE_BIT)
-          node = triton::ast::concat(
-                  triton::ast::extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, op1),
-                  triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2)
+          node = this->astCtxt->concat(
+                  this->astCtxt->extract(DQWORD_SIZE_BIT-1, QWORD_SIZE_BIT, op1),
+                  this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, op2)
                  );
 
         /* when source operand is XMM register and destination operand is memory location */
         else if (dst.getBitSize() < src.getBitSize())
-          node = triton::ast::extract(QWORD_SIZE_BIT-1, 0, op2);
+          node = this->astCtxt->extract(QWORD_SIZE_BIT-1, 0, op2);
 
         /* when source operand is memory location and destination operand is XMM register */
         else if (dst.getBitSize() > src.getBitSize())
-          node = triton::ast::zx(QWORD_SIZE_BIT, op2);
+          node = this->astCtxt->zx(QWORD_SIZE_BIT, op2);
 
         /* Invalid operation */
         else
@@ -6359,7 +6555,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::zx(QWORD_SIZE_BIT, op2);
+        auto node = this->astCtxt->zx(QWORD_SIZE_BIT, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVQ2DQ operation");
@@ -6375,9 +6571,9 @@ namespace triton {
       void x86Semantics::movsb_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -6387,15 +6583,15 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(BYTE_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(BYTE_SIZE, index1.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(BYTE_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(BYTE_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(BYTE_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(BYTE_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(BYTE_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(BYTE_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -6416,9 +6612,9 @@ namespace triton {
       void x86Semantics::movsd_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -6428,15 +6624,15 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(DWORD_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(DWORD_SIZE, index1.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(DWORD_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(DWORD_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(DWORD_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(DWORD_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(DWORD_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(DWORD_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -6493,9 +6689,9 @@ namespace triton {
       void x86Semantics::movsq_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -6505,15 +6701,15 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(QWORD_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(QWORD_SIZE, index1.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(QWORD_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(QWORD_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(QWORD_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(QWORD_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(QWORD_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(QWORD_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -6534,9 +6730,9 @@ namespace triton {
       void x86Semantics::movsw_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index1 = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  index2 = triton::arch::OperandWrapper(TRITON_X86_REG_SI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index1 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  index2 = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -6546,15 +6742,15 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(WORD_SIZE, index1.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(WORD_SIZE, index1.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(WORD_SIZE, index1.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(WORD_SIZE, index1.getBitSize()))
                      );
-        auto node3 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(WORD_SIZE, index2.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(WORD_SIZE, index2.getBitSize()))
+        auto node3 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(WORD_SIZE, index2.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(WORD_SIZE, index2.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -6580,7 +6776,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::sx(dst.getBitSize() - src.getBitSize(), op1);
+        auto node = this->astCtxt->sx(dst.getBitSize() - src.getBitSize(), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVSX operation");
@@ -6601,7 +6797,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::sx(dst.getBitSize() - src.getBitSize(), op1);
+        auto node = this->astCtxt->sx(dst.getBitSize() - src.getBitSize(), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVSXD operation");
@@ -6622,7 +6818,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::zx(dst.getBitSize() - src.getBitSize(), op1);
+        auto node = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOVZX operation");
@@ -6642,19 +6838,19 @@ namespace triton {
 
           /* AX = AL * r/m8 */
           case BYTE_SIZE: {
-            auto dst  = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-            auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_AL);
+            auto dst  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+            auto src1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AL));
             /* Create symbolic operands */
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
             /* Create the semantics */
-            auto node = triton::ast::bvmul(triton::ast::zx(BYTE_SIZE_BIT, op1), triton::ast::zx(BYTE_SIZE_BIT, op2));
+            auto node = this->astCtxt->bvmul(this->astCtxt->zx(BYTE_SIZE_BIT, op1), this->astCtxt->zx(BYTE_SIZE_BIT, op2));
             /* Create symbolic expression */
             auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MUL operation");
             /* Apply the taint */
             expr->isTainted = this->taintEngine->taintUnion(dst, src2);
             /* Upate symbolic flags */
-            auto ah = triton::ast::extract((WORD_SIZE_BIT - 1), BYTE_SIZE_BIT, node);
+            auto ah = this->astCtxt->extract((WORD_SIZE_BIT - 1), BYTE_SIZE_BIT, node);
             this->cfMul_s(inst, expr, src2, ah);
             this->ofMul_s(inst, expr, src2, ah);
             break;
@@ -6662,21 +6858,21 @@ namespace triton {
 
           /* DX:AX = AX * r/m16 */
           case WORD_SIZE: {
-            auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
-            auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_DX);
-            auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_AX);
+            auto dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
+            auto dst2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DX));
+            auto src1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AX));
             /* Create symbolic operands */
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
             /* Create the semantics */
-            auto node = triton::ast::bvmul(triton::ast::zx(WORD_SIZE_BIT, op1), triton::ast::zx(WORD_SIZE_BIT, op2));
+            auto node = this->astCtxt->bvmul(this->astCtxt->zx(WORD_SIZE_BIT, op1), this->astCtxt->zx(WORD_SIZE_BIT, op2));
             /* Create symbolic expression for ax */
-            auto ax = triton::ast::extract((WORD_SIZE_BIT - 1), 0, node);
+            auto ax = this->astCtxt->extract((WORD_SIZE_BIT - 1), 0, node);
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, ax, dst1, "MUL operation");
             /* Apply the taint */
             expr1->isTainted = this->taintEngine->taintUnion(dst1, src2);
             /* Create symbolic expression for dx */
-            auto dx = triton::ast::extract((DWORD_SIZE_BIT - 1), WORD_SIZE_BIT, node);
+            auto dx = this->astCtxt->extract((DWORD_SIZE_BIT - 1), WORD_SIZE_BIT, node);
             auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, dx, dst2, "MUL operation");
             /* Apply the taint */
             expr2->isTainted = this->taintEngine->taintUnion(dst2, src2);
@@ -6689,21 +6885,21 @@ namespace triton {
 
           /* EDX:EAX = EAX * r/m32 */
           case DWORD_SIZE: {
-            auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-            auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-            auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
+            auto dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
+            auto dst2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+            auto src1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
             /* Create symbolic operands */
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
             /* Create the semantics */
-            auto node = triton::ast::bvmul(triton::ast::zx(DWORD_SIZE_BIT, op1), triton::ast::zx(DWORD_SIZE_BIT, op2));
+            auto node = this->astCtxt->bvmul(this->astCtxt->zx(DWORD_SIZE_BIT, op1), this->astCtxt->zx(DWORD_SIZE_BIT, op2));
             /* Create symbolic expression for eax */
-            auto eax = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, node);
+            auto eax = this->astCtxt->extract((DWORD_SIZE_BIT - 1), 0, node);
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, eax, dst1, "MUL operation");
             /* Apply the taint */
             expr1->isTainted = this->taintEngine->taintUnion(dst1, src2);
             /* Create symbolic expression for edx */
-            auto edx = triton::ast::extract((QWORD_SIZE_BIT - 1), DWORD_SIZE_BIT, node);
+            auto edx = this->astCtxt->extract((QWORD_SIZE_BIT - 1), DWORD_SIZE_BIT, node);
             auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, edx, dst2, "MUL operation");
             /* Apply the taint */
             expr2->isTainted = this->taintEngine->taintUnion(dst2, src2);
@@ -6716,21 +6912,21 @@ namespace triton {
 
           /* RDX:RAX = RAX * r/m64 */
           case QWORD_SIZE: {
-            auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
-            auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
-            auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_RAX);
+            auto dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
+            auto dst2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
+            auto src1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RAX));
             /* Create symbolic operands */
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
             /* Create the semantics */
-            auto node = triton::ast::bvmul(triton::ast::zx(QWORD_SIZE_BIT, op1), triton::ast::zx(QWORD_SIZE_BIT, op2));
+            auto node = this->astCtxt->bvmul(this->astCtxt->zx(QWORD_SIZE_BIT, op1), this->astCtxt->zx(QWORD_SIZE_BIT, op2));
             /* Create symbolic expression for eax */
-            auto rax = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, node);
+            auto rax = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, node);
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, rax, dst1, "MUL operation");
             /* Apply the taint */
             expr1->isTainted = this->taintEngine->taintUnion(dst1, src2);
             /* Create symbolic expression for rdx */
-            auto rdx = triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, node);
+            auto rdx = this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, node);
             auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, rdx, dst2, "MUL operation");
             /* Apply the taint */
             expr2->isTainted = this->taintEngine->taintUnion(dst2, src2);
@@ -6756,16 +6952,16 @@ namespace triton {
             auto& dst1 = inst.operands[0];
             auto& dst2 = inst.operands[1];
             auto  src1 = inst.operands[2];
-            auto  src2 = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
+            auto  src2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
 
             /* Create symbolic operands */
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
             /* Create the semantics */
-            auto node  = triton::ast::bvmul(triton::ast::zx(DWORD_SIZE_BIT, op1), triton::ast::zx(DWORD_SIZE_BIT, op2));
-            auto node1 = triton::ast::extract((DWORD_SIZE_BIT - 1), 0, node);
-            auto node2 = triton::ast::extract((QWORD_SIZE_BIT - 1), DWORD_SIZE_BIT, node);
+            auto node  = this->astCtxt->bvmul(this->astCtxt->zx(DWORD_SIZE_BIT, op1), this->astCtxt->zx(DWORD_SIZE_BIT, op2));
+            auto node1 = this->astCtxt->extract((DWORD_SIZE_BIT - 1), 0, node);
+            auto node2 = this->astCtxt->extract((QWORD_SIZE_BIT - 1), DWORD_SIZE_BIT, node);
 
             /* Create symbolic expression for eax */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, dst2, "MULX operation");
@@ -6785,16 +6981,16 @@ namespace triton {
             auto& dst1 = inst.operands[0];
             auto& dst2 = inst.operands[1];
             auto  src1 = inst.operands[2];
-            auto  src2 = triton::arch::OperandWrapper(TRITON_X86_REG_RDX);
+            auto  src2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RDX));
 
             /* Create symbolic operands */
             auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
             auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
             /* Create the semantics */
-            auto node  = triton::ast::bvmul(triton::ast::zx(QWORD_SIZE_BIT, op1), triton::ast::zx(QWORD_SIZE_BIT, op2));
-            auto node1 = triton::ast::extract((QWORD_SIZE_BIT - 1), 0, node);
-            auto node2 = triton::ast::extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, node);
+            auto node  = this->astCtxt->bvmul(this->astCtxt->zx(QWORD_SIZE_BIT, op1), this->astCtxt->zx(QWORD_SIZE_BIT, op2));
+            auto node1 = this->astCtxt->extract((QWORD_SIZE_BIT - 1), 0, node);
+            auto node2 = this->astCtxt->extract((DQWORD_SIZE_BIT - 1), QWORD_SIZE_BIT, node);
 
             /* Create symbolic expression for eax */
             auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, node1, dst2, "MULX operation");
@@ -6823,7 +7019,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvneg(op1);
+        auto node = this->astCtxt->bvneg(op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, src, "NEG operation");
@@ -6857,7 +7053,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvnot(op1);
+        auto node = this->astCtxt->bvnot(op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, src, "NOT operation");
@@ -6879,7 +7075,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvor(op1, op2);
+        auto node = this->astCtxt->bvor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "OR operation");
@@ -6888,8 +7084,8 @@ namespace triton {
         expr->isTainted = this->taintEngine->taintUnion(dst, src);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->pf_s(inst, expr, dst);
         this->sf_s(inst, expr, dst);
         this->zf_s(inst, expr, dst);
@@ -6908,7 +7104,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvor(op1, op2);
+        auto node = this->astCtxt->bvor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ORPD operation");
@@ -6930,7 +7126,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvor(op1, op2);
+        auto node = this->astCtxt->bvor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ORPS operation");
@@ -6958,25 +7154,25 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 120, op1), triton::ast::extract(127, 120, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(119, 112, op1), triton::ast::extract(119, 112, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(111, 104, op1), triton::ast::extract(111, 104, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(103, 96,  op1), triton::ast::extract(103, 96,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(95,  88,  op1), triton::ast::extract(95,  88,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(87,  80,  op1), triton::ast::extract(87,  80,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(79,  72,  op1), triton::ast::extract(79,  72,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(71,  64,  op1), triton::ast::extract(71,  64,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 120, op1), this->astCtxt->extract(127, 120, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(119, 112, op1), this->astCtxt->extract(119, 112, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(111, 104, op1), this->astCtxt->extract(111, 104, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(103, 96,  op1), this->astCtxt->extract(103, 96,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  88,  op1), this->astCtxt->extract(95,  88,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(87,  80,  op1), this->astCtxt->extract(87,  80,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(79,  72,  op1), this->astCtxt->extract(79,  72,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(71,  64,  op1), this->astCtxt->extract(71,  64,  op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  56,  op1), triton::ast::extract(63,  56,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(55,  48,  op1), triton::ast::extract(55,  48,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(47,  40,  op1), triton::ast::extract(47,  40,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(39,  32,  op1), triton::ast::extract(39,  32,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(31,  24,  op1), triton::ast::extract(31,  24,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(23,  16,  op1), triton::ast::extract(23,  16,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(15,  8,   op1), triton::ast::extract(15,  8,   op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(7,   0,   op1), triton::ast::extract(7,   0,   op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  56,  op1), this->astCtxt->extract(63,  56,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(55,  48,  op1), this->astCtxt->extract(55,  48,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(47,  40,  op1), this->astCtxt->extract(47,  40,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(39,  32,  op1), this->astCtxt->extract(39,  32,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  24,  op1), this->astCtxt->extract(31,  24,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(23,  16,  op1), this->astCtxt->extract(23,  16,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(15,  8,   op1), this->astCtxt->extract(15,  8,   op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(7,   0,   op1), this->astCtxt->extract(7,   0,   op2)));
             break;
 
           default:
@@ -6984,7 +7180,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDB operation");
@@ -7012,13 +7208,13 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 96, op1), triton::ast::extract(127, 96, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(95,  64, op1), triton::ast::extract(95,  64, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 96, op1), this->astCtxt->extract(127, 96, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  64, op1), this->astCtxt->extract(95,  64, op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  32, op1), triton::ast::extract(63,  32, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(31,  0,  op1), triton::ast::extract(31,  0,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  32, op1), this->astCtxt->extract(63,  32, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  0,  op1), this->astCtxt->extract(31,  0,  op2)));
             break;
 
           default:
@@ -7026,7 +7222,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDD operation");
@@ -7054,11 +7250,11 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 64, op1), triton::ast::extract(127, 64, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 64, op1), this->astCtxt->extract(127, 64, op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  0,  op1), triton::ast::extract(63,  0,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  0,  op1), this->astCtxt->extract(63,  0,  op2)));
             break;
 
           default:
@@ -7066,7 +7262,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDQ operation");
@@ -7094,17 +7290,17 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 112, op1), triton::ast::extract(127, 112, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(111, 96,  op1), triton::ast::extract(111, 96,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(95,  80,  op1), triton::ast::extract(95,  80,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(79,  64,  op1), triton::ast::extract(79,  64,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(127, 112, op1), this->astCtxt->extract(127, 112, op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(111, 96,  op1), this->astCtxt->extract(111, 96,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(95,  80,  op1), this->astCtxt->extract(95,  80,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(79,  64,  op1), this->astCtxt->extract(79,  64,  op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  48,  op1), triton::ast::extract(63,  48,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(47,  32,  op1), triton::ast::extract(47,  32,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(31,  16,  op1), triton::ast::extract(31,  16,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(15,  0,   op1), triton::ast::extract(15,  0,   op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(63,  48,  op1), this->astCtxt->extract(63,  48,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(47,  32,  op1), this->astCtxt->extract(47,  32,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(31,  16,  op1), this->astCtxt->extract(31,  16,  op2)));
+            packed.push_back(this->astCtxt->bvadd(this->astCtxt->extract(15,  0,   op1), this->astCtxt->extract(15,  0,   op2)));
             break;
 
           default:
@@ -7112,7 +7308,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDW operation");
@@ -7134,7 +7330,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(op1, op2);
+        auto node = this->astCtxt->bvand(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PAND operation");
@@ -7156,7 +7352,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(triton::ast::bvnot(op1), op2);
+        auto node = this->astCtxt->bvand(this->astCtxt->bvnot(op1), op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PANDN operation");
@@ -7190,22 +7386,22 @@ namespace triton {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
           pck.push_back(
-            triton::ast::extract(BYTE_SIZE_BIT-1, 0,
-              triton::ast::bvlshr(
-                triton::ast::bvadd(
-                  triton::ast::bvadd(
-                    triton::ast::zx(1, triton::ast::extract(high, low, op1)),
-                    triton::ast::zx(1, triton::ast::extract(high, low, op2))
+            this->astCtxt->extract(BYTE_SIZE_BIT-1, 0,
+              this->astCtxt->bvlshr(
+                this->astCtxt->bvadd(
+                  this->astCtxt->bvadd(
+                    this->astCtxt->zx(1, this->astCtxt->extract(high, low, op1)),
+                    this->astCtxt->zx(1, this->astCtxt->extract(high, low, op2))
                   ),
-                  triton::ast::bv(1, BYTE_SIZE_BIT+1)
+                  this->astCtxt->bv(1, BYTE_SIZE_BIT+1)
                 ),
-                triton::ast::bv(1, BYTE_SIZE_BIT+1)
+                this->astCtxt->bv(1, BYTE_SIZE_BIT+1)
               )
             )
           );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PAVGB operation");
@@ -7233,22 +7429,22 @@ namespace triton {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
           pck.push_back(
-            triton::ast::extract(WORD_SIZE_BIT-1, 0,
-              triton::ast::bvlshr(
-                triton::ast::bvadd(
-                  triton::ast::bvadd(
-                    triton::ast::zx(1, triton::ast::extract(high, low, op1)),
-                    triton::ast::zx(1, triton::ast::extract(high, low, op2))
+            this->astCtxt->extract(WORD_SIZE_BIT-1, 0,
+              this->astCtxt->bvlshr(
+                this->astCtxt->bvadd(
+                  this->astCtxt->bvadd(
+                    this->astCtxt->zx(1, this->astCtxt->extract(high, low, op1)),
+                    this->astCtxt->zx(1, this->astCtxt->extract(high, low, op2))
                   ),
-                  triton::ast::bv(1, WORD_SIZE_BIT+1)
+                  this->astCtxt->bv(1, WORD_SIZE_BIT+1)
                 ),
-                triton::ast::bv(1, WORD_SIZE_BIT+1)
+                this->astCtxt->bv(1, WORD_SIZE_BIT+1)
               )
             )
           );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PAVGW operation");
@@ -7274,16 +7470,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize(); index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::equal(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xff, BYTE_SIZE_BIT),
-                          triton::ast::bv(0x00, BYTE_SIZE_BIT))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->equal(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->bv(0xff, BYTE_SIZE_BIT),
+                          this->astCtxt->bv(0x00, BYTE_SIZE_BIT))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQB operation");
@@ -7309,16 +7505,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::equal(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xffffffff, DWORD_SIZE_BIT),
-                          triton::ast::bv(0x00000000, DWORD_SIZE_BIT))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->equal(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->bv(0xffffffff, DWORD_SIZE_BIT),
+                          this->astCtxt->bv(0x00000000, DWORD_SIZE_BIT))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQD operation");
@@ -7344,16 +7540,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::equal(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xffff, WORD_SIZE_BIT),
-                          triton::ast::bv(0x0000, WORD_SIZE_BIT))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->equal(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->bv(0xffff, WORD_SIZE_BIT),
+                          this->astCtxt->bv(0x0000, WORD_SIZE_BIT))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQW operation");
@@ -7379,16 +7575,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize(); index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsgt(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xff, BYTE_SIZE_BIT),
-                          triton::ast::bv(0x00, BYTE_SIZE_BIT))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsgt(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->bv(0xff, BYTE_SIZE_BIT),
+                          this->astCtxt->bv(0x00, BYTE_SIZE_BIT))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPGTB operation");
@@ -7414,16 +7610,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsgt(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xffffffff, DWORD_SIZE_BIT),
-                          triton::ast::bv(0x00000000, DWORD_SIZE_BIT))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsgt(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->bv(0xffffffff, DWORD_SIZE_BIT),
+                          this->astCtxt->bv(0x00000000, DWORD_SIZE_BIT))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPGTD operation");
@@ -7449,16 +7645,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsgt(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xffff, WORD_SIZE_BIT),
-                          triton::ast::bv(0x0000, WORD_SIZE_BIT))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsgt(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->bv(0xffff, WORD_SIZE_BIT),
+                          this->astCtxt->bv(0x0000, WORD_SIZE_BIT))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPGTW operation");
@@ -7484,16 +7680,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize(); index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsle(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsle(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXSB operation");
@@ -7519,16 +7715,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsle(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsle(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXSD operation");
@@ -7554,16 +7750,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsle(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsle(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXSW operation");
@@ -7589,16 +7785,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize(); index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvule(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvule(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXUB operation");
@@ -7624,16 +7820,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvule(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvule(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXUD operation");
@@ -7659,16 +7855,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvule(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvule(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMAXUW operation");
@@ -7694,16 +7890,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize(); index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsge(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsge(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINSB operation");
@@ -7729,16 +7925,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsge(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsge(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINSD operation");
@@ -7764,16 +7960,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvsge(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvsge(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINSW operation");
@@ -7799,16 +7995,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize(); index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvuge(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvuge(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINUB operation");
@@ -7834,16 +8030,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvuge(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvuge(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINUD operation");
@@ -7869,16 +8065,16 @@ namespace triton {
         for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
           uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
           uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::bvuge(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::extract(high, low, op2),
-                          triton::ast::extract(high, low, op1))
+          pck.push_back(this->astCtxt->ite(
+                          this->astCtxt->bvuge(
+                            this->astCtxt->extract(high, low, op1),
+                            this->astCtxt->extract(high, low, op2)),
+                          this->astCtxt->extract(high, low, op2),
+                          this->astCtxt->extract(high, low, op1))
                        );
         }
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMINUW operation");
@@ -7903,29 +8099,29 @@ namespace triton {
 
         switch (src.getSize()) {
           case DQWORD_SIZE:
-            mskb.push_back(triton::ast::extract(127, 127, op2));
-            mskb.push_back(triton::ast::extract(119, 119, op2));
-            mskb.push_back(triton::ast::extract(111, 111, op2));
-            mskb.push_back(triton::ast::extract(103, 103, op2));
-            mskb.push_back(triton::ast::extract(95,  95,  op2));
-            mskb.push_back(triton::ast::extract(87,  87,  op2));
-            mskb.push_back(triton::ast::extract(79,  79,  op2));
-            mskb.push_back(triton::ast::extract(71,  71,  op2));
+            mskb.push_back(this->astCtxt->extract(127, 127, op2));
+            mskb.push_back(this->astCtxt->extract(119, 119, op2));
+            mskb.push_back(this->astCtxt->extract(111, 111, op2));
+            mskb.push_back(this->astCtxt->extract(103, 103, op2));
+            mskb.push_back(this->astCtxt->extract(95,  95,  op2));
+            mskb.push_back(this->astCtxt->extract(87,  87,  op2));
+            mskb.push_back(this->astCtxt->extract(79,  79,  op2));
+            mskb.push_back(this->astCtxt->extract(71,  71,  op2));
 
           case QWORD_SIZE:
-            mskb.push_back(triton::ast::extract(63,  63,  op2));
-            mskb.push_back(triton::ast::extract(55,  55,  op2));
-            mskb.push_back(triton::ast::extract(47,  47,  op2));
-            mskb.push_back(triton::ast::extract(39,  39,  op2));
-            mskb.push_back(triton::ast::extract(31,  31,  op2));
-            mskb.push_back(triton::ast::extract(23,  23,  op2));
-            mskb.push_back(triton::ast::extract(15,  15,  op2));
-            mskb.push_back(triton::ast::extract(7,   7,   op2));
+            mskb.push_back(this->astCtxt->extract(63,  63,  op2));
+            mskb.push_back(this->astCtxt->extract(55,  55,  op2));
+            mskb.push_back(this->astCtxt->extract(47,  47,  op2));
+            mskb.push_back(this->astCtxt->extract(39,  39,  op2));
+            mskb.push_back(this->astCtxt->extract(31,  31,  op2));
+            mskb.push_back(this->astCtxt->extract(23,  23,  op2));
+            mskb.push_back(this->astCtxt->extract(15,  15,  op2));
+            mskb.push_back(this->astCtxt->extract(7,   7,   op2));
         }
 
-        auto node = triton::ast::zx(
+        auto node = this->astCtxt->zx(
                       dst.getBitSize() - static_cast<triton::uint32>(mskb.size()),
-                      triton::ast::concat(mskb)
+                      this->astCtxt->concat(mskb)
                     );
 
         /* Create symbolic expression */
@@ -7949,12 +8145,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(31, 24, op2)));
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(23, 16, op2)));
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(15, 8,  op2)));
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(7,  0,  op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(31, 24, op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(23, 16, op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8,  op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(7,  0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVSXBD operation");
@@ -7977,10 +8173,10 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::sx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(15, 8,  op2)));
-        pck.push_back(triton::ast::sx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(7,  0,  op2)));
+        pck.push_back(this->astCtxt->sx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8,  op2)));
+        pck.push_back(this->astCtxt->sx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(7,  0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVSXBQ operation");
@@ -8003,16 +8199,16 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(63, 56, op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(55, 48, op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(47, 40, op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(39, 32, op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(31, 24, op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(23, 16, op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(15, 8,  op2)));
-        pck.push_back(triton::ast::sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(7,  0,  op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(63, 56, op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(55, 48, op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(47, 40, op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(39, 32, op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(31, 24, op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(23, 16, op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8,  op2)));
+        pck.push_back(this->astCtxt->sx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(7,  0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVSXBW operation");
@@ -8035,10 +8231,10 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::sx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, triton::ast::extract(63, 32, op2)));
-        pck.push_back(triton::ast::sx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, triton::ast::extract(31, 0,  op2)));
+        pck.push_back(this->astCtxt->sx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, this->astCtxt->extract(63, 32, op2)));
+        pck.push_back(this->astCtxt->sx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, this->astCtxt->extract(31, 0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVSXDQ operation");
@@ -8061,12 +8257,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(63, 48, op2)));
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(47, 32, op2)));
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(31, 16, op2)));
-        pck.push_back(triton::ast::sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(15, 0,  op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(63, 48, op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(47, 32, op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(31, 16, op2)));
+        pck.push_back(this->astCtxt->sx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(15, 0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVSXWD operation");
@@ -8089,10 +8285,10 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::sx(QWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(31, 16, op2)));
-        pck.push_back(triton::ast::sx(QWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(15, 0,  op2)));
+        pck.push_back(this->astCtxt->sx(QWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(31, 16, op2)));
+        pck.push_back(this->astCtxt->sx(QWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(15, 0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVSXWQ operation");
@@ -8115,12 +8311,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(31, 24, op2)));
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(23, 16, op2)));
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(15, 8,  op2)));
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(7,  0,  op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(31, 24, op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(23, 16, op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8,  op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(7,  0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVZXBD operation");
@@ -8143,10 +8339,10 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::zx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(15, 8,  op2)));
-        pck.push_back(triton::ast::zx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(7,  0,  op2)));
+        pck.push_back(this->astCtxt->zx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8,  op2)));
+        pck.push_back(this->astCtxt->zx(QWORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(7,  0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVZXBQ operation");
@@ -8169,16 +8365,16 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(63, 56, op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(55, 48, op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(47, 40, op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(39, 32, op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(31, 24, op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(23, 16, op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(15, 8,  op2)));
-        pck.push_back(triton::ast::zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, triton::ast::extract(7,  0,  op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(63, 56, op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(55, 48, op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(47, 40, op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(39, 32, op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(31, 24, op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(23, 16, op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(15, 8,  op2)));
+        pck.push_back(this->astCtxt->zx(WORD_SIZE_BIT - BYTE_SIZE_BIT, this->astCtxt->extract(7,  0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVZXBW operation");
@@ -8201,10 +8397,10 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::zx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, triton::ast::extract(63, 32, op2)));
-        pck.push_back(triton::ast::zx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, triton::ast::extract(31, 0,  op2)));
+        pck.push_back(this->astCtxt->zx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, this->astCtxt->extract(63, 32, op2)));
+        pck.push_back(this->astCtxt->zx(QWORD_SIZE_BIT - DWORD_SIZE_BIT, this->astCtxt->extract(31, 0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVZXDQ operation");
@@ -8227,12 +8423,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(63, 48, op2)));
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(47, 32, op2)));
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(31, 16, op2)));
-        pck.push_back(triton::ast::zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(15, 0,  op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(63, 48, op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(47, 32, op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(31, 16, op2)));
+        pck.push_back(this->astCtxt->zx(DWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(15, 0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVZXWD operation");
@@ -8255,10 +8451,10 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode *> pck;
 
-        pck.push_back(triton::ast::zx(QWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(31, 16, op2)));
-        pck.push_back(triton::ast::zx(QWORD_SIZE_BIT - WORD_SIZE_BIT, triton::ast::extract(15, 0,  op2)));
+        pck.push_back(this->astCtxt->zx(QWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(31, 16, op2)));
+        pck.push_back(this->astCtxt->zx(QWORD_SIZE_BIT - WORD_SIZE_BIT, this->astCtxt->extract(15, 0,  op2)));
 
-        auto node = triton::ast::concat(pck);
+        auto node = this->astCtxt->concat(pck);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PMOVZXWQ operation");
@@ -8273,7 +8469,7 @@ namespace triton {
 
       void x86Semantics::pop_s(triton::arch::Instruction& inst) {
         bool  stackRelative = false;
-        auto  stack         = TRITON_X86_REG_SP.getParent();
+        auto  stack         = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         auto  stackValue    = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
         auto& dst           = inst.operands[0];
         auto  src           = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize()));
@@ -8292,7 +8488,7 @@ namespace triton {
          * the ESP register.
          */
         if (dst.getType() == triton::arch::OP_MEM) {
-          if (dst.getMemory().getBaseRegister().getParent().getId() == stack.getId()) {
+          if (dst.getMemory().getBaseRegister().getParentId() == stack.getId()) {
             /* Align the stack */
             alignAddStack_s(inst, src.getSize());
 
@@ -8319,16 +8515,16 @@ namespace triton {
 
 
       void x86Semantics::popal_s(triton::arch::Instruction& inst) {
-        auto stack      = TRITON_X86_REG_SP.getParent();
+        auto stack      = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
-        auto dst1       = triton::arch::OperandWrapper(TRITON_X86_REG_EDI);
-        auto dst2       = triton::arch::OperandWrapper(TRITON_X86_REG_ESI);
-        auto dst3       = triton::arch::OperandWrapper(TRITON_X86_REG_EBP);
-        auto dst4       = triton::arch::OperandWrapper(TRITON_X86_REG_ESP);
-        auto dst5       = triton::arch::OperandWrapper(TRITON_X86_REG_EBX);
-        auto dst6       = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-        auto dst7       = triton::arch::OperandWrapper(TRITON_X86_REG_ECX);
-        auto dst8       = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
+        auto dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDI));
+        auto dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ESI));
+        auto dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EBP));
+        auto dst4       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ESP));
+        auto dst5       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EBX));
+        auto dst6       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+        auto dst7       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ECX));
+        auto dst8       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
         auto src1       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue+(stack.getSize() * 0), stack.getSize()));
         auto src2       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue+(stack.getSize() * 1), stack.getSize()));
         auto src3       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue+(stack.getSize() * 2), stack.getSize()));
@@ -8374,32 +8570,32 @@ namespace triton {
 
 
       void x86Semantics::popfd_s(triton::arch::Instruction& inst) {
-        auto  stack      = TRITON_X86_REG_SP.getParent();
+        auto  stack      = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         auto  stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
-        auto  dst1       = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  dst2       = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
-        auto  dst3       = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
-        auto  dst4       = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
-        auto  dst5       = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  dst6       = triton::arch::OperandWrapper(TRITON_X86_REG_TF);
-        auto  dst7       = triton::arch::OperandWrapper(TRITON_X86_REG_IF);
-        auto  dst8       = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
-        auto  dst9       = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
+        auto  dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AF));
+        auto  dst4       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
+        auto  dst5       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  dst6       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_TF));
+        auto  dst7       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_IF));
+        auto  dst8       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
+        auto  dst9       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
         auto  src        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node1 = triton::ast::extract(0,  0,  op1);
-        auto node2 = triton::ast::extract(2,  2,  op1);
-        auto node3 = triton::ast::extract(4,  4,  op1);
-        auto node4 = triton::ast::extract(6,  6,  op1);
-        auto node5 = triton::ast::extract(7,  7,  op1);
-        auto node6 = triton::ast::extract(8,  8,  op1);
-        auto node7 = triton::ast::bvtrue(); /* TODO IF and IOPL */
-        auto node8 = triton::ast::extract(10, 10, op1);
-        auto node9 = triton::ast::extract(11, 11, op1);
+        auto node1 = this->astCtxt->extract(0,  0,  op1);
+        auto node2 = this->astCtxt->extract(2,  2,  op1);
+        auto node3 = this->astCtxt->extract(4,  4,  op1);
+        auto node4 = this->astCtxt->extract(6,  6,  op1);
+        auto node5 = this->astCtxt->extract(7,  7,  op1);
+        auto node6 = this->astCtxt->extract(8,  8,  op1);
+        auto node7 = this->astCtxt->bvtrue(); /* TODO IF and IOPL */
+        auto node8 = this->astCtxt->extract(10, 10, op1);
+        auto node9 = this->astCtxt->extract(11, 11, op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "POPFD CF operation");
@@ -8432,32 +8628,32 @@ namespace triton {
 
 
       void x86Semantics::popfq_s(triton::arch::Instruction& inst) {
-        auto  stack      = TRITON_X86_REG_SP.getParent();
+        auto  stack      = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         auto  stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
-        auto  dst1       = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  dst2       = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
-        auto  dst3       = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
-        auto  dst4       = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
-        auto  dst5       = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  dst6       = triton::arch::OperandWrapper(TRITON_X86_REG_TF);
-        auto  dst7       = triton::arch::OperandWrapper(TRITON_X86_REG_IF);
-        auto  dst8       = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
-        auto  dst9       = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  dst1       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  dst2       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
+        auto  dst3       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AF));
+        auto  dst4       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
+        auto  dst5       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  dst6       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_TF));
+        auto  dst7       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_IF));
+        auto  dst8       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
+        auto  dst9       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
         auto  src        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node1 = triton::ast::extract(0,  0,  op1);
-        auto node2 = triton::ast::extract(2,  2,  op1);
-        auto node3 = triton::ast::extract(4,  4,  op1);
-        auto node4 = triton::ast::extract(6,  6,  op1);
-        auto node5 = triton::ast::extract(7,  7,  op1);
-        auto node6 = triton::ast::extract(8,  8,  op1);
-        auto node7 = triton::ast::bvtrue(); /* TODO IF and IOPL */
-        auto node8 = triton::ast::extract(10, 10, op1);
-        auto node9 = triton::ast::extract(11, 11, op1);
+        auto node1 = this->astCtxt->extract(0,  0,  op1);
+        auto node2 = this->astCtxt->extract(2,  2,  op1);
+        auto node3 = this->astCtxt->extract(4,  4,  op1);
+        auto node4 = this->astCtxt->extract(6,  6,  op1);
+        auto node5 = this->astCtxt->extract(7,  7,  op1);
+        auto node6 = this->astCtxt->extract(8,  8,  op1);
+        auto node7 = this->astCtxt->bvtrue(); /* TODO IF and IOPL */
+        auto node8 = this->astCtxt->extract(10, 10, op1);
+        auto node9 = this->astCtxt->extract(11, 11, op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "POPFQ CF operation");
@@ -8498,7 +8694,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvor(op1, op2);
+        auto node = this->astCtxt->bvor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "POR operation");
@@ -8534,51 +8730,51 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> pack;
         pack.push_back(
-          triton::ast::extract(31, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(31, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(7, 6, op3)),
-                triton::ast::bv(32, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(7, 6, op3)),
+                this->astCtxt->bv(32, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(31, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(31, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(5, 4, op3)),
-                triton::ast::bv(32, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(5, 4, op3)),
+                this->astCtxt->bv(32, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(31, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(31, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(3, 2, op3)),
-                triton::ast::bv(32, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(3, 2, op3)),
+                this->astCtxt->bv(32, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(31, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(31, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(1, 0, op3)),
-                triton::ast::bv(32, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(1, 0, op3)),
+                this->astCtxt->bv(32, DQWORD_SIZE_BIT)
               )
             )
           )
         );
 
-        auto node = triton::ast::concat(pack);
+        auto node = this->astCtxt->concat(pack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSHUFD operation");
@@ -8603,54 +8799,54 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> pack;
         pack.push_back(
-          triton::ast::extract(79, 64,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(79, 64,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(7, 6, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(7, 6, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(79, 64,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(79, 64,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(5, 4, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(5, 4, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(79, 64,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(79, 64,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(3, 2, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(3, 2, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(79, 64,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(79, 64,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(1, 0, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(1, 0, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(63, 0, op2)
+          this->astCtxt->extract(63, 0, op2)
         );
 
-        auto node = triton::ast::concat(pack);
+        auto node = this->astCtxt->concat(pack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSHUFHW operation");
@@ -8675,54 +8871,54 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> pack;
         pack.push_back(
-          triton::ast::extract(127, 64, op2)
+          this->astCtxt->extract(127, 64, op2)
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(7, 6, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(7, 6, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(5, 4, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(5, 4, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(3, 2, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(3, 2, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(DQWORD_SIZE_BIT-2, triton::ast::extract(1, 0, op3)),
-                triton::ast::bv(16, DQWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(DQWORD_SIZE_BIT-2, this->astCtxt->extract(1, 0, op3)),
+                this->astCtxt->bv(16, DQWORD_SIZE_BIT)
               )
             )
           )
         );
 
-        auto node = triton::ast::concat(pack);
+        auto node = this->astCtxt->concat(pack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSHUFLW operation");
@@ -8747,51 +8943,51 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> pack;
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(QWORD_SIZE_BIT-2, triton::ast::extract(7, 6, op3)),
-                triton::ast::bv(16, QWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(QWORD_SIZE_BIT-2, this->astCtxt->extract(7, 6, op3)),
+                this->astCtxt->bv(16, QWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(QWORD_SIZE_BIT-2, triton::ast::extract(5, 4, op3)),
-                triton::ast::bv(16, QWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(QWORD_SIZE_BIT-2, this->astCtxt->extract(5, 4, op3)),
+                this->astCtxt->bv(16, QWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(QWORD_SIZE_BIT-2, triton::ast::extract(3, 2, op3)),
-                triton::ast::bv(16, QWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(QWORD_SIZE_BIT-2, this->astCtxt->extract(3, 2, op3)),
+                this->astCtxt->bv(16, QWORD_SIZE_BIT)
               )
             )
           )
         );
         pack.push_back(
-          triton::ast::extract(15, 0,
-            triton::ast::bvlshr(
+          this->astCtxt->extract(15, 0,
+            this->astCtxt->bvlshr(
               op2,
-              triton::ast::bvmul(
-                triton::ast::zx(QWORD_SIZE_BIT-2, triton::ast::extract(1, 0, op3)),
-                triton::ast::bv(16, QWORD_SIZE_BIT)
+              this->astCtxt->bvmul(
+                this->astCtxt->zx(QWORD_SIZE_BIT-2, this->astCtxt->extract(1, 0, op3)),
+                this->astCtxt->bv(16, QWORD_SIZE_BIT)
               )
             )
           )
         );
 
-        auto node = triton::ast::concat(pack);
+        auto node = this->astCtxt->concat(pack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSHUFW operation");
@@ -8810,18 +9006,18 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op2 = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
 
         /* Create the semantics */
-        auto node = triton::ast::bvshl(
+        auto node = this->astCtxt->bvshl(
                       op1,
-                      triton::ast::bvmul(
-                        triton::ast::ite(
-                          triton::ast::bvuge(op2, triton::ast::bv(WORD_SIZE_BIT, dst.getBitSize())),
-                          triton::ast::bv(WORD_SIZE_BIT, dst.getBitSize()),
+                      this->astCtxt->bvmul(
+                        this->astCtxt->ite(
+                          this->astCtxt->bvuge(op2, this->astCtxt->bv(WORD_SIZE_BIT, dst.getBitSize())),
+                          this->astCtxt->bv(WORD_SIZE_BIT, dst.getBitSize()),
                           op2
                         ),
-                        triton::ast::bv(QWORD_SIZE, dst.getBitSize())
+                        this->astCtxt->bv(QWORD_SIZE, dst.getBitSize())
                       )
                     );
 
@@ -8842,18 +9038,18 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op2 = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
 
         /* Create the semantics */
-        auto node = triton::ast::bvlshr(
+        auto node = this->astCtxt->bvlshr(
                       op1,
-                      triton::ast::bvmul(
-                        triton::ast::ite(
-                          triton::ast::bvuge(op2, triton::ast::bv(WORD_SIZE_BIT, dst.getBitSize())),
-                          triton::ast::bv(WORD_SIZE_BIT, dst.getBitSize()),
+                      this->astCtxt->bvmul(
+                        this->astCtxt->ite(
+                          this->astCtxt->bvuge(op2, this->astCtxt->bv(WORD_SIZE_BIT, dst.getBitSize())),
+                          this->astCtxt->bv(WORD_SIZE_BIT, dst.getBitSize()),
                           op2
                         ),
-                        triton::ast::bv(QWORD_SIZE, dst.getBitSize())
+                        this->astCtxt->bv(QWORD_SIZE, dst.getBitSize())
                       )
                     );
 
@@ -8883,25 +9079,25 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(127, 120, op1), triton::ast::extract(127, 120, op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(119, 112, op1), triton::ast::extract(119, 112, op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(111, 104, op1), triton::ast::extract(111, 104, op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(103, 96,  op1), triton::ast::extract(103, 96,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(95,  88,  op1), triton::ast::extract(95,  88,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(87,  80,  op1), triton::ast::extract(87,  80,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(79,  72,  op1), triton::ast::extract(79,  72,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(71,  64,  op1), triton::ast::extract(71,  64,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 120, op1), this->astCtxt->extract(127, 120, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(119, 112, op1), this->astCtxt->extract(119, 112, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(111, 104, op1), this->astCtxt->extract(111, 104, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(103, 96,  op1), this->astCtxt->extract(103, 96,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  88,  op1), this->astCtxt->extract(95,  88,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(87,  80,  op1), this->astCtxt->extract(87,  80,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(79,  72,  op1), this->astCtxt->extract(79,  72,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(71,  64,  op1), this->astCtxt->extract(71,  64,  op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(63,  56,  op1), triton::ast::extract(63,  56,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(55,  48,  op1), triton::ast::extract(55,  48,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(47,  40,  op1), triton::ast::extract(47,  40,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(39,  32,  op1), triton::ast::extract(39,  32,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(31,  24,  op1), triton::ast::extract(31,  24,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(23,  16,  op1), triton::ast::extract(23,  16,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(15,  8,   op1), triton::ast::extract(15,  8,   op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(7,   0,   op1), triton::ast::extract(7,   0,   op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  56,  op1), this->astCtxt->extract(63,  56,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(55,  48,  op1), this->astCtxt->extract(55,  48,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(47,  40,  op1), this->astCtxt->extract(47,  40,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(39,  32,  op1), this->astCtxt->extract(39,  32,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  24,  op1), this->astCtxt->extract(31,  24,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(23,  16,  op1), this->astCtxt->extract(23,  16,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(15,  8,   op1), this->astCtxt->extract(15,  8,   op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(7,   0,   op1), this->astCtxt->extract(7,   0,   op2)));
             break;
 
           default:
@@ -8909,7 +9105,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBB operation");
@@ -8937,13 +9133,13 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(127, 96, op1), triton::ast::extract(127, 96, op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(95,  64, op1), triton::ast::extract(95,  64, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 96, op1), this->astCtxt->extract(127, 96, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  64, op1), this->astCtxt->extract(95,  64, op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(63,  32, op1), triton::ast::extract(63,  32, op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(31,  0,  op1), triton::ast::extract(31,  0,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  32, op1), this->astCtxt->extract(63,  32, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  0,  op1), this->astCtxt->extract(31,  0,  op2)));
             break;
 
           default:
@@ -8951,7 +9147,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBD operation");
@@ -8979,11 +9175,11 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(127, 64, op1), triton::ast::extract(127, 64, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 64, op1), this->astCtxt->extract(127, 64, op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(63,  0,  op1), triton::ast::extract(63,  0,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  0,  op1), this->astCtxt->extract(63,  0,  op2)));
             break;
 
           default:
@@ -8991,7 +9187,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBQ operation");
@@ -9019,17 +9215,17 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(127, 112, op1), triton::ast::extract(127, 112, op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(111, 96,  op1), triton::ast::extract(111, 96,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(95,  80,  op1), triton::ast::extract(95,  80,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(79,  64,  op1), triton::ast::extract(79,  64,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(127, 112, op1), this->astCtxt->extract(127, 112, op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(111, 96,  op1), this->astCtxt->extract(111, 96,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(95,  80,  op1), this->astCtxt->extract(95,  80,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(79,  64,  op1), this->astCtxt->extract(79,  64,  op2)));
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(63,  48,  op1), triton::ast::extract(63,  48,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(47,  32,  op1), triton::ast::extract(47,  32,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(31,  16,  op1), triton::ast::extract(31,  16,  op2)));
-            packed.push_back(triton::ast::bvsub(triton::ast::extract(15,  0,   op1), triton::ast::extract(15,  0,   op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(63,  48,  op1), this->astCtxt->extract(63,  48,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(47,  32,  op1), this->astCtxt->extract(47,  32,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(31,  16,  op1), this->astCtxt->extract(31,  16,  op2)));
+            packed.push_back(this->astCtxt->bvsub(this->astCtxt->extract(15,  0,   op1), this->astCtxt->extract(15,  0,   op2)));
             break;
 
           default:
@@ -9037,7 +9233,7 @@ namespace triton {
 
         }
 
-        auto node = triton::ast::concat(packed);
+        auto node = this->astCtxt->concat(packed);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PSUBW operation");
@@ -9059,8 +9255,8 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvand(op1, op2);
-        auto node2 = triton::ast::bvand(op1, triton::ast::bvnot(op2));
+        auto node1 = this->astCtxt->bvand(op1, op2);
+        auto node2 = this->astCtxt->bvand(op1, this->astCtxt->bvnot(op2));
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "PTEST operation");
@@ -9071,11 +9267,11 @@ namespace triton {
         expr2->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_AF, "Clears adjust flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_AF), "Clears adjust flag");
         this->cfPtest_s(inst, expr2, src1, true);
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_PF, "Clears parity flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_SF, "Clears sign flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_PF), "Clears parity flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_SF), "Clears sign flag");
         this->zf_s(inst, expr1, src1, true);
 
         /* Upate the symbolic control flow */
@@ -9098,41 +9294,41 @@ namespace triton {
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 56, op2));
-            unpack.push_back(triton::ast::extract(63, 56, op1));
-            unpack.push_back(triton::ast::extract(55, 48, op2));
-            unpack.push_back(triton::ast::extract(55, 48, op1));
-            unpack.push_back(triton::ast::extract(47, 40, op2));
-            unpack.push_back(triton::ast::extract(55, 40, op1));
-            unpack.push_back(triton::ast::extract(39, 32, op2));
-            unpack.push_back(triton::ast::extract(39, 32, op1));
+            unpack.push_back(this->astCtxt->extract(63, 56, op2));
+            unpack.push_back(this->astCtxt->extract(63, 56, op1));
+            unpack.push_back(this->astCtxt->extract(55, 48, op2));
+            unpack.push_back(this->astCtxt->extract(55, 48, op1));
+            unpack.push_back(this->astCtxt->extract(47, 40, op2));
+            unpack.push_back(this->astCtxt->extract(55, 40, op1));
+            unpack.push_back(this->astCtxt->extract(39, 32, op2));
+            unpack.push_back(this->astCtxt->extract(39, 32, op1));
             break;
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(127, 120, op2));
-            unpack.push_back(triton::ast::extract(127, 120, op1));
-            unpack.push_back(triton::ast::extract(119, 112, op2));
-            unpack.push_back(triton::ast::extract(119, 112, op1));
-            unpack.push_back(triton::ast::extract(111, 104, op2));
-            unpack.push_back(triton::ast::extract(111, 104, op1));
-            unpack.push_back(triton::ast::extract(103, 96,  op2));
-            unpack.push_back(triton::ast::extract(103, 96,  op1));
-            unpack.push_back(triton::ast::extract(95,  88,  op2));
-            unpack.push_back(triton::ast::extract(95,  88,  op1));
-            unpack.push_back(triton::ast::extract(87,  80,  op2));
-            unpack.push_back(triton::ast::extract(87,  80,  op1));
-            unpack.push_back(triton::ast::extract(79,  72,  op2));
-            unpack.push_back(triton::ast::extract(79,  72,  op1));
-            unpack.push_back(triton::ast::extract(71,  64,  op2));
-            unpack.push_back(triton::ast::extract(71,  64,  op1));
+            unpack.push_back(this->astCtxt->extract(127, 120, op2));
+            unpack.push_back(this->astCtxt->extract(127, 120, op1));
+            unpack.push_back(this->astCtxt->extract(119, 112, op2));
+            unpack.push_back(this->astCtxt->extract(119, 112, op1));
+            unpack.push_back(this->astCtxt->extract(111, 104, op2));
+            unpack.push_back(this->astCtxt->extract(111, 104, op1));
+            unpack.push_back(this->astCtxt->extract(103, 96,  op2));
+            unpack.push_back(this->astCtxt->extract(103, 96,  op1));
+            unpack.push_back(this->astCtxt->extract(95,  88,  op2));
+            unpack.push_back(this->astCtxt->extract(95,  88,  op1));
+            unpack.push_back(this->astCtxt->extract(87,  80,  op2));
+            unpack.push_back(this->astCtxt->extract(87,  80,  op1));
+            unpack.push_back(this->astCtxt->extract(79,  72,  op2));
+            unpack.push_back(this->astCtxt->extract(79,  72,  op1));
+            unpack.push_back(this->astCtxt->extract(71,  64,  op2));
+            unpack.push_back(this->astCtxt->extract(71,  64,  op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpckhbw_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKHBW operation");
@@ -9160,23 +9356,23 @@ namespace triton {
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 32, op2));
-            unpack.push_back(triton::ast::extract(63, 32, op1));
+            unpack.push_back(this->astCtxt->extract(63, 32, op2));
+            unpack.push_back(this->astCtxt->extract(63, 32, op1));
             break;
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(127, 96, op2));
-            unpack.push_back(triton::ast::extract(127, 96, op1));
-            unpack.push_back(triton::ast::extract(95,  64, op2));
-            unpack.push_back(triton::ast::extract(95,  64, op1));
+            unpack.push_back(this->astCtxt->extract(127, 96, op2));
+            unpack.push_back(this->astCtxt->extract(127, 96, op1));
+            unpack.push_back(this->astCtxt->extract(95,  64, op2));
+            unpack.push_back(this->astCtxt->extract(95,  64, op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpckhdq_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKHDQ operation");
@@ -9204,15 +9400,15 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(127, 64, op2));
-            unpack.push_back(triton::ast::extract(127, 64, op1));
+            unpack.push_back(this->astCtxt->extract(127, 64, op2));
+            unpack.push_back(this->astCtxt->extract(127, 64, op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpckhqdq_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKHQDQ operation");
@@ -9240,29 +9436,29 @@ namespace triton {
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 48, op2));
-            unpack.push_back(triton::ast::extract(63, 48, op1));
-            unpack.push_back(triton::ast::extract(47, 32, op2));
-            unpack.push_back(triton::ast::extract(47, 32, op1));
+            unpack.push_back(this->astCtxt->extract(63, 48, op2));
+            unpack.push_back(this->astCtxt->extract(63, 48, op1));
+            unpack.push_back(this->astCtxt->extract(47, 32, op2));
+            unpack.push_back(this->astCtxt->extract(47, 32, op1));
             break;
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(127, 112, op2));
-            unpack.push_back(triton::ast::extract(127, 112, op1));
-            unpack.push_back(triton::ast::extract(111, 96,  op2));
-            unpack.push_back(triton::ast::extract(111, 96,  op1));
-            unpack.push_back(triton::ast::extract(95,  80,  op2));
-            unpack.push_back(triton::ast::extract(95,  80,  op1));
-            unpack.push_back(triton::ast::extract(79,  64,  op2));
-            unpack.push_back(triton::ast::extract(79,  64,  op1));
+            unpack.push_back(this->astCtxt->extract(127, 112, op2));
+            unpack.push_back(this->astCtxt->extract(127, 112, op1));
+            unpack.push_back(this->astCtxt->extract(111, 96,  op2));
+            unpack.push_back(this->astCtxt->extract(111, 96,  op1));
+            unpack.push_back(this->astCtxt->extract(95,  80,  op2));
+            unpack.push_back(this->astCtxt->extract(95,  80,  op1));
+            unpack.push_back(this->astCtxt->extract(79,  64,  op2));
+            unpack.push_back(this->astCtxt->extract(79,  64,  op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpckhwd_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKHWD operation");
@@ -9290,41 +9486,41 @@ namespace triton {
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(31, 24, op2));
-            unpack.push_back(triton::ast::extract(31, 24, op1));
-            unpack.push_back(triton::ast::extract(23, 16, op2));
-            unpack.push_back(triton::ast::extract(23, 16, op1));
-            unpack.push_back(triton::ast::extract(15, 8,  op2));
-            unpack.push_back(triton::ast::extract(15, 8,  op1));
-            unpack.push_back(triton::ast::extract(7,  0,  op2));
-            unpack.push_back(triton::ast::extract(7,  0,  op1));
+            unpack.push_back(this->astCtxt->extract(31, 24, op2));
+            unpack.push_back(this->astCtxt->extract(31, 24, op1));
+            unpack.push_back(this->astCtxt->extract(23, 16, op2));
+            unpack.push_back(this->astCtxt->extract(23, 16, op1));
+            unpack.push_back(this->astCtxt->extract(15, 8,  op2));
+            unpack.push_back(this->astCtxt->extract(15, 8,  op1));
+            unpack.push_back(this->astCtxt->extract(7,  0,  op2));
+            unpack.push_back(this->astCtxt->extract(7,  0,  op1));
             break;
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 56, op2));
-            unpack.push_back(triton::ast::extract(63, 56, op1));
-            unpack.push_back(triton::ast::extract(55, 48, op2));
-            unpack.push_back(triton::ast::extract(55, 48, op1));
-            unpack.push_back(triton::ast::extract(47, 40, op2));
-            unpack.push_back(triton::ast::extract(47, 40, op1));
-            unpack.push_back(triton::ast::extract(39, 32, op2));
-            unpack.push_back(triton::ast::extract(39, 32, op1));
-            unpack.push_back(triton::ast::extract(31, 24, op2));
-            unpack.push_back(triton::ast::extract(31, 24, op1));
-            unpack.push_back(triton::ast::extract(23, 16, op2));
-            unpack.push_back(triton::ast::extract(23, 16, op1));
-            unpack.push_back(triton::ast::extract(15, 8,  op2));
-            unpack.push_back(triton::ast::extract(15, 8,  op1));
-            unpack.push_back(triton::ast::extract(7,  0,  op2));
-            unpack.push_back(triton::ast::extract(7,  0,  op1));
+            unpack.push_back(this->astCtxt->extract(63, 56, op2));
+            unpack.push_back(this->astCtxt->extract(63, 56, op1));
+            unpack.push_back(this->astCtxt->extract(55, 48, op2));
+            unpack.push_back(this->astCtxt->extract(55, 48, op1));
+            unpack.push_back(this->astCtxt->extract(47, 40, op2));
+            unpack.push_back(this->astCtxt->extract(47, 40, op1));
+            unpack.push_back(this->astCtxt->extract(39, 32, op2));
+            unpack.push_back(this->astCtxt->extract(39, 32, op1));
+            unpack.push_back(this->astCtxt->extract(31, 24, op2));
+            unpack.push_back(this->astCtxt->extract(31, 24, op1));
+            unpack.push_back(this->astCtxt->extract(23, 16, op2));
+            unpack.push_back(this->astCtxt->extract(23, 16, op1));
+            unpack.push_back(this->astCtxt->extract(15, 8,  op2));
+            unpack.push_back(this->astCtxt->extract(15, 8,  op1));
+            unpack.push_back(this->astCtxt->extract(7,  0,  op2));
+            unpack.push_back(this->astCtxt->extract(7,  0,  op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpcklbw_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKLBW operation");
@@ -9352,23 +9548,23 @@ namespace triton {
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(31, 0, op2));
-            unpack.push_back(triton::ast::extract(31, 0, op1));
+            unpack.push_back(this->astCtxt->extract(31, 0, op2));
+            unpack.push_back(this->astCtxt->extract(31, 0, op1));
             break;
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 32, op2));
-            unpack.push_back(triton::ast::extract(63, 32, op1));
-            unpack.push_back(triton::ast::extract(31, 0,  op2));
-            unpack.push_back(triton::ast::extract(31, 0,  op1));
+            unpack.push_back(this->astCtxt->extract(63, 32, op2));
+            unpack.push_back(this->astCtxt->extract(63, 32, op1));
+            unpack.push_back(this->astCtxt->extract(31, 0,  op2));
+            unpack.push_back(this->astCtxt->extract(31, 0,  op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpckldq_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKLDQ operation");
@@ -9396,15 +9592,15 @@ namespace triton {
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 0, op2));
-            unpack.push_back(triton::ast::extract(63, 0, op1));
+            unpack.push_back(this->astCtxt->extract(63, 0, op2));
+            unpack.push_back(this->astCtxt->extract(63, 0, op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpcklqdq_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKLQDQ operation");
@@ -9432,29 +9628,29 @@ namespace triton {
 
           /* MMX */
           case QWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(31, 16, op2));
-            unpack.push_back(triton::ast::extract(31, 16, op1));
-            unpack.push_back(triton::ast::extract(15, 0,  op2));
-            unpack.push_back(triton::ast::extract(15, 0,  op1));
+            unpack.push_back(this->astCtxt->extract(31, 16, op2));
+            unpack.push_back(this->astCtxt->extract(31, 16, op1));
+            unpack.push_back(this->astCtxt->extract(15, 0,  op2));
+            unpack.push_back(this->astCtxt->extract(15, 0,  op1));
             break;
 
           /* XMM */
           case DQWORD_SIZE_BIT:
-            unpack.push_back(triton::ast::extract(63, 48, op2));
-            unpack.push_back(triton::ast::extract(63, 48, op1));
-            unpack.push_back(triton::ast::extract(47, 32, op2));
-            unpack.push_back(triton::ast::extract(47, 32, op1));
-            unpack.push_back(triton::ast::extract(31, 16, op2));
-            unpack.push_back(triton::ast::extract(31, 16, op1));
-            unpack.push_back(triton::ast::extract(15, 0,  op2));
-            unpack.push_back(triton::ast::extract(15, 0,  op1));
+            unpack.push_back(this->astCtxt->extract(63, 48, op2));
+            unpack.push_back(this->astCtxt->extract(63, 48, op1));
+            unpack.push_back(this->astCtxt->extract(47, 32, op2));
+            unpack.push_back(this->astCtxt->extract(47, 32, op1));
+            unpack.push_back(this->astCtxt->extract(31, 16, op2));
+            unpack.push_back(this->astCtxt->extract(31, 16, op1));
+            unpack.push_back(this->astCtxt->extract(15, 0,  op2));
+            unpack.push_back(this->astCtxt->extract(15, 0,  op1));
             break;
 
           default:
             throw triton::exceptions::Semantics("x86Semantics::punpcklwd_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUNPCKLWD operation");
@@ -9469,7 +9665,7 @@ namespace triton {
 
       void x86Semantics::push_s(triton::arch::Instruction& inst) {
         auto& src           = inst.operands[0];
-        auto stack          = TRITON_X86_REG_SP.getParent();
+        auto stack          = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         triton::uint32 size = stack.getSize();
 
         /* If it's an immediate source, the memory access is always based on the arch size */
@@ -9484,7 +9680,7 @@ namespace triton {
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::zx(dst.getBitSize() - src.getBitSize(), op1);
+        auto node = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUSH operation");
@@ -9498,7 +9694,7 @@ namespace triton {
 
 
       void x86Semantics::pushal_s(triton::arch::Instruction& inst) {
-        auto stack      = TRITON_X86_REG_SP.getParent();
+        auto stack      = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
         auto dst1       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 1), stack.getSize()));
         auto dst2       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 2), stack.getSize()));
@@ -9508,14 +9704,14 @@ namespace triton {
         auto dst6       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 6), stack.getSize()));
         auto dst7       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 7), stack.getSize()));
         auto dst8       = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue-(stack.getSize() * 8), stack.getSize()));
-        auto src1       = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
-        auto src2       = triton::arch::OperandWrapper(TRITON_X86_REG_ECX);
-        auto src3       = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-        auto src4       = triton::arch::OperandWrapper(TRITON_X86_REG_EBX);
-        auto src5       = triton::arch::OperandWrapper(TRITON_X86_REG_ESP);
-        auto src6       = triton::arch::OperandWrapper(TRITON_X86_REG_EBP);
-        auto src7       = triton::arch::OperandWrapper(TRITON_X86_REG_ESI);
-        auto src8       = triton::arch::OperandWrapper(TRITON_X86_REG_EDI);
+        auto src1       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
+        auto src2       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ECX));
+        auto src3       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+        auto src4       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EBX));
+        auto src5       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ESP));
+        auto src6       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EBP));
+        auto src7       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ESI));
+        auto src8       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDI));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
@@ -9528,14 +9724,14 @@ namespace triton {
         auto op8 = this->symbolicEngine->buildSymbolicOperand(inst, src8);
 
         /* Create the semantics */
-        auto node1 = triton::ast::zx(dst1.getBitSize() - src1.getBitSize(), op1);
-        auto node2 = triton::ast::zx(dst2.getBitSize() - src2.getBitSize(), op2);
-        auto node3 = triton::ast::zx(dst3.getBitSize() - src3.getBitSize(), op3);
-        auto node4 = triton::ast::zx(dst4.getBitSize() - src4.getBitSize(), op4);
-        auto node5 = triton::ast::zx(dst5.getBitSize() - src5.getBitSize(), op5);
-        auto node6 = triton::ast::zx(dst6.getBitSize() - src6.getBitSize(), op6);
-        auto node7 = triton::ast::zx(dst7.getBitSize() - src7.getBitSize(), op7);
-        auto node8 = triton::ast::zx(dst8.getBitSize() - src8.getBitSize(), op8);
+        auto node1 = this->astCtxt->zx(dst1.getBitSize() - src1.getBitSize(), op1);
+        auto node2 = this->astCtxt->zx(dst2.getBitSize() - src2.getBitSize(), op2);
+        auto node3 = this->astCtxt->zx(dst3.getBitSize() - src3.getBitSize(), op3);
+        auto node4 = this->astCtxt->zx(dst4.getBitSize() - src4.getBitSize(), op4);
+        auto node5 = this->astCtxt->zx(dst5.getBitSize() - src5.getBitSize(), op5);
+        auto node6 = this->astCtxt->zx(dst6.getBitSize() - src6.getBitSize(), op6);
+        auto node7 = this->astCtxt->zx(dst7.getBitSize() - src7.getBitSize(), op7);
+        auto node8 = this->astCtxt->zx(dst8.getBitSize() - src8.getBitSize(), op8);
 
         /* Create symbolic expression */
         alignSubStack_s(inst, 32);
@@ -9564,20 +9760,20 @@ namespace triton {
 
 
       void x86Semantics::pushfd_s(triton::arch::Instruction& inst) {
-        auto stack = TRITON_X86_REG_SP.getParent();
+        auto stack = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
 
         /* Create the semantics - side effect */
         auto stackValue = alignSubStack_s(inst, stack.getSize());
         auto dst        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
-        auto src1       = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto src2       = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
-        auto src3       = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
-        auto src4       = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
-        auto src5       = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto src6       = triton::arch::OperandWrapper(TRITON_X86_REG_TF);
-        auto src7       = triton::arch::OperandWrapper(TRITON_X86_REG_IF);
-        auto src8       = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
-        auto src9       = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto src1       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto src2       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
+        auto src3       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AF));
+        auto src4       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
+        auto src5       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto src6       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_TF));
+        auto src7       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_IF));
+        auto src8       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
+        auto src9       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
@@ -9598,16 +9794,16 @@ namespace triton {
         eflags.push_back(op6);
         eflags.push_back(op5);
         eflags.push_back(op4);
-        eflags.push_back(triton::ast::bvfalse()); /* Reserved */
+        eflags.push_back(this->astCtxt->bvfalse()); /* Reserved */
         eflags.push_back(op3);
-        eflags.push_back(triton::ast::bvfalse()); /* Reserved */
+        eflags.push_back(this->astCtxt->bvfalse()); /* Reserved */
         eflags.push_back(op2);
-        eflags.push_back(triton::ast::bvfalse()); /* Reserved */
+        eflags.push_back(this->astCtxt->bvfalse()); /* Reserved */
         eflags.push_back(op1);
 
-        auto node = triton::ast::zx(
+        auto node = this->astCtxt->zx(
                       dst.getBitSize() - static_cast<triton::uint32>(eflags.size()),
-                      triton::ast::concat(eflags)
+                      this->astCtxt->concat(eflags)
                     );
 
         /* Create symbolic expression */
@@ -9630,20 +9826,20 @@ namespace triton {
 
 
       void x86Semantics::pushfq_s(triton::arch::Instruction& inst) {
-        auto stack = TRITON_X86_REG_SP.getParent();
+        auto stack = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
 
         /* Create the semantics - side effect */
         auto stackValue = alignSubStack_s(inst, stack.getSize());
         auto dst        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
-        auto src1       = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto src2       = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
-        auto src3       = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
-        auto src4       = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
-        auto src5       = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto src6       = triton::arch::OperandWrapper(TRITON_X86_REG_TF);
-        auto src7       = triton::arch::OperandWrapper(TRITON_X86_REG_IF);
-        auto src8       = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
-        auto src9       = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto src1       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto src2       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
+        auto src3       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AF));
+        auto src4       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
+        auto src5       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto src6       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_TF));
+        auto src7       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_IF));
+        auto src8       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
+        auto src9       = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
@@ -9664,16 +9860,16 @@ namespace triton {
         eflags.push_back(op6);
         eflags.push_back(op5);
         eflags.push_back(op4);
-        eflags.push_back(triton::ast::bvfalse()); /* Reserved */
+        eflags.push_back(this->astCtxt->bvfalse()); /* Reserved */
         eflags.push_back(op3);
-        eflags.push_back(triton::ast::bvfalse()); /* Reserved */
+        eflags.push_back(this->astCtxt->bvfalse()); /* Reserved */
         eflags.push_back(op2);
-        eflags.push_back(triton::ast::bvfalse()); /* Reserved */
+        eflags.push_back(this->astCtxt->bvfalse()); /* Reserved */
         eflags.push_back(op1);
 
-        auto node = triton::ast::zx(
+        auto node = this->astCtxt->zx(
                       dst.getBitSize() - static_cast<triton::uint32>(eflags.size()),
-                      triton::ast::concat(eflags)
+                      this->astCtxt->concat(eflags)
                     );
 
         /* Create symbolic expression */
@@ -9704,7 +9900,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvxor(op1, op2);
+        auto node = this->astCtxt->bvxor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PXOR operation");
@@ -9720,7 +9916,7 @@ namespace triton {
       void x86Semantics::rcl_s(triton::arch::Instruction& inst) {
         auto& dst   = inst.operands[0];
         auto& src   = inst.operands[1];
-        auto  srcCf = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  srcCf = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1    = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -9731,28 +9927,28 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask: 0x1f without MOD */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(
+            op2 = this->astCtxt->bvand(
                     op2,
-                    triton::ast::bv(QWORD_SIZE_BIT-1, src.getBitSize())
+                    this->astCtxt->bv(QWORD_SIZE_BIT-1, src.getBitSize())
                   );
             break;
 
           /* Mask: 0x1f without MOD */
           case DWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(
+            op2 = this->astCtxt->bvand(
                     op2,
-                    triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())
+                    this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())
                   );
             break;
 
           /* Mask: 0x1f MOD size + 1 */
           case WORD_SIZE_BIT:
           case BYTE_SIZE_BIT:
-            op2 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op2 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op2,
-                      triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())),
-                    triton::ast::bv(dst.getBitSize()+1, src.getBitSize())
+                      this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize()+1, src.getBitSize())
                   );
             break;
 
@@ -9761,7 +9957,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvrol(triton::ast::decimal(op2->evaluate()), triton::ast::concat(op3, op1));
+        auto node1 = this->astCtxt->bvrol(this->astCtxt->decimal(op2->evaluate()), this->astCtxt->concat(op3, op1));
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "RCL tempory operation");
@@ -9770,7 +9966,7 @@ namespace triton {
         expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
 
         /* Create the semantics */
-        auto node2 = triton::ast::extract(dst.getBitSize()-1, 0, node1);
+        auto node2 = this->astCtxt->extract(dst.getBitSize()-1, 0, node1);
 
         /* Create symbolic expression */
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, dst, "RCL operation");
@@ -9791,7 +9987,7 @@ namespace triton {
       void x86Semantics::rcr_s(triton::arch::Instruction& inst) {
         auto& dst   = inst.operands[0];
         auto& src   = inst.operands[1];
-        auto  srcCf = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  srcCf = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1    = this->symbolicEngine->buildSymbolicOperand(inst, dst);
@@ -9801,28 +9997,28 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask: 0x3f without MOD */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(
+            op2 = this->astCtxt->bvand(
                     op2,
-                    triton::ast::bv(QWORD_SIZE_BIT-1, src.getBitSize())
+                    this->astCtxt->bv(QWORD_SIZE_BIT-1, src.getBitSize())
                   );
             break;
 
           /* Mask: 0x1f without MOD */
           case DWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(
+            op2 = this->astCtxt->bvand(
                     op2,
-                    triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())
+                    this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())
                   );
             break;
 
           /* Mask: 0x1f MOD size + 1 */
           case WORD_SIZE_BIT:
           case BYTE_SIZE_BIT:
-            op2 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op2 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op2,
-                      triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())),
-                    triton::ast::bv(dst.getBitSize()+1, src.getBitSize())
+                      this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize()+1, src.getBitSize())
                   );
             break;
 
@@ -9831,7 +10027,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvror(triton::ast::decimal(op2->evaluate()), triton::ast::concat(op3, op1));
+        auto node1 = this->astCtxt->bvror(this->astCtxt->decimal(op2->evaluate()), this->astCtxt->concat(op3, op1));
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "RCR tempory operation");
@@ -9840,7 +10036,7 @@ namespace triton {
         expr1->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
 
         /* Create the semantics */
-        auto node2 = triton::ast::extract(dst.getBitSize()-1, 0, node1);
+        auto node2 = this->astCtxt->extract(dst.getBitSize()-1, 0, node1);
 
         /* Create symbolic expression */
         auto expr2 = this->symbolicEngine->createSymbolicExpression(inst, node2, dst, "RCR operation");
@@ -9859,12 +10055,12 @@ namespace triton {
 
 
       void x86Semantics::rdtsc_s(triton::arch::Instruction& inst) {
-        auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_EDX);
-        auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_EAX);
+        auto dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EDX));
+        auto dst2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EAX));
 
         /* Create symbolic operands */
-        auto op1 = triton::ast::bv(0, dst1.getBitSize());
-        auto op2 = triton::ast::bv(this->symbolicEngine->getSymbolicExpressions().size(), dst2.getBitSize());
+        auto op1 = this->astCtxt->bv(0, dst1.getBitSize());
+        auto op2 = this->astCtxt->bv(this->symbolicEngine->getSymbolicExpressions().size(), dst2.getBitSize());
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, op1, dst1, "RDTSC EDX operation");
@@ -9880,9 +10076,9 @@ namespace triton {
 
 
       void x86Semantics::ret_s(triton::arch::Instruction& inst) {
-        auto stack      = TRITON_X86_REG_SP.getParent();
+        auto stack      = this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP);
         auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
-        auto pc         = triton::arch::OperandWrapper(TRITON_X86_REG_PC);
+        auto pc         = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
         auto sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
 
         /* Create symbolic operands */
@@ -9924,16 +10120,16 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op2 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op2,
-                      triton::ast::bv(QWORD_SIZE_BIT-1, src.getBitSize())),
-                    triton::ast::bv(dst.getBitSize(), src.getBitSize())
+                      this->astCtxt->bv(QWORD_SIZE_BIT-1, src.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize(), src.getBitSize())
                   );
 
-            op2bis = triton::ast::bvand(
+            op2bis = this->astCtxt->bvand(
                        op2bis,
-                       triton::ast::bv(QWORD_SIZE_BIT-1, src.getBitSize())
+                       this->astCtxt->bv(QWORD_SIZE_BIT-1, src.getBitSize())
                      );
             break;
 
@@ -9941,16 +10137,16 @@ namespace triton {
           case DWORD_SIZE_BIT:
           case WORD_SIZE_BIT:
           case BYTE_SIZE_BIT:
-            op2 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op2 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op2,
-                      triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())),
-                    triton::ast::bv(dst.getBitSize(), src.getBitSize())
+                      this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize(), src.getBitSize())
                   );
 
-            op2bis = triton::ast::bvand(
+            op2bis = this->astCtxt->bvand(
                        op2bis,
-                       triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())
+                       this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())
                      );
             break;
 
@@ -9959,7 +10155,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::bvrol(triton::ast::decimal(op2->evaluate()), op1);
+        auto node = this->astCtxt->bvrol(this->astCtxt->decimal(op2->evaluate()), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ROL operation");
@@ -9988,16 +10184,16 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op2 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op2,
-                      triton::ast::bv(QWORD_SIZE_BIT-1, src.getBitSize())),
-                    triton::ast::bv(dst.getBitSize(), src.getBitSize())
+                      this->astCtxt->bv(QWORD_SIZE_BIT-1, src.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize(), src.getBitSize())
                   );
 
-            op2bis = triton::ast::bvand(
+            op2bis = this->astCtxt->bvand(
                        op2bis,
-                       triton::ast::bv(QWORD_SIZE_BIT-1, src.getBitSize())
+                       this->astCtxt->bv(QWORD_SIZE_BIT-1, src.getBitSize())
                      );
             break;
 
@@ -10005,16 +10201,16 @@ namespace triton {
           case DWORD_SIZE_BIT:
           case WORD_SIZE_BIT:
           case BYTE_SIZE_BIT:
-            op2 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op2 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op2,
-                      triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())),
-                    triton::ast::bv(dst.getBitSize(), src.getBitSize())
+                      this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize(), src.getBitSize())
                   );
 
-            op2bis = triton::ast::bvand(
+            op2bis = this->astCtxt->bvand(
                        op2bis,
-                       triton::ast::bv(DWORD_SIZE_BIT-1, src.getBitSize())
+                       this->astCtxt->bv(DWORD_SIZE_BIT-1, src.getBitSize())
                      );
             break;
 
@@ -10023,7 +10219,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::bvror(triton::ast::decimal(op2->evaluate()), op1);
+        auto node = this->astCtxt->bvror(this->astCtxt->decimal(op2->evaluate()), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ROR operation");
@@ -10052,12 +10248,12 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           /* Mask 0x1f MOD size */
           case DWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           default:
@@ -10065,7 +10261,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::bvror(triton::ast::decimal(op2->evaluate()), op1);
+        auto node = this->astCtxt->bvror(this->astCtxt->decimal(op2->evaluate()), op1);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "RORX operation");
@@ -10080,22 +10276,22 @@ namespace triton {
 
 
       void x86Semantics::sahf_s(triton::arch::Instruction& inst) {
-        auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
-        auto dst3 = triton::arch::OperandWrapper(TRITON_X86_REG_AF);
-        auto dst4 = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
-        auto dst5 = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto src  = triton::arch::OperandWrapper(TRITON_X86_REG_AH);
+        auto dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto dst2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
+        auto dst3 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AF));
+        auto dst4 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
+        auto dst5 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto src  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_AH));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node1 = triton::ast::extract(7, 7, op1);
-        auto node2 = triton::ast::extract(6, 6, op1);
-        auto node3 = triton::ast::extract(4, 4, op1);
-        auto node4 = triton::ast::extract(2, 2, op1);
-        auto node5 = triton::ast::extract(0, 0, op1);
+        auto node1 = this->astCtxt->extract(7, 7, op1);
+        auto node2 = this->astCtxt->extract(6, 6, op1);
+        auto node3 = this->astCtxt->extract(4, 4, op1);
+        auto node4 = this->astCtxt->extract(2, 2, op1);
+        auto node5 = this->astCtxt->extract(0, 0, op1);
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicFlagExpression(inst, node1, dst1.getRegister(), "SAHF SF operation");
@@ -10122,15 +10318,15 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op2 = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
 
         if (dst.getBitSize() == QWORD_SIZE_BIT)
-          op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
+          op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
         else
-          op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, dst.getBitSize()));
+          op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, dst.getBitSize()));
 
         /* Create the semantics */
-        auto node = triton::ast::bvashr(op1, op2);
+        auto node = this->astCtxt->bvashr(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SAR operation");
@@ -10162,12 +10358,12 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           /* Mask 0x1f MOD size */
           case DWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           default:
@@ -10175,7 +10371,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::bvashr(op1, op2);
+        auto node = this->astCtxt->bvashr(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SARX operation");
@@ -10192,15 +10388,15 @@ namespace triton {
       void x86Semantics::sbb_s(triton::arch::Instruction& inst) {
         auto& dst   = inst.operands[0];
         auto& src   = inst.operands[1];
-        auto  srcCf = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  srcCf = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
-        auto op3 = triton::ast::zx(src.getBitSize()-1, this->symbolicEngine->buildSymbolicOperand(inst, srcCf));
+        auto op3 = this->astCtxt->zx(src.getBitSize()-1, this->symbolicEngine->buildSymbolicOperand(inst, srcCf));
 
         /* Create the semantics */
-        auto node = triton::ast::bvsub(op1, triton::ast::bvadd(op2, op3));
+        auto node = this->astCtxt->bvsub(op1, this->astCtxt->bvadd(op2, op3));
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SBB operation");
@@ -10225,8 +10421,8 @@ namespace triton {
       void x86Semantics::scasb_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -10239,11 +10435,11 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(BYTE_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(BYTE_SIZE, index.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(BYTE_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(BYTE_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -10270,8 +10466,8 @@ namespace triton {
       void x86Semantics::scasd_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -10284,11 +10480,11 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(DWORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(DWORD_SIZE, index.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(DWORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(DWORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -10315,8 +10511,8 @@ namespace triton {
       void x86Semantics::scasq_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -10329,11 +10525,11 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(QWORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(QWORD_SIZE, index.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(QWORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(QWORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -10360,8 +10556,8 @@ namespace triton {
       void x86Semantics::scasw_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* If the REP prefix is defined, convert REP into REPE */
         if (inst.getPrefix() == triton::arch::x86::ID_PREFIX_REP)
@@ -10374,11 +10570,11 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, df);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvsub(op1, op2);
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op4, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op3, triton::ast::bv(WORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op3, triton::ast::bv(WORD_SIZE, index.getBitSize()))
+        auto node1 = this->astCtxt->bvsub(op1, op2);
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op4, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op3, this->astCtxt->bv(WORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op3, this->astCtxt->bv(WORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -10404,24 +10600,24 @@ namespace triton {
 
       void x86Semantics::seta_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::bvand(
-                          triton::ast::bvnot(op2),
-                          triton::ast::bvnot(op3)
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(
+                        this->astCtxt->bvand(
+                          this->astCtxt->bvnot(op2),
+                          this->astCtxt->bvnot(op3)
                         ),
-                        triton::ast::bvtrue()
+                        this->astCtxt->bvtrue()
                       ),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10443,16 +10639,16 @@ namespace triton {
 
       void x86Semantics::setae_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvfalse()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10473,16 +10669,16 @@ namespace triton {
 
       void x86Semantics::setb_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10503,18 +10699,18 @@ namespace triton {
 
       void x86Semantics::setbe_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  cf  = triton::arch::OperandWrapper(TRITON_X86_REG_CF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  cf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_CF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, cf);
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(triton::ast::bvor(op2, op3), triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(this->astCtxt->bvor(op2, op3), this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10536,16 +10732,16 @@ namespace triton {
 
       void x86Semantics::sete_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10566,9 +10762,9 @@ namespace triton {
 
       void x86Semantics::setg_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
@@ -10576,10 +10772,10 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op2, op3), op4), triton::ast::bvfalse()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op2, op3), op4), this->astCtxt->bvfalse()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10602,18 +10798,18 @@ namespace triton {
 
       void x86Semantics::setge_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, op3),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, op3),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10635,18 +10831,18 @@ namespace triton {
 
       void x86Semantics::setl_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(triton::ast::bvxor(op2, op3), triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(this->astCtxt->bvxor(op2, op3), this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10668,9 +10864,9 @@ namespace triton {
 
       void x86Semantics::setle_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
@@ -10678,10 +10874,10 @@ namespace triton {
         auto op4 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(triton::ast::bvor(triton::ast::bvxor(op2, op3), op4), triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(this->astCtxt->bvor(this->astCtxt->bvxor(op2, op3), op4), this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10704,16 +10900,16 @@ namespace triton {
 
       void x86Semantics::setne_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  zf  = triton::arch::OperandWrapper(TRITON_X86_REG_ZF);
+        auto  zf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_ZF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, zf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvfalse()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10734,16 +10930,16 @@ namespace triton {
 
       void x86Semantics::setno_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvfalse()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10764,16 +10960,16 @@ namespace triton {
 
       void x86Semantics::setnp_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto  pf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, pf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvfalse()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10794,16 +10990,16 @@ namespace triton {
 
       void x86Semantics::setns_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvfalse()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvfalse()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10824,16 +11020,16 @@ namespace triton {
 
       void x86Semantics::seto_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  of  = triton::arch::OperandWrapper(TRITON_X86_REG_OF);
+        auto  of  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_OF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, of);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10854,16 +11050,16 @@ namespace triton {
 
       void x86Semantics::setp_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  pf  = triton::arch::OperandWrapper(TRITON_X86_REG_PF);
+        auto  pf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_PF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, pf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10884,16 +11080,16 @@ namespace triton {
 
       void x86Semantics::sets_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  sf  = triton::arch::OperandWrapper(TRITON_X86_REG_SF);
+        auto  sf  = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_SF));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, sf);
 
         /* Create the semantics */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(op2, triton::ast::bvtrue()),
-                      triton::ast::bv(1, dst.getBitSize()),
-                      triton::ast::bv(0, dst.getBitSize())
+        auto node = this->astCtxt->ite(
+                      this->astCtxt->equal(op2, this->astCtxt->bvtrue()),
+                      this->astCtxt->bv(1, dst.getBitSize()),
+                      this->astCtxt->bv(0, dst.getBitSize())
                     );
 
         /* Create symbolic expression */
@@ -10924,15 +11120,15 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op2 = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
 
         if (dst.getBitSize() == QWORD_SIZE_BIT)
-          op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
+          op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
         else
-          op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, dst.getBitSize()));
+          op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, dst.getBitSize()));
 
         /* Create the semantics */
-        auto node = triton::ast::bvshl(op1, op2);
+        auto node = this->astCtxt->bvshl(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SHL operation");
@@ -10965,22 +11161,22 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op3 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op3 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op3,
-                      triton::ast::bv(QWORD_SIZE_BIT-1, src2.getBitSize())),
-                    triton::ast::bv(dst.getBitSize(), src2.getBitSize())
+                      this->astCtxt->bv(QWORD_SIZE_BIT-1, src2.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize(), src2.getBitSize())
                   );
             break;
 
           /* Mask 0x1f MOD size */
           case DWORD_SIZE_BIT:
           case WORD_SIZE_BIT:
-            op3 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op3 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op3,
-                      triton::ast::bv(DWORD_SIZE_BIT-1, src2.getBitSize())),
-                    triton::ast::bv(DWORD_SIZE_BIT, src2.getBitSize())
+                      this->astCtxt->bv(DWORD_SIZE_BIT-1, src2.getBitSize())),
+                    this->astCtxt->bv(DWORD_SIZE_BIT, src2.getBitSize())
                   );
             break;
 
@@ -10989,11 +11185,11 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::extract(
+        auto node = this->astCtxt->extract(
                       dst.getBitSize()-1, 0,
-                      triton::ast::bvrol(
-                        triton::ast::decimal(op3->evaluate()),
-                        triton::ast::concat(op2, op1))
+                      this->astCtxt->bvrol(
+                        this->astCtxt->decimal(op3->evaluate()),
+                        this->astCtxt->concat(op2, op1))
                     );
 
         /* Create symbolic expression */
@@ -11027,12 +11223,12 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           /* Mask 0x1f MOD size */
           case DWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           default:
@@ -11040,7 +11236,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::bvshl(op1, op2);
+        auto node = this->astCtxt->bvshl(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SHLX operation");
@@ -11060,15 +11256,15 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op2 = this->astCtxt->zx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
 
         if (dst.getBitSize() == QWORD_SIZE_BIT)
-          op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
+          op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, dst.getBitSize()));
         else
-          op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, dst.getBitSize()));
+          op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, dst.getBitSize()));
 
         /* Create the semantics */
-        auto node = triton::ast::bvlshr(op1, op2);
+        auto node = this->astCtxt->bvlshr(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SHR operation");
@@ -11101,22 +11297,22 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op3 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op3 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op3,
-                      triton::ast::bv(QWORD_SIZE_BIT-1, src2.getBitSize())),
-                    triton::ast::bv(dst.getBitSize(), src2.getBitSize())
+                      this->astCtxt->bv(QWORD_SIZE_BIT-1, src2.getBitSize())),
+                    this->astCtxt->bv(dst.getBitSize(), src2.getBitSize())
                   );
             break;
 
           /* Mask 0x1f MOD size */
           case DWORD_SIZE_BIT:
           case WORD_SIZE_BIT:
-            op3 = triton::ast::bvsmod(
-                    triton::ast::bvand(
+            op3 = this->astCtxt->bvsmod(
+                    this->astCtxt->bvand(
                       op3,
-                      triton::ast::bv(DWORD_SIZE_BIT-1, src2.getBitSize())),
-                    triton::ast::bv(DWORD_SIZE_BIT, src2.getBitSize())
+                      this->astCtxt->bv(DWORD_SIZE_BIT-1, src2.getBitSize())),
+                    this->astCtxt->bv(DWORD_SIZE_BIT, src2.getBitSize())
                   );
             break;
 
@@ -11125,11 +11321,11 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::extract(
+        auto node = this->astCtxt->extract(
                       dst.getBitSize()-1, 0,
-                      triton::ast::bvror(
-                        triton::ast::decimal(op3->evaluate()),
-                        triton::ast::concat(op2, op1))
+                      this->astCtxt->bvror(
+                        this->astCtxt->decimal(op3->evaluate()),
+                        this->astCtxt->concat(op2, op1))
                     );
 
         /* Create symbolic expression */
@@ -11163,12 +11359,12 @@ namespace triton {
         switch (dst.getBitSize()) {
           /* Mask 0x3f MOD size */
           case QWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(QWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           /* Mask 0x1f MOD size */
           case DWORD_SIZE_BIT:
-            op2 = triton::ast::bvand(op2, triton::ast::bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
+            op2 = this->astCtxt->bvand(op2, this->astCtxt->bv(DWORD_SIZE_BIT-1, src2.getBitSize()));
             break;
 
           default:
@@ -11176,7 +11372,7 @@ namespace triton {
         }
 
         /* Create the semantics */
-        auto node = triton::ast::bvlshr(op1, op2);
+        auto node = this->astCtxt->bvlshr(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SHRX operation");
@@ -11191,21 +11387,21 @@ namespace triton {
 
 
       void x86Semantics::stc_s(triton::arch::Instruction& inst) {
-        this->setFlag_s(inst, TRITON_X86_REG_CF, "Sets carry flag");
+        this->setFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Sets carry flag");
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
 
 
       void x86Semantics::std_s(triton::arch::Instruction& inst) {
-        this->setFlag_s(inst, TRITON_X86_REG_DF, "Sets direction flag");
+        this->setFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_DF), "Sets direction flag");
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
 
 
       void x86Semantics::sti_s(triton::arch::Instruction& inst) {
-        this->setFlag_s(inst, TRITON_X86_REG_IF, "Sets interrupt flag");
+        this->setFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_IF), "Sets interrupt flag");
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
@@ -11213,13 +11409,13 @@ namespace triton {
 
       void x86Semantics::stmxcsr_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
-        auto  src = triton::arch::OperandWrapper(TRITON_X86_REG_MXCSR);
+        auto  src = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_MXCSR));
 
         /* Create symbolic operands */
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::extract(DWORD_SIZE_BIT-1, 0, op2);
+        auto node = this->astCtxt->extract(DWORD_SIZE_BIT-1, 0, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "STMXCSR operation");
@@ -11235,8 +11431,8 @@ namespace triton {
       void x86Semantics::stosb_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -11245,10 +11441,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(BYTE_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(BYTE_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(BYTE_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(BYTE_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -11267,8 +11463,8 @@ namespace triton {
       void x86Semantics::stosd_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -11277,10 +11473,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(DWORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(DWORD_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(DWORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(DWORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -11299,8 +11495,8 @@ namespace triton {
       void x86Semantics::stosq_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -11309,10 +11505,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(QWORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(QWORD_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(QWORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(QWORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -11331,8 +11527,8 @@ namespace triton {
       void x86Semantics::stosw_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
-        auto  index  = triton::arch::OperandWrapper(TRITON_X86_REG_DI.getParent());
-        auto  df     = triton::arch::OperandWrapper(TRITON_X86_REG_DF);
+        auto  index  = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_DI));
+        auto  df     = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_DF));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
@@ -11341,10 +11537,10 @@ namespace triton {
 
         /* Create the semantics */
         auto node1 = op1;
-        auto node2 = triton::ast::ite(
-                       triton::ast::equal(op3, triton::ast::bvfalse()),
-                       triton::ast::bvadd(op2, triton::ast::bv(WORD_SIZE, index.getBitSize())),
-                       triton::ast::bvsub(op2, triton::ast::bv(WORD_SIZE, index.getBitSize()))
+        auto node2 = this->astCtxt->ite(
+                       this->astCtxt->equal(op3, this->astCtxt->bvfalse()),
+                       this->astCtxt->bvadd(op2, this->astCtxt->bv(WORD_SIZE, index.getBitSize())),
+                       this->astCtxt->bvsub(op2, this->astCtxt->bv(WORD_SIZE, index.getBitSize()))
                      );
 
         /* Create symbolic expression */
@@ -11369,7 +11565,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvsub(op1, op2);
+        auto node = this->astCtxt->bvsub(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SUB operation");
@@ -11391,17 +11587,17 @@ namespace triton {
 
 
       void x86Semantics::syscall_s(triton::arch::Instruction& inst) {
-        auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_RCX);
-        auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_R11);
-        auto src1 = triton::arch::OperandWrapper(TRITON_X86_REG_RIP);
-        auto src2 = triton::arch::OperandWrapper(TRITON_X86_REG_EFLAGS);
+        auto dst1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RCX));
+        auto dst2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_R11));
+        auto src1 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_RIP));
+        auto src2 = triton::arch::OperandWrapper(this->architecture->getRegister(triton::arch::x86::ID_REG_EFLAGS));
 
         /* Create symbolic operands */
         auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src1);
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvadd(op1, triton::ast::bv(inst.getSize(), src1.getBitSize()));
+        auto node1 = this->astCtxt->bvadd(op1, this->astCtxt->bv(inst.getSize(), src1.getBitSize()));
         auto node2 = op2;
 
         /* Create symbolic expression */
@@ -11426,7 +11622,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(op1, op2);
+        auto node = this->astCtxt->bvand(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "TEST operation");
@@ -11435,8 +11631,8 @@ namespace triton {
         expr->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->pf_s(inst, expr, src1, true);
         this->sf_s(inst, expr, src1, true);
         this->zf_s(inst, expr, src1, true);
@@ -11459,154 +11655,154 @@ namespace triton {
         triton::ast::AbstractNode* node = nullptr;
         switch (src.getSize()) {
           case BYTE_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)),
-                     triton::ast::bv(bvSize1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)),
+                     this->astCtxt->bv(bvSize1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))
                    );
             break;
           case WORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)),
-                     triton::ast::bv(bvSize1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)),
+                     this->astCtxt->bv(bvSize1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))
                    );
             break;
           case DWORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)),
-                     triton::ast::bv(bvSize1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(16, 16, op2), triton::ast::bvtrue()), triton::ast::bv(16, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(17, 17, op2), triton::ast::bvtrue()), triton::ast::bv(17, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(18, 18, op2), triton::ast::bvtrue()), triton::ast::bv(18, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(19, 19, op2), triton::ast::bvtrue()), triton::ast::bv(19, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(20, 20, op2), triton::ast::bvtrue()), triton::ast::bv(20, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(21, 21, op2), triton::ast::bvtrue()), triton::ast::bv(21, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(22, 22, op2), triton::ast::bvtrue()), triton::ast::bv(22, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(23, 23, op2), triton::ast::bvtrue()), triton::ast::bv(23, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(24, 24, op2), triton::ast::bvtrue()), triton::ast::bv(24, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(25, 25, op2), triton::ast::bvtrue()), triton::ast::bv(25, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(26, 26, op2), triton::ast::bvtrue()), triton::ast::bv(26, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(27, 27, op2), triton::ast::bvtrue()), triton::ast::bv(27, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(28, 28, op2), triton::ast::bvtrue()), triton::ast::bv(28, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(29, 29, op2), triton::ast::bvtrue()), triton::ast::bv(29, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(30, 30, op2), triton::ast::bvtrue()), triton::ast::bv(30, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(31, 31, op2), triton::ast::bvtrue()), triton::ast::bv(31, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)),
+                     this->astCtxt->bv(bvSize1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(16, 16, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(16, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(17, 17, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(17, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(18, 18, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(18, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(19, 19, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(19, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(20, 20, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(20, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(21, 21, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(21, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(22, 22, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(22, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(23, 23, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(23, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(24, 24, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(24, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(25, 25, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(25, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(26, 26, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(26, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(27, 27, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(27, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(28, 28, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(28, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(29, 29, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(29, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(30, 30, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(30, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(31, 31, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(31, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))))))))))))))))))
                    );
             break;
           case QWORD_SIZE:
-            node = triton::ast::ite(
-                     triton::ast::equal(op2, triton::ast::bv(0, bvSize2)),
-                     triton::ast::bv(bvSize1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(0, 0, op2), triton::ast::bvtrue()), triton::ast::bv(0, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(1, 1, op2), triton::ast::bvtrue()), triton::ast::bv(1, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(2, 2, op2), triton::ast::bvtrue()), triton::ast::bv(2, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(3, 3, op2), triton::ast::bvtrue()), triton::ast::bv(3, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(4, 4, op2), triton::ast::bvtrue()), triton::ast::bv(4, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(5, 5, op2), triton::ast::bvtrue()), triton::ast::bv(5, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(6, 6, op2), triton::ast::bvtrue()), triton::ast::bv(6, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(7, 7, op2), triton::ast::bvtrue()), triton::ast::bv(7, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(8, 8, op2), triton::ast::bvtrue()), triton::ast::bv(8, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(9, 9, op2), triton::ast::bvtrue()), triton::ast::bv(9, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(10, 10, op2), triton::ast::bvtrue()), triton::ast::bv(10, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(11, 11, op2), triton::ast::bvtrue()), triton::ast::bv(11, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(12, 12, op2), triton::ast::bvtrue()), triton::ast::bv(12, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(13, 13, op2), triton::ast::bvtrue()), triton::ast::bv(13, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(14, 14, op2), triton::ast::bvtrue()), triton::ast::bv(14, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(15, 15, op2), triton::ast::bvtrue()), triton::ast::bv(15, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(16, 16, op2), triton::ast::bvtrue()), triton::ast::bv(16, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(17, 17, op2), triton::ast::bvtrue()), triton::ast::bv(17, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(18, 18, op2), triton::ast::bvtrue()), triton::ast::bv(18, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(19, 19, op2), triton::ast::bvtrue()), triton::ast::bv(19, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(20, 20, op2), triton::ast::bvtrue()), triton::ast::bv(20, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(21, 21, op2), triton::ast::bvtrue()), triton::ast::bv(21, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(22, 22, op2), triton::ast::bvtrue()), triton::ast::bv(22, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(23, 23, op2), triton::ast::bvtrue()), triton::ast::bv(23, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(24, 24, op2), triton::ast::bvtrue()), triton::ast::bv(24, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(25, 25, op2), triton::ast::bvtrue()), triton::ast::bv(25, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(26, 26, op2), triton::ast::bvtrue()), triton::ast::bv(26, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(27, 27, op2), triton::ast::bvtrue()), triton::ast::bv(27, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(28, 28, op2), triton::ast::bvtrue()), triton::ast::bv(28, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(29, 29, op2), triton::ast::bvtrue()), triton::ast::bv(29, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(30, 30, op2), triton::ast::bvtrue()), triton::ast::bv(30, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(31, 31, op2), triton::ast::bvtrue()), triton::ast::bv(31, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(32, 32, op2), triton::ast::bvtrue()), triton::ast::bv(32, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(33, 33, op2), triton::ast::bvtrue()), triton::ast::bv(33, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(34, 34, op2), triton::ast::bvtrue()), triton::ast::bv(34, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(35, 35, op2), triton::ast::bvtrue()), triton::ast::bv(35, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(36, 36, op2), triton::ast::bvtrue()), triton::ast::bv(36, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(37, 37, op2), triton::ast::bvtrue()), triton::ast::bv(37, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(38, 38, op2), triton::ast::bvtrue()), triton::ast::bv(38, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(39, 39, op2), triton::ast::bvtrue()), triton::ast::bv(39, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(40, 40, op2), triton::ast::bvtrue()), triton::ast::bv(40, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(41, 41, op2), triton::ast::bvtrue()), triton::ast::bv(41, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(42, 42, op2), triton::ast::bvtrue()), triton::ast::bv(42, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(43, 43, op2), triton::ast::bvtrue()), triton::ast::bv(43, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(44, 44, op2), triton::ast::bvtrue()), triton::ast::bv(44, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(45, 45, op2), triton::ast::bvtrue()), triton::ast::bv(45, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(46, 46, op2), triton::ast::bvtrue()), triton::ast::bv(46, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(47, 47, op2), triton::ast::bvtrue()), triton::ast::bv(47, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(48, 48, op2), triton::ast::bvtrue()), triton::ast::bv(48, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(49, 49, op2), triton::ast::bvtrue()), triton::ast::bv(49, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(50, 50, op2), triton::ast::bvtrue()), triton::ast::bv(50, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(51, 51, op2), triton::ast::bvtrue()), triton::ast::bv(51, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(52, 52, op2), triton::ast::bvtrue()), triton::ast::bv(52, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(53, 53, op2), triton::ast::bvtrue()), triton::ast::bv(53, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(54, 54, op2), triton::ast::bvtrue()), triton::ast::bv(54, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(55, 55, op2), triton::ast::bvtrue()), triton::ast::bv(55, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(56, 56, op2), triton::ast::bvtrue()), triton::ast::bv(56, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(57, 57, op2), triton::ast::bvtrue()), triton::ast::bv(57, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(58, 58, op2), triton::ast::bvtrue()), triton::ast::bv(58, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(59, 59, op2), triton::ast::bvtrue()), triton::ast::bv(59, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(60, 60, op2), triton::ast::bvtrue()), triton::ast::bv(60, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(61, 61, op2), triton::ast::bvtrue()), triton::ast::bv(61, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(62, 62, op2), triton::ast::bvtrue()), triton::ast::bv(62, bvSize1),
-                     triton::ast::ite(triton::ast::equal(triton::ast::extract(63, 63, op2), triton::ast::bvtrue()), triton::ast::bv(63, bvSize1),
-                     triton::ast::bv(0, bvSize1)
+            node = this->astCtxt->ite(
+                     this->astCtxt->equal(op2, this->astCtxt->bv(0, bvSize2)),
+                     this->astCtxt->bv(bvSize1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(0, 0, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(0, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(1, 1, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(1, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(2, 2, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(2, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(3, 3, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(3, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(4, 4, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(4, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(5, 5, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(5, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(6, 6, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(6, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(7, 7, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(7, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(8, 8, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(8, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(9, 9, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(9, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(10, 10, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(10, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(11, 11, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(11, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(12, 12, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(12, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(13, 13, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(13, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(14, 14, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(14, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(15, 15, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(15, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(16, 16, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(16, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(17, 17, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(17, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(18, 18, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(18, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(19, 19, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(19, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(20, 20, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(20, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(21, 21, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(21, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(22, 22, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(22, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(23, 23, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(23, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(24, 24, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(24, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(25, 25, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(25, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(26, 26, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(26, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(27, 27, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(27, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(28, 28, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(28, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(29, 29, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(29, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(30, 30, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(30, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(31, 31, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(31, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(32, 32, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(32, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(33, 33, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(33, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(34, 34, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(34, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(35, 35, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(35, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(36, 36, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(36, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(37, 37, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(37, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(38, 38, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(38, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(39, 39, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(39, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(40, 40, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(40, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(41, 41, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(41, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(42, 42, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(42, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(43, 43, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(43, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(44, 44, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(44, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(45, 45, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(45, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(46, 46, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(46, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(47, 47, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(47, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(48, 48, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(48, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(49, 49, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(49, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(50, 50, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(50, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(51, 51, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(51, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(52, 52, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(52, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(53, 53, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(53, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(54, 54, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(54, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(55, 55, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(55, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(56, 56, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(56, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(57, 57, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(57, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(58, 58, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(58, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(59, 59, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(59, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(60, 60, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(60, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(61, 61, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(61, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(62, 62, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(62, bvSize1),
+                     this->astCtxt->ite(this->astCtxt->equal(this->astCtxt->extract(63, 63, op2), this->astCtxt->bvtrue()), this->astCtxt->bv(63, bvSize1),
+                     this->astCtxt->bv(0, bvSize1)
                      ))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))
                    );
             break;
@@ -11637,9 +11833,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::concat(
-                      triton::ast::extract(127, 64, op2),
-                      triton::ast::extract(127, 64, op1)
+        auto node = this->astCtxt->concat(
+                      this->astCtxt->extract(127, 64, op2),
+                      this->astCtxt->extract(127, 64, op1)
                     );
 
         /* Create symbolic expression */
@@ -11664,12 +11860,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> unpack;
 
-        unpack.push_back(triton::ast::extract(127, 96, op2));
-        unpack.push_back(triton::ast::extract(127, 96, op1));
-        unpack.push_back(triton::ast::extract(95, 64, op2));
-        unpack.push_back(triton::ast::extract(95, 64, op1));
+        unpack.push_back(this->astCtxt->extract(127, 96, op2));
+        unpack.push_back(this->astCtxt->extract(127, 96, op1));
+        unpack.push_back(this->astCtxt->extract(95, 64, op2));
+        unpack.push_back(this->astCtxt->extract(95, 64, op1));
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "UNPCKHPS operation");
@@ -11691,9 +11887,9 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::concat(
-                      triton::ast::extract(63, 0, op2),
-                      triton::ast::extract(63, 0, op1)
+        auto node = this->astCtxt->concat(
+                      this->astCtxt->extract(63, 0, op2),
+                      this->astCtxt->extract(63, 0, op1)
                     );
 
         /* Create symbolic expression */
@@ -11718,12 +11914,12 @@ namespace triton {
         /* Create the semantics */
         std::list<triton::ast::AbstractNode*> unpack;
 
-        unpack.push_back(triton::ast::extract(63, 32, op2));
-        unpack.push_back(triton::ast::extract(63, 32, op1));
-        unpack.push_back(triton::ast::extract(31, 0, op2));
-        unpack.push_back(triton::ast::extract(31, 0, op1));
+        unpack.push_back(this->astCtxt->extract(63, 32, op2));
+        unpack.push_back(this->astCtxt->extract(63, 32, op1));
+        unpack.push_back(this->astCtxt->extract(31, 0, op2));
+        unpack.push_back(this->astCtxt->extract(31, 0, op1));
 
-        auto node = triton::ast::concat(unpack);
+        auto node = this->astCtxt->concat(unpack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "UNPCKLPS operation");
@@ -11782,7 +11978,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(op2, op3);
+        auto node = this->astCtxt->bvand(op2, op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPAND operation");
@@ -11805,7 +12001,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvand(triton::ast::bvnot(op2), op3);
+        auto node = this->astCtxt->bvand(this->astCtxt->bvnot(op2), op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPANDN operation");
@@ -11828,7 +12024,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvor(op2, op3);
+        auto node = this->astCtxt->bvor(op2, op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPOR operation");
@@ -11859,45 +12055,45 @@ namespace triton {
           /* YMM */
           case QQWORD_SIZE_BIT:
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(7, 6, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(7, 6, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
             );
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(5, 4, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(5, 4, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
             );
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(3, 2, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(3, 2, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
             );
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(1, 0, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(1, 0, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
@@ -11906,45 +12102,45 @@ namespace triton {
           /* XMM */
           case DQWORD_SIZE_BIT:
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(7, 6, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(7, 6, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
             );
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(5, 4, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(5, 4, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
             );
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(3, 2, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(3, 2, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
             );
             pack.push_back(
-              triton::ast::extract(31, 0,
-                triton::ast::bvlshr(
+              this->astCtxt->extract(31, 0,
+                this->astCtxt->bvlshr(
                   op2,
-                  triton::ast::bvmul(
-                    triton::ast::zx(dstSize-2, triton::ast::extract(1, 0, op3)),
-                    triton::ast::bv(32, dstSize)
+                  this->astCtxt->bvmul(
+                    this->astCtxt->zx(dstSize-2, this->astCtxt->extract(1, 0, op3)),
+                    this->astCtxt->bv(32, dstSize)
                   )
                 )
               )
@@ -11955,7 +12151,7 @@ namespace triton {
             throw triton::exceptions::Semantics("x86Semantics::vpshufd_s(): Invalid operand size.");
         }
 
-        auto node = triton::ast::concat(pack);
+        auto node = this->astCtxt->concat(pack);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPSHUFD operation");
@@ -11977,8 +12173,8 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node1 = triton::ast::bvand(op1, op2);
-        auto node2 = triton::ast::bvand(op1, triton::ast::bvnot(op2));
+        auto node1 = this->astCtxt->bvand(op1, op2);
+        auto node2 = this->astCtxt->bvand(op1, this->astCtxt->bvnot(op2));
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicVolatileExpression(inst, node1, "VPTEST operation");
@@ -11989,11 +12185,11 @@ namespace triton {
         expr2->isTainted = this->taintEngine->isTainted(src1) | this->taintEngine->isTainted(src2);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_AF, "Clears adjust flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_AF), "Clears adjust flag");
         this->cfPtest_s(inst, expr2, src1, true);
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_PF, "Clears parity flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_SF, "Clears sign flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_PF), "Clears parity flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_SF), "Clears sign flag");
         this->zf_s(inst, expr1, src1, true);
 
         /* Upate the symbolic control flow */
@@ -12011,7 +12207,7 @@ namespace triton {
         auto op3 = this->symbolicEngine->buildSymbolicOperand(inst, src2);
 
         /* Create the semantics */
-        auto node = triton::ast::bvxor(op2, op3);
+        auto node = this->astCtxt->bvxor(op2, op3);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "VPXOR operation");
@@ -12057,7 +12253,7 @@ namespace triton {
         op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node3 = triton::ast::bvadd(op1, op2);
+        auto node3 = this->astCtxt->bvadd(op1, op2);
 
         /* Create symbolic expression */
         auto expr3 = this->symbolicEngine->createSymbolicExpression(inst, node3, dst, "ADD operation");
@@ -12114,7 +12310,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvxor(op1, op2);
+        auto node = this->astCtxt->bvxor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "XOR operation");
@@ -12123,8 +12319,8 @@ namespace triton {
         expr->isTainted = this->taintEngine->taintUnion(dst, src);
 
         /* Upate symbolic flags */
-        this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
-        this->clearFlag_s(inst, TRITON_X86_REG_OF, "Clears overflow flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_CF), "Clears carry flag");
+        this->clearFlag_s(inst, this->architecture->getRegister(triton::arch::x86::ID_REG_OF), "Clears overflow flag");
         this->pf_s(inst, expr, dst);
         this->sf_s(inst, expr, dst);
         this->zf_s(inst, expr, dst);
@@ -12143,7 +12339,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvxor(op1, op2);
+        auto node = this->astCtxt->bvxor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "XORPD operation");
@@ -12165,7 +12361,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        auto node = triton::ast::bvxor(op1, op2);
+        auto node = this->astCtxt->bvxor(op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "XORPS operation");
@@ -12177,6 +12373,571 @@ namespace triton {
         this->controlFlow_s(inst);
       }
 
+
+      /* Taint-only semantics ===================================================== */
+
+      triton::uint64 x86Semantics::alignAddStack_t(triton::arch::Instruction& inst, triton::uint32 delta) {
+        auto dst = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP));
+
+        /* Compute the new stack value */
+        auto value = this->read_t(inst, dst).bvadd(triton::SmallBitvector(static_cast<triton::uint64>(delta), dst.getBitSize()));
+
+        /* Write it and spread taint */
+        this->write_t(inst, dst, value, this->taintEngine->taintUnion(dst, dst));
+
+        return value.toUint64();
+      }
+
+
+      triton::uint64 x86Semantics::alignSubStack_t(triton::arch::Instruction& inst, triton::uint32 delta) {
+        auto dst = triton::arch::OperandWrapper(this->architecture->getParentRegister(triton::arch::x86::ID_REG_SP));
+
+        /* Compute the new stack value */
+        auto value = this->read_t(inst, dst).bvsub(triton::SmallBitvector(static_cast<triton::uint64>(delta), dst.getBitSize()));
+
+        /* Write it and spread taint */
+        this->write_t(inst, dst, value, this->taintEngine->taintUnion(dst, dst));
+
+        return value.toUint64();
+      }
+
+
+      void x86Semantics::controlFlow_t(triton::arch::Instruction& inst) {
+        auto pc = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+
+        /* The next address is a constant, PC is untainted */
+        bool taint = this->taintEngine->setTaintRegister(pc.getConstRegister(), triton::engines::taint::UNTAINTED);
+
+        this->write_t(inst, pc, triton::SmallBitvector(inst.getNextAddress(), pc.getBitSize()), taint);
+      }
+
+
+      void x86Semantics::flag_t(triton::arch::Instruction& inst, triton::uint32 flagId, bool value, bool taint) {
+        triton::arch::Register flag = this->architecture->getRegister(flagId);
+
+        flag.setConcreteValue(value ? 1 : 0);
+        this->architecture->setConcreteRegisterValue(flag);
+        inst.setWrittenRegister(flag, nullptr);
+
+        if (this->taintEngine->setTaintRegister(flag, taint))
+          inst.setTaint(true);
+      }
+
+
+      void x86Semantics::resultFlags_t(triton::arch::Instruction& inst, const triton::SmallBitvector& res, bool taint) {
+        triton::uint64 low = res.extract(BYTE_SIZE_BIT - 1, 0).toUint64();
+        bool pf = true;
+
+        /* PF is set if the least significant byte of the result has an even number of bits set */
+        for (triton::uint32 counter = 0; counter < BYTE_SIZE_BIT; counter++)
+          pf ^= (((low >> counter) & 1) == 1);
+
+        this->flag_t(inst, ID_REG_PF, pf, taint);
+        this->flag_t(inst, ID_REG_SF, res.isSigned(), taint);
+        this->flag_t(inst, ID_REG_ZF, res.isZero(), taint);
+      }
+
+
+      void x86Semantics::initAddress_t(triton::arch::MemoryAccess& mem, bool force) {
+        if (mem.getBitSize() < BYTE_SIZE_BIT)
+          return;
+
+        const triton::arch::Register& base  = mem.getConstBaseRegister();
+        const triton::arch::Register& index = mem.getConstIndexRegister();
+        const triton::arch::Register& seg   = mem.getConstSegmentRegister();
+        triton::uint64 segmentValue         = (this->architecture->isRegisterValid(seg) ? this->architecture->getConcreteRegisterValue(seg).convert_to<triton::uint64>() : 0);
+        triton::uint32 bitSize              = (this->architecture->isRegisterValid(index) ? index.getBitSize() :
+                                                (this->architecture->isRegisterValid(base) ? base.getBitSize() :
+                                                  (mem.getConstDisplacement().getBitSize() ? mem.getConstDisplacement().getBitSize() :
+                                                    this->architecture->registerBitSize()
+                                                  )
+                                                )
+                                              );
+
+        /* The same address as the LEA of the symbolic engine -> ((pc + base) + (index * scale) + disp) */
+        triton::SmallBitvector address(static_cast<triton::uint64>(0), bitSize);
+
+        if (mem.getPcRelative())
+          address = triton::SmallBitvector(mem.getPcRelative(), bitSize);
+        else if (this->architecture->isRegisterValid(base))
+          address = triton::SmallBitvector(this->architecture->getConcreteRegisterValue(base), bitSize);
+
+        if (this->architecture->isRegisterValid(index)) {
+          auto indexValue = triton::SmallBitvector(this->architecture->getConcreteRegisterValue(index), bitSize);
+          address = address.bvadd(indexValue.bvmul(triton::SmallBitvector(mem.getConstScale().getValue(), bitSize)));
+        }
+
+        address = address.bvadd(triton::SmallBitvector(mem.getConstDisplacement().getValue(), bitSize));
+
+        /* Use segments as base address instead of selector into the GDT. */
+        if (segmentValue)
+          address = triton::SmallBitvector(segmentValue, seg.getBitSize()).bvadd(address.sx(seg.getBitSize() - bitSize));
+
+        /* Initialize the address only if it is not already defined */
+        if (!mem.getAddress() || force)
+          mem.setAddress(address.toUint64());
+      }
+
+
+      triton::SmallBitvector x86Semantics::readImmediate_t(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+        inst.setReadImmediate(imm, nullptr);
+        return triton::SmallBitvector(imm.getValue(), imm.getBitSize());
+      }
+
+
+      triton::SmallBitvector x86Semantics::readMemory_t(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+        triton::uint512 value = this->architecture->getConcreteMemoryValue(mem);
+
+        mem.setConcreteValue(value);
+        inst.setLoadAccess(mem, nullptr);
+
+        return triton::SmallBitvector(value, mem.getBitSize());
+      }
+
+
+      triton::SmallBitvector x86Semantics::readRegister_t(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+        triton::uint512 value = this->architecture->getConcreteRegisterValue(reg);
+
+        reg.setConcreteValue(value);
+        inst.setReadRegister(reg, nullptr);
+
+        return triton::SmallBitvector(value, reg.getBitSize());
+      }
+
+
+      triton::SmallBitvector x86Semantics::read_t(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return this->readImmediate_t(inst, op.getImmediate());
+          case triton::arch::OP_MEM: return this->readMemory_t(inst, op.getMemory());
+          case triton::arch::OP_REG: return this->readRegister_t(inst, op.getRegister());
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::read_t(): Invalid operand.");
+        }
+      }
+
+
+      void x86Semantics::write_t(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, const triton::SmallBitvector& value, bool taint) {
+        switch (op.getType()) {
+          case triton::arch::OP_MEM: {
+            auto& mem = op.getMemory();
+            mem.setConcreteValue(value.toUint512());
+            this->architecture->setConcreteMemoryValue(mem);
+            inst.setStoreAccess(mem, nullptr);
+            break;
+          }
+
+          case triton::arch::OP_REG: {
+            triton::arch::Register written = op.getConstRegister();
+            written.setConcreteValue(value.toUint512());
+
+            /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register (Thx Wisk!) */
+            if (written.getSize() == DWORD_SIZE && this->architecture->getArchitecture() == triton::arch::ARCH_X86_64) {
+              triton::arch::Register parent = this->architecture->getParentRegister(written);
+              parent.setConcreteValue(value.toUint512());
+              this->architecture->setConcreteRegisterValue(parent);
+            }
+            else
+              this->architecture->setConcreteRegisterValue(written);
+
+            inst.setWrittenRegister(written, nullptr);
+            break;
+          }
+
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::write_t(): Invalid operand.");
+        }
+
+        if (taint)
+          inst.setTaint(true);
+      }
+
+
+      void x86Semantics::binary_t(triton::arch::Instruction& inst) {
+        auto& dst  = inst.operands[0];
+        auto& src  = inst.operands[1];
+        auto  type = inst.getType();
+        bool  taint;
+
+        /* Read the operands */
+        auto op1 = this->read_t(inst, dst);
+        auto op2 = this->read_t(inst, src);
+
+        /* CMP sign-extends its immediate */
+        if (op2.getSize() < op1.getSize())
+          op2 = op2.sx(op1.getSize() - op2.getSize());
+
+        /* Compute the result */
+        triton::SmallBitvector res;
+        switch (type) {
+          case ID_INS_ADD:  res = op1.bvadd(op2); break;
+          case ID_INS_AND:
+          case ID_INS_TEST: res = op1.bvand(op2); break;
+          case ID_INS_OR:   res = op1.bvor(op2);  break;
+          case ID_INS_XOR:  res = op1.bvxor(op2); break;
+          default:          res = op1.bvsub(op2); break;
+        }
+
+        /* CMP and TEST only write the flags */
+        if (type == ID_INS_CMP || type == ID_INS_TEST)
+          taint = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        else {
+          taint = this->taintEngine->taintUnion(dst, src);
+          this->write_t(inst, dst, res, taint);
+        }
+
+        /* Update the flags */
+        auto mask = triton::SmallBitvector(static_cast<triton::uint64>(0x10), op1.getSize());
+        auto diff = op1.bvxor(op2);
+        switch (type) {
+          case ID_INS_ADD:
+            this->flag_t(inst, ID_REG_AF, !res.bvxor(diff).bvand(mask).isZero(), taint);
+            this->flag_t(inst, ID_REG_CF, op1.bvand(op2).bvxor(diff.bvxor(res).bvand(diff)).isSigned(), taint);
+            this->flag_t(inst, ID_REG_OF, op1.bvxor(op2.bvnot()).bvand(op1.bvxor(res)).isSigned(), taint);
+            break;
+
+          case ID_INS_CMP:
+          case ID_INS_SUB:
+            this->flag_t(inst, ID_REG_AF, !res.bvxor(diff).bvand(mask).isZero(), taint);
+            this->flag_t(inst, ID_REG_CF, diff.bvxor(res).bvxor(op1.bvxor(res).bvand(diff)).isSigned(), taint);
+            this->flag_t(inst, ID_REG_OF, diff.bvand(op1.bvxor(res)).isSigned(), taint);
+            break;
+
+          default:
+            this->flag_t(inst, ID_REG_CF, false, triton::engines::taint::UNTAINTED);
+            this->flag_t(inst, ID_REG_OF, false, triton::engines::taint::UNTAINTED);
+            break;
+        }
+        this->resultFlags_t(inst, res, taint);
+
+        /* Update the control flow */
+        this->controlFlow_t(inst);
+      }
+
+
+      void x86Semantics::call_t(triton::arch::Instruction& inst) {
+        auto stack = this->architecture->getParentRegister(ID_REG_SP);
+
+        /* Create the new stack value */
+        auto stackValue = this->alignSubStack_t(inst, stack.getSize());
+        auto pc         = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
+        auto& src       = inst.operands[0];
+
+        /* Read the target */
+        auto target = this->read_t(inst, src);
+
+        /* Push the return address, then jump */
+        this->write_t(inst, sp, triton::SmallBitvector(inst.getNextAddress(), pc.getBitSize()), this->taintEngine->taintAssignmentMemoryImmediate(sp.getMemory()));
+        this->write_t(inst, pc, target, this->taintEngine->taintAssignment(pc, src));
+      }
+
+
+      void x86Semantics::jcc_t(triton::arch::Instruction& inst) {
+        std::vector<triton::uint32> flags;
+        auto  type    = inst.getType();
+        auto  pc      = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto  srcImm1 = triton::arch::OperandWrapper(Immediate(inst.getNextAddress(), pc.getSize()));
+        auto& srcImm2 = inst.operands[0];
+
+        /* The flags read by the condition */
+        switch (type) {
+          case ID_INS_JA:
+          case ID_INS_JBE: flags = {ID_REG_CF, ID_REG_ZF};            break;
+          case ID_INS_JAE:
+          case ID_INS_JB:  flags = {ID_REG_CF};                       break;
+          case ID_INS_JE:
+          case ID_INS_JNE: flags = {ID_REG_ZF};                       break;
+          case ID_INS_JG:
+          case ID_INS_JLE: flags = {ID_REG_SF, ID_REG_OF, ID_REG_ZF}; break;
+          case ID_INS_JGE:
+          case ID_INS_JL:  flags = {ID_REG_SF, ID_REG_OF};            break;
+          case ID_INS_JNO:
+          case ID_INS_JO:  flags = {ID_REG_OF};                       break;
+          case ID_INS_JNP:
+          case ID_INS_JP:  flags = {ID_REG_PF};                       break;
+          default:         flags = {ID_REG_SF};                       break;
+        }
+
+        /* Read the flags, the first one is the value of the single flag conditions */
+        std::vector<triton::arch::OperandWrapper> operands;
+        std::vector<bool> values;
+        for (auto flagId : flags) {
+          operands.push_back(triton::arch::OperandWrapper(this->architecture->getRegister(flagId)));
+          values.push_back(!this->read_t(inst, operands.back()).isZero());
+        }
+
+        /* Read the targets */
+        auto next   = this->read_t(inst, srcImm1);
+        auto target = this->read_t(inst, srcImm2);
+
+        /* Evaluate the condition */
+        bool taken = false;
+        switch (type) {
+          case ID_INS_JA:  taken = !values[0] && !values[1];                         break;
+          case ID_INS_JBE: taken = values[0] || values[1];                           break;
+          case ID_INS_JAE: taken = !values[0];                                       break;
+          case ID_INS_JB:  taken = values[0];                                        break;
+          case ID_INS_JG:  taken = !((values[0] != values[1]) || values[2]);         break;
+          case ID_INS_JLE: taken = (values[0] != values[1]) || values[2];            break;
+          case ID_INS_JGE: taken = (values[0] == values[1]);                         break;
+          case ID_INS_JL:  taken = (values[0] != values[1]);                         break;
+          case ID_INS_JNE:
+          case ID_INS_JNO:
+          case ID_INS_JNP:
+          case ID_INS_JNS: taken = !values[0];                                       break;
+          default:         taken = values[0];                                        break;
+        }
+
+        /* Spread taint */
+        bool taint = this->taintEngine->taintAssignment(pc, operands[0]);
+        for (triton::usize index = 1; index < operands.size(); index++)
+          taint = this->taintEngine->taintUnion(pc, operands[index]);
+
+        /* Set condition flag */
+        if (taken)
+          inst.setConditionTaken(true);
+
+        /* Update the control flow */
+        this->write_t(inst, pc, (taken ? target : next), taint);
+      }
+
+
+      void x86Semantics::jmp_t(triton::arch::Instruction& inst) {
+        auto  pc  = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto& src = inst.operands[0];
+
+        /* Read the target */
+        auto target = this->read_t(inst, src);
+
+        /* Set condition flag */
+        inst.setConditionTaken(true);
+
+        /* Jump and spread taint */
+        this->write_t(inst, pc, target, this->taintEngine->taintAssignment(pc, src));
+      }
+
+
+      void x86Semantics::lea_t(triton::arch::Instruction& inst) {
+        auto& dst                = inst.operands[0];
+        auto& srcDisp            = inst.operands[1].getMemory().getDisplacement();
+        auto& srcBase            = inst.operands[1].getMemory().getBaseRegister();
+        auto& srcIndex           = inst.operands[1].getMemory().getIndexRegister();
+        auto& srcScale           = inst.operands[1].getMemory().getScale();
+        triton::uint32 leaSize   = 0;
+
+        /* Setup LEA size */
+        if (this->architecture->isRegisterValid(srcBase))
+          leaSize = srcBase.getBitSize();
+        else if (this->architecture->isRegisterValid(srcIndex))
+          leaSize = srcIndex.getBitSize();
+        else
+          leaSize = srcDisp.getBitSize();
+
+        /* Displacement */
+        auto disp = this->readImmediate_t(inst, srcDisp);
+        if (leaSize > disp.getSize())
+          disp = disp.zx(leaSize - disp.getSize());
+
+        /* Base, with PC */
+        auto base = triton::SmallBitvector(static_cast<triton::uint64>(0), leaSize);
+        if (this->architecture->isRegisterValid(srcBase)) {
+          base = this->readRegister_t(inst, srcBase);
+          if (srcBase.getParentId() == this->architecture->getProgramCounter().getId())
+            base = base.bvadd(triton::SmallBitvector(static_cast<triton::uint64>(inst.getSize()), leaSize));
+        }
+
+        /* Index */
+        auto index = triton::SmallBitvector(static_cast<triton::uint64>(0), leaSize);
+        if (this->architecture->isRegisterValid(srcIndex))
+          index = this->readRegister_t(inst, srcIndex);
+
+        /* Scale */
+        auto scale = this->readImmediate_t(inst, srcScale);
+        if (leaSize > scale.getSize())
+          scale = scale.zx(leaSize - scale.getSize());
+
+        /* Effective address = Displacement + BaseReg + IndexReg * Scale */
+        auto value = disp.bvadd(base.bvadd(index.bvmul(scale)));
+
+        if (dst.getBitSize() > leaSize)
+          value = value.zx(dst.getBitSize() - leaSize);
+
+        if (dst.getBitSize() < leaSize)
+          value = value.extract(dst.getBitSize() - 1, 0);
+
+        /* Write it and spread taint */
+        this->write_t(inst, dst, value, this->taintEngine->setTaint(dst, this->taintEngine->isTainted(srcBase) | this->taintEngine->isTainted(srcIndex)));
+
+        /* Update the control flow */
+        this->controlFlow_t(inst);
+      }
+
+
+      void x86Semantics::mov_t(triton::arch::Instruction& inst) {
+        auto& dst = inst.operands[0];
+        auto& src = inst.operands[1];
+
+        /* Read the source */
+        auto value = this->read_t(inst, src);
+
+        /* Extend it */
+        switch (inst.getType()) {
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+            value = value.sx(dst.getBitSize() - src.getBitSize());
+            break;
+
+          case ID_INS_MOVZX:
+            value = value.zx(dst.getBitSize() - src.getBitSize());
+            break;
+        }
+
+        /* Write it and spread taint */
+        this->write_t(inst, dst, value, this->taintEngine->taintAssignment(dst, src));
+
+        /* Update the control flow */
+        this->controlFlow_t(inst);
+      }
+
+
+      void x86Semantics::nop_t(triton::arch::Instruction& inst) {
+        this->controlFlow_t(inst);
+      }
+
+
+      void x86Semantics::pop_t(triton::arch::Instruction& inst) {
+        bool stackRelative = false;
+        auto stack         = this->architecture->getParentRegister(ID_REG_SP);
+        auto stackValue    = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto& dst          = inst.operands[0];
+        auto src           = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize()));
+
+        /* Read the top of the stack */
+        auto value = this->read_t(inst, src);
+
+        /*
+         * Create the semantics - side effect
+         *
+         * Intel: If the ESP register is used as a base register for addressing a destination operand in
+         * memory, the POP instruction computes the effective address of the operand after it increments
+         * the ESP register.
+         */
+        if (dst.getType() == triton::arch::OP_MEM) {
+          const auto& base = dst.getMemory().getConstBaseRegister();
+          if (this->architecture->isRegisterValid(base) && base.getParentId() == stack.getId()) {
+            this->alignAddStack_t(inst, src.getSize());
+            this->initAddress_t(dst.getMemory(), triton::arch::FORCE_MEMORY_INITIALIZATION);
+            stackRelative = true;
+          }
+        }
+
+        /* Write it and spread taint */
+        this->write_t(inst, dst, value, this->taintEngine->taintAssignment(dst, src));
+
+        /* Create the semantics - side effect */
+        if (!stackRelative)
+          this->alignAddStack_t(inst, src.getSize());
+
+        /* Update the control flow */
+        this->controlFlow_t(inst);
+      }
+
+
+      void x86Semantics::push_t(triton::arch::Instruction& inst) {
+        auto& src          = inst.operands[0];
+        auto stack         = this->architecture->getParentRegister(ID_REG_SP);
+        triton::uint32 size = stack.getSize();
+
+        /* If it's not an immediate source, the size depends of the operand */
+        if (src.getType() != triton::arch::OP_IMM)
+          size = src.getSize();
+
+        /* Create the new stack value */
+        auto stackValue = this->alignSubStack_t(inst, size);
+        auto dst        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, size));
+
+        /* Read the source, an immediate is pushed with the size of the stack */
+        auto value = this->read_t(inst, src);
+        if (dst.getBitSize() > value.getSize())
+          value = value.zx(dst.getBitSize() - value.getSize());
+
+        /* Write it and spread taint */
+        this->write_t(inst, dst, value, this->taintEngine->taintAssignment(dst, src));
+
+        /* Update the control flow */
+        this->controlFlow_t(inst);
+      }
+
+
+      void x86Semantics::ret_t(triton::arch::Instruction& inst) {
+        auto stack      = this->architecture->getParentRegister(ID_REG_SP);
+        auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+        auto pc         = triton::arch::OperandWrapper(this->architecture->getProgramCounter());
+        auto sp         = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, stack.getSize()));
+
+        /* Pop the return address and spread taint */
+        auto target = this->read_t(inst, sp);
+        this->write_t(inst, pc, target, this->taintEngine->taintAssignment(pc, sp));
+
+        /* Create the semantics - side effect */
+        this->alignAddStack_t(inst, sp.getSize());
+
+        /* Create the semantics - side effect */
+        if (inst.operands.size() > 0) {
+          auto offset = this->readImmediate_t(inst, inst.operands[0].getImmediate());
+          this->alignAddStack_t(inst, static_cast<triton::uint32>(offset.toUint64()));
+        }
+      }
+
+
+      void x86Semantics::unary_t(triton::arch::Instruction& inst) {
+        auto& dst  = inst.operands[0];
+        auto  type = inst.getType();
+
+        /* Read the operand */
+        auto op1 = this->read_t(inst, dst);
+        auto op2 = triton::SmallBitvector(static_cast<triton::uint64>(1), op1.getSize());
+
+        /* Compute the result */
+        triton::SmallBitvector res;
+        switch (type) {
+          case ID_INS_DEC: res = op1.bvsub(op2); break;
+          case ID_INS_INC: res = op1.bvadd(op2); break;
+          case ID_INS_NEG: res = op1.bvneg();    break;
+          default:         res = op1.bvnot();    break;
+        }
+
+        /* Write it and spread taint */
+        bool taint = this->taintEngine->taintUnion(dst, dst);
+        this->write_t(inst, dst, res, taint);
+
+        /* Update the flags, INC and DEC keep CF, NOT keeps them all */
+        auto mask = triton::SmallBitvector(static_cast<triton::uint64>(0x10), op1.getSize());
+        switch (type) {
+          case ID_INS_DEC:
+            this->flag_t(inst, ID_REG_AF, !res.bvxor(op1.bvxor(op2)).bvand(mask).isZero(), taint);
+            this->flag_t(inst, ID_REG_OF, op1.bvxor(op2).bvand(op1.bvxor(res)).isSigned(), taint);
+            this->resultFlags_t(inst, res, taint);
+            break;
+
+          case ID_INS_INC:
+            this->flag_t(inst, ID_REG_AF, !res.bvxor(op1.bvxor(op2)).bvand(mask).isZero(), taint);
+            this->flag_t(inst, ID_REG_OF, op1.bvxor(op2.bvnot()).bvand(op1.bvxor(res)).isSigned(), taint);
+            this->resultFlags_t(inst, res, taint);
+            break;
+
+          case ID_INS_NEG:
+            this->flag_t(inst, ID_REG_AF, !op1.bvxor(res).bvand(mask).isZero(), taint);
+            this->flag_t(inst, ID_REG_CF, !op1.isZero(), taint);
+            this->flag_t(inst, ID_REG_OF, res.bvand(op1).isSigned(), taint);
+            this->resultFlags_t(inst, res, taint);
+            break;
+        }
+
+        /* Update the control flow */
+        this->controlFlow_t(inst);
+      }
+
     }; /* x86 namespace */
   }; /* arch namespace */
 }; /* triton namespace */
@@ -16,434 +16,6 @@ namespace triton {
   namespace arch {
     namespace x86 {
 
-      /*
-       * Inside semantics, sometime we have to use references to registers.
-       * TRITON_X86_REG_RAX, TRITON_X86_REG_RBX, ..., TRITON_X86_REG_AF...
-       * are now available for a temporary access to the triton::arch::Register
-       * class. By default, these X86_REG are empty. We must use init32 or init64 before.
-       */
-
-      triton::arch::Register x86_reg_invalid = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rax     = triton::arch::Register();
-      triton::arch::Register x86_reg_eax     = triton::arch::Register();
-      triton::arch::Register x86_reg_ax      = triton::arch::Register();
-      triton::arch::Register x86_reg_ah      = triton::arch::Register();
-      triton::arch::Register x86_reg_al      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rbx     = triton::arch::Register();
-      triton::arch::Register x86_reg_ebx     = triton::arch::Register();
-      triton::arch::Register x86_reg_bx      = triton::arch::Register();
-      triton::arch::Register x86_reg_bh      = triton::arch::Register();
-      triton::arch::Register x86_reg_bl      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rcx     = triton::arch::Register();
-      triton::arch::Register x86_reg_ecx     = triton::arch::Register();
-      triton::arch::Register x86_reg_cx      = triton::arch::Register();
-      triton::arch::Register x86_reg_ch      = triton::arch::Register();
-      triton::arch::Register x86_reg_cl      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rdx     = triton::arch::Register();
-      triton::arch::Register x86_reg_edx     = triton::arch::Register();
-      triton::arch::Register x86_reg_dx      = triton::arch::Register();
-      triton::arch::Register x86_reg_dh      = triton::arch::Register();
-      triton::arch::Register x86_reg_dl      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rdi     = triton::arch::Register();
-      triton::arch::Register x86_reg_edi     = triton::arch::Register();
-      triton::arch::Register x86_reg_di      = triton::arch::Register();
-      triton::arch::Register x86_reg_dil     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rsi     = triton::arch::Register();
-      triton::arch::Register x86_reg_esi     = triton::arch::Register();
-      triton::arch::Register x86_reg_si      = triton::arch::Register();
-      triton::arch::Register x86_reg_sil     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rsp     = triton::arch::Register();
-      triton::arch::Register x86_reg_esp     = triton::arch::Register();
-      triton::arch::Register x86_reg_sp      = triton::arch::Register();
-      triton::arch::Register x86_reg_spl     = triton::arch::Register();
-      triton::arch::Register x86_reg_stack   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rbp     = triton::arch::Register();
-      triton::arch::Register x86_reg_ebp     = triton::arch::Register();
-      triton::arch::Register x86_reg_bp      = triton::arch::Register();
-      triton::arch::Register x86_reg_bpl     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_rip     = triton::arch::Register();
-      triton::arch::Register x86_reg_eip     = triton::arch::Register();
-      triton::arch::Register x86_reg_ip      = triton::arch::Register();
-      triton::arch::Register x86_reg_pc      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_eflags  = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r8      = triton::arch::Register();
-      triton::arch::Register x86_reg_r8d     = triton::arch::Register();
-      triton::arch::Register x86_reg_r8w     = triton::arch::Register();
-      triton::arch::Register x86_reg_r8b     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r9      = triton::arch::Register();
-      triton::arch::Register x86_reg_r9d     = triton::arch::Register();
-      triton::arch::Register x86_reg_r9w     = triton::arch::Register();
-      triton::arch::Register x86_reg_r9b     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r10     = triton::arch::Register();
-      triton::arch::Register x86_reg_r10d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r10w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r10b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r11     = triton::arch::Register();
-      triton::arch::Register x86_reg_r11d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r11w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r11b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r12     = triton::arch::Register();
-      triton::arch::Register x86_reg_r12d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r12w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r12b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r13     = triton::arch::Register();
-      triton::arch::Register x86_reg_r13d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r13w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r13b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r14     = triton::arch::Register();
-      triton::arch::Register x86_reg_r14d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r14w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r14b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_r15     = triton::arch::Register();
-      triton::arch::Register x86_reg_r15d    = triton::arch::Register();
-      triton::arch::Register x86_reg_r15w    = triton::arch::Register();
-      triton::arch::Register x86_reg_r15b    = triton::arch::Register();
-
-      triton::arch::Register x86_reg_mm0     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm1     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm2     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm3     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm4     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm5     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm6     = triton::arch::Register();
-      triton::arch::Register x86_reg_mm7     = triton::arch::Register();
-
-      triton::arch::Register x86_reg_xmm0    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm1    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm2    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm3    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm4    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm5    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm6    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm7    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm8    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm9    = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm10   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm11   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm12   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm13   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm14   = triton::arch::Register();
-      triton::arch::Register x86_reg_xmm15   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_ymm0    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm1    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm2    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm3    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm4    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm5    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm6    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm7    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm8    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm9    = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm10   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm11   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm12   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm13   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm14   = triton::arch::Register();
-      triton::arch::Register x86_reg_ymm15   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_zmm0    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm1    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm2    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm3    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm4    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm5    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm6    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm7    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm8    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm9    = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm10   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm11   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm12   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm13   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm14   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm15   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm16   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm17   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm18   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm19   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm20   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm21   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm22   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm23   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm24   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm25   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm26   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm27   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm28   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm29   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm30   = triton::arch::Register();
-      triton::arch::Register x86_reg_zmm31   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_mxcsr   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_cr0    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr1    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr2    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr3    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr4    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr5    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr6    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr7    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr8    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr9    = triton::arch::Register();
-      triton::arch::Register x86_reg_cr10   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr11   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr12   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr13   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr14   = triton::arch::Register();
-      triton::arch::Register x86_reg_cr15   = triton::arch::Register();
-
-      triton::arch::Register x86_reg_ie      = triton::arch::Register();
-      triton::arch::Register x86_reg_de      = triton::arch::Register();
-      triton::arch::Register x86_reg_ze      = triton::arch::Register();
-      triton::arch::Register x86_reg_oe      = triton::arch::Register();
-      triton::arch::Register x86_reg_ue      = triton::arch::Register();
-      triton::arch::Register x86_reg_pe      = triton::arch::Register();
-      triton::arch::Register x86_reg_daz     = triton::arch::Register();
-      triton::arch::Register x86_reg_im      = triton::arch::Register();
-      triton::arch::Register x86_reg_dm      = triton::arch::Register();
-      triton::arch::Register x86_reg_zm      = triton::arch::Register();
-      triton::arch::Register x86_reg_om      = triton::arch::Register();
-      triton::arch::Register x86_reg_um      = triton::arch::Register();
-      triton::arch::Register x86_reg_pm      = triton::arch::Register();
-      triton::arch::Register x86_reg_rl      = triton::arch::Register();
-      triton::arch::Register x86_reg_rh      = triton::arch::Register();
-      triton::arch::Register x86_reg_fz      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_af      = triton::arch::Register();
-      triton::arch::Register x86_reg_cf      = triton::arch::Register();
-      triton::arch::Register x86_reg_df      = triton::arch::Register();
-      triton::arch::Register x86_reg_if      = triton::arch::Register();
-      triton::arch::Register x86_reg_of      = triton::arch::Register();
-      triton::arch::Register x86_reg_pf      = triton::arch::Register();
-      triton::arch::Register x86_reg_sf      = triton::arch::Register();
-      triton::arch::Register x86_reg_tf      = triton::arch::Register();
-      triton::arch::Register x86_reg_zf      = triton::arch::Register();
-
-      triton::arch::Register x86_reg_cs      = triton::arch::Register();
-      triton::arch::Register x86_reg_ds      = triton::arch::Register();
-      triton::arch::Register x86_reg_es      = triton::arch::Register();
-      triton::arch::Register x86_reg_fs      = triton::arch::Register();
-      triton::arch::Register x86_reg_gs      = triton::arch::Register();
-      triton::arch::Register x86_reg_ss      = triton::arch::Register();
-
-
-      triton::arch::Register* x86_regs[triton::arch::x86::ID_REG_LAST_ITEM] = {
-        &TRITON_X86_REG_INVALID,
-        &TRITON_X86_REG_RAX,
-        &TRITON_X86_REG_RBX,
-        &TRITON_X86_REG_RCX,
-        &TRITON_X86_REG_RDX,
-        &TRITON_X86_REG_RDI,
-        &TRITON_X86_REG_RSI,
-        &TRITON_X86_REG_RBP,
-        &TRITON_X86_REG_RSP,
-        &TRITON_X86_REG_RIP,
-        &TRITON_X86_REG_EFLAGS,
-        &TRITON_X86_REG_R8,
-        &TRITON_X86_REG_R8D,
-        &TRITON_X86_REG_R8W,
-        &TRITON_X86_REG_R8B,
-        &TRITON_X86_REG_R9,
-        &TRITON_X86_REG_R9D,
-        &TRITON_X86_REG_R9W,
-        &TRITON_X86_REG_R9B,
-        &TRITON_X86_REG_R10,
-        &TRITON_X86_REG_R10D,
-        &TRITON_X86_REG_R10W,
-        &TRITON_X86_REG_R10B,
-        &TRITON_X86_REG_R11,
-        &TRITON_X86_REG_R11D,
-        &TRITON_X86_REG_R11W,
-        &TRITON_X86_REG_R11B,
-        &TRITON_X86_REG_R12,
-        &TRITON_X86_REG_R12D,
-        &TRITON_X86_REG_R12W,
-        &TRITON_X86_REG_R12B,
-        &TRITON_X86_REG_R13,
-        &TRITON_X86_REG_R13D,
-        &TRITON_X86_REG_R13W,
-        &TRITON_X86_REG_R13B,
-        &TRITON_X86_REG_R14,
-        &TRITON_X86_REG_R14D,
-        &TRITON_X86_REG_R14W,
-        &TRITON_X86_REG_R14B,
-        &TRITON_X86_REG_R15,
-        &TRITON_X86_REG_R15D,
-        &TRITON_X86_REG_R15W,
-        &TRITON_X86_REG_R15B,
-        &TRITON_X86_REG_EAX,
-        &TRITON_X86_REG_AX,
-        &TRITON_X86_REG_AH,
-        &TRITON_X86_REG_AL,
-        &TRITON_X86_REG_EBX,
-        &TRITON_X86_REG_BX,
-        &TRITON_X86_REG_BH,
-        &TRITON_X86_REG_BL,
-        &TRITON_X86_REG_ECX,
-        &TRITON_X86_REG_CX,
-        &TRITON_X86_REG_CH,
-        &TRITON_X86_REG_CL,
-        &TRITON_X86_REG_EDX,
-        &TRITON_X86_REG_DX,
-        &TRITON_X86_REG_DH,
-        &TRITON_X86_REG_DL,
-        &TRITON_X86_REG_EDI,
-        &TRITON_X86_REG_DI,
-        &TRITON_X86_REG_DIL,
-        &TRITON_X86_REG_ESI,
-        &TRITON_X86_REG_SI,
-        &TRITON_X86_REG_SIL,
-        &TRITON_X86_REG_EBP,
-        &TRITON_X86_REG_BP,
-        &TRITON_X86_REG_BPL,
-        &TRITON_X86_REG_ESP,
-        &TRITON_X86_REG_SP,
-        &TRITON_X86_REG_SPL,
-        &TRITON_X86_REG_EIP,
-        &TRITON_X86_REG_IP,
-        &TRITON_X86_REG_MM0,
-        &TRITON_X86_REG_MM1,
-        &TRITON_X86_REG_MM2,
-        &TRITON_X86_REG_MM3,
-        &TRITON_X86_REG_MM4,
-        &TRITON_X86_REG_MM5,
-        &TRITON_X86_REG_MM6,
-        &TRITON_X86_REG_MM7,
-        &TRITON_X86_REG_XMM0,
-        &TRITON_X86_REG_XMM1,
-        &TRITON_X86_REG_XMM2,
-        &TRITON_X86_REG_XMM3,
-        &TRITON_X86_REG_XMM4,
-        &TRITON_X86_REG_XMM5,
-        &TRITON_X86_REG_XMM6,
-        &TRITON_X86_REG_XMM7,
-        &TRITON_X86_REG_XMM8,
-        &TRITON_X86_REG_XMM9,
-        &TRITON_X86_REG_XMM10,
-        &TRITON_X86_REG_XMM11,
-        &TRITON_X86_REG_XMM12,
-        &TRITON_X86_REG_XMM13,
-        &TRITON_X86_REG_XMM14,
-        &TRITON_X86_REG_XMM15,
-        &TRITON_X86_REG_YMM0,
-        &TRITON_X86_REG_YMM1,
-        &TRITON_X86_REG_YMM2,
-        &TRITON_X86_REG_YMM3,
-        &TRITON_X86_REG_YMM4,
-        &TRITON_X86_REG_YMM5,
-        &TRITON_X86_REG_YMM6,
-        &TRITON_X86_REG_YMM7,
-        &TRITON_X86_REG_YMM8,
-        &TRITON_X86_REG_YMM9,
-        &TRITON_X86_REG_YMM10,
-        &TRITON_X86_REG_YMM11,
-        &TRITON_X86_REG_YMM12,
-        &TRITON_X86_REG_YMM13,
-        &TRITON_X86_REG_YMM14,
-        &TRITON_X86_REG_YMM15,
-        &TRITON_X86_REG_ZMM0,
-        &TRITON_X86_REG_ZMM1,
-        &TRITON_X86_REG_ZMM2,
-        &TRITON_X86_REG_ZMM3,
-        &TRITON_X86_REG_ZMM4,
-        &TRITON_X86_REG_ZMM5,
-        &TRITON_X86_REG_ZMM6,
-        &TRITON_X86_REG_ZMM7,
-        &TRITON_X86_REG_ZMM8,
-        &TRITON_X86_REG_ZMM9,
-        &TRITON_X86_REG_ZMM10,
-        &TRITON_X86_REG_ZMM11,
-        &TRITON_X86_REG_ZMM12,
-        &TRITON_X86_REG_ZMM13,
-        &TRITON_X86_REG_ZMM14,
-        &TRITON_X86_REG_ZMM15,
-        &TRITON_X86_REG_ZMM16,
-        &TRITON_X86_REG_ZMM17,
-        &TRITON_X86_REG_ZMM18,
-        &TRITON_X86_REG_ZMM19,
-        &TRITON_X86_REG_ZMM20,
-        &TRITON_X86_REG_ZMM21,
-        &TRITON_X86_REG_ZMM22,
-        &TRITON_X86_REG_ZMM23,
-        &TRITON_X86_REG_ZMM24,
-        &TRITON_X86_REG_ZMM25,
-        &TRITON_X86_REG_ZMM26,
-        &TRITON_X86_REG_ZMM27,
-        &TRITON_X86_REG_ZMM28,
-        &TRITON_X86_REG_ZMM29,
-        &TRITON_X86_REG_ZMM30,
-        &TRITON_X86_REG_ZMM31,
-        &TRITON_X86_REG_MXCSR,
-        &TRITON_X86_REG_CR0,
-        &TRITON_X86_REG_CR1,
-        &TRITON_X86_REG_CR2,
-        &TRITON_X86_REG_CR3,
-        &TRITON_X86_REG_CR4,
-        &TRITON_X86_REG_CR5,
-        &TRITON_X86_REG_CR6,
-        &TRITON_X86_REG_CR7,
-        &TRITON_X86_REG_CR8,
-        &TRITON_X86_REG_CR9,
-        &TRITON_X86_REG_CR10,
-        &TRITON_X86_REG_CR11,
-        &TRITON_X86_REG_CR12,
-        &TRITON_X86_REG_CR13,
-        &TRITON_X86_REG_CR14,
-        &TRITON_X86_REG_CR15,
-        &TRITON_X86_REG_IE,
-        &TRITON_X86_REG_DE,
-        &TRITON_X86_REG_ZE,
-        &TRITON_X86_REG_OE,
-        &TRITON_X86_REG_UE,
-        &TRITON_X86_REG_PE,
-        &TRITON_X86_REG_DAZ,
-        &TRITON_X86_REG_IM,
-        &TRITON_X86_REG_DM,
-        &TRITON_X86_REG_ZM,
-        &TRITON_X86_REG_OM,
-        &TRITON_X86_REG_UM,
-        &TRITON_X86_REG_PM,
-        &TRITON_X86_REG_RL,
-        &TRITON_X86_REG_RH,
-        &TRITON_X86_REG_FZ,
-        &TRITON_X86_REG_AF,
-        &TRITON_X86_REG_CF,
-        &TRITON_X86_REG_DF,
-        &TRITON_X86_REG_IF,
-        &TRITON_X86_REG_OF,
-        &TRITON_X86_REG_PF,
-        &TRITON_X86_REG_SF,
-        &TRITON_X86_REG_TF,
-        &TRITON_X86_REG_ZF,
-        &TRITON_X86_REG_CS,
-        &TRITON_X86_REG_DS,
-        &TRITON_X86_REG_ES,
-        &TRITON_X86_REG_FS,
-        &TRITON_X86_REG_GS,
-        &TRITON_X86_REG_SS
-      };
-
-
       x86Specifications::x86Specifications() {
       }
 
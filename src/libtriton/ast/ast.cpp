@@ -8,9 +8,9 @@
 #include <cmath>
 #include <new>
 
-#include <triton/api.hpp>
 #include <triton/ast.hpp>
-#include <triton/astRepresentation.hpp>
+#include <triton/astArena.hpp>
+#include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/tritonToZ3Ast.hpp>
 #include <triton/z3Result.hpp>
@@ -22,28 +22,24 @@ namespace triton {
 
     /* ====== Abstract node */
 
-    AbstractNode::AbstractNode(enum kind_e kind) {
-      this->eval        = 0;
-      this->kind        = kind;
-      this->size        = 0;
-      this->symbolized  = false;
-    }
-
-
-    AbstractNode::AbstractNode() {
-      this->eval        = 0;
-      this->kind        = UNDEFINED_NODE;
-      this->size        = 0;
-      this->symbolized  = false;
+    AbstractNode::AbstractNode(enum kind_e kind, AstContext& ctxt) : ctxt(ctxt) {
+      this->arenaAllocated  = (ctxt.getArena() != nullptr);
+      this->kind            = kind;
+      this->size            = 0;
+      this->structuralHash  = triton::ast::hash128(0, 0);
+      this->symbolized      = false;
     }
 
 
-    AbstractNode::AbstractNode(const AbstractNode& copy) {
-      this->eval        = copy.eval;
-      this->kind        = copy.kind;
-      this->parents     = copy.parents;
-      this->size        = copy.size;
-      this->symbolized  = copy.symbolized;
+    AbstractNode::AbstractNode(const AbstractNode& copy) : ctxt(copy.ctxt) {
+      /* Like operator new, the copy is allocated from the current arena of the context */
+      this->arenaAllocated  = (copy.ctxt.getArena() != nullptr);
+      this->eval            = copy.eval;
+      this->kind            = copy.kind;
+      this->parents         = copy.parents;
+      this->size            = copy.size;
+      this->structuralHash  = copy.structuralHash;
+      this->symbolized      = copy.symbolized;
 
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
         this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
@@ -55,11 +51,107 @@ namespace triton {
     }
 
 
+    void* AbstractNode::operator new(std::size_t size, AstContext& ctxt) noexcept {
+      triton::ast::AstArena* arena = ctxt.getArena();
+
+      if (arena != nullptr)
+        return arena->allocate(size);
+
+      return ::operator new(size, std::nothrow);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, AstContext& ctxt) noexcept {
+      if (ctxt.getArena() != nullptr)
+        triton::ast::AstArena::release(ptr);
+      else
+        ::operator delete(ptr);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr) noexcept {
+      ::operator delete(ptr);
+    }
+
+
+    void AbstractNode::destroy(AbstractNode* node) {
+      if (node == nullptr)
+        return;
+
+      bool arenaAllocated = node->arenaAllocated;
+
+      node->~AbstractNode();
+      if (arenaAllocated)
+        triton::ast::AstArena::release(node);
+      else
+        ::operator delete(node);
+    }
+
+
+    AstContext& AbstractNode::getContext(void) const {
+      return this->ctxt;
+    }
+
+
+    bool AbstractNode::isArenaAllocated(void) const {
+      return this->arenaAllocated;
+    }
+
+
     enum kind_e AbstractNode::getKind(void) const {
       return this->kind;
     }
 
 
+    const triton::ast::hash128& AbstractNode::getStructuralHash(void) const {
+      return this->structuralHash;
+    }
+
+
+    void AbstractNode::initHash(void) {
+      triton::ast::hash128 h(0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL);
+
+      triton::ast::mixHash(h, this->kind);
+      triton::ast::mixHash(h, this->size);
+
+      switch (this->kind) {
+        case DECIMAL_NODE: {
+          triton::uint512 value = reinterpret_cast<DecimalNode*>(this)->getValue();
+          for (triton::uint32 i = 0; i < 8; i++) {
+            triton::ast::mixHash(h, static_cast<triton::uint64>(value & 0xffffffffffffffffULL));
+            value >>= 64;
+          }
+          break;
+        }
+
+        case REFERENCE_NODE:
+          triton::ast::mixHash(h, reinterpret_cast<ReferenceNode*>(this)->getValue());
+          break;
+
+        case STRING_NODE:
+        case VARIABLE_NODE: {
+          const std::string value = (this->kind == STRING_NODE) ? reinterpret_cast<StringNode*>(this)->getValue() : reinterpret_cast<VariableNode*>(this)->getValue();
+          for (auto c : value)
+            triton::ast::mixHash(h, static_cast<triton::uint8>(c));
+          break;
+        }
+
+        default:
+          break;
+      }
+
+      /* Childs are already hashed, the tree is not walked */
+      triton::ast::mixHash(h, this->childs.size());
+      for (auto child : this->childs) {
+        const triton::ast::hash128& sub = child->getStructuralHash();
+        h.first  = triton::ast::mixHash(h.first, sub.first);
+        h.second = triton::ast::mixHash(h.second, sub.second);
+      }
+
+      this->structuralHash = h;
+    }
+
+
     triton::uint32 AbstractNode::getBitvectorSize(void) const {
       return this->size;
     }
@@ -73,9 +165,7 @@ namespace triton {
 
 
     bool AbstractNode::isSigned(void) const {
-      if ((this->eval >> (this->size-1)) & 1)
-        return true;
-      return false;
+      return this->eval.isSigned();
     }
 
 
@@ -85,6 +175,11 @@ namespace triton {
 
 
     triton::uint512 AbstractNode::evaluate(void) const {
+      return this->eval.toUint512();
+    }
+
+
+    const triton::SmallBitvector& AbstractNode::getEvaluation(void) const {
       return this->eval;
     }
 
@@ -146,8 +241,7 @@ namespace triton {
     /* ====== assert */
 
 
-    AssertNode::AssertNode(AbstractNode* expr) {
-      this->kind = ASSERT_NODE;
+    AssertNode::AssertNode(AbstractNode* expr) : AbstractNode(ASSERT_NODE, expr->getContext()) {
       this->addChild(expr);
       this->init();
     }
@@ -167,7 +261,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->eval = triton::SmallBitvector();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -175,6 +269,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -198,8 +295,7 @@ namespace triton {
     /* ====== bvadd */
 
 
-    BvaddNode::BvaddNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVADD_NODE;
+    BvaddNode::BvaddNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVADD_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -223,7 +319,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvadd(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -231,6 +327,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -254,8 +353,7 @@ namespace triton {
     /* ====== bvand */
 
 
-    BvandNode::BvandNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVAND_NODE;
+    BvandNode::BvandNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVAND_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -279,7 +377,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() & this->childs[1]->evaluate());
+      this->eval = this->childs[0]->getEvaluation().bvand(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -287,6 +385,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -311,8 +412,7 @@ namespace triton {
     /* ====== bvashr (shift with sign extension fill) */
 
 
-    BvashrNode::BvashrNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVASHR_NODE;
+    BvashrNode::BvashrNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVASHR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -328,47 +428,15 @@ namespace triton {
 
 
     void BvashrNode::init(void) {
-      triton::uint32 shift  = 0;
-      triton::uint512 mask  = 0;
-      triton::uint512 value = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvashrNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->childs[0]->evaluate();
-      shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-
-      /* Mask based on the sign */
-      if (this->childs[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
-      }
-
-      if (shift >= this->size && this->childs[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
-      }
-
-      else if (shift >= this->size && !this->childs[0]->isSigned()) {
-        this->eval = 0;
-      }
-
-      else if (shift == 0) {
-        this->eval = value;
-      }
-
-      else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
-        }
-      }
+      this->eval = this->childs[0]->getEvaluation().bvashr(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -376,6 +444,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -399,9 +470,8 @@ namespace triton {
     /* ====== bvdecl */
 
 
-    BvdeclNode::BvdeclNode(triton::uint32 size) {
-      this->kind = BVDECL_NODE;
-      this->addChild(triton::ast::decimal(size));
+    BvdeclNode::BvdeclNode(AstContext& ctxt, triton::uint32 size) : AbstractNode(BVDECL_NODE, ctxt) {
+      this->addChild(this->ctxt.decimal(size));
       this->init();
     }
 
@@ -432,7 +502,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = 0;
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(0), size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -440,6 +510,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -463,8 +536,7 @@ namespace triton {
     /* ====== bvlshr (shift with zero filled) */
 
 
-    BvlshrNode::BvlshrNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVLSHR_NODE;
+    BvlshrNode::BvlshrNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVLSHR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -488,7 +560,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
+      this->eval = this->childs[0]->getEvaluation().bvlshr(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -496,6 +568,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -519,8 +594,7 @@ namespace triton {
     /* ====== bvmul */
 
 
-    BvmulNode::BvmulNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVMUL_NODE;
+    BvmulNode::BvmulNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVMUL_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -544,7 +618,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvmul(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -552,6 +626,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -575,8 +652,7 @@ namespace triton {
     /* ====== bvnand */
 
 
-    BvnandNode::BvnandNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVNAND_NODE;
+    BvnandNode::BvnandNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVNAND_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -600,7 +676,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvnand(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -608,6 +684,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -631,8 +710,7 @@ namespace triton {
     /* ====== bvneg */
 
 
-    BvnegNode::BvnegNode(AbstractNode* expr) {
-      this->kind = BVNEG_NODE;
+    BvnegNode::BvnegNode(AbstractNode* expr) : AbstractNode(BVNEG_NODE, expr->getContext()) {
       this->addChild(expr);
       this->init();
     }
@@ -652,7 +730,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvneg();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -660,6 +738,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -683,8 +764,7 @@ namespace triton {
     /* ====== bvnor */
 
 
-    BvnorNode::BvnorNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVNOR_NODE;
+    BvnorNode::BvnorNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVNOR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -708,7 +788,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvnor(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -716,6 +796,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -739,8 +822,7 @@ namespace triton {
     /* ====== bvnot */
 
 
-    BvnotNode::BvnotNode(AbstractNode* expr) {
-      this->kind = BVNOT_NODE;
+    BvnotNode::BvnotNode(AbstractNode* expr) : AbstractNode(BVNOT_NODE, expr->getContext()) {
       this->addChild(expr);
       this->init();
     }
@@ -760,7 +842,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~this->childs[0]->evaluate() & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvnot();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -768,6 +850,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -791,8 +876,7 @@ namespace triton {
     /* ====== bvor */
 
 
-    BvorNode::BvorNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVOR_NODE;
+    BvorNode::BvorNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVOR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -816,7 +900,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() | this->childs[1]->evaluate());
+      this->eval = this->childs[0]->getEvaluation().bvor(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -824,6 +908,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -847,16 +934,14 @@ namespace triton {
     /* ====== bvrol */
 
 
-    BvrolNode::BvrolNode(triton::uint32 rot, AbstractNode* expr) {
-      this->kind = BVROL_NODE;
-      this->addChild(triton::ast::decimal(rot));
+    BvrolNode::BvrolNode(triton::uint32 rot, AbstractNode* expr) : AbstractNode(BVROL_NODE, expr->getContext()) {
+      this->addChild(this->ctxt.decimal(rot));
       this->addChild(expr);
       this->init();
     }
 
 
-    BvrolNode::BvrolNode(AbstractNode* rot, AbstractNode* expr) {
-      this->kind = BVROL_NODE;
+    BvrolNode::BvrolNode(AbstractNode* rot, AbstractNode* expr) : AbstractNode(BVROL_NODE, rot->getContext()) {
       this->addChild(rot);
       this->addChild(expr);
       this->init();
@@ -873,8 +958,7 @@ namespace triton {
 
 
     void BvrolNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvrolNode::init(): Must take at least two childs.");
@@ -882,13 +966,11 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      this->eval = this->childs[1]->getEvaluation().bvrol(rot);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -896,6 +978,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -919,16 +1004,14 @@ namespace triton {
     /* ====== bvror */
 
 
-    BvrorNode::BvrorNode(triton::uint32 rot, AbstractNode* expr) {
-      this->kind = BVROR_NODE;
-      this->addChild(triton::ast::decimal(rot));
+    BvrorNode::BvrorNode(triton::uint32 rot, AbstractNode* expr) : AbstractNode(BVROR_NODE, expr->getContext()) {
+      this->addChild(this->ctxt.decimal(rot));
       this->addChild(expr);
       this->init();
     }
 
 
-    BvrorNode::BvrorNode(AbstractNode* rot, AbstractNode* expr) {
-      this->kind = BVROR_NODE;
+    BvrorNode::BvrorNode(AbstractNode* rot, AbstractNode* expr) : AbstractNode(BVROR_NODE, rot->getContext()) {
       this->addChild(rot);
       this->addChild(expr);
       this->init();
@@ -944,8 +1027,7 @@ namespace triton {
 
 
     void BvrorNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvrorNode::init(): Must take at least two childs.");
@@ -953,13 +1035,11 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      this->eval = this->childs[1]->getEvaluation().bvror(rot);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -967,6 +1047,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -990,8 +1073,7 @@ namespace triton {
     /* ====== bvsdiv */
 
 
-    BvsdivNode::BvsdivNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSDIV_NODE;
+    BvsdivNode::BvsdivNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSDIV_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1007,28 +1089,16 @@ namespace triton {
 
 
     void BvsdivNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
-      }
-      else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvsdiv(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1036,6 +1106,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1059,8 +1132,7 @@ namespace triton {
     /* ====== bvsge */
 
 
-    BvsgeNode::BvsgeNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSGE_NODE;
+    BvsgeNode::BvsgeNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSGE_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1076,22 +1148,15 @@ namespace triton {
 
 
     void BvsgeNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvsge(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1099,6 +1164,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1122,8 +1190,7 @@ namespace triton {
     /* ====== bvsgt */
 
 
-    BvsgtNode::BvsgtNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSGT_NODE;
+    BvsgtNode::BvsgtNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSGT_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1139,22 +1206,15 @@ namespace triton {
 
 
     void BvsgtNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvsgt(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1162,6 +1222,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1185,8 +1248,7 @@ namespace triton {
     /* ====== bvshl */
 
 
-    BvshlNode::BvshlNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSHL_NODE;
+    BvshlNode::BvshlNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSHL_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1210,7 +1272,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvshl(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1218,6 +1280,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1241,8 +1306,7 @@ namespace triton {
     /* ====== bvsle */
 
 
-    BvsleNode::BvsleNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSLE_NODE;
+    BvsleNode::BvsleNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSLE_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1258,22 +1322,15 @@ namespace triton {
 
 
     void BvsleNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsleNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvsle(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1281,6 +1338,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1304,8 +1364,7 @@ namespace triton {
     /* ====== bvslt */
 
 
-    BvsltNode::BvsltNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSLT_NODE;
+    BvsltNode::BvsltNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSLT_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1321,22 +1380,15 @@ namespace triton {
 
 
     void BvsltNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsltNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvslt(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1344,6 +1396,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1367,8 +1422,7 @@ namespace triton {
     /* ====== bvsmod - 2's complement signed remainder (sign follows divisor) */
 
 
-    BvsmodNode::BvsmodNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSMOD_NODE;
+    BvsmodNode::BvsmodNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSMOD_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1384,26 +1438,16 @@ namespace triton {
 
 
     void BvsmodNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvsmod(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1411,6 +1455,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1434,8 +1481,7 @@ namespace triton {
     /* ====== bvsrem - 2's complement signed remainder (sign follows dividend) */
 
 
-    BvsremNode::BvsremNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSREM_NODE;
+    BvsremNode::BvsremNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSREM_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1451,26 +1497,16 @@ namespace triton {
 
 
     void BvsremNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
-
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsremNode::init(): Must take at least two childs.");
 
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvsrem(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1478,6 +1514,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1501,8 +1540,7 @@ namespace triton {
     /* ====== bvsub */
 
 
-    BvsubNode::BvsubNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVSUB_NODE;
+    BvsubNode::BvsubNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVSUB_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1526,7 +1564,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvsub(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1534,6 +1572,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1557,8 +1598,7 @@ namespace triton {
     /* ====== bvudiv */
 
 
-    BvudivNode::BvudivNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVUDIV_NODE;
+    BvudivNode::BvudivNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVUDIV_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1583,10 +1623,7 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
-      else
-        this->eval = (this->childs[0]->evaluate() / this->childs[1]->evaluate());
+      this->eval = this->childs[0]->getEvaluation().bvudiv(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1594,6 +1631,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1617,8 +1657,7 @@ namespace triton {
     /* ====== bvuge */
 
 
-    BvugeNode::BvugeNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVUGE_NODE;
+    BvugeNode::BvugeNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVUGE_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1642,7 +1681,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() >= this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvuge(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1650,6 +1689,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1673,8 +1715,7 @@ namespace triton {
     /* ====== bvugt */
 
 
-    BvugtNode::BvugtNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVUGT_NODE;
+    BvugtNode::BvugtNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVUGT_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1698,7 +1739,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() > this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvugt(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1706,6 +1747,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1729,8 +1773,7 @@ namespace triton {
     /* ====== bvule */
 
 
-    BvuleNode::BvuleNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVULE_NODE;
+    BvuleNode::BvuleNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVULE_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1754,7 +1797,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() <= this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvule(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1762,6 +1805,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1785,8 +1831,7 @@ namespace triton {
     /* ====== bvult */
 
 
-    BvultNode::BvultNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVULT_NODE;
+    BvultNode::BvultNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVULT_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1810,7 +1855,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() < this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().bvult(this->childs[1]->getEvaluation())), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1818,6 +1863,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1841,8 +1889,7 @@ namespace triton {
     /* ====== bvurem */
 
 
-    BvuremNode::BvuremNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVUREM_NODE;
+    BvuremNode::BvuremNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVUREM_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1867,10 +1914,7 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
-      else
-        this->eval = (this->childs[0]->evaluate() % this->childs[1]->evaluate());
+      this->eval = this->childs[0]->getEvaluation().bvurem(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1878,6 +1922,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1901,8 +1948,7 @@ namespace triton {
     /* ====== bvxnor */
 
 
-    BvxnorNode::BvxnorNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVXNOR_NODE;
+    BvxnorNode::BvxnorNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVXNOR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1926,7 +1972,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
+      this->eval = this->childs[0]->getEvaluation().bvxnor(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1934,6 +1980,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -1957,8 +2006,7 @@ namespace triton {
     /* ====== bvxor */
 
 
-    BvxorNode::BvxorNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = BVXOR_NODE;
+    BvxorNode::BvxorNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(BVXOR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -1982,7 +2030,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
+      this->eval = this->childs[0]->getEvaluation().bvxor(this->childs[1]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1990,6 +2038,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2013,10 +2064,9 @@ namespace triton {
     /* ====== bv */
 
 
-    BvNode::BvNode(triton::uint512 value, triton::uint32 size) {
-      this->kind = BV_NODE;
-      this->addChild(triton::ast::decimal(value));
-      this->addChild(triton::ast::decimal(size));
+    BvNode::BvNode(AstContext& ctxt, triton::uint512 value, triton::uint32 size) : AbstractNode(BV_NODE, ctxt) {
+      this->addChild(this->ctxt.decimal(value));
+      this->addChild(this->ctxt.decimal(size));
       this->init();
     }
 
@@ -2050,7 +2100,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = (value & this->getBitvectorMask());
+      this->eval = triton::SmallBitvector(value, this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2058,6 +2108,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2081,8 +2134,7 @@ namespace triton {
     /* ====== compound */
 
 
-    CompoundNode::CompoundNode(std::vector<AbstractNode*> exprs) {
-      this->kind = COMPOUND_NODE;
+    CompoundNode::CompoundNode(AstContext& ctxt, std::vector<AbstractNode*> exprs) : AbstractNode(COMPOUND_NODE, ctxt) {
       for (triton::uint32 index = 0; index < exprs.size(); index++)
         this->addChild(exprs[index]);
       this->init();
@@ -2103,7 +2155,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 0;
-      this->eval = 0;
+      this->eval = triton::SmallBitvector();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2111,6 +2163,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2134,24 +2189,21 @@ namespace triton {
     /* ====== concat */
 
 
-    ConcatNode::ConcatNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = CONCAT_NODE;
+    ConcatNode::ConcatNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(CONCAT_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
     }
 
 
-    ConcatNode::ConcatNode(std::vector<AbstractNode*> exprs) {
-      this->kind = CONCAT_NODE;
+    ConcatNode::ConcatNode(AstContext& ctxt, std::vector<AbstractNode*> exprs) : AbstractNode(CONCAT_NODE, ctxt) {
       for (triton::uint32 index = 0; index < exprs.size(); index++)
         this->addChild(exprs[index]);
       this->init();
     }
 
 
-    ConcatNode::ConcatNode(std::list<AbstractNode*> exprs) {
-      this->kind = CONCAT_NODE;
+    ConcatNode::ConcatNode(AstContext& ctxt, std::list<AbstractNode*> exprs) : AbstractNode(CONCAT_NODE, ctxt) {
       for (std::list<AbstractNode *>::iterator it = exprs.begin() ; it != exprs.end(); it++)
         this->addChild(*it);
       this->init();
@@ -2179,9 +2231,9 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->childs[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
-        this->eval = ((this->eval << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+      this->eval = this->childs[0]->getEvaluation();
+      for (triton::uint32 index = 1; index < this->childs.size(); index++)
+        this->eval = this->eval.concat(this->childs[index]->getEvaluation());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2189,6 +2241,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2212,8 +2267,7 @@ namespace triton {
     /* ====== Decimal node */
 
 
-    DecimalNode::DecimalNode(triton::uint512 value) {
-      this->kind  = DECIMAL_NODE;
+    DecimalNode::DecimalNode(AstContext& ctxt, triton::uint512 value) : AbstractNode(DECIMAL_NODE, ctxt) {
       this->value = value;
       this->init();
     }
@@ -2230,10 +2284,13 @@ namespace triton {
 
     void DecimalNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
+      this->eval        = triton::SmallBitvector();
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2259,9 +2316,8 @@ namespace triton {
     /* ====== Declare node */
 
 
-    DeclareFunctionNode::DeclareFunctionNode(std::string name, AbstractNode* bvDecl) {
-      this->kind = DECLARE_FUNCTION_NODE;
-      this->addChild(triton::ast::string(name));
+    DeclareFunctionNode::DeclareFunctionNode(std::string name, AbstractNode* bvDecl) : AbstractNode(DECLARE_FUNCTION_NODE, bvDecl->getContext()) {
+      this->addChild(this->ctxt.string(name));
       this->addChild(bvDecl);
       this->init();
     }
@@ -2287,7 +2343,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[1]->evaluate();
+      this->eval = this->childs[1]->getEvaluation();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2295,6 +2351,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2318,8 +2377,7 @@ namespace triton {
     /* ====== Distinct node */
 
 
-    DistinctNode::DistinctNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = DISTINCT_NODE;
+    DistinctNode::DistinctNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(DISTINCT_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -2340,7 +2398,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() != this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation() != this->childs[1]->getEvaluation()), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2348,6 +2406,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2371,8 +2432,7 @@ namespace triton {
     /* ====== equal */
 
 
-    EqualNode::EqualNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = EQUAL_NODE;
+    EqualNode::EqualNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(EQUAL_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -2393,7 +2453,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() == this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation() == this->childs[1]->getEvaluation()), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2401,6 +2461,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2424,10 +2487,9 @@ namespace triton {
     /* ====== extract */
 
 
-    ExtractNode::ExtractNode(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
-      this->kind = EXTRACT_NODE;
-      this->addChild(triton::ast::decimal(high));
-      this->addChild(triton::ast::decimal(low));
+    ExtractNode::ExtractNode(triton::uint32 high, triton::uint32 low, AbstractNode* expr) : AbstractNode(EXTRACT_NODE, expr->getContext()) {
+      this->addChild(this->ctxt.decimal(high));
+      this->addChild(this->ctxt.decimal(low));
       this->addChild(expr);
       this->init();
     }
@@ -2459,7 +2521,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = ((high - low) + 1);
-      this->eval = ((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
+      this->eval = this->childs[2]->getEvaluation().extract(high, low);
 
       if (this->size > this->childs[2]->getBitvectorSize() || high >= this->childs[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
@@ -2470,6 +2532,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2493,8 +2558,7 @@ namespace triton {
     /* ====== ite */
 
 
-    IteNode::IteNode(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr) {
-      this->kind = ITE_NODE;
+    IteNode::IteNode(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr) : AbstractNode(ITE_NODE, ifExpr->getContext()) {
       this->addChild(ifExpr);
       this->addChild(thenExpr);
       this->addChild(elseExpr);
@@ -2519,7 +2583,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate();
+      this->eval = !this->childs[0]->getEvaluation().isZero() ? this->childs[1]->getEvaluation() : this->childs[2]->getEvaluation();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2527,6 +2591,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2550,8 +2617,7 @@ namespace triton {
     /* ====== Land */
 
 
-    LandNode::LandNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = LAND_NODE;
+    LandNode::LandNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(LAND_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -2572,7 +2638,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(!this->childs[0]->getEvaluation().isZero() && !this->childs[1]->getEvaluation().isZero()), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2580,6 +2646,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2603,9 +2672,8 @@ namespace triton {
     /* ====== Let */
 
 
-    LetNode::LetNode(std::string alias, AbstractNode* expr2, AbstractNode* expr3) {
-      this->kind = LET_NODE;
-      this->addChild(triton::ast::string(alias));
+    LetNode::LetNode(std::string alias, AbstractNode* expr2, AbstractNode* expr3) : AbstractNode(LET_NODE, expr2->getContext()) {
+      this->addChild(this->ctxt.string(alias));
       this->addChild(expr2);
       this->addChild(expr3);
       this->init();
@@ -2629,7 +2697,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[2]->getBitvectorSize();
-      this->eval = this->childs[2]->evaluate();
+      this->eval = this->childs[2]->getEvaluation();
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2637,6 +2705,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2660,8 +2731,7 @@ namespace triton {
     /* ====== Lnot */
 
 
-    LnotNode::LnotNode(AbstractNode* expr) {
-      this->kind = LNOT_NODE;
+    LnotNode::LnotNode(AbstractNode* expr) : AbstractNode(LNOT_NODE, expr->getContext()) {
       this->addChild(expr);
       this->init();
     }
@@ -2681,7 +2751,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = !(this->childs[0]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(this->childs[0]->getEvaluation().isZero()), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2689,6 +2759,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2712,8 +2785,7 @@ namespace triton {
     /* ====== Lor */
 
 
-    LorNode::LorNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = LOR_NODE;
+    LorNode::LorNode(AbstractNode* expr1, AbstractNode* expr2) : AbstractNode(LOR_NODE, expr1->getContext()) {
       this->addChild(expr1);
       this->addChild(expr2);
       this->init();
@@ -2734,7 +2806,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() || this->childs[1]->evaluate());
+      this->eval = triton::SmallBitvector(static_cast<triton::uint64>(!this->childs[0]->getEvaluation().isZero() || !this->childs[1]->getEvaluation().isZero()), this->size);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2742,6 +2814,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2765,15 +2840,14 @@ namespace triton {
     /* ====== Reference node */
 
 
-    ReferenceNode::ReferenceNode(triton::usize value) {
-      this->kind  = REFERENCE_NODE;
-      this->value = value;
+    ReferenceNode::ReferenceNode(AstContext& ctxt, triton::usize value) : AbstractNode(REFERENCE_NODE, ctxt) {
+      this->value   = value;
       this->init();
     }
 
 
     ReferenceNode::ReferenceNode(const ReferenceNode& copy) : AbstractNode(copy) {
-      this->value = copy.value;
+      this->value   = copy.value;
     }
 
 
@@ -2783,19 +2857,26 @@ namespace triton {
 
     void ReferenceNode::init(void) {
       /* Init attributes */
-      if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
-        this->eval        = 0;
+      if (!this->ctxt.isSymbolicExpressionIdExists(this->value)) {
+        this->eval        = triton::SmallBitvector();
         this->size        = 0;
         this->symbolized  = false;
       }
       else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
-        this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
-        this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
+        this->eval        = this->ctxt.getAstFromId(this->value)->getEvaluation();
+        this->size        = this->ctxt.getAstFromId(this->value)->getBitvectorSize();
+        this->symbolized  = this->ctxt.getAstFromId(this->value)->isSymbolized();
 
-        triton::api.getAstFromId(this->value)->setParent(this);
+        this->ctxt.getAstFromId(this->value)->setParent(this);
+        this->targets.insert(this->ctxt.getAstFromId(this->value));
       }
 
+      /* Init the structural hash, a reference is hashed as the expression it points to */
+      if (this->ctxt.isSymbolicExpressionIdExists(this->value))
+        this->structuralHash = this->ctxt.getAstFromId(this->value)->getStructuralHash();
+      else
+        this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2807,6 +2888,18 @@ namespace triton {
     }
 
 
+    void ReferenceNode::detach(void) {
+      for (std::set<AbstractNode*>::iterator it = this->targets.begin(); it != this->targets.end(); it++)
+        (*it)->removeParent(this);
+      this->targets.clear();
+    }
+
+
+    void ReferenceNode::removeTarget(AbstractNode* node) {
+      this->targets.erase(node);
+    }
+
+
     void ReferenceNode::accept(AstVisitor& v) {
       v(*this);
     }
@@ -2821,8 +2914,7 @@ namespace triton {
     /* ====== String node */
 
 
-    StringNode::StringNode(std::string value) {
-      this->kind  = STRING_NODE;
+    StringNode::StringNode(AstContext& ctxt, std::string value) : AbstractNode(STRING_NODE, ctxt) {
       this->value = value;
       this->init();
     }
@@ -2839,10 +2931,13 @@ namespace triton {
 
     void StringNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
+      this->eval        = triton::SmallBitvector();
       this->size        = 0;
       this->symbolized  = false;
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2871,9 +2966,8 @@ namespace triton {
     /* ====== sx */
 
 
-    SxNode::SxNode(triton::uint32 sizeExt, AbstractNode* expr) {
-      this->kind = SX_NODE;
-      this->addChild(triton::ast::decimal(sizeExt));
+    SxNode::SxNode(triton::uint32 sizeExt, AbstractNode* expr) : AbstractNode(SX_NODE, expr->getContext()) {
+      this->addChild(this->ctxt.decimal(sizeExt));
       this->addChild(expr);
       this->init();
     }
@@ -2903,7 +2997,7 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      this->eval = this->childs[1]->getEvaluation().sx(sizeExt);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2911,6 +3005,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2934,15 +3031,14 @@ namespace triton {
     /* ====== Variable node */
 
 
-    VariableNode::VariableNode(triton::engines::symbolic::SymbolicVariable& symVar) {
-      this->kind  = VARIABLE_NODE;
-      this->value = symVar.getName();
+    VariableNode::VariableNode(AstContext& ctxt, triton::engines::symbolic::SymbolicVariable& symVar) : AbstractNode(VARIABLE_NODE, ctxt) {
+      this->value   = symVar.getName();
       this->init();
     }
 
 
     VariableNode::VariableNode(const VariableNode& copy) : AbstractNode(copy) {
-      this->value = copy.value;
+      this->value   = copy.value;
     }
 
 
@@ -2953,15 +3049,18 @@ namespace triton {
     void VariableNode::init(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
-      symVar = triton::api.getSymbolicVariableFromName(this->value);
+      symVar = this->ctxt.getSymbolicVariableFromName(this->value);
       if (symVar) {
         this->size        = symVar->getSize();
-        this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
+        this->eval        = triton::SmallBitvector(symVar->getConcreteValue(), this->size);
         this->symbolized  = true;
       }
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -2990,9 +3089,8 @@ namespace triton {
     /* ====== zx */
 
 
-    ZxNode::ZxNode(triton::uint32 sizeExt, AbstractNode* expr) {
-      this->kind = ZX_NODE;
-      this->addChild(triton::ast::decimal(sizeExt));
+    ZxNode::ZxNode(triton::uint32 sizeExt, AbstractNode* expr) : AbstractNode(ZX_NODE, expr->getContext()) {
+      this->addChild(this->ctxt.decimal(sizeExt));
       this->addChild(expr);
       this->init();
     }
@@ -3022,7 +3120,7 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->childs[1]->evaluate() & this->getBitvectorMask());
+      this->eval = this->childs[1]->getEvaluation().zx(sizeExt);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -3030,6 +3128,9 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the structural hash */
+      this->initHash();
+
       /* Init parents */
       for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
         (*it)->init();
@@ -3061,7 +3162,7 @@ namespace triton {
 
     /* Representation dispatcher from an abstract node */
     std::ostream& operator<<(std::ostream& stream, AbstractNode* node) {
-      return triton::ast::representations::astRepresentation.print(stream, node);
+      return node->getContext().print(stream, node);
     }
 
 
@@ -3098,6 +3199,23 @@ namespace triton {
     }
 
 
+    triton::uint64 mixHash(triton::uint64 h, triton::uint64 v) {
+      h ^= v + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+      h ^= h >> 30;
+      h *= 0xbf58476d1ce4e5b9ULL;
+      h ^= h >> 27;
+      h *= 0x94d049bb133111ebULL;
+      h ^= h >> 31;
+      return h;
+    }
+
+
+    void mixHash(triton::ast::hash128& h, triton::uint64 v) {
+      h.first  = triton::ast::mixHash(h.first, v);
+      h.second = triton::ast::mixHash(h.second, ~v);
+    }
+
+
     triton::sint512 modularSignExtend(AbstractNode* node) {
       triton::sint512 value = 0;
 
@@ -3122,449 +3240,6 @@ namespace triton {
 namespace triton {
   namespace ast {
 
-    AbstractNode* assert_(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) AssertNode(expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bv(triton::uint512 value, triton::uint32 size) {
-      AbstractNode* node = new(std::nothrow) BvNode(value, size);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvadd(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvaddNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvandNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvashr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvashrNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvdecl(triton::uint32 size) {
-      AbstractNode* node = new(std::nothrow) BvdeclNode(size);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvfalse(void) {
-      AbstractNode* node = new(std::nothrow) BvNode(0, 1);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvlshr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvlshrNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvmul(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvmulNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvnand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvnandNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvneg(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvnegNode(expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvnor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvnorNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvnot(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvnotNode(expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvorNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvrol(triton::uint32 rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvrol(AbstractNode* rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvror(triton::uint32 rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvror(AbstractNode* rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsdiv(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsdivNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsge(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsgeNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsgt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsgtNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvshl(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvshlNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsle(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsleNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvslt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsltNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsmod(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsmodNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsrem(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsremNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvsub(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsubNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvtrue(void) {
-      AbstractNode* node = new(std::nothrow) BvNode(1, 1);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvudiv(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvudivNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvuge(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvugeNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvugt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvugtNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvule(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvuleNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvult(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvultNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvurem(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvuremNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-     AbstractNode* bvxnor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvxnorNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* bvxor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvxorNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* compound(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new(std::nothrow) CompoundNode(exprs);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* concat(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) ConcatNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* concat(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* concat(std::list<AbstractNode*> exprs) {
-      AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* decimal(triton::uint512 value) {
-      AbstractNode* node = new(std::nothrow) DecimalNode(value);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* declareFunction(std::string name, AbstractNode* bvDecl) {
-      AbstractNode* node = new(std::nothrow) DeclareFunctionNode(name, bvDecl);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* distinct(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) DistinctNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* equal(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) EqualNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) ExtractNode(high, low, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* ite(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr) {
-      AbstractNode* node = new(std::nothrow) IteNode(ifExpr, thenExpr, elseExpr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* land(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) LandNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* let(std::string alias, AbstractNode* expr2, AbstractNode* expr3) {
-      AbstractNode* node = new(std::nothrow) LetNode(alias, expr2, expr3);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* lnot(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) LnotNode(expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* lor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) LorNode(expr1, expr2);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* reference(triton::usize value) {
-      AbstractNode* node = new(std::nothrow) ReferenceNode(value);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* string(std::string value) {
-      AbstractNode* node = new(std::nothrow) StringNode(value);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* sx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) SxNode(sizeExt, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
-    AbstractNode* variable(triton::engines::symbolic::SymbolicVariable& symVar) {
-      AbstractNode* ret  = nullptr;
-      AbstractNode* node = new(std::nothrow) VariableNode(symVar);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      ret = triton::api.recordAstNode(node);
-      triton::api.recordVariableAstNode(symVar.getName(), ret);
-      return ret;
-    }
-
-
-    AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) ZxNode(sizeExt, expr);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
-    }
-
-
     AbstractNode* newInstance(AbstractNode* node) {
       AbstractNode* newNode = nullptr;
 
@@ -3572,55 +3247,55 @@ namespace triton {
         return nullptr;
 
       switch (node->getKind()) {
-        case ASSERT_NODE:               newNode = new(std::nothrow) AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
-        case BVADD_NODE:                newNode = new(std::nothrow) BvaddNode(*reinterpret_cast<BvaddNode*>(node)); break;
-        case BVAND_NODE:                newNode = new(std::nothrow) BvandNode(*reinterpret_cast<BvandNode*>(node)); break;
-        case BVASHR_NODE:               newNode = new(std::nothrow) BvashrNode(*reinterpret_cast<BvashrNode*>(node)); break;
-        case BVDECL_NODE:               newNode = new(std::nothrow) BvdeclNode(*reinterpret_cast<BvdeclNode*>(node)); break;
-        case BVLSHR_NODE:               newNode = new(std::nothrow) BvlshrNode(*reinterpret_cast<BvlshrNode*>(node)); break;
-        case BVMUL_NODE:                newNode = new(std::nothrow) BvmulNode(*reinterpret_cast<BvmulNode*>(node)); break;
-        case BVNAND_NODE:               newNode = new(std::nothrow) BvnandNode(*reinterpret_cast<BvnandNode*>(node)); break;
-        case BVNEG_NODE:                newNode = new(std::nothrow) BvnegNode(*reinterpret_cast<BvnegNode*>(node)); break;
-        case BVNOR_NODE:                newNode = new(std::nothrow) BvnorNode(*reinterpret_cast<BvnorNode*>(node)); break;
-        case BVNOT_NODE:                newNode = new(std::nothrow) BvnotNode(*reinterpret_cast<BvnotNode*>(node)); break;
-        case BVOR_NODE:                 newNode = new(std::nothrow) BvorNode(*reinterpret_cast<BvorNode*>(node)); break;
-        case BVROL_NODE:                newNode = new(std::nothrow) BvrolNode(*reinterpret_cast<BvrolNode*>(node)); break;
-        case BVROR_NODE:                newNode = new(std::nothrow) BvrorNode(*reinterpret_cast<BvrorNode*>(node)); break;
-        case BVSDIV_NODE:               newNode = new(std::nothrow) BvsdivNode(*reinterpret_cast<BvsdivNode*>(node)); break;
-        case BVSGE_NODE:                newNode = new(std::nothrow) BvsgeNode(*reinterpret_cast<BvsgeNode*>(node)); break;
-        case BVSGT_NODE:                newNode = new(std::nothrow) BvsgtNode(*reinterpret_cast<BvsgtNode*>(node)); break;
-        case BVSHL_NODE:                newNode = new(std::nothrow) BvshlNode(*reinterpret_cast<BvshlNode*>(node)); break;
-        case BVSLE_NODE:                newNode = new(std::nothrow) BvsleNode(*reinterpret_cast<BvsleNode*>(node)); break;
-        case BVSLT_NODE:                newNode = new(std::nothrow) BvsltNode(*reinterpret_cast<BvsltNode*>(node)); break;
-        case BVSMOD_NODE:               newNode = new(std::nothrow) BvsmodNode(*reinterpret_cast<BvsmodNode*>(node)); break;
-        case BVSREM_NODE:               newNode = new(std::nothrow) BvsremNode(*reinterpret_cast<BvsremNode*>(node)); break;
-        case BVSUB_NODE:                newNode = new(std::nothrow) BvsubNode(*reinterpret_cast<BvsubNode*>(node)); break;
-        case BVUDIV_NODE:               newNode = new(std::nothrow) BvudivNode(*reinterpret_cast<BvudivNode*>(node)); break;
-        case BVUGE_NODE:                newNode = new(std::nothrow) BvugeNode(*reinterpret_cast<BvugeNode*>(node)); break;
-        case BVUGT_NODE:                newNode = new(std::nothrow) BvugtNode(*reinterpret_cast<BvugtNode*>(node)); break;
-        case BVULE_NODE:                newNode = new(std::nothrow) BvuleNode(*reinterpret_cast<BvuleNode*>(node)); break;
-        case BVULT_NODE:                newNode = new(std::nothrow) BvultNode(*reinterpret_cast<BvultNode*>(node)); break;
-        case BVUREM_NODE:               newNode = new(std::nothrow) BvuremNode(*reinterpret_cast<BvuremNode*>(node)); break;
-        case BVXNOR_NODE:               newNode = new(std::nothrow) BvxnorNode(*reinterpret_cast<BvxnorNode*>(node)); break;
-        case BVXOR_NODE:                newNode = new(std::nothrow) BvxorNode(*reinterpret_cast<BvxorNode*>(node)); break;
-        case BV_NODE:                   newNode = new(std::nothrow) BvNode(*reinterpret_cast<BvNode*>(node)); break;
-        case COMPOUND_NODE:             newNode = new(std::nothrow) CompoundNode(*reinterpret_cast<CompoundNode*>(node)); break;
-        case CONCAT_NODE:               newNode = new(std::nothrow) ConcatNode(*reinterpret_cast<ConcatNode*>(node)); break;
-        case DECIMAL_NODE:              newNode = new(std::nothrow) DecimalNode(*reinterpret_cast<DecimalNode*>(node)); break;
-        case DECLARE_FUNCTION_NODE:     newNode = new(std::nothrow) DeclareFunctionNode(*reinterpret_cast<DeclareFunctionNode*>(node)); break;
-        case DISTINCT_NODE:             newNode = new(std::nothrow) DistinctNode(*reinterpret_cast<DistinctNode*>(node)); break;
-        case EQUAL_NODE:                newNode = new(std::nothrow) EqualNode(*reinterpret_cast<EqualNode*>(node)); break;
-        case EXTRACT_NODE:              newNode = new(std::nothrow) ExtractNode(*reinterpret_cast<ExtractNode*>(node)); break;
-        case ITE_NODE:                  newNode = new(std::nothrow) IteNode(*reinterpret_cast<IteNode*>(node)); break;
-        case LAND_NODE:                 newNode = new(std::nothrow) LandNode(*reinterpret_cast<LandNode*>(node)); break;
-        case LET_NODE:                  newNode = new(std::nothrow) LetNode(*reinterpret_cast<LetNode*>(node)); break;
-        case LNOT_NODE:                 newNode = new(std::nothrow) LnotNode(*reinterpret_cast<LnotNode*>(node)); break;
-        case LOR_NODE:                  newNode = new(std::nothrow) LorNode(*reinterpret_cast<LorNode*>(node)); break;
-        case REFERENCE_NODE:            newNode = new(std::nothrow) ReferenceNode(*reinterpret_cast<ReferenceNode*>(node)); break;
-        case STRING_NODE:               newNode = new(std::nothrow) StringNode(*reinterpret_cast<StringNode*>(node)); break;
-        case SX_NODE:                   newNode = new(std::nothrow) SxNode(*reinterpret_cast<SxNode*>(node)); break;
-        case VARIABLE_NODE:             newNode = new(std::nothrow) VariableNode(*reinterpret_cast<VariableNode*>(node)); break;
-        case ZX_NODE:                   newNode = new(std::nothrow) ZxNode(*reinterpret_cast<ZxNode*>(node)); break;
+        case ASSERT_NODE:               newNode = new(node->getContext()) AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
+        case BVADD_NODE:                newNode = new(node->getContext()) BvaddNode(*reinterpret_cast<BvaddNode*>(node)); break;
+        case BVAND_NODE:                newNode = new(node->getContext()) BvandNode(*reinterpret_cast<BvandNode*>(node)); break;
+        case BVASHR_NODE:               newNode = new(node->getContext()) BvashrNode(*reinterpret_cast<BvashrNode*>(node)); break;
+        case BVDECL_NODE:               newNode = new(node->getContext()) BvdeclNode(*reinterpret_cast<BvdeclNode*>(node)); break;
+        case BVLSHR_NODE:               newNode = new(node->getContext()) BvlshrNode(*reinterpret_cast<BvlshrNode*>(node)); break;
+        case BVMUL_NODE:                newNode = new(node->getContext()) BvmulNode(*reinterpret_cast<BvmulNode*>(node)); break;
+        case BVNAND_NODE:               newNode = new(node->getContext()) BvnandNode(*reinterpret_cast<BvnandNode*>(node)); break;
+        case BVNEG_NODE:                newNode = new(node->getContext()) BvnegNode(*reinterpret_cast<BvnegNode*>(node)); break;
+        case BVNOR_NODE:                newNode = new(node->getContext()) BvnorNode(*reinterpret_cast<BvnorNode*>(node)); break;
+        case BVNOT_NODE:                newNode = new(node->getContext()) BvnotNode(*reinterpret_cast<BvnotNode*>(node)); break;
+        case BVOR_NODE:                 newNode = new(node->getContext()) BvorNode(*reinterpret_cast<BvorNode*>(node)); break;
+        case BVROL_NODE:                newNode = new(node->getContext()) BvrolNode(*reinterpret_cast<BvrolNode*>(node)); break;
+        case BVROR_NODE:                newNode = new(node->getContext()) BvrorNode(*reinterpret_cast<BvrorNode*>(node)); break;
+        case BVSDIV_NODE:               newNode = new(node->getContext()) BvsdivNode(*reinterpret_cast<BvsdivNode*>(node)); break;
+        case BVSGE_NODE:                newNode = new(node->getContext()) BvsgeNode(*reinterpret_cast<BvsgeNode*>(node)); break;
+        case BVSGT_NODE:                newNode = new(node->getContext()) BvsgtNode(*reinterpret_cast<BvsgtNode*>(node)); break;
+        case BVSHL_NODE:                newNode = new(node->getContext()) BvshlNode(*reinterpret_cast<BvshlNode*>(node)); break;
+        case BVSLE_NODE:                newNode = new(node->getContext()) BvsleNode(*reinterpret_cast<BvsleNode*>(node)); break;
+        case BVSLT_NODE:                newNode = new(node->getContext()) BvsltNode(*reinterpret_cast<BvsltNode*>(node)); break;
+        case BVSMOD_NODE:               newNode = new(node->getContext()) BvsmodNode(*reinterpret_cast<BvsmodNode*>(node)); break;
+        case BVSREM_NODE:               newNode = new(node->getContext()) BvsremNode(*reinterpret_cast<BvsremNode*>(node)); break;
+        case BVSUB_NODE:                newNode = new(node->getContext()) BvsubNode(*reinterpret_cast<BvsubNode*>(node)); break;
+        case BVUDIV_NODE:               newNode = new(node->getContext()) BvudivNode(*reinterpret_cast<BvudivNode*>(node)); break;
+        case BVUGE_NODE:                newNode = new(node->getContext()) BvugeNode(*reinterpret_cast<BvugeNode*>(node)); break;
+        case BVUGT_NODE:                newNode = new(node->getContext()) BvugtNode(*reinterpret_cast<BvugtNode*>(node)); break;
+        case BVULE_NODE:                newNode = new(node->getContext()) BvuleNode(*reinterpret_cast<BvuleNode*>(node)); break;
+        case BVULT_NODE:                newNode = new(node->getContext()) BvultNode(*reinterpret_cast<BvultNode*>(node)); break;
+        case BVUREM_NODE:               newNode = new(node->getContext()) BvuremNode(*reinterpret_cast<BvuremNode*>(node)); break;
+        case BVXNOR_NODE:               newNode = new(node->getContext()) BvxnorNode(*reinterpret_cast<BvxnorNode*>(node)); break;
+        case BVXOR_NODE:                newNode = new(node->getContext()) BvxorNode(*reinterpret_cast<BvxorNode*>(node)); break;
+        case BV_NODE:                   newNode = new(node->getContext()) BvNode(*reinterpret_cast<BvNode*>(node)); break;
+        case COMPOUND_NODE:             newNode = new(node->getContext()) CompoundNode(*reinterpret_cast<CompoundNode*>(node)); break;
+        case CONCAT_NODE:               newNode = new(node->getContext()) ConcatNode(*reinterpret_cast<ConcatNode*>(node)); break;
+        case DECIMAL_NODE:              newNode = new(node->getContext()) DecimalNode(*reinterpret_cast<DecimalNode*>(node)); break;
+        case DECLARE_FUNCTION_NODE:     newNode = new(node->getContext()) DeclareFunctionNode(*reinterpret_cast<DeclareFunctionNode*>(node)); break;
+        case DISTINCT_NODE:             newNode = new(node->getContext()) DistinctNode(*reinterpret_cast<DistinctNode*>(node)); break;
+        case EQUAL_NODE:                newNode = new(node->getContext()) EqualNode(*reinterpret_cast<EqualNode*>(node)); break;
+        case EXTRACT_NODE:              newNode = new(node->getContext()) ExtractNode(*reinterpret_cast<ExtractNode*>(node)); break;
+        case ITE_NODE:                  newNode = new(node->getContext()) IteNode(*reinterpret_cast<IteNode*>(node)); break;
+        case LAND_NODE:                 newNode = new(node->getContext()) LandNode(*reinterpret_cast<LandNode*>(node)); break;
+        case LET_NODE:                  newNode = new(node->getContext()) LetNode(*reinterpret_cast<LetNode*>(node)); break;
+        case LNOT_NODE:                 newNode = new(node->getContext()) LnotNode(*reinterpret_cast<LnotNode*>(node)); break;
+        case LOR_NODE:                  newNode = new(node->getContext()) LorNode(*reinterpret_cast<LorNode*>(node)); break;
+        case REFERENCE_NODE:            newNode = new(node->getContext()) ReferenceNode(*reinterpret_cast<ReferenceNode*>(node)); break;
+        case STRING_NODE:               newNode = new(node->getContext()) StringNode(*reinterpret_cast<StringNode*>(node)); break;
+        case SX_NODE:                   newNode = new(node->getContext()) SxNode(*reinterpret_cast<SxNode*>(node)); break;
+        case VARIABLE_NODE:             newNode = new(node->getContext()) VariableNode(*reinterpret_cast<VariableNode*>(node)); break;
+        case ZX_NODE:                   newNode = new(node->getContext()) ZxNode(*reinterpret_cast<ZxNode*>(node)); break;
         default:
           throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid kind node.");
       }
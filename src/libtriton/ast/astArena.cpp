@@ -0,0 +1,228 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdlib>
+
+#include <triton/ast.hpp>
+#include <triton/astArena.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstArena::AstArena() {
+      static_assert(sizeof(header) <= AstArena::headerSize, "AstArena::AstArena(): The header of a block is too large.");
+
+      this->classes.resize(AstArena::maxBlockSize / AstArena::granularity + 1);
+      this->liveBlocks  = 0;
+      this->scopeOpened = false;
+    }
+
+
+    AstArena::~AstArena() {
+      for (triton::uint32 index = 0; index < this->classes.size(); index++) {
+        triton::usize blockSize = index * AstArena::granularity;
+
+        for (auto& slab : this->classes[index].slabs) {
+          for (triton::usize offset = 0; offset + blockSize <= slab.second; offset += blockSize) {
+            header* block = reinterpret_cast<header*>(slab.first + offset);
+            if (block->live)
+              this->destroyBlock(block);
+          }
+          std::free(slab.first);
+        }
+      }
+    }
+
+
+    void* AstArena::allocate(std::size_t size) {
+      header* block = nullptr;
+      triton::usize total = AstArena::headerSize + size;
+
+      if (total <= AstArena::maxBlockSize) {
+        block = this->allocateBlock(static_cast<triton::uint32>((total + AstArena::granularity - 1) / AstArena::granularity));
+        if (block == nullptr)
+          return nullptr;
+      }
+
+      else {
+        block = reinterpret_cast<header*>(std::malloc(total));
+        if (block == nullptr)
+          return nullptr;
+        block->arena     = nullptr;
+        block->sizeClass = 0;
+      }
+
+      block->live  = true;
+      block->owned = false;
+
+      return reinterpret_cast<triton::uint8*>(block) + AstArena::headerSize;
+    }
+
+
+    void AstArena::release(void* object) {
+      if (object == nullptr)
+        return;
+
+      header* block = reinterpret_cast<header*>(reinterpret_cast<triton::uint8*>(object) - AstArena::headerSize);
+
+      if (block->arena == nullptr) {
+        std::free(block);
+        return;
+      }
+
+      block->arena->releaseBlock(block);
+    }
+
+
+    bool AstArena::adopt(AbstractNode* node) {
+      if (!node->isArenaAllocated())
+        return false;
+
+      header* block = reinterpret_cast<header*>(reinterpret_cast<triton::uint8*>(node) - AstArena::headerSize);
+      if (block->arena == nullptr)
+        return false;
+
+      block->owned = true;
+      return true;
+    }
+
+
+    bool AstArena::isOwned(const AbstractNode* node) {
+      if (!node->isArenaAllocated())
+        return false;
+
+      const header* block = reinterpret_cast<const header*>(reinterpret_cast<const triton::uint8*>(node) - AstArena::headerSize);
+      return block->arena != nullptr && block->live && block->owned;
+    }
+
+
+    AstArena::header* AstArena::allocateBlock(triton::uint32 index) {
+      sizeClass& cls = this->classes[index];
+      triton::usize blockSize = index * AstArena::granularity;
+      header* block = nullptr;
+
+      /* Reuse a freed block first */
+      if (!cls.freeBlocks.empty()) {
+        block = cls.freeBlocks.back();
+        cls.freeBlocks.pop_back();
+      }
+
+      else {
+        /* Carve a new block, from a new slab if the current one is full */
+        if (cls.slabs.empty() || cls.slabs.back().second + blockSize > AstArena::slabSize) {
+          triton::uint8* slab = reinterpret_cast<triton::uint8*>(std::malloc(AstArena::slabSize));
+          if (slab == nullptr)
+            return nullptr;
+          cls.slabs.push_back(std::make_pair(slab, 0));
+        }
+        block = reinterpret_cast<header*>(cls.slabs.back().first + cls.slabs.back().second);
+        cls.slabs.back().second += blockSize;
+      }
+
+      block->arena     = this;
+      block->sizeClass = index;
+      this->liveBlocks++;
+
+      if (this->scopeOpened)
+        this->scope.push_back(block);
+
+      return block;
+    }
+
+
+    void AstArena::destroyBlock(header* block) {
+      AbstractNode* node = reinterpret_cast<AbstractNode*>(reinterpret_cast<triton::uint8*>(block) + AstArena::headerSize);
+
+      /* Only runs the destructor, the block is given back below */
+      node->~AbstractNode();
+      this->releaseBlock(block);
+    }
+
+
+    void AstArena::releaseBlock(header* block) {
+      block->live  = false;
+      block->owned = false;
+      this->classes[block->sizeClass].freeBlocks.push_back(block);
+      this->liveBlocks--;
+    }
+
+
+    void AstArena::beginScope(void) {
+      this->scope.clear();
+      this->scopeOpened = true;
+    }
+
+
+    void AstArena::endScope(void) {
+      this->scope.clear();
+      this->scopeOpened = false;
+    }
+
+
+    void AstArena::releaseScope(void) {
+      /*
+       * A block freed and allocated again during the scope is recorded
+       * twice, its second record is then no longer live.
+       */
+      for (auto block : this->scope) {
+        if (block->live && block->owned)
+          this->destroyBlock(block);
+      }
+      this->endScope();
+    }
+
+
+    bool AstArena::isScopeOpened(void) const {
+      return this->scopeOpened;
+    }
+
+
+    void AstArena::releaseAll(void) {
+      for (triton::uint32 index = 0; index < this->classes.size(); index++) {
+        triton::usize blockSize = index * AstArena::granularity;
+
+        for (auto& slab : this->classes[index].slabs) {
+          for (triton::usize offset = 0; offset + blockSize <= slab.second; offset += blockSize) {
+            header* block = reinterpret_cast<header*>(slab.first + offset);
+            if (block->live && block->owned)
+              this->destroyBlock(block);
+          }
+        }
+      }
+
+      this->endScope();
+
+      /* Nothing left, give the slabs back at once */
+      if (this->liveBlocks == 0) {
+        for (auto& cls : this->classes) {
+          for (auto& slab : cls.slabs)
+            std::free(slab.first);
+          cls.slabs.clear();
+          cls.freeBlocks.clear();
+        }
+      }
+    }
+
+
+    triton::usize AstArena::getNumberOfLiveNodes(void) const {
+      return this->liveBlocks;
+    }
+
+
+    triton::usize AstArena::getNumberOfSlabs(void) const {
+      triton::usize count = 0;
+
+      for (const auto& cls : this->classes)
+        count += cls.slabs.size();
+
+      return count;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -0,0 +1,516 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <new>
+
+#include <triton/api.hpp>
+#include <triton/astContext.hpp>
+#include <triton/exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstContext::AstContext(triton::API& api) : api(api) {
+      this->arena = nullptr;
+    }
+
+
+    AstContext::~AstContext() {
+    }
+
+
+    AbstractNode* AstContext::assert_(AbstractNode* expr) {
+      AbstractNode* node = new(*this) AssertNode(expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bv(triton::uint512 value, triton::uint32 size) {
+      AbstractNode* node = new(*this) BvNode(*this, value, size);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvadd(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvaddNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvand(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvandNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvashr(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvashrNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvdecl(triton::uint32 size) {
+      AbstractNode* node = new(*this) BvdeclNode(*this, size);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvfalse(void) {
+      AbstractNode* node = new(*this) BvNode(*this, 0, 1);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvlshr(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvlshrNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvmul(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvmulNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvnand(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvnandNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvneg(AbstractNode* expr) {
+      AbstractNode* node = new(*this) BvnegNode(expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvnor(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvnorNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvnot(AbstractNode* expr) {
+      AbstractNode* node = new(*this) BvnotNode(expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvor(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvorNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvrol(triton::uint32 rot, AbstractNode* expr) {
+      AbstractNode* node = new(*this) BvrolNode(rot, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvrol(AbstractNode* rot, AbstractNode* expr) {
+      AbstractNode* node = new(*this) BvrolNode(rot, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvror(triton::uint32 rot, AbstractNode* expr) {
+      AbstractNode* node = new(*this) BvrorNode(rot, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvror(AbstractNode* rot, AbstractNode* expr) {
+      AbstractNode* node = new(*this) BvrorNode(rot, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsdiv(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsdivNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsge(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsgeNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsgt(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsgtNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvshl(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvshlNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsle(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsleNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvslt(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsltNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsmod(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsmodNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsrem(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsremNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvsub(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvsubNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvtrue(void) {
+      AbstractNode* node = new(*this) BvNode(*this, 1, 1);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvudiv(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvudivNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvuge(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvugeNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvugt(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvugtNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvule(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvuleNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvult(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvultNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvurem(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvuremNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvxnor(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvxnorNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::bvxor(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) BvxorNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::compound(std::vector<AbstractNode*> exprs) {
+      AbstractNode* node = new(*this) CompoundNode(*this, exprs);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::concat(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) ConcatNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::concat(std::vector<AbstractNode*> exprs) {
+      AbstractNode* node = new(*this) ConcatNode(*this, exprs);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::concat(std::list<AbstractNode*> exprs) {
+      AbstractNode* node = new(*this) ConcatNode(*this, exprs);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::decimal(triton::uint512 value) {
+      AbstractNode* node = new(*this) DecimalNode(*this, value);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::declareFunction(std::string name, AbstractNode* bvDecl) {
+      AbstractNode* node = new(*this) DeclareFunctionNode(name, bvDecl);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::distinct(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) DistinctNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::equal(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) EqualNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
+      AbstractNode* node = new(*this) ExtractNode(high, low, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::ite(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr) {
+      AbstractNode* node = new(*this) IteNode(ifExpr, thenExpr, elseExpr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::land(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) LandNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::let(std::string alias, AbstractNode* expr2, AbstractNode* expr3) {
+      AbstractNode* node = new(*this) LetNode(alias, expr2, expr3);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::lnot(AbstractNode* expr) {
+      AbstractNode* node = new(*this) LnotNode(expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::lor(AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(*this) LorNode(expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::reference(triton::usize value) {
+      AbstractNode* node = new(*this) ReferenceNode(*this, value);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::string(std::string value) {
+      AbstractNode* node = new(*this) StringNode(*this, value);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::sx(triton::uint32 sizeExt, AbstractNode* expr) {
+      AbstractNode* node = new(*this) SxNode(sizeExt, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    AbstractNode* AstContext::variable(triton::engines::symbolic::SymbolicVariable& symVar) {
+      AbstractNode* ret  = nullptr;
+      AbstractNode* node = new(*this) VariableNode(*this, symVar);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      ret = this->api.recordAstNode(node);
+      this->api.recordVariableAstNode(symVar.getName(), ret);
+      return ret;
+    }
+
+
+    AbstractNode* AstContext::zx(triton::uint32 sizeExt, AbstractNode* expr) {
+      AbstractNode* node = new(*this) ZxNode(sizeExt, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return this->api.recordAstNode(node);
+    }
+
+
+    triton::ast::AstArena* AstContext::getArena(void) const {
+      return this->arena;
+    }
+
+
+    void AstContext::setArena(triton::ast::AstArena* arena) {
+      this->arena = arena;
+    }
+
+
+    bool AstContext::isSymbolicExpressionIdExists(triton::usize id) const {
+      return this->api.isSymbolicExpressionIdExists(id);
+    }
+
+
+    AbstractNode* AstContext::getAstFromId(triton::usize id) {
+      return this->api.getAstFromId(id);
+    }
+
+
+    AbstractNode* AstContext::getAstVariableNode(const std::string& name) const {
+      return this->api.getAstVariableNode(name);
+    }
+
+
+    triton::engines::symbolic::SymbolicVariable* AstContext::getSymbolicVariableFromName(const std::string& name) const {
+      return this->api.getSymbolicVariableFromName(name);
+    }
+
+
+    triton::uint32 AstContext::getRepresentationMode(void) const {
+      return this->astRepresentation.getMode();
+    }
+
+
+    void AstContext::setRepresentationMode(triton::uint32 mode) {
+      this->astRepresentation.setMode(mode);
+    }
+
+
+    std::ostream& AstContext::print(std::ostream& stream, AbstractNode* node) {
+      return this->astRepresentation.print(stream, node);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -12,11 +12,15 @@
 namespace triton {
   namespace ast {
 
+    /* The initial capacity of the table, a power of two */
+    static const triton::usize initialCapacity = 1024;
+
+
     AstDictionaries::AstDictionaries(bool isBackup) {
       this->allocatedNodes  = 0;
       this->backupFlag      = isBackup;
-
-      this->linkDictionaries();
+      this->tableSize       = 0;
+      this->table.resize(initialCapacity, slot{0, nullptr});
     }
 
 
@@ -27,8 +31,8 @@ namespace triton {
 
     AstDictionaries::~AstDictionaries() {
       if (this->backupFlag == false) {
-        for (auto it = this->allocatedDictionaries.begin(); it != this->allocatedDictionaries.end(); it++)
-          delete *it;
+        for (auto it = this->table.begin(); it != this->table.end(); it++)
+          triton::ast::AbstractNode::destroy(it->node);
       }
     }
 
@@ -39,243 +43,144 @@ namespace triton {
 
 
     void AstDictionaries::copy(const AstDictionaries& other) {
-      /* Global information */
-      this->allocatedNodes              = other.allocatedNodes;
-      this->allocatedDictionaries       = other.allocatedDictionaries;
-      this->backupFlag                  = true;
-
-      /* Dictionnaries */
-      this->assertDictionary            = other.assertDictionary;
-      this->bvaddDictionary             = other.bvaddDictionary;
-      this->bvandDictionary             = other.bvandDictionary;
-      this->bvashrDictionary            = other.bvashrDictionary;
-      this->bvdeclDictionary            = other.bvdeclDictionary;
-      this->bvlshrDictionary            = other.bvlshrDictionary;
-      this->bvmulDictionary             = other.bvmulDictionary;
-      this->bvnandDictionary            = other.bvnandDictionary;
-      this->bvnegDictionary             = other.bvnegDictionary;
-      this->bvnorDictionary             = other.bvnorDictionary;
-      this->bvnotDictionary             = other.bvnotDictionary;
-      this->bvorDictionary              = other.bvorDictionary;
-      this->bvrolDictionary             = other.bvrolDictionary;
-      this->bvrorDictionary             = other.bvrorDictionary;
-      this->bvsdivDictionary            = other.bvsdivDictionary;
-      this->bvsgeDictionary             = other.bvsgeDictionary;
-      this->bvsgtDictionary             = other.bvsgtDictionary;
-      this->bvshlDictionary             = other.bvshlDictionary;
-      this->bvsleDictionary             = other.bvsleDictionary;
-      this->bvsltDictionary             = other.bvsltDictionary;
-      this->bvsmodDictionary            = other.bvsmodDictionary;
-      this->bvsremDictionary            = other.bvsremDictionary;
-      this->bvsubDictionary             = other.bvsubDictionary;
-      this->bvudivDictionary            = other.bvudivDictionary;
-      this->bvugeDictionary             = other.bvugeDictionary;
-      this->bvugtDictionary             = other.bvugtDictionary;
-      this->bvuleDictionary             = other.bvuleDictionary;
-      this->bvultDictionary             = other.bvultDictionary;
-      this->bvuremDictionary            = other.bvuremDictionary;
-      this->bvxnorDictionary            = other.bvxnorDictionary;
-      this->bvxorDictionary             = other.bvxorDictionary;
-      this->bvDictionary                = other.bvDictionary;
-      this->compoundDictionary          = other.compoundDictionary;
-      this->concatDictionary            = other.concatDictionary;
-      this->decimalDictionary           = other.decimalDictionary;
-      this->declareFunctionDictionary   = other.declareFunctionDictionary;
-      this->distinctDictionary          = other.distinctDictionary;
-      this->equalDictionary             = other.equalDictionary;
-      this->extractDictionary           = other.extractDictionary;
-      this->iteDictionary               = other.iteDictionary;
-      this->landDictionary              = other.landDictionary;
-      this->letDictionary               = other.letDictionary;
-      this->lnotDictionary              = other.lnotDictionary;
-      this->lorDictionary               = other.lorDictionary;
-      this->referenceDictionary         = other.referenceDictionary;
-      this->stringDictionary            = other.stringDictionary;
-      this->sxDictionary                = other.sxDictionary;
-      this->variableDictionary          = other.variableDictionary;
-      this->zxDictionary                = other.zxDictionary;
-
-      this->linkDictionaries();
+      this->allocatedNodes  = other.allocatedNodes;
+      this->backupFlag      = true;
+      this->kindSizes       = other.kindSizes;
+      this->table           = other.table;
+      this->tableSize       = other.tableSize;
+    }
+
+
+    bool AstDictionaries::isSameNode(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) {
+      if (node1->getKind() != node2->getKind() || node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      switch (node1->getKind()) {
+        case triton::ast::DECIMAL_NODE:
+          return reinterpret_cast<triton::ast::DecimalNode*>(node1)->getValue() == reinterpret_cast<triton::ast::DecimalNode*>(node2)->getValue();
+
+        case triton::ast::REFERENCE_NODE:
+          return reinterpret_cast<triton::ast::ReferenceNode*>(node1)->getValue() == reinterpret_cast<triton::ast::ReferenceNode*>(node2)->getValue();
+
+        case triton::ast::STRING_NODE:
+          return reinterpret_cast<triton::ast::StringNode*>(node1)->getValue() == reinterpret_cast<triton::ast::StringNode*>(node2)->getValue();
+
+        case triton::ast::VARIABLE_NODE:
+          return reinterpret_cast<triton::ast::VariableNode*>(node1)->getValue() == reinterpret_cast<triton::ast::VariableNode*>(node2)->getValue();
+
+        default:
+          return node1->getChilds() == node2->getChilds();
+      }
     }
 
 
-    void AstDictionaries::linkDictionaries(void) {
-      this->dictionaries[triton::ast::ASSERT_NODE]             = &this->assertDictionary;
-      this->dictionaries[triton::ast::BVADD_NODE]              = &this->bvaddDictionary;
-      this->dictionaries[triton::ast::BVAND_NODE]              = &this->bvandDictionary;
-      this->dictionaries[triton::ast::BVASHR_NODE]             = &this->bvashrDictionary;
-      this->dictionaries[triton::ast::BVDECL_NODE]             = &this->bvdeclDictionary;
-      this->dictionaries[triton::ast::BVLSHR_NODE]             = &this->bvlshrDictionary;
-      this->dictionaries[triton::ast::BVMUL_NODE]              = &this->bvmulDictionary;
-      this->dictionaries[triton::ast::BVNAND_NODE]             = &this->bvnandDictionary;
-      this->dictionaries[triton::ast::BVNEG_NODE]              = &this->bvnegDictionary;
-      this->dictionaries[triton::ast::BVNOR_NODE]              = &this->bvnorDictionary;
-      this->dictionaries[triton::ast::BVNOT_NODE]              = &this->bvnotDictionary;
-      this->dictionaries[triton::ast::BVOR_NODE]               = &this->bvorDictionary;
-      this->dictionaries[triton::ast::BVROL_NODE]              = &this->bvrolDictionary;
-      this->dictionaries[triton::ast::BVROR_NODE]              = &this->bvrorDictionary;
-      this->dictionaries[triton::ast::BVSDIV_NODE]             = &this->bvsdivDictionary;
-      this->dictionaries[triton::ast::BVSGE_NODE]              = &this->bvsgeDictionary;
-      this->dictionaries[triton::ast::BVSGT_NODE]              = &this->bvsgtDictionary;
-      this->dictionaries[triton::ast::BVSHL_NODE]              = &this->bvshlDictionary;
-      this->dictionaries[triton::ast::BVSLE_NODE]              = &this->bvsleDictionary;
-      this->dictionaries[triton::ast::BVSLT_NODE]              = &this->bvsltDictionary;
-      this->dictionaries[triton::ast::BVSMOD_NODE]             = &this->bvsmodDictionary;
-      this->dictionaries[triton::ast::BVSREM_NODE]             = &this->bvsremDictionary;
-      this->dictionaries[triton::ast::BVSUB_NODE]              = &this->bvsubDictionary;
-      this->dictionaries[triton::ast::BVUDIV_NODE]             = &this->bvudivDictionary;
-      this->dictionaries[triton::ast::BVUGE_NODE]              = &this->bvugeDictionary;
-      this->dictionaries[triton::ast::BVUGT_NODE]              = &this->bvugtDictionary;
-      this->dictionaries[triton::ast::BVULE_NODE]              = &this->bvuleDictionary;
-      this->dictionaries[triton::ast::BVULT_NODE]              = &this->bvultDictionary;
-      this->dictionaries[triton::ast::BVUREM_NODE]             = &this->bvuremDictionary;
-      this->dictionaries[triton::ast::BVXNOR_NODE]             = &this->bvxnorDictionary;
-      this->dictionaries[triton::ast::BVXOR_NODE]              = &this->bvxorDictionary;
-      this->dictionaries[triton::ast::BV_NODE]                 = &this->bvDictionary;
-      this->dictionaries[triton::ast::COMPOUND_NODE]           = &this->compoundDictionary;
-      this->dictionaries[triton::ast::CONCAT_NODE]             = &this->concatDictionary;
-      this->dictionaries[triton::ast::DECIMAL_NODE]            = &this->decimalDictionary;
-      this->dictionaries[triton::ast::DECLARE_FUNCTION_NODE]   = &this->declareFunctionDictionary;
-      this->dictionaries[triton::ast::DISTINCT_NODE]           = &this->distinctDictionary;
-      this->dictionaries[triton::ast::EQUAL_NODE]              = &this->equalDictionary;
-      this->dictionaries[triton::ast::EXTRACT_NODE]            = &this->extractDictionary;
-      this->dictionaries[triton::ast::ITE_NODE]                = &this->iteDictionary;
-      this->dictionaries[triton::ast::LAND_NODE]               = &this->landDictionary;
-      this->dictionaries[triton::ast::LET_NODE]                = &this->letDictionary;
-      this->dictionaries[triton::ast::LNOT_NODE]               = &this->lnotDictionary;
-      this->dictionaries[triton::ast::LOR_NODE]                = &this->lorDictionary;
-      this->dictionaries[triton::ast::REFERENCE_NODE]          = &this->referenceDictionary;
-      this->dictionaries[triton::ast::STRING_NODE]             = &this->stringDictionary;
-      this->dictionaries[triton::ast::SX_NODE]                 = &this->sxDictionary;
-      this->dictionaries[triton::ast::VARIABLE_NODE]           = &this->variableDictionary;
-      this->dictionaries[triton::ast::ZX_NODE]                 = &this->zxDictionary;
+    void AstDictionaries::growTable(void) {
+      std::vector<slot> old(this->table.size() * 2, slot{0, nullptr});
+      triton::usize mask = old.size() - 1;
+
+      old.swap(this->table);
+
+      /* The hashes are kept in the slots, nodes are not hashed again */
+      for (auto it = old.begin(); it != old.end(); it++) {
+        if (it->node == nullptr)
+          continue;
+        triton::usize index = it->hash & mask;
+        while (this->table[index].node != nullptr)
+          index = (index + 1) & mask;
+        this->table[index] = *it;
+      }
     }
 
 
     triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
       this->allocatedNodes++;
-      triton::uint32 kind = node->getKind();
-
-      switch (kind) {
-
-        case triton::ast::DECIMAL_NODE: {
-          auto value       = static_cast<triton::ast::DecimalNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::uint512, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
-
-        case triton::ast::REFERENCE_NODE: {
-          auto value       = static_cast<triton::ast::ReferenceNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::usize, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
 
-        case triton::ast::STRING_NODE: {
-          auto value       = static_cast<triton::ast::StringNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
+      /* Keep the load factor under 1/2 */
+      if ((this->tableSize + 1) * 2 > this->table.size())
+        this->growTable();
 
-        case triton::ast::VARIABLE_NODE: {
-          auto value       = static_cast<triton::ast::VariableNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
-        }
+      triton::uint64 hash  = node->getStructuralHash().first;
+      triton::usize mask   = this->table.size() - 1;
+      triton::usize index  = hash & mask;
 
-        default: {
-          auto value       = node->getChilds();
-          auto dictionary  = static_cast<std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
-          break;
+      while (this->table[index].node != nullptr) {
+        const slot& entry = this->table[index];
+        if (entry.hash == hash && AstDictionaries::isSameNode(entry.node, node)) {
+          triton::ast::AbstractNode::destroy(node);
+          return entry.node;
         }
-
+        index = (index + 1) & mask;
       }
 
-      this->allocatedDictionaries.insert(node);
+      this->table[index] = slot{hash, node};
+      this->kindSizes[node->getKind()]++;
+      this->tableSize++;
+
       return nullptr;
     }
 
 
     std::map<std::string, triton::usize> AstDictionaries::getAstDictionariesStats(void) const {
       std::map<std::string, triton::usize> stats;
-      stats["assert"]                 = this->assertDictionary.size();
-      stats["bvadd"]                  = this->bvaddDictionary.size();
-      stats["bvand"]                  = this->bvandDictionary.size();
-      stats["bvashr"]                 = this->bvashrDictionary.size();
-      stats["bvdecl"]                 = this->bvdeclDictionary.size();
-      stats["bvlshr"]                 = this->bvlshrDictionary.size();
-      stats["bvmul"]                  = this->bvmulDictionary.size();
-      stats["bvnand"]                 = this->bvnandDictionary.size();
-      stats["bvneg"]                  = this->bvnegDictionary.size();
-      stats["bvnor"]                  = this->bvnorDictionary.size();
-      stats["bvnot"]                  = this->bvnotDictionary.size();
-      stats["bvor"]                   = this->bvorDictionary.size();
-      stats["bvrol"]                  = this->bvrolDictionary.size();
-      stats["bvror"]                  = this->bvrorDictionary.size();
-      stats["bvsdiv"]                 = this->bvsdivDictionary.size();
-      stats["bvsge"]                  = this->bvsgeDictionary.size();
-      stats["bvsgt"]                  = this->bvsgtDictionary.size();
-      stats["bvshl"]                  = this->bvshlDictionary.size();
-      stats["bvsle"]                  = this->bvsleDictionary.size();
-      stats["bvslt"]                  = this->bvsltDictionary.size();
-      stats["bvsmod"]                 = this->bvsmodDictionary.size();
-      stats["bvsrem"]                 = this->bvsremDictionary.size();
-      stats["bvsub"]                  = this->bvsubDictionary.size();
-      stats["bvudiv"]                 = this->bvudivDictionary.size();
-      stats["bvuge"]                  = this->bvugeDictionary.size();
-      stats["bvugt"]                  = this->bvugtDictionary.size();
-      stats["bvule"]                  = this->bvuleDictionary.size();
-      stats["bvult"]                  = this->bvultDictionary.size();
-      stats["bvurem"]                 = this->bvuremDictionary.size();
-      stats["bvxnor"]                 = this->bvxnorDictionary.size();
-      stats["bvxor"]                  = this->bvxorDictionary.size();
-      stats["bv"]                     = this->bvDictionary.size();
-      stats["compound"]               = this->compoundDictionary.size();
-      stats["concat"]                 = this->concatDictionary.size();
-      stats["decimal"]                = this->decimalDictionary.size();
-      stats["declareFunction"]        = this->declareFunctionDictionary.size();
-      stats["distinct"]               = this->distinctDictionary.size();
-      stats["equal"]                  = this->equalDictionary.size();
-      stats["extract"]                = this->extractDictionary.size();
-      stats["ite"]                    = this->iteDictionary.size();
-      stats["land"]                   = this->landDictionary.size();
-      stats["let"]                    = this->letDictionary.size();
-      stats["lnot"]                   = this->lnotDictionary.size();
-      stats["lor"]                    = this->lorDictionary.size();
-      stats["reference"]              = this->referenceDictionary.size();
-      stats["string"]                 = this->stringDictionary.size();
-      stats["sx"]                     = this->sxDictionary.size();
-      stats["variable"]               = this->variableDictionary.size();
-      stats["zx"]                     = this->zxDictionary.size();
-      stats["allocatedDictionaries"]  = this->allocatedDictionaries.size();
+
+      auto count = [this](triton::uint32 kind) -> triton::usize {
+        auto it = this->kindSizes.find(kind);
+        return (it != this->kindSizes.end()) ? it->second : 0;
+      };
+
+      stats["assert"]                 = count(triton::ast::ASSERT_NODE);
+      stats["bvadd"]                  = count(triton::ast::BVADD_NODE);
+      stats["bvand"]                  = count(triton::ast::BVAND_NODE);
+      stats["bvashr"]                 = count(triton::ast::BVASHR_NODE);
+      stats["bvdecl"]                 = count(triton::ast::BVDECL_NODE);
+      stats["bvlshr"]                 = count(triton::ast::BVLSHR_NODE);
+      stats["bvmul"]                  = count(triton::ast::BVMUL_NODE);
+      stats["bvnand"]                 = count(triton::ast::BVNAND_NODE);
+      stats["bvneg"]                  = count(triton::ast::BVNEG_NODE);
+      stats["bvnor"]                  = count(triton::ast::BVNOR_NODE);
+      stats["bvnot"]                  = count(triton::ast::BVNOT_NODE);
+      stats["bvor"]                   = count(triton::ast::BVOR_NODE);
+      stats["bvrol"]                  = count(triton::ast::BVROL_NODE);
+      stats["bvror"]                  = count(triton::ast::BVROR_NODE);
+      stats["bvsdiv"]                 = count(triton::ast::BVSDIV_NODE);
+      stats["bvsge"]                  = count(triton::ast::BVSGE_NODE);
+      stats["bvsgt"]                  = count(triton::ast::BVSGT_NODE);
+      stats["bvshl"]                  = count(triton::ast::BVSHL_NODE);
+      stats["bvsle"]                  = count(triton::ast::BVSLE_NODE);
+      stats["bvslt"]                  = count(triton::ast::BVSLT_NODE);
+      stats["bvsmod"]                 = count(triton::ast::BVSMOD_NODE);
+      stats["bvsrem"]                 = count(triton::ast::BVSREM_NODE);
+      stats["bvsub"]                  = count(triton::ast::BVSUB_NODE);
+      stats["bvudiv"]                 = count(triton::ast::BVUDIV_NODE);
+      stats["bvuge"]                  = count(triton::ast::BVUGE_NODE);
+      stats["bvugt"]                  = count(triton::ast::BVUGT_NODE);
+      stats["bvule"]                  = count(triton::ast::BVULE_NODE);
+      stats["bvult"]                  = count(triton::ast::BVULT_NODE);
+      stats["bvurem"]                 = count(triton::ast::BVUREM_NODE);
+      stats["bvxnor"]                 = count(triton::ast::BVXNOR_NODE);
+      stats["bvxor"]                  = count(triton::ast::BVXOR_NODE);
+      stats["bv"]                     = count(triton::ast::BV_NODE);
+      stats["compound"]               = count(triton::ast::COMPOUND_NODE);
+      stats["concat"]                 = count(triton::ast::CONCAT_NODE);
+      stats["decimal"]                = count(triton::ast::DECIMAL_NODE);
+      stats["declareFunction"]        = count(triton::ast::DECLARE_FUNCTION_NODE);
+      stats["distinct"]               = count(triton::ast::DISTINCT_NODE);
+      stats["equal"]                  = count(triton::ast::EQUAL_NODE);
+      stats["extract"]                = count(triton::ast::EXTRACT_NODE);
+      stats["ite"]                    = count(triton::ast::ITE_NODE);
+      stats["land"]                   = count(triton::ast::LAND_NODE);
+      stats["let"]                    = count(triton::ast::LET_NODE);
+      stats["lnot"]                   = count(triton::ast::LNOT_NODE);
+      stats["lor"]                    = count(triton::ast::LOR_NODE);
+      stats["reference"]              = count(triton::ast::REFERENCE_NODE);
+      stats["string"]                 = count(triton::ast::STRING_NODE);
+      stats["sx"]                     = count(triton::ast::SX_NODE);
+      stats["variable"]               = count(triton::ast::VARIABLE_NODE);
+      stats["zx"]                     = count(triton::ast::ZX_NODE);
+      stats["allocatedDictionaries"]  = this->tableSize;
       stats["allocatedNodes"]         = this->allocatedNodes;
       return stats;
     }
 
   }; /* ast namespace */
 }; /*triton namespace */
-
@@ -13,19 +13,22 @@
 namespace triton {
   namespace ast {
 
-    AstGarbageCollector::AstGarbageCollector(triton::modes::Modes* modes, bool isBackup)
+    AstGarbageCollector::AstGarbageCollector(triton::modes::Modes* modes, bool isBackup, triton::ast::AstArena* arena)
       : triton::ast::AstDictionaries(isBackup) {
 
       if (modes == nullptr)
         throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::AstGarbageCollector(): The modes API cannot be null.");
 
-      this->backupFlag = isBackup;
-      this->modes      = modes;
+      this->arena         = arena;
+      this->backupFlag    = isBackup;
+      this->journalOpened = false;
+      this->modes         = modes;
     }
 
 
     AstGarbageCollector::AstGarbageCollector(const AstGarbageCollector& other)
       : triton::ast::AstDictionaries(other) {
+      this->arena = nullptr;
       this->copy(other);
     }
 
@@ -37,15 +40,24 @@ namespace triton {
 
 
     void AstGarbageCollector::copy(const AstGarbageCollector& other) {
+      /*
+       * The arena is not copied, its nodes are not in allocatedNodes and
+       * stay owned by the arena of the API.
+       */
+
       /* Remove unused nodes before the assignation */
       for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
         if (other.allocatedNodes.find(*it) == other.allocatedNodes.end())
-          delete *it;
+          triton::ast::AbstractNode::destroy(*it);
       }
       this->allocatedNodes  = other.allocatedNodes;
       this->backupFlag      = true;
+      this->journalOpened   = false;
       this->modes           = other.modes;
       this->variableNodes   = other.variableNodes;
+      this->checkpoints.clear();
+      this->journal.clear();
+      this->arenaJournal.clear();
     }
 
 
@@ -57,10 +69,20 @@ namespace triton {
 
     void AstGarbageCollector::freeAllAstNodes(void) {
       for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
-        delete *it;
+        triton::ast::AbstractNode::destroy(*it);
 
       this->variableNodes.clear();
       this->allocatedNodes.clear();
+
+      /* Destroy at once the nodes owned by the arena */
+      if (this->arena)
+        this->arena->releaseAll();
+
+      /* Nothing is left to free by the checkpoints */
+      for (auto it = this->checkpoints.begin(); it != this->checkpoints.end(); it++)
+        *it = std::make_pair(0, 0);
+      this->journal.clear();
+      this->arenaJournal.clear();
     }
 
 
@@ -80,13 +102,32 @@ namespace triton {
           this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
 
         /* Delete the node */
-        delete *it;
+        triton::ast::AbstractNode::destroy(*it);
       }
 
       nodes.clear();
     }
 
 
+    void AstGarbageCollector::detachAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) const {
+      for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        triton::ast::AbstractNode* node = *it;
+
+        for (auto child = node->getChilds().begin(); child != node->getChilds().end(); child++)
+          (*child)->removeParent(node);
+
+        /* A reference is a parent of the AST of its expression */
+        if (node->getKind() == triton::ast::REFERENCE_NODE)
+          reinterpret_cast<triton::ast::ReferenceNode*>(node)->detach();
+
+        for (auto parent = node->getParents().begin(); parent != node->getParents().end(); parent++) {
+          if ((*parent)->getKind() == triton::ast::REFERENCE_NODE)
+            reinterpret_cast<triton::ast::ReferenceNode*>(*parent)->removeTarget(node);
+        }
+      }
+    }
+
+
     void AstGarbageCollector::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
       std::vector<triton::ast::AbstractNode*>::const_iterator it;
       uniqueNodes.insert(root);
@@ -102,9 +143,14 @@ namespace triton {
         if (ret != nullptr)
           return ret;
       }
-      else {
-        /* Record the node */
+      else if (!this->arena || !triton::ast::AstArena::adopt(node)) {
+        /* Record the node, unless the arena owns it */
         this->allocatedNodes.insert(node);
+        if (!this->checkpoints.empty())
+          this->journal.push_back(node);
+      }
+      else if (!this->checkpoints.empty()) {
+        this->arenaJournal.push_back(node);
       }
       return node;
     }
@@ -115,6 +161,100 @@ namespace triton {
     }
 
 
+    triton::usize AstGarbageCollector::newCheckpoint(void) {
+      this->checkpoints.push_back(std::make_pair(this->journal.size(), this->arenaJournal.size()));
+      return this->checkpoints.size() - 1;
+    }
+
+
+    void AstGarbageCollector::restoreCheckpoint(triton::usize index) {
+      std::set<triton::ast::AbstractNode*> nodes;
+      std::set<triton::ast::AbstractNode*> arenaNodes;
+
+      if (index >= this->checkpoints.size())
+        throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::restoreCheckpoint(): Invalid checkpoint.");
+
+      /* Nodes already freed since the checkpoint are skipped */
+      for (triton::usize i = this->checkpoints[index].first; i < this->journal.size(); i++) {
+        if (this->allocatedNodes.find(this->journal[i]) != this->allocatedNodes.end())
+          nodes.insert(this->journal[i]);
+      }
+
+      /* The blocks of the arena stay readable, a block reused since the checkpoint is recorded again */
+      for (triton::usize i = this->checkpoints[index].second; i < this->arenaJournal.size(); i++) {
+        if (triton::ast::AstArena::isOwned(this->arenaJournal[i]))
+          arenaNodes.insert(this->arenaJournal[i]);
+      }
+
+      this->journal.resize(this->checkpoints[index].first);
+      this->arenaJournal.resize(this->checkpoints[index].second);
+      this->checkpoints.erase(this->checkpoints.begin() + index + 1, this->checkpoints.end());
+
+      /* The nodes created before the checkpoint may be initialized again, they must not see the freed ones */
+      if (!this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES))
+        this->detachAstNodes(nodes);
+      this->detachAstNodes(arenaNodes);
+
+      this->freeAstNodes(nodes);
+
+      for (auto it = arenaNodes.begin(); it != arenaNodes.end(); it++) {
+        if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
+          this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
+        triton::ast::AbstractNode::destroy(*it);
+      }
+    }
+
+
+    void AstGarbageCollector::removeCheckpoint(triton::usize index) {
+      if (index >= this->checkpoints.size())
+        throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::removeCheckpoint(): Invalid checkpoint.");
+
+      this->checkpoints.erase(this->checkpoints.begin() + index, this->checkpoints.end());
+
+      if (this->checkpoints.empty()) {
+        this->journal.clear();
+        this->arenaJournal.clear();
+      }
+    }
+
+
+    triton::usize AstGarbageCollector::getNumberOfCheckpoints(void) const {
+      return this->checkpoints.size();
+    }
+
+
+    void AstGarbageCollector::beginJournal(void) {
+      /* A journal left opened by an exception during the processing is undone */
+      if (this->journalOpened)
+        this->rollbackJournal();
+
+      this->newCheckpoint();
+      this->journalOpened = true;
+    }
+
+
+    void AstGarbageCollector::rollbackJournal(void) {
+      if (!this->journalOpened)
+        throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::rollbackJournal(): No journal opened.");
+
+      triton::usize index = this->checkpoints.size() - 1;
+
+      this->restoreCheckpoint(index);
+      this->removeCheckpoint(index);
+      this->journalOpened = false;
+    }
+
+
+    bool AstGarbageCollector::isJournalOpened(void) const {
+      return this->journalOpened;
+    }
+
+
+    triton::ast::AstArena* AstGarbageCollector::getAstArena(void) const {
+      return this->arena;
+    }
+
+
     const std::set<triton::ast::AbstractNode*>& AstGarbageCollector::getAllocatedAstNodes(void) const {
       return this->allocatedNodes;
     }
@@ -136,7 +276,7 @@ namespace triton {
       /* Remove unused nodes before the assignation */
       for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
         if (nodes.find(*it) == nodes.end())
-          delete *it;
+          triton::ast::AbstractNode::destroy(*it);
       }
       this->allocatedNodes = nodes;
     }
@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+
 #include <triton/cpuSize.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/tritonToZ3Ast.hpp>
@@ -14,12 +16,14 @@
 namespace triton {
   namespace ast {
 
-    TritonToZ3Ast::TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval) {
+    TritonToZ3Ast::TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval, bool normalize) {
       if (symbolicEngine == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::TritonToZ3Ast(): The symbolicEngine API cannot be null.");
 
       this->symbolicEngine = symbolicEngine;
       this->isEval = eval;
+      this->letDepth = 0;
+      this->normalize = normalize;
     }
 
 
@@ -28,43 +32,258 @@ namespace triton {
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
-      e.accept(*this);
+      if (this->letDepth == 0) {
+        auto it = this->translatedNodes.find(&e);
+        if (it != this->translatedNodes.end()) {
+          this->result.setExpr(it->second);
+          return this->result;
+        }
+      }
+
+      /* Nodes under a let depend on its symbols, they are translated as is */
+      if (!this->normalize || this->letDepth != 0 || !this->normalizeNode(e))
+        e.accept(*this);
+
+      if (this->letDepth == 0)
+        this->translatedNodes.insert(std::make_pair(&e, this->result.getExpr()));
+
       return this->result;
     }
 
 
+    bool TritonToZ3Ast::isLogical(const triton::ast::AbstractNode& e) {
+      switch (e.getKind()) {
+        case triton::ast::ASSERT_NODE:
+        case triton::ast::BVSGE_NODE:
+        case triton::ast::BVSGT_NODE:
+        case triton::ast::BVSLE_NODE:
+        case triton::ast::BVSLT_NODE:
+        case triton::ast::BVUGE_NODE:
+        case triton::ast::BVUGT_NODE:
+        case triton::ast::BVULE_NODE:
+        case triton::ast::BVULT_NODE:
+        case triton::ast::DISTINCT_NODE:
+        case triton::ast::EQUAL_NODE:
+        case triton::ast::LAND_NODE:
+        case triton::ast::LNOT_NODE:
+        case triton::ast::LOR_NODE:
+          return true;
+        default:
+          return false;
+      }
+    }
+
+
+    triton::ast::AbstractNode* TritonToZ3Ast::resolve(triton::ast::AbstractNode* node) const {
+      while (node->getKind() == triton::ast::REFERENCE_NODE) {
+        auto expr = this->symbolicEngine->getSymbolicExpressionFromId(reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue());
+        if (expr == nullptr)
+          break;
+        node = expr->getAst();
+      }
+      return node;
+    }
+
+
+    bool TritonToZ3Ast::normalizeNode(triton::ast::AbstractNode& e) {
+      z3::context& ctx = this->result.getContext();
+
+      /* Constant folding, the concrete value of a node without symbolic variable is its value */
+      if (!e.isSymbolized()) {
+        switch (e.getKind()) {
+          case triton::ast::BVDECL_NODE:
+          case triton::ast::COMPOUND_NODE:
+          case triton::ast::DECIMAL_NODE:
+          case triton::ast::DECLARE_FUNCTION_NODE:
+          case triton::ast::FUNCTION_NODE:
+          case triton::ast::LET_NODE:
+          case triton::ast::PARAM_NODE:
+          case triton::ast::STRING_NODE:
+          case triton::ast::UNDEFINED_NODE:
+            return false;
+          default:
+            break;
+        }
+
+        if (isLogical(e)) {
+          z3::expr newexpr = ctx.bool_val(e.evaluate() != 0);
+          this->result.setExpr(newexpr);
+          return true;
+        }
+
+        if (e.getBitvectorSize() == 0)
+          return false;
+
+        z3::expr newexpr = ctx.bv_val(e.evaluate().str().c_str(), e.getBitvectorSize());
+        this->result.setExpr(newexpr);
+        return true;
+      }
+
+      switch (e.getKind()) {
+        /* An ite with a constant condition or with the same branches is one of its branches */
+        case triton::ast::ITE_NODE: {
+          const auto& childs = e.getChilds();
+          if (!childs[0]->isSymbolized()) {
+            this->eval(*(childs[0]->evaluate() != 0 ? childs[1] : childs[2]));
+            return true;
+          }
+          if (childs[1]->getStructuralHash() == childs[2]->getStructuralHash()) {
+            this->eval(*childs[1]);
+            return true;
+          }
+          return false;
+        }
+
+        /* (= (ite c x y) z) with constant x, y and z, as built for each branch by the path manager */
+        case triton::ast::EQUAL_NODE: {
+          triton::ast::AbstractNode* ite   = this->resolve(e.getChilds()[0]);
+          triton::ast::AbstractNode* value = this->resolve(e.getChilds()[1]);
+
+          if (ite->getKind() != triton::ast::ITE_NODE)
+            std::swap(ite, value);
+
+          if (ite->getKind() != triton::ast::ITE_NODE || value->isSymbolized())
+            return false;
+
+          const auto& childs = ite->getChilds();
+          if (childs[1]->isSymbolized() || childs[2]->isSymbolized())
+            return false;
+
+          bool onTrue  = (childs[1]->evaluate() == value->evaluate());
+          bool onFalse = (childs[2]->evaluate() == value->evaluate());
+
+          if (onTrue == onFalse) {
+            z3::expr newexpr = ctx.bool_val(onTrue);
+            this->result.setExpr(newexpr);
+          }
+          else if (onTrue) {
+            this->eval(*childs[0]);
+          }
+          else {
+            z3::expr newexpr = !this->eval(*childs[0]).getExpr();
+            this->result.setExpr(newexpr);
+          }
+
+          return true;
+        }
+
+        case triton::ast::EXTRACT_NODE: {
+          triton::uint32 hv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+          triton::uint32 lv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
+          return this->normalizeExtract(hv, lv, e.getChilds()[2]);
+        }
+
+        default:
+          return false;
+      }
+    }
+
+
+    bool TritonToZ3Ast::normalizeExtract(triton::uint32 hv, triton::uint32 lv, triton::ast::AbstractNode* node) {
+      z3::context& ctx = this->result.getContext();
+
+      node = this->resolve(node);
+
+      /* All the bits */
+      if (lv == 0 && hv + 1 == node->getBitvectorSize()) {
+        this->eval(*node);
+        return true;
+      }
+
+      switch (node->getKind()) {
+        /* ((_ extract hv lv) ((_ extract h l) x)) is ((_ extract hv+l lv+l) x) */
+        case triton::ast::EXTRACT_NODE: {
+          triton::uint32 low = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[1])->getValue().convert_to<triton::uint32>();
+          if (!this->normalizeExtract(hv + low, lv + low, node->getChilds()[2])) {
+            z3::expr value = this->eval(*node->getChilds()[2]).getExpr();
+            z3::expr newexpr = to_expr(ctx, Z3_mk_extract(ctx, hv + low, lv + low, value));
+            this->result.setExpr(newexpr);
+          }
+          return true;
+        }
+
+        /* Only the part of the concatenation which holds the bits, the last child holds the low bits */
+        case triton::ast::CONCAT_NODE: {
+          const auto& childs = node->getChilds();
+          triton::uint32 offset = 0;
+          for (auto it = childs.rbegin(); it != childs.rend(); it++) {
+            triton::uint32 size = (*it)->getBitvectorSize();
+            if (lv >= offset && hv < offset + size) {
+              if (!this->normalizeExtract(hv - offset, lv - offset, *it)) {
+                z3::expr value = this->eval(**it).getExpr();
+                z3::expr newexpr = to_expr(ctx, Z3_mk_extract(ctx, hv - offset, lv - offset, value));
+                this->result.setExpr(newexpr);
+              }
+              return true;
+            }
+            offset += size;
+          }
+          return false;
+        }
+
+        /* The extended bits are zero */
+        case triton::ast::ZX_NODE: {
+          triton::ast::AbstractNode* value = node->getChilds()[1];
+          triton::uint32 size = value->getBitvectorSize();
+          if (lv >= size) {
+            z3::expr newexpr = ctx.bv_val(0, hv - lv + 1);
+            this->result.setExpr(newexpr);
+            return true;
+          }
+          if (hv < size) {
+            if (!this->normalizeExtract(hv, lv, value)) {
+              z3::expr newexpr = to_expr(ctx, Z3_mk_extract(ctx, hv, lv, this->eval(*value).getExpr()));
+              this->result.setExpr(newexpr);
+            }
+            return true;
+          }
+          return false;
+        }
+
+        default:
+          return false;
+      }
+    }
+
+
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->result.getContext();
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AbstractNode& e) {
       e.accept(*this);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::AssertNode& e) {
-      throw triton::exceptions::AstTranslations("TritonToZ3Ast::AssertNode(): Not implemented.");
+      z3::expr op1 = this->eval(*e.getChilds()[0]).getExpr();
+      this->result.setExpr(op1);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvaddNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvashrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -76,18 +295,18 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvlshrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvmulNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1, op2));
 
 
       this->result.setExpr(newexpr);
@@ -95,52 +314,52 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsmodNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnegNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -148,8 +367,8 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::BvrolNode& e) {
       triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2.getExpr()));
+      z3::expr op2        = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
@@ -157,163 +376,161 @@ namespace triton {
 
     void TritonToZ3Ast::operator()(triton::ast::BvrorNode& e) {
       triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2.getExpr()));
+      z3::expr op2        = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsdivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvshlNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsltNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsubNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvudivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvultNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvNode& e) {
-      Z3Result value        = this->eval(*e.getChilds()[0]);
-      Z3Result size         = this->eval(*e.getChilds()[1]);
-      triton::uint32 bvsize = static_cast<triton::uint32>(size.getUintValue());
-
-      z3::expr newexpr = this->result.getContext().bv_val(value.getStringValue().c_str(), bvsize);
+      triton::uint512 value = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue();
+      triton::uint32 bvsize = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
+      z3::expr newexpr      = this->result.getContext().bv_val(value.str().c_str(), bvsize);
 
       this->result.setExpr(newexpr);
     }
@@ -343,8 +560,8 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::DecimalNode& e) {
-      std::string value(e.getValue());
-      z3::expr newexpr = this->result.getContext().int_val(value.c_str());
+      std::string value = e.getValue().str();
+      z3::expr newexpr  = this->result.getContext().int_val(value.c_str());
       this->result.setExpr(newexpr);
     }
 
@@ -355,9 +572,9 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::DistinctNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_distinct(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -365,40 +582,38 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::EqualNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1, op2));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::ExtractNode& e) {
-      Z3Result high     = this->eval(*e.getChilds()[0]);
-      Z3Result low      = this->eval(*e.getChilds()[1]);
-      Z3Result value    = this->eval(*e.getChilds()[2]);
-      triton::uint32 hv = static_cast<triton::uint32>(high.getUintValue());
-      triton::uint32 lv = static_cast<triton::uint32>(low.getUintValue());
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value.getExpr()));
+      triton::uint32 hv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      triton::uint32 lv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
+      z3::expr value    = this->eval(*e.getChilds()[2]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::IteNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]); // condition
-      Z3Result op2      = this->eval(*e.getChilds()[1]); // if true
-      Z3Result op3      = this->eval(*e.getChilds()[2]); // if false
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1.getExpr(), op2.getExpr(), op3.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr(); // condition
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr(); // if true
+      z3::expr op3      = this->eval(*e.getChilds()[2]).getExpr(); // if false
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1, op2, op3));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_and(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -408,24 +623,26 @@ namespace triton {
     void TritonToZ3Ast::operator()(triton::ast::LetNode& e) {
       std::string symbol    = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
       this->symbols[symbol] = e.getChilds()[1];
-      Z3Result op2          = this->eval(*e.getChilds()[2]);
+      this->letDepth++;
+      z3::expr op2          = this->eval(*e.getChilds()[2]).getExpr();
+      this->letDepth--;
 
-      this->result.setExpr(op2.getExpr());
+      this->result.setExpr(op2);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1));
 
       this->result.setExpr(newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->eval(*e.getChilds()[0]).getExpr();
+      z3::expr op2      = this->eval(*e.getChilds()[1]).getExpr();
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_or(this->result.getContext(), 2, ops));
 
       this->result.setExpr(newexpr);
@@ -433,27 +650,39 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ReferenceNode& e) {
+      auto it = this->translatedReferences.find(e.getValue());
+      if (it != this->translatedReferences.end()) {
+        this->result.setExpr(it->second);
+        return;
+      }
+
       triton::engines::symbolic::SymbolicExpression* refNode = this->symbolicEngine->getSymbolicExpressionFromId(e.getValue());
       if (refNode == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::ReferenceNode(): Reference node not found.");
-      Z3Result op1 = this->eval(*(refNode->getAst()));
-      this->result.setExpr(op1.getExpr());
+
+      /* The referenced AST does not depend on let bindings */
+      triton::uint32 letDepth = this->letDepth;
+      this->letDepth = 0;
+      z3::expr op1 = this->eval(*(refNode->getAst())).getExpr();
+      this->letDepth = letDepth;
+
+      this->translatedReferences.insert(std::make_pair(e.getValue(), op1));
+      this->result.setExpr(op1);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::StringNode& e) {
       if (this->symbols.find(e.getValue()) == this->symbols.end())
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::StringNode(): Symbols not found.");
-      Z3Result op1 = this->eval(*(this->symbols[e.getValue()]));
-      this->result.setExpr(op1.getExpr());
+      z3::expr op1 = this->eval(*(this->symbols[e.getValue()])).getExpr();
+      this->result.setExpr(op1);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::SxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value.getExpr()));
+      triton::uint32 extv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr value      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value));
 
       this->result.setExpr(newexpr);
     }
@@ -474,14 +703,12 @@ namespace triton {
         if (symVar->getKind() == triton::engines::symbolic::MEM) {
           triton::uint32 memSize   = symVar->getSize();
           triton::uint512 memValue = symVar->getConcreteValue();
-          std::string memStrValue(memValue);
-          z3::expr newexpr = this->result.getContext().bv_val(memStrValue.c_str(), memSize);
+          z3::expr newexpr = this->result.getContext().bv_val(memValue.str().c_str(), memSize);
           this->result.setExpr(newexpr);
         }
         else if (symVar->getKind() == triton::engines::symbolic::REG) {
           triton::uint512 regValue = symVar->getConcreteValue();
-          std::string regStrValue(regValue);
-          z3::expr newexpr = this->result.getContext().bv_val(regStrValue.c_str(), symVar->getSize());
+          z3::expr newexpr = this->result.getContext().bv_val(regValue.str().c_str(), symVar->getSize());
           this->result.setExpr(newexpr);
         }
         else
@@ -497,10 +724,9 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::ZxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value.getExpr()));
+      triton::uint32 extv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr value      = this->eval(*e.getChilds()[1]).getExpr();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value));
 
       this->result.setExpr(newexpr);
     }
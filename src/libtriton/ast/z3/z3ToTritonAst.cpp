@@ -21,6 +21,7 @@ namespace triton {
         throw triton::exceptions::AstTranslations("Z3ToTritonAst::Z3ToTritonAst(): The symbolicEngine API cannot be null.");
 
       this->symbolicEngine = symbolicEngine;
+      this->astCtxt        = &symbolicEngine->getAstContext();
     }
 
 
@@ -30,12 +31,14 @@ namespace triton {
         throw triton::exceptions::AstTranslations("Z3ToTritonAst::Z3ToTritonAst(): The symbolicEngine API cannot be null.");
 
       this->symbolicEngine = symbolicEngine;
+      this->astCtxt        = &symbolicEngine->getAstContext();
       this->expr = expr;
     }
 
 
     Z3ToTritonAst::Z3ToTritonAst(const Z3ToTritonAst& copy)
       : expr(copy.expr) {
+      this->astCtxt        = copy.astCtxt;
       this->symbolicEngine = copy.symbolicEngine;
     }
 
@@ -50,13 +53,25 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
-      return this->visit(this->expr);
+      AbstractNode* node = nullptr;
+
+      this->translatedNodes.clear();
+      node = this->visit(this->expr);
+      this->translatedNodes.clear();
+
+      return node;
     }
 
 
     AbstractNode* Z3ToTritonAst::visit(z3::expr const& expr) {
       AbstractNode* node = nullptr;
 
+      /* Z3's ASTs are hash-consed, shared sub-expressions are converted only once */
+      triton::uint32 id = Z3_get_ast_id(expr.ctx(), expr);
+      auto it = this->translatedNodes.find(id);
+      if (it != this->translatedNodes.end())
+        return it->second;
+
       /* Currently, only support application node */
       if (expr.is_quantifier())
         throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Quantifier not supported yet.");
@@ -73,41 +88,41 @@ namespace triton {
         case Z3_OP_EQ: {
           if (expr.num_args() != 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EQ must contain two arguments.");
-          node = triton::ast::equal(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->equal(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           break;
         }
 
         case Z3_OP_DISTINCT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_DISTINCT must contain at least two arguments.");
-          node = triton::ast::distinct(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->distinct(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::distinct(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->distinct(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ITE: {
           if (expr.num_args() != 3)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ITE must contain three arguments.");
-          node = triton::ast::ite(this->visit(expr.arg(0)), this->visit(expr.arg(1)), this->visit(expr.arg(2)));
+          node = this->astCtxt->ite(this->visit(expr.arg(0)), this->visit(expr.arg(1)), this->visit(expr.arg(2)));
           break;
         }
 
         case Z3_OP_AND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_AND must contain at least two arguments.");
-          node = triton::ast::land(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->land(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::land(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->land(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_OR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_OR must contain at least two arguments.");
-          node = triton::ast::lor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->lor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::lor(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->lor(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -115,48 +130,48 @@ namespace triton {
         case Z3_OP_NOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_NOT must contain one argument.");
-          node = triton::ast::lnot(this->visit(expr.arg(0)));
+          node = this->astCtxt->lnot(this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BNUM: {
           std::string stringValue = Z3_get_numeral_string(this->context, expr);
           triton::uint512 intValue{stringValue};
-          node = triton::ast::bv(intValue, expr.get_sort().bv_size());
+          node = this->astCtxt->bv(intValue, expr.get_sort().bv_size());
           break;
         }
 
         case Z3_OP_BNEG: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNEG must contain one argument.");
-          node = triton::ast::bvneg(this->visit(expr.arg(0)));
+          node = this->astCtxt->bvneg(this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BADD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BADD must contain at least two arguments.");
-          node = triton::ast::bvadd(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvadd(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvadd(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvadd(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BSUB: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSUB must contain at least two arguments.");
-          node = triton::ast::bvsub(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsub(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsub(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsub(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BMUL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BMUL must contain at least two arguments.");
-          node = triton::ast::bvmul(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvmul(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvmul(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvmul(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -164,9 +179,9 @@ namespace triton {
         case Z3_OP_BSDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSDIV must contain at least two arguments.");
-          node = triton::ast::bvsdiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsdiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsdiv(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsdiv(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -174,9 +189,9 @@ namespace triton {
         case Z3_OP_BUDIV: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUDIV must contain at least two arguments.");
-          node = triton::ast::bvudiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvudiv(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvudiv(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvudiv(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -184,9 +199,9 @@ namespace triton {
         case Z3_OP_BSREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSREM must contain at least two arguments.");
-          node = triton::ast::bvsrem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsrem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsrem(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsrem(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -194,9 +209,9 @@ namespace triton {
         case Z3_OP_BUREM: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BUREM must contain at least two arguments.");
-          node = triton::ast::bvurem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvurem(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvurem(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvurem(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -204,142 +219,142 @@ namespace triton {
         case Z3_OP_BSMOD: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSMOD must contain at least two arguments.");
-          node = triton::ast::bvsmod(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsmod(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsmod(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsmod(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ULEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULEQ must contain at least two arguments.");
-          node = triton::ast::bvule(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvule(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvule(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvule(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SLEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLEQ must contain at least two arguments.");
-          node = triton::ast::bvsle(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsle(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsle(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsle(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_UGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGEQ must contain at least two arguments.");
-          node = triton::ast::bvuge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvuge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvuge(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvuge(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SGEQ: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGEQ must contain at least two arguments.");
-          node = triton::ast::bvsge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsge(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsge(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsge(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ULT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ULT must contain at least two arguments.");
-          node = triton::ast::bvult(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvult(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvult(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvult(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SLT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SLT must contain at least two arguments.");
-          node = triton::ast::bvslt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvslt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvslt(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvslt(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_UGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_UGT must contain at least two arguments.");
-          node = triton::ast::bvugt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvugt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvugt(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvugt(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_SGT: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SGT must contain at least two arguments.");
-          node = triton::ast::bvsgt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvsgt(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvsgt(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvsgt(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BAND must contain at least two arguments.");
-          node = triton::ast::bvand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvand(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvand(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BOR must contain at least two arguments.");
-          node = triton::ast::bvor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvor(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvor(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNOT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOT must contain one argument.");
-          node = triton::ast::bvnot(this->visit(expr.arg(0)));
+          node = this->astCtxt->bvnot(this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BXOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXOR must contain at least two arguments.");
-          node = triton::ast::bvxor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvxor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxor(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvxor(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNAND: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNAND must contain at least two arguments.");
-          node = triton::ast::bvnand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvnand(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnand(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvnand(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BNOR must contain at least two arguments.");
-          node = triton::ast::bvnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvnor(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvnor(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BXNOR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BXNOR must contain at least two arguments.");
-          node = triton::ast::bvxnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvxnor(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvxnor(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvxnor(node, this->visit(expr.arg(i)));
           break;
         }
 
@@ -352,69 +367,69 @@ namespace triton {
             args.push_back(this->visit(expr.arg(i)));
           }
 
-          node = triton::ast::concat(args);
+          node = this->astCtxt->concat(args);
           break;
         }
 
         case Z3_OP_SIGN_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SIGN_EXT must contain one argument.");
-          node = triton::ast::sx(expr.hi(), this->visit(expr.arg(0)));
+          node = this->astCtxt->sx(expr.hi(), this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_ZERO_EXT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ZERO_EXT must contain one argument.");
-          node = triton::ast::zx(expr.hi(), this->visit(expr.arg(0)));
+          node = this->astCtxt->zx(expr.hi(), this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_EXTRACT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_EXTRACT must contain one argument.");
-          node = triton::ast::extract(expr.hi(), expr.lo(), this->visit(expr.arg(0)));
+          node = this->astCtxt->extract(expr.hi(), expr.lo(), this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_BSHL: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BSHL must contain at least two arguments.");
-          node = triton::ast::bvshl(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvshl(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvshl(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvshl(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BLSHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BLSHR must contain at least two arguments.");
-          node = triton::ast::bvlshr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvlshr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvlshr(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvlshr(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_BASHR: {
           if (expr.num_args() < 2)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_BASHR must contain at least two arguments.");
-          node = triton::ast::bvashr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          node = this->astCtxt->bvashr(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
           for (triton::uint32 i = 2; i < expr.num_args(); i++)
-            node = triton::ast::bvashr(node, this->visit(expr.arg(i)));
+            node = this->astCtxt->bvashr(node, this->visit(expr.arg(i)));
           break;
         }
 
         case Z3_OP_ROTATE_LEFT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_LEFT must contain one argument.");
-          node = triton::ast::bvrol(expr.hi(), this->visit(expr.arg(0)));
+          node = this->astCtxt->bvrol(expr.hi(), this->visit(expr.arg(0)));
           break;
         }
 
         case Z3_OP_ROTATE_RIGHT: {
           if (expr.num_args() != 1)
             throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_ROTATE_RIGHT must contain one argument.");
-          node = triton::ast::bvror(expr.hi(), this->visit(expr.arg(0)));
+          node = this->astCtxt->bvror(expr.hi(), this->visit(expr.arg(0)));
           break;
         }
 
@@ -424,9 +439,9 @@ namespace triton {
           triton::engines::symbolic::SymbolicVariable* symVar = this->symbolicEngine->getSymbolicVariableFromName(name);
 
           if (symVar)
-            node = triton::ast::variable(*symVar);
+            node = this->astCtxt->variable(*symVar);
           else
-            node = triton::ast::string(name);
+            node = this->astCtxt->string(name);
 
           break;
         }
@@ -435,6 +450,8 @@ namespace triton {
           throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): '" + function.name().str() + "' AST node not supported yet");
       }
 
+      this->translatedNodes[id] = node;
+
       return node;
     }
 
@@ -56,6 +56,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 - \ref py_Immediate_page
 - \ref py_Instruction_page
 - \ref py_MemoryAccess_page
+- \ref py_MemoryPage_page
 - \ref py_PathConstraint_page
 - \ref py_Pe_page
 - \ref py_PeExportEntry_page
@@ -105,6 +106,9 @@ Builds a symbolic register from a \ref py_REG_page with the SSA form.
 - <b>void clearPathConstraints(void)</b><br>
 Clears the logical conjunction vector of path constraints.
 
+- <b>void clearSolverCache(void)</b><br>
+Clears the solver's query cache and resets its hit and miss counters.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -144,9 +148,24 @@ Returns the new symbolic volatile expression and links this expression to the in
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- <b>dict emulate(integer pc, [integer, ...] stopAddresses, integer maxInstructions, bool stopOnSyscall=False, function hook=None)</b><br>
+Emulates from `pc` without going back to Python for each instruction: the opcodes are fetched from the concrete memory, processed
+and the program counter is followed until a stop address (checked before processing), `maxInstructions` instructions (0 for no limit),
+a system call if `stopOnSyscall` is true, or until the `hook` returns true. The hook is called after each instruction with the
+\ref py_Instruction_page processed. Returns a dictionary with the keys `pc` (the next instruction to process), `count` (the number
+of instructions processed) and `reason` (a \ref py_STOP_page).
+
 - <b>void enableMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
+- <b>void enableSolverCache(bool flag)</b><br>
+Enables or disables the solver's query cache. When enabled (default), the independent parts of a constraint are solved
+(or found in the cache) on their own by getModel().
+
+- <b>void enableSolverNormalization(bool flag)</b><br>
+Enables or disables the normalization of the constraints. When enabled (default), the constraints structurally identical
+to a previous one are solved once and the constraints are simplified by cheap local rewrites before being solved.
+
 - <b>void enableSymbolicEngine(bool flag)</b><br>
 Enables or disables the symbolic execution engine.
 
@@ -174,6 +193,10 @@ Returns the current AST representation mode.
 - <b>bytes getConcreteMemoryAreaValue(integer baseAddr, integer size)</b><br>
 Returns the concrete value of a memory area.
 
+- <b>\ref py_MemoryPage_page getConcreteMemoryPage(integer addr)</b><br>
+Returns the page (4 KiB) of `addr`, mapped if needed. A `memoryview` of the page reads and writes the concrete memory in place,
+without copy. The bytes written through the page do not go through the callbacks and do not change the symbolic and taint states.
+
 - <b>integer getConcreteMemoryValue(intger addr)</b><br>
 Returns the concrete value of a memory cell.
 
@@ -183,18 +206,40 @@ Returns the concrete value of memory cells.
 - <b>integer getConcreteRegisterValue(\ref py_REG_page reg)</b><br>
 Returns the concrete value of a register.
 
+- <b>dict getDecodeCacheStats(void)</b><br>
+Returns a dictionary which contains the statistics of the decode cache (entries, hits, invalidations and misses). Instructions are
+decoded once per address and opcodes, a memory write over a decoded instruction invalidates it.
+
 - <b>\ref py_AstNode_page getFullAst(\ref py_AstNode_page node)</b><br>
 Returns the full AST without SSA form from a given root node.
 
 - <b>\ref py_AstNode_page getFullAstFromId(integer symExprId)</b><br>
 Returns the full AST without SSA form from a symbolic expression id.
 
+- <b>[integer, ...] getMemoryLabels(intger addr)</b><br>
+Returns the taint labels of an address. See \ref py_MODE_page `TAINT_LABELS`.
+
+- <b>[integer, ...] getMemoryLabels(\ref py_MemoryAccess_page mem)</b><br>
+Returns the taint labels of a memory (the union of the labels of its bytes).
+
 - <b>dict getModel(\ref py_AstNode_page node)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
 
 - <b>[dict, ...] getModels(\ref py_AstNode_page node)</b><br>
 Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
 
+- <b>[([dict, ...], integer), ...] getModelsBatch([\ref py_AstNode_page, ...] nodes, integer limit)</b><br>
+Solves a list of independent symbolic constraints in parallel (see setSolverThreads()). Returns, for each constraint, a tuple
+of its models (as getModels()) and of the time spent to solve it in microseconds.
+
+- <b>[(integer, [dict, ...], integer), ...] getModelsOfUntakenBranches(integer limit)</b><br>
+Solves, for each path constraint, its branches not taken under the prefix of the path constraints taken before it. The prefix
+is asserted incrementally in a single solver. Returns a list of tuples of the path constraint index, the models (as getModels())
+and the time spent to solve the query in microseconds.
+
+- <b>integer getNumberOfSnapshots(void)</b><br>
+Returns the number of snapshots.
+
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
 Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
 
@@ -207,9 +252,21 @@ Returns the logical conjunction AST of path constraints.
 - <b>integer getRegisterBitSize(void)</b><br>
 Returns the max size (in bit) of the CPU register (GPR).
 
+- <b>[integer, ...] getRegisterLabels(\ref py_REG_page reg)</b><br>
+Returns the taint labels of a register. See \ref py_MODE_page `TAINT_LABELS`.
+
 - <b>integer getRegisterSize(void)</b><br>
 Returns the max size (in byte) of the CPU register (GPR).
 
+- <b>integer getSolverCacheHits(void)</b><br>
+Returns the number of queries found in the solver's cache.
+
+- <b>integer getSolverCacheMisses(void)</b><br>
+Returns the number of queries not found in the solver's cache.
+
+- <b>integer getSolverThreads(void)</b><br>
+Returns the number of threads used by getModelsBatch().
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(intger symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -291,6 +348,12 @@ Returns true if the register is tainted.
 - <b>bool isRegisterValid(\ref py_REG_page reg)</b><br>
 Returns true if the register id is valid.
 
+- <b>bool isSolverCacheEnabled(void)</b><br>
+Returns true if the solver's query cache is enabled.
+
+- <b>bool isSolverNormalizationEnabled(void)</b><br>
+Returns true if the constraints are normalized before being solved.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
@@ -300,6 +363,18 @@ Returns true if the symbolic expression id exists.
 - <b>bool isTaintEngineEnabled(void)</b><br>
 Returns true if the taint engine is enabled.
 
+- <b>bool labelMemory(intger addr, integer label)</b><br>
+Taints an address and adds a label to it. The \ref py_MODE_page `TAINT_LABELS` must be enabled.
+
+- <b>bool labelMemory(\ref py_MemoryAccess_page mem, integer label)</b><br>
+Taints a memory and adds a label to each of its bytes. The \ref py_MODE_page `TAINT_LABELS` must be enabled.
+
+- <b>bool labelRegister(\ref py_REG_page reg, integer label)</b><br>
+Taints a register and adds a label to it. The \ref py_MODE_page `TAINT_LABELS` must be enabled.
+
+- <b>void mapMemoryPages(integer baseAddr, integer size)</b><br>
+Maps all the bytes of the pages (4 KiB) overlapping the range `[baseAddr:size]`. The bytes not mapped yet are zero.
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment="")</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
@@ -315,9 +390,16 @@ Removes all recorded callbacks.
 - <b>void removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- <b>void removeSnapshot(integer id)</b><br>
+Removes the snapshot `id` and the snapshots taken after it.
+
 - <b>void resetEngines(void)</b><br>
 Resets everything.
 
+- <b>void restoreSnapshot(integer id)</b><br>
+Restores the registers, the memory, the taint and the symbolic state saved by the snapshot `id`. The snapshot
+is kept and may be restored again, the snapshots taken after it are removed.
+
 - <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
 Initializes an architecture. This function must be called before any call to the rest of the API.
 
@@ -328,9 +410,10 @@ Sets the AST representation mode.
 Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
-- <b>void setConcreteMemoryAreaValue(integer baseAddr, bytes opcodes)</b><br>
-Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
-the symbolic state (if it exists). You should probably use the concretize functions after this.
+- <b>void setConcreteMemoryAreaValue(integer baseAddr, bytes values)</b><br>
+Sets the concrete value of a memory area from any object supporting the buffer protocol (`bytes`, `bytearray`, `memoryview`, ...)
+without intermediate copy. Note that by setting a concrete value will probably imply a desynchronization with the symbolic state
+(if it exists). You should probably use the concretize functions after this.
 
 - <b>void setConcreteMemoryValue(integer addr, integer value)</b><br>
 Sets the concrete value of a memory cell. Note that by setting a concrete value will probably imply a desynchronization with
@@ -344,6 +427,12 @@ the symbolic state (if it exists). You should probably use the concretize functi
 Sets the concrete value of a register. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- <b>void setSolverCachePath(string path)</b><br>
+Loads the solver's query cache from `path` and appends the new queries to it, so that they are kept across runs.
+
+- <b>void setSolverThreads(integer threads)</b><br>
+Sets the number of threads used by getModelsBatch(). 0 means the number of hardware threads.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
@@ -410,9 +499,17 @@ tainted. Returns true if `regDst` is tainted.
 Taints `regDst` from `regSrc` with an union - `regDst` is tainted if `regDst` or `regSrc` are
 tainted. Returns true if `regDst` is tainted.
 
+- <b>integer takeSnapshot(void)</b><br>
+Takes a snapshot of the registers, the memory, the taint and the symbolic state and returns its id. The memory
+pages are shared with the snapshot and copied on their first write, thus the cost does not depend on the size
+of the state.
+
 - <b>void unmapMemory(integer baseAddr, integer size=1)</b><br>
 Removes the range `[baseAddr:size]` from the internal memory representation.
 
+- <b>void unmapMemoryPages(integer baseAddr, integer size)</b><br>
+Removes the pages (4 KiB) overlapping the range `[baseAddr:size]` from the internal memory representation.
+
 - <b>bool untaintMemory(intger addr)</b><br>
 Untaints an address. Returns true if the address is still tainted.
 
@@ -436,6 +533,7 @@ Untaints a register. Returns true if the register is still tainted.
 - \ref py_OPERAND_page
 - \ref py_PE_page
 - \ref py_REG_page
+- \ref py_STOP_page
 - \ref py_SYMEXPR_page
 - \ref py_SYSCALL_page
 - \ref py_VERSION_page
@@ -703,6 +801,9 @@ namespace triton {
         /* Extract arguments */
         PyArg_ParseTuple(args, "|OO", &regIn, &concreteValue);
 
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "Register(): Architecture is not defined.");
+
         /* Check if the second arg is a integer */
         if (concreteValue != nullptr && (!PyLong_Check(concreteValue) && !PyInt_Check(concreteValue)))
           return PyErr_Format(PyExc_TypeError, "Register(): Expects an integer as second argument.");
@@ -724,11 +825,11 @@ namespace triton {
 
         try {
           if (concreteValue == nullptr) {
-            triton::arch::Register regOut(rid);
+            triton::arch::Register regOut(*triton::api.getCpu(), rid);
             return PyRegister(regOut);
           }
 
-          triton::arch::Register regOut(rid, cv);
+          triton::arch::Register regOut(*triton::api.getCpu(), rid, cv);
           return PyRegister(regOut);
         }
         catch (const triton::exceptions::Exception& e) {
@@ -910,6 +1011,23 @@ namespace triton {
       }
 
 
+      static PyObject* triton_clearSolverCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearSolverCache(): Architecture is not defined.");
+
+        try {
+          triton::api.clearSolverCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1261,6 +1379,86 @@ namespace triton {
       }
 
 
+      static PyObject* triton_emulate(PyObject* self, PyObject* args) {
+        PyObject* pc              = nullptr;
+        PyObject* addresses       = nullptr;
+        PyObject* maxInstructions = nullptr;
+        PyObject* syscall         = nullptr;
+        PyObject* hook            = nullptr;
+        PyObject* ret             = nullptr;
+        triton::arch::StopCondition stop;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOOO", &pc, &addresses, &maxInstructions, &syscall, &hook);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "emulate(): Architecture is not defined.");
+
+        if (pc == nullptr || (!PyLong_Check(pc) && !PyInt_Check(pc)))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as first argument.");
+
+        if (addresses == nullptr || !PyList_Check(addresses))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a list of integers as second argument.");
+
+        if (maxInstructions == nullptr || (!PyLong_Check(maxInstructions) && !PyInt_Check(maxInstructions)))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as third argument.");
+
+        if (syscall != nullptr && !PyBool_Check(syscall))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a boolean as fourth argument.");
+
+        if (hook != nullptr && hook != Py_None && !PyCallable_Check(hook))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a function as fifth argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(addresses); i++) {
+          PyObject* item = PyList_GetItem(addresses, i);
+          if (!PyLong_Check(item) && !PyInt_Check(item))
+            return PyErr_Format(PyExc_TypeError, "emulate(): Each stop address must be an integer.");
+          stop.addresses.insert(PyLong_AsUint64(item));
+        }
+
+        if (syscall != nullptr)
+          stop.syscall = PyLong_AsBool(syscall);
+
+        if (hook != nullptr && hook != Py_None) {
+          stop.hook = [hook](triton::arch::Instruction& inst) -> bool {
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(1);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyInstruction(inst));
+
+            /* Call the hook */
+            PyObject* ret = PyObject_CallObject(hook, args);
+            Py_DECREF(args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("emulate(): Fail to call the python hook.");
+            }
+
+            bool result = (PyObject_IsTrue(ret) != 0);
+            Py_DECREF(ret);
+
+            return result;
+          };
+        }
+
+        try {
+          triton::arch::EmulationSummary summary = triton::api.emulate(PyLong_AsUint64(pc), stop, PyLong_AsUsize(maxInstructions));
+
+          ret = xPyDict_New();
+          PyDict_SetItem(ret, PyString_FromString("pc"),     PyLong_FromUint64(summary.pc));
+          PyDict_SetItem(ret, PyString_FromString("count"),  PyLong_FromUsize(summary.count));
+          PyDict_SetItem(ret, PyString_FromString("reason"), PyLong_FromUint32(summary.reason));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_enableMode(PyObject* self, PyObject* args) {
         PyObject* mode = nullptr;
         PyObject* flag = nullptr;
@@ -1290,6 +1488,46 @@ namespace triton {
       }
 
 
+      static PyObject* triton_enableSolverCache(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableSolverCache(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableSolverCache(): Expects an boolean as argument.");
+
+        try {
+          triton::api.enableSolverCache(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_enableSolverNormalization(PyObject* self, PyObject* flag) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableSolverNormalization(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableSolverNormalization(): Expects an boolean as argument.");
+
+        try {
+          triton::api.enableSolverNormalization(PyLong_AsBool(flag));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_enableSymbolicEngine(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1362,7 +1600,7 @@ namespace triton {
 
         try {
           triton::uint32 index = 0;
-          std::set<triton::arch::Register*> reg = triton::api.getAllRegisters();
+          std::set<const triton::arch::Register*> reg = triton::api.getAllRegisters();
 
           ret = xPyList_New(reg.size());
           for (auto it = reg.begin(); it != reg.end(); it++)
@@ -1429,7 +1667,6 @@ namespace triton {
 
 
       static PyObject* triton_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
-        triton::uint8*  area = nullptr;
         PyObject*       ret  = nullptr;
         PyObject*       addr = nullptr;
         PyObject*       size = nullptr;
@@ -1443,13 +1680,7 @@ namespace triton {
 
         try {
           std::vector<triton::uint8> vv = triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
-          area = new triton::uint8[vv.size()];
-
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
-
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
+          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(vv.data()), vv.size());
           return ret;
 
         }
@@ -1461,6 +1692,24 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getConcreteMemoryPage(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryPage(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryPage(): Expects an integer as argument.");
+
+        try {
+          triton::uint64 c_addr = PyLong_AsUint64(addr);
+          return PyMemoryPage(c_addr, triton::api.getConcreteMemoryPage(c_addr));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getConcreteMemoryValue(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1497,6 +1746,28 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getDecodeCacheStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getDecodeCacheStats(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::api.getDecodeCacheStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1531,6 +1802,37 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getMemoryLabels(PyObject* self, PyObject* mem) {
+        std::set<triton::uint32> labels;
+        PyObject* ret = nullptr;
+        triton::usize index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Architecture is not defined.");
+
+        try {
+          if (PyMemoryAccess_Check(mem))
+            labels = triton::api.getMemoryLabels(*PyMemoryAccess_AsMemoryAccess(mem));
+
+          else if (PyLong_Check(mem) || PyInt_Check(mem))
+            labels = triton::api.getMemoryLabels(PyLong_AsUint64(mem));
+
+          else
+            return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Expects a MemoryAccess or an integer as argument.");
+
+          ret = xPyList_New(labels.size());
+          for (auto it = labels.begin(); it != labels.end(); it++)
+            PyList_SetItem(ret, index++, PyLong_FromUint32(*it));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getModel(PyObject* self, PyObject* node) {
         PyObject* ret = nullptr;
 
@@ -1598,6 +1900,129 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getModelsBatch(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::AbstractNode*> nodes;
+        std::vector<triton::engines::solver::SolverQueryResult> results;
+        PyObject* ret   = nullptr;
+        PyObject* list  = nullptr;
+        PyObject* limit = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &list, &limit);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelsBatch(): Architecture is not defined.");
+
+        if (list == nullptr || !PyList_Check(list))
+          return PyErr_Format(PyExc_TypeError, "getModelsBatch(): Expects a list of AstNode as first argument.");
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "getModelsBatch(): Expects an integer as second argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(list); i++) {
+          PyObject* item = PyList_GetItem(list, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "getModelsBatch(): Each item of the list must be an AstNode.");
+          nodes.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          triton::uint32 nbModels = PyLong_AsUint32(limit);
+
+          /* Solvers do not touch Python objects */
+          Py_BEGIN_ALLOW_THREADS
+          try {
+            results = triton::api.getModelsBatch(nodes, nbModels);
+          }
+          catch (...) {
+            Py_BLOCK_THREADS
+            throw;
+          }
+          Py_END_ALLOW_THREADS
+
+          ret = xPyList_New(results.size());
+          for (triton::usize index = 0; index < results.size(); index++) {
+            const auto& models = results[index].getModels();
+            PyObject* mlist    = xPyList_New(models.size());
+            PyObject* item     = xPyTuple_New(2);
+            triton::uint32 idx = 0;
+
+            for (auto it = models.begin(); it != models.end(); it++) {
+              PyObject* mdict = xPyDict_New();
+              for (auto it2 = it->begin(); it2 != it->end(); it2++)
+                PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
+              PyList_SetItem(mlist, idx++, mdict);
+            }
+
+            PyTuple_SetItem(item, 0, mlist);
+            PyTuple_SetItem(item, 1, PyLong_FromUint64(results[index].getTime()));
+            PyList_SetItem(ret, index, item);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModelsOfUntakenBranches(PyObject* self, PyObject* limit) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelsOfUntakenBranches(): Architecture is not defined.");
+
+        if (!PyLong_Check(limit) && !PyInt_Check(limit))
+          return PyErr_Format(PyExc_TypeError, "getModelsOfUntakenBranches(): Expects an integer as argument.");
+
+        try {
+          auto results = triton::api.getModelsOfUntakenBranches(PyLong_AsUint32(limit));
+
+          ret = xPyList_New(results.size());
+          for (triton::usize index = 0; index < results.size(); index++) {
+            const auto& models = results[index].getModels();
+            PyObject* mlist    = xPyList_New(models.size());
+            PyObject* item     = xPyTuple_New(3);
+            triton::uint32 idx = 0;
+
+            for (auto it = models.begin(); it != models.end(); it++) {
+              PyObject* mdict = xPyDict_New();
+              for (auto it2 = it->begin(); it2 != it->end(); it2++)
+                PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
+              PyList_SetItem(mlist, idx++, mdict);
+            }
+
+            PyTuple_SetItem(item, 0, PyLong_FromUsize(results[index].getIndex()));
+            PyTuple_SetItem(item, 1, mlist);
+            PyTuple_SetItem(item, 2, PyLong_FromUint64(results[index].getTime()));
+            PyList_SetItem(ret, index, item);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getNumberOfSnapshots(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNumberOfSnapshots(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.getNumberOfSnapshots());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -1607,7 +2032,7 @@ namespace triton {
 
         try {
           triton::uint32 index = 0;
-          std::set<triton::arch::Register*> reg = triton::api.getParentRegisters();
+          std::set<const triton::arch::Register*> reg = triton::api.getParentRegisters();
           ret = xPyList_New(reg.size());
 
           for (auto it = reg.begin(); it != reg.end(); it++)
@@ -1663,11 +2088,80 @@ namespace triton {
       }
 
 
+      static PyObject* triton_getRegisterLabels(PyObject* self, PyObject* reg) {
+        std::set<triton::uint32> labels;
+        PyObject* ret = nullptr;
+        triton::usize index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getRegisterLabels(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterLabels(): Expects a REG as argument.");
+
+        try {
+          labels = triton::api.getRegisterLabels(*PyRegister_AsRegister(reg));
+
+          ret = xPyList_New(labels.size());
+          for (auto it = labels.begin(); it != labels.end(); it++)
+            PyList_SetItem(ret, index++, PyLong_FromUint32(*it));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_getRegisterSize(PyObject* self, PyObject* noarg) {
         return PyLong_FromUint32(triton::api.getRegisterSize());
       }
 
 
+      static PyObject* triton_getSolverCacheHits(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverCacheHits(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.getSolverCacheHits());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSolverCacheMisses(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverCacheMisses(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.getSolverCacheMisses());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSolverThreads(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverThreads(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUint32(triton::api.getSolverThreads());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -1890,7 +2384,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "getTaintedMemory(): Architecture is not defined.");
 
         try {
-          std::set<triton::uint64> addresses = triton::api.getTaintedMemory();
+          const triton::engines::taint::ShadowMemory& addresses = triton::api.getTaintedMemory();
 
           size = addresses.size();
           ret = xPyList_New(size);
@@ -2113,6 +2607,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_isSolverCacheEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSolverCacheEnabled(): Architecture is not defined.");
+
+        if (triton::api.isSolverCacheEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isSolverNormalizationEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSolverNormalizationEnabled(): Architecture is not defined.");
+
+        if (triton::api.isSolverNormalizationEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "isSymbolicEngineEnabled(): Architecture is not defined.");
@@ -2159,6 +2673,97 @@ namespace triton {
       }
 
 
+      static PyObject* triton_labelMemory(PyObject* self, PyObject* args) {
+        PyObject* mem   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &mem, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Architecture is not defined.");
+
+        if (mem == nullptr || (!PyMemoryAccess_Check(mem) && !PyLong_Check(mem) && !PyInt_Check(mem)))
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Expects a MemoryAccess or an integer as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Expects an integer as second argument.");
+
+        try {
+          if (PyMemoryAccess_Check(mem)) {
+            if (triton::api.labelMemory(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsUint32(label)) == true)
+              Py_RETURN_TRUE;
+          }
+          else if (triton::api.labelMemory(PyLong_AsUint64(mem), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_labelRegister(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Architecture is not defined.");
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Expects a REG as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Expects an integer as second argument.");
+
+        try {
+          if (triton::api.labelRegister(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_mapMemoryPages(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "mapMemoryPages(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "mapMemoryPages(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "mapMemoryPages(): Expects a size (integer) as second argument.");
+
+        try {
+          triton::api.mapMemoryPages(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_newSymbolicExpression(PyObject* self, PyObject* args) {
         PyObject* node          = nullptr;
         PyObject* comment       = nullptr;
@@ -2280,6 +2885,26 @@ namespace triton {
       }
 
 
+      static PyObject* triton_removeSnapshot(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSnapshot(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "removeSnapshot(): Expects an integer as argument.");
+
+        try {
+          triton::api.removeSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -2297,12 +2922,41 @@ namespace triton {
       }
 
 
+      static PyObject* triton_restoreSnapshot(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "restoreSnapshot(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "restoreSnapshot(): Expects an integer as argument.");
+
+        try {
+          triton::api.restoreSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
         if (!PyLong_Check(arg) && !PyInt_Check(arg))
           return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
 
         try {
           triton::api.setArchitecture(PyLong_AsUint32(arg));
+
+          /* Update the python env with the registers of the new CPU */
+          triton::bindings::python::initRegNamespace();
+          triton::bindings::python::initCpuSizeNamespace();
+          triton::bindings::python::initX86OpcodesNamespace();
+          triton::bindings::python::initX86PrefixesNamespace();
+          #if defined(__unix__) || defined(__APPLE__)
+            triton::bindings::python::initSyscallNamespace();
+          #endif
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2392,6 +3046,24 @@ namespace triton {
           }
         }
 
+        // Python object: Buffer (memoryview, ...)
+        else if (PyObject_CheckBuffer(values)) {
+          Py_buffer view;
+
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0)
+            return nullptr;
+
+          try {
+            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
+          }
+          catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+          PyBuffer_Release(&view);
+        }
+
         // Invalid Python object
         else
           return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a bytes array as second argument.");
@@ -2473,6 +3145,46 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setSolverCachePath(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverCachePath(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "setSolverCachePath(): Expects a string as argument.");
+
+        try {
+          triton::api.setSolverCachePath(PyString_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setSolverThreads(PyObject* self, PyObject* threads) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverThreads(): Architecture is not defined.");
+
+        if (!PyLong_Check(threads) && !PyInt_Check(threads))
+          return PyErr_Format(PyExc_TypeError, "setSolverThreads(): Expects an integer as argument.");
+
+        try {
+          triton::api.setSolverThreads(PyLong_AsUint32(threads));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_setTaintMemory(PyObject* self, PyObject* args) {
         PyObject* mem    = nullptr;
         PyObject* flag   = nullptr;
@@ -2928,6 +3640,20 @@ namespace triton {
       }
 
 
+      static PyObject* triton_takeSnapshot(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "takeSnapshot(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::api.takeSnapshot());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* triton_unmapMemory(PyObject* self, PyObject* args) {
         PyObject* baseAddr        = nullptr;
         PyObject* size            = nullptr;
@@ -2962,6 +3688,35 @@ namespace triton {
       }
 
 
+      static PyObject* triton_unmapMemoryPages(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "unmapMemoryPages(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "unmapMemoryPages(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "unmapMemoryPages(): Expects a size (integer) as second argument.");
+
+        try {
+          triton::api.unmapMemoryPages(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_untaintMemory(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
         if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
@@ -3022,6 +3777,7 @@ namespace triton {
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearSolverCache",                    (PyCFunction)triton_clearSolverCache,                       METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)triton_concretizeMemory,                       METH_O,             ""},
@@ -3034,7 +3790,10 @@ namespace triton {
         {"createSymbolicRegisterExpression",    (PyCFunction)triton_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)triton_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
         {"disassembly",                         (PyCFunction)triton_disassembly,                            METH_O,             ""},
+        {"emulate",                             (PyCFunction)triton_emulate,                                METH_VARARGS,       ""},
         {"enableMode",                          (PyCFunction)triton_enableMode,                             METH_VARARGS,       ""},
+        {"enableSolverCache",                   (PyCFunction)triton_enableSolverCache,                      METH_O,             ""},
+        {"enableSolverNormalization",           (PyCFunction)triton_enableSolverNormalization,              METH_O,             ""},
         {"enableSymbolicEngine",                (PyCFunction)triton_enableSymbolicEngine,                   METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
@@ -3044,17 +3803,27 @@ namespace triton {
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
+        {"getConcreteMemoryPage",               (PyCFunction)triton_getConcreteMemoryPage,                  METH_O,             ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
+        {"getDecodeCacheStats",                 (PyCFunction)triton_getDecodeCacheStats,                    METH_NOARGS,        ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
+        {"getMemoryLabels",                     (PyCFunction)triton_getMemoryLabels,                        METH_O,             ""},
         {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getModelsBatch",                      (PyCFunction)triton_getModelsBatch,                         METH_VARARGS,       ""},
+        {"getModelsOfUntakenBranches",          (PyCFunction)triton_getModelsOfUntakenBranches,             METH_O,             ""},
+        {"getNumberOfSnapshots",                (PyCFunction)triton_getNumberOfSnapshots,                   METH_NOARGS,        ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
         {"getRegisterBitSize",                  (PyCFunction)triton_getRegisterBitSize,                     METH_NOARGS,        ""},
+        {"getRegisterLabels",                   (PyCFunction)triton_getRegisterLabels,                      METH_O,             ""},
         {"getRegisterSize",                     (PyCFunction)triton_getRegisterSize,                        METH_NOARGS,        ""},
+        {"getSolverCacheHits",                  (PyCFunction)triton_getSolverCacheHits,                     METH_NOARGS,        ""},
+        {"getSolverCacheMisses",                (PyCFunction)triton_getSolverCacheMisses,                   METH_NOARGS,        ""},
+        {"getSolverThreads",                    (PyCFunction)triton_getSolverThreads,                       METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
         {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
@@ -3079,20 +3848,29 @@ namespace triton {
         {"isRegisterSymbolized",                (PyCFunction)triton_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)triton_isRegisterTainted,                      METH_O,             ""},
         {"isRegisterValid",                     (PyCFunction)triton_isRegisterValid,                        METH_O,             ""},
+        {"isSolverCacheEnabled",                (PyCFunction)triton_isSolverCacheEnabled,                   METH_NOARGS,        ""},
+        {"isSolverNormalizationEnabled",        (PyCFunction)triton_isSolverNormalizationEnabled,           METH_NOARGS,        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)triton_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)triton_isSymbolicExpressionIdExists,           METH_O,             ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"labelMemory",                         (PyCFunction)triton_labelMemory,                            METH_VARARGS,       ""},
+        {"labelRegister",                       (PyCFunction)triton_labelRegister,                          METH_VARARGS,       ""},
+        {"mapMemoryPages",                      (PyCFunction)triton_mapMemoryPages,                         METH_VARARGS,       ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
+        {"removeSnapshot",                      (PyCFunction)triton_removeSnapshot,                         METH_O,             ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
+        {"restoreSnapshot",                     (PyCFunction)triton_restoreSnapshot,                        METH_O,             ""},
         {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)triton_setConcreteMemoryValue,                 METH_VARARGS,       ""},
         {"setConcreteRegisterValue",            (PyCFunction)triton_setConcreteRegisterValue,               METH_O,             ""},
+        {"setSolverCachePath",                  (PyCFunction)triton_setSolverCachePath,                     METH_O,             ""},
+        {"setSolverThreads",                    (PyCFunction)triton_setSolverThreads,                       METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
@@ -3111,7 +3889,9 @@ namespace triton {
         {"taintUnionRegisterImmediate",         (PyCFunction)triton_taintUnionRegisterImmediate,            METH_O,             ""},
         {"taintUnionRegisterMemory",            (PyCFunction)triton_taintUnionRegisterMemory,               METH_VARARGS,       ""},
         {"taintUnionRegisterRegister",          (PyCFunction)triton_taintUnionRegisterRegister,             METH_VARARGS,       ""},
+        {"takeSnapshot",                        (PyCFunction)triton_takeSnapshot,                           METH_NOARGS,        ""},
         {"unmapMemory",                         (PyCFunction)triton_unmapMemory,                            METH_VARARGS,       ""},
+        {"unmapMemoryPages",                    (PyCFunction)triton_unmapMemoryPages,                       METH_VARARGS,       ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                    0,                  nullptr}
@@ -32,6 +32,22 @@ The CALLBACK namespace contains all kinds of callbacks.
 \section CALLBACK_py_api Python API - Items of the CALLBACK namespace
 <hr>
 
+- **CALLBACK.GET_CONCRETE_MEMORY_PAGE**<br>
+The callback takes as arguments the address of a page (4 KiB) which is not in the memory yet and its size. Callbacks
+will be called the first time that the Triton library accesses the page, like a page fault. The callback must return the
+bytes of the page (a string or any object supporting the buffer protocol, the missing bytes are zero), or None if it does
+not provide this page. A page provided is mapped and the callbacks are not called again for it until it is unmapped.
+A page declined by all the callbacks is not asked again until it is mapped or unmapped, or a callback is added or removed.
+
+~~~~~~~~~~~~~{.py}
+>>> def provider(addr, size):
+...     if addr >= base and addr < base + len(image):
+...         return image[addr - base:addr - base + size]
+...     return None
+...
+>>> addCallback(provider, CALLBACK.GET_CONCRETE_MEMORY_PAGE)
+~~~~~~~~~~~~~
+
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as unique argument a \ref py_MemoryAccess_page. Callbacks will be called each time that the
 Triton library will need a concrete memory value. The callback must return nothing.
@@ -54,6 +70,7 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_PAGE",    PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_PAGE));
         PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
         PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
         PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
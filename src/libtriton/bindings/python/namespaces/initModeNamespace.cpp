@@ -35,9 +35,24 @@ The MODE namespace contains all kinds of mode.
 - **MODE.ALIGNED_MEMORY**<br>
 Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory explosion of `LOAD` and `STORE` acceess.
 
+- **MODE.AST_ARENA**<br>
+Enabled, Triton will allocate AST nodes from slabs (one per kind of node) instead of one by one. When an instruction
+does not keep any symbolic expression, all its nodes are released at once instead of being collected from their trees.
+
 - **MODE.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **MODE.LAZY_FLAGS**<br>
+Enabled, Triton will only compute the concrete value of the flags set by the common arithmetic and logical instructions
+(AF, CF, OF, PF, SF and ZF). Their symbolic expressions are built when the flags are read, by an instruction (e.g. `jcc`,
+`setcc`, `cmovcc`, `adc`, `pushf`) or by the user (e.g. `getSymbolicRegisterId`). A flag overwritten before being read never
+gets a symbolic expression, and such flags are not listed in the written registers of their instruction.
+
+- **MODE.MEMORY_RANGES**<br>
+Enabled, Triton will keep each memory store as a single symbolic expression covering the whole range of the access instead
+of one expression per byte. A load matching a previous store returns a reference to its expression, a load overlapping several
+stores only extracts the needed bytes from each of them. The symbolic expressions of the memory cells are then as wide as their store.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
@@ -47,6 +62,11 @@ Enabled, Triton will perform symbolic execution only on tainted instructions.
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.TAINT_LABELS**<br>
+Enabled, the tainted registers and memory cells also carry a set of labels given by `labelMemory()` and `labelRegister()`.
+Assignments copy the labels of the source and unions merge them. The labels read by an instruction are returned by its
+`getTaintLabels()` method, so one run tells which labeled input bytes reach each instruction.
+
 */
 
 
@@ -57,10 +77,14 @@ namespace triton {
 
       void initModeNamespace(PyObject* modeDict) {
         PyDict_SetItemString(modeDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        PyDict_SetItemString(modeDict, "AST_ARENA",              PyLong_FromUint32(triton::modes::AST_ARENA));
         PyDict_SetItemString(modeDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::modes::AST_DICTIONARIES));
+        PyDict_SetItemString(modeDict, "LAZY_FLAGS",             PyLong_FromUint32(triton::modes::LAZY_FLAGS));
+        PyDict_SetItemString(modeDict, "MEMORY_RANGES",          PyLong_FromUint32(triton::modes::MEMORY_RANGES));
         PyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
         PyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
         PyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        PyDict_SetItemString(modeDict, "TAINT_LABELS",           PyLong_FromUint32(triton::modes::TAINT_LABELS));
       }
 
     }; /* python namespace */
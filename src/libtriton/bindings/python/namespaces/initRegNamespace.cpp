@@ -345,304 +345,304 @@ namespace triton {
 
         switch (api.getArchitecture()) {
           case triton::arch::ARCH_X86_64:
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AF",     PyRegister(TRITON_X86_REG_AF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AH",     PyRegister(TRITON_X86_REG_AH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AL",     PyRegister(TRITON_X86_REG_AL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AX",     PyRegister(TRITON_X86_REG_AX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BH",     PyRegister(TRITON_X86_REG_BH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BL",     PyRegister(TRITON_X86_REG_BL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BP",     PyRegister(TRITON_X86_REG_BP,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BPL",    PyRegister(TRITON_X86_REG_BPL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BX",     PyRegister(TRITON_X86_REG_BX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CF",     PyRegister(TRITON_X86_REG_CF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CH",     PyRegister(TRITON_X86_REG_CH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CL",     PyRegister(TRITON_X86_REG_CL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR0",    PyRegister(TRITON_X86_REG_CR0,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR1",    PyRegister(TRITON_X86_REG_CR1,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR10",   PyRegister(TRITON_X86_REG_CR10,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR11",   PyRegister(TRITON_X86_REG_CR11,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR12",   PyRegister(TRITON_X86_REG_CR12,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR13",   PyRegister(TRITON_X86_REG_CR13,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR14",   PyRegister(TRITON_X86_REG_CR14,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR15",   PyRegister(TRITON_X86_REG_CR15,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR2",    PyRegister(TRITON_X86_REG_CR2,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR3",    PyRegister(TRITON_X86_REG_CR3,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR4",    PyRegister(TRITON_X86_REG_CR4,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR5",    PyRegister(TRITON_X86_REG_CR5,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR6",    PyRegister(TRITON_X86_REG_CR6,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR7",    PyRegister(TRITON_X86_REG_CR7,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR8",    PyRegister(TRITON_X86_REG_CR8,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR9",    PyRegister(TRITON_X86_REG_CR9,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CS",     PyRegister(TRITON_X86_REG_CS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CX",     PyRegister(TRITON_X86_REG_CX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DAZ",    PyRegister(TRITON_X86_REG_DAZ,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DE",     PyRegister(TRITON_X86_REG_DE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DF",     PyRegister(TRITON_X86_REG_DF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DH",     PyRegister(TRITON_X86_REG_DH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DI",     PyRegister(TRITON_X86_REG_DI,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DIL",    PyRegister(TRITON_X86_REG_DIL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DL",     PyRegister(TRITON_X86_REG_DL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DM",     PyRegister(TRITON_X86_REG_DM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DS",     PyRegister(TRITON_X86_REG_DS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DX",     PyRegister(TRITON_X86_REG_DX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EAX",    PyRegister(TRITON_X86_REG_EAX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EBP",    PyRegister(TRITON_X86_REG_EBP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EBX",    PyRegister(TRITON_X86_REG_EBX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ECX",    PyRegister(TRITON_X86_REG_ECX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EDI",    PyRegister(TRITON_X86_REG_EDI,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EDX",    PyRegister(TRITON_X86_REG_EDX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EFLAGS", PyRegister(TRITON_X86_REG_EFLAGS, 0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EIP",    PyRegister(TRITON_X86_REG_EIP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ES",     PyRegister(TRITON_X86_REG_ES,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ESI",    PyRegister(TRITON_X86_REG_ESI,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ESP",    PyRegister(TRITON_X86_REG_ESP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "FS",     PyRegister(TRITON_X86_REG_FS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "FZ",     PyRegister(TRITON_X86_REG_FZ,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "GS",     PyRegister(TRITON_X86_REG_GS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IE",     PyRegister(TRITON_X86_REG_IE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IF",     PyRegister(TRITON_X86_REG_IF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IM",     PyRegister(TRITON_X86_REG_IM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IP",     PyRegister(TRITON_X86_REG_IP,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM0",    PyRegister(TRITON_X86_REG_MM0,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM1",    PyRegister(TRITON_X86_REG_MM1,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM2",    PyRegister(TRITON_X86_REG_MM2,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM3",    PyRegister(TRITON_X86_REG_MM3,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM4",    PyRegister(TRITON_X86_REG_MM4,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM5",    PyRegister(TRITON_X86_REG_MM5,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM6",    PyRegister(TRITON_X86_REG_MM6,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM7",    PyRegister(TRITON_X86_REG_MM7,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MXCSR",  PyRegister(TRITON_X86_REG_MXCSR,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "OE",     PyRegister(TRITON_X86_REG_OE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "OF",     PyRegister(TRITON_X86_REG_OF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "OM",     PyRegister(TRITON_X86_REG_OM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "PE",     PyRegister(TRITON_X86_REG_PE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "PF",     PyRegister(TRITON_X86_REG_PF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "PM",     PyRegister(TRITON_X86_REG_PM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R10",    PyRegister(TRITON_X86_REG_R10,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R10B",   PyRegister(TRITON_X86_REG_R10B,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R10D",   PyRegister(TRITON_X86_REG_R10D,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R10W",   PyRegister(TRITON_X86_REG_R10W,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R11",    PyRegister(TRITON_X86_REG_R11,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R11B",   PyRegister(TRITON_X86_REG_R11B,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R11D",   PyRegister(TRITON_X86_REG_R11D,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R11W",   PyRegister(TRITON_X86_REG_R11W,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R12",    PyRegister(TRITON_X86_REG_R12,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R12B",   PyRegister(TRITON_X86_REG_R12B,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R12D",   PyRegister(TRITON_X86_REG_R12D,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R12W",   PyRegister(TRITON_X86_REG_R12W,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R13",    PyRegister(TRITON_X86_REG_R13,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R13B",   PyRegister(TRITON_X86_REG_R13B,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R13D",   PyRegister(TRITON_X86_REG_R13D,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R13W",   PyRegister(TRITON_X86_REG_R13W,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R14",    PyRegister(TRITON_X86_REG_R14,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R14B",   PyRegister(TRITON_X86_REG_R14B,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R14D",   PyRegister(TRITON_X86_REG_R14D,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R14W",   PyRegister(TRITON_X86_REG_R14W,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R15",    PyRegister(TRITON_X86_REG_R15,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R15B",   PyRegister(TRITON_X86_REG_R15B,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R15D",   PyRegister(TRITON_X86_REG_R15D,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R15W",   PyRegister(TRITON_X86_REG_R15W,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R8",     PyRegister(TRITON_X86_REG_R8,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R8B",    PyRegister(TRITON_X86_REG_R8B,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R8D",    PyRegister(TRITON_X86_REG_R8D,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R8W",    PyRegister(TRITON_X86_REG_R8W,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R9",     PyRegister(TRITON_X86_REG_R9,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R9B",    PyRegister(TRITON_X86_REG_R9B,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R9D",    PyRegister(TRITON_X86_REG_R9D,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "R9W",    PyRegister(TRITON_X86_REG_R9W,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RAX",    PyRegister(TRITON_X86_REG_RAX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RBP",    PyRegister(TRITON_X86_REG_RBP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RBX",    PyRegister(TRITON_X86_REG_RBX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RCX",    PyRegister(TRITON_X86_REG_RCX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RDI",    PyRegister(TRITON_X86_REG_RDI,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RDX",    PyRegister(TRITON_X86_REG_RDX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RH",     PyRegister(TRITON_X86_REG_RH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RIP",    PyRegister(TRITON_X86_REG_RIP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RL",     PyRegister(TRITON_X86_REG_RL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RSI",    PyRegister(TRITON_X86_REG_RSI,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RSP",    PyRegister(TRITON_X86_REG_RSP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SF",     PyRegister(TRITON_X86_REG_SF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SI",     PyRegister(TRITON_X86_REG_SI,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SIL",    PyRegister(TRITON_X86_REG_SIL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SP",     PyRegister(TRITON_X86_REG_SP,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SPL",    PyRegister(TRITON_X86_REG_SPL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SS",     PyRegister(TRITON_X86_REG_SS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "TF",     PyRegister(TRITON_X86_REG_TF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "UE",     PyRegister(TRITON_X86_REG_UE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "UM",     PyRegister(TRITON_X86_REG_UM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM0",   PyRegister(TRITON_X86_REG_XMM0,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM1",   PyRegister(TRITON_X86_REG_XMM1,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM10",  PyRegister(TRITON_X86_REG_XMM10,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM11",  PyRegister(TRITON_X86_REG_XMM11,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM12",  PyRegister(TRITON_X86_REG_XMM12,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM13",  PyRegister(TRITON_X86_REG_XMM13,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM14",  PyRegister(TRITON_X86_REG_XMM14,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM15",  PyRegister(TRITON_X86_REG_XMM15,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM2",   PyRegister(TRITON_X86_REG_XMM2,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM3",   PyRegister(TRITON_X86_REG_XMM3,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM4",   PyRegister(TRITON_X86_REG_XMM4,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM5",   PyRegister(TRITON_X86_REG_XMM5,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM6",   PyRegister(TRITON_X86_REG_XMM6,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM7",   PyRegister(TRITON_X86_REG_XMM7,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM8",   PyRegister(TRITON_X86_REG_XMM8,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM9",   PyRegister(TRITON_X86_REG_XMM9,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM0",   PyRegister(TRITON_X86_REG_YMM0,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM1",   PyRegister(TRITON_X86_REG_YMM1,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM10",  PyRegister(TRITON_X86_REG_YMM10,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM11",  PyRegister(TRITON_X86_REG_YMM11,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM12",  PyRegister(TRITON_X86_REG_YMM12,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM13",  PyRegister(TRITON_X86_REG_YMM13,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM14",  PyRegister(TRITON_X86_REG_YMM14,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM15",  PyRegister(TRITON_X86_REG_YMM15,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM2",   PyRegister(TRITON_X86_REG_YMM2,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM3",   PyRegister(TRITON_X86_REG_YMM3,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM4",   PyRegister(TRITON_X86_REG_YMM4,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM5",   PyRegister(TRITON_X86_REG_YMM5,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM6",   PyRegister(TRITON_X86_REG_YMM6,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM7",   PyRegister(TRITON_X86_REG_YMM7,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM8",   PyRegister(TRITON_X86_REG_YMM8,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM9",   PyRegister(TRITON_X86_REG_YMM9,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZE",     PyRegister(TRITON_X86_REG_ZE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZF",     PyRegister(TRITON_X86_REG_ZF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZM",     PyRegister(TRITON_X86_REG_ZM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM0",   PyRegister(TRITON_X86_REG_ZMM0,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM1",   PyRegister(TRITON_X86_REG_ZMM1,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM10",  PyRegister(TRITON_X86_REG_ZMM10,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM11",  PyRegister(TRITON_X86_REG_ZMM11,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM12",  PyRegister(TRITON_X86_REG_ZMM12,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM13",  PyRegister(TRITON_X86_REG_ZMM13,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM14",  PyRegister(TRITON_X86_REG_ZMM14,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM15",  PyRegister(TRITON_X86_REG_ZMM15,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM16",  PyRegister(TRITON_X86_REG_ZMM16,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM17",  PyRegister(TRITON_X86_REG_ZMM17,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM18",  PyRegister(TRITON_X86_REG_ZMM18,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM19",  PyRegister(TRITON_X86_REG_ZMM19,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM2",   PyRegister(TRITON_X86_REG_ZMM2,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM20",  PyRegister(TRITON_X86_REG_ZMM20,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM21",  PyRegister(TRITON_X86_REG_ZMM21,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM22",  PyRegister(TRITON_X86_REG_ZMM22,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM23",  PyRegister(TRITON_X86_REG_ZMM23,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM24",  PyRegister(TRITON_X86_REG_ZMM24,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM25",  PyRegister(TRITON_X86_REG_ZMM25,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM26",  PyRegister(TRITON_X86_REG_ZMM26,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM27",  PyRegister(TRITON_X86_REG_ZMM27,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM28",  PyRegister(TRITON_X86_REG_ZMM28,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM29",  PyRegister(TRITON_X86_REG_ZMM29,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM3",   PyRegister(TRITON_X86_REG_ZMM3,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM30",  PyRegister(TRITON_X86_REG_ZMM30,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM31",  PyRegister(TRITON_X86_REG_ZMM31,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM4",   PyRegister(TRITON_X86_REG_ZMM4,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM5",   PyRegister(TRITON_X86_REG_ZMM5,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM6",   PyRegister(TRITON_X86_REG_ZMM6,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM7",   PyRegister(TRITON_X86_REG_ZMM7,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM8",   PyRegister(TRITON_X86_REG_ZMM8,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM9",   PyRegister(TRITON_X86_REG_ZMM9,   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BP",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BP),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BPL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_BPL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR0",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR0),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR1",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR1),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR10",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR10),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR11",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR11),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR12",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR12),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR13",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR13),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR14",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR14),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR15",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR15),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR2",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR2),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR3",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR3),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR4",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR4),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR5",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR5),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR6",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR6),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR7",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR7),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR8",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR8),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR9",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR9),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DAZ",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_DAZ),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DI",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DI),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DIL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_DIL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EAX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EAX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EBP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EBP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EBX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EBX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ECX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_ECX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EDI",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EDI),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EDX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EDX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EFLAGS", PyRegister(api.getRegister(triton::arch::x86::ID_REG_EFLAGS), 0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EIP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EIP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ES",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ES),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ESI",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_ESI),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ESP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_ESP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "FS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_FS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "FZ",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_FZ),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "GS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_GS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IP",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IP),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM0",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM0),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM1",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM1),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM2",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM2),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM3",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM3),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM4",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM4),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM5",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM5),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM6",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM6),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM7",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM7),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MXCSR",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_MXCSR),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "OE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_OE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "OF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_OF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "OM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_OM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "PE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_PE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "PF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_PF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "PM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_PM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R10",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R10),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R10B",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R10B),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R10D",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R10D),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R10W",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R10W),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R11",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R11),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R11B",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R11B),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R11D",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R11D),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R11W",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R11W),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R12",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R12),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R12B",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R12B),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R12D",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R12D),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R12W",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R12W),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R13",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R13),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R13B",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R13B),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R13D",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R13D),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R13W",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R13W),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R14",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R14),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R14B",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R14B),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R14D",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R14D),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R14W",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R14W),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R15",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R15),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R15B",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R15B),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R15D",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R15D),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R15W",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_R15W),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R8",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_R8),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R8B",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R8B),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R8D",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R8D),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R8W",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R8W),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R9",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_R9),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R9B",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R9B),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R9D",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R9D),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "R9W",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_R9W),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RAX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RAX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RBP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RBP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RBX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RBX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RCX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RCX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RDI",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RDI),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RDX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RDX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_RH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RIP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RIP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_RL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RSI",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RSI),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RSP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_RSP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SI",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SI),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SIL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_SIL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SP",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SP),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SPL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_SPL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "TF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_TF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "UE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_UE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "UM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_UM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM0",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM0),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM1",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM1),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM10",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM10),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM11",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM11),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM12",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM12),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM13",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM13),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM14",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM14),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM15",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM15),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM2",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM2),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM3",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM3),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM4",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM4),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM5",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM5),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM6",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM6),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM7",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM7),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM8",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM8),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM9",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM9),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM0",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM0),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM1",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM1),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM10",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM10),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM11",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM11),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM12",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM12),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM13",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM13),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM14",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM14),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM15",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM15),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM2",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM2),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM3",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM3),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM4",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM4),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM5",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM5),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM6",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM6),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM7",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM7),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM8",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM8),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM9",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM9),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM0",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM0),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM1",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM1),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM10",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM10),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM11",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM11),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM12",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM12),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM13",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM13),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM14",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM14),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM15",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM15),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM16",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM16),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM17",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM17),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM18",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM18),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM19",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM19),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM2",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM2),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM20",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM20),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM21",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM21),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM22",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM22),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM23",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM23),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM24",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM24),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM25",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM25),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM26",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM26),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM27",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM27),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM28",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM28),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM29",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM29),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM3",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM3),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM30",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM30),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM31",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM31),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM4",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM4),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM5",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM5),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM6",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM6),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM7",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM7),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM8",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM8),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZMM9",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZMM9),   0x00, triton::arch::IMMUTABLE_REGISTER));
             break;
 
           case triton::arch::ARCH_X86:
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AF",     PyRegister(TRITON_X86_REG_AF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AH",     PyRegister(TRITON_X86_REG_AH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AL",     PyRegister(TRITON_X86_REG_AL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "AX",     PyRegister(TRITON_X86_REG_AX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BH",     PyRegister(TRITON_X86_REG_BH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BL",     PyRegister(TRITON_X86_REG_BL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BP",     PyRegister(TRITON_X86_REG_BP,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BPL",    PyRegister(TRITON_X86_REG_BPL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "BX",     PyRegister(TRITON_X86_REG_BX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CF",     PyRegister(TRITON_X86_REG_CF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CH",     PyRegister(TRITON_X86_REG_CH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CL",     PyRegister(TRITON_X86_REG_CL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR0",    PyRegister(TRITON_X86_REG_CR0,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR1",    PyRegister(TRITON_X86_REG_CR1,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR10",   PyRegister(TRITON_X86_REG_CR10,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR11",   PyRegister(TRITON_X86_REG_CR11,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR12",   PyRegister(TRITON_X86_REG_CR12,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR13",   PyRegister(TRITON_X86_REG_CR13,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR14",   PyRegister(TRITON_X86_REG_CR14,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR15",   PyRegister(TRITON_X86_REG_CR15,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR2",    PyRegister(TRITON_X86_REG_CR2,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR3",    PyRegister(TRITON_X86_REG_CR3,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR4",    PyRegister(TRITON_X86_REG_CR4,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR5",    PyRegister(TRITON_X86_REG_CR5,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR6",    PyRegister(TRITON_X86_REG_CR6,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR7",    PyRegister(TRITON_X86_REG_CR7,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR8",    PyRegister(TRITON_X86_REG_CR8,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CR9",    PyRegister(TRITON_X86_REG_CR9,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CS",     PyRegister(TRITON_X86_REG_CS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "CX",     PyRegister(TRITON_X86_REG_CX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DAZ",    PyRegister(TRITON_X86_REG_DAZ,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DE",     PyRegister(TRITON_X86_REG_DE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DF",     PyRegister(TRITON_X86_REG_DF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DH",     PyRegister(TRITON_X86_REG_DH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DI",     PyRegister(TRITON_X86_REG_DI,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DIL",    PyRegister(TRITON_X86_REG_DIL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DL",     PyRegister(TRITON_X86_REG_DL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DM",     PyRegister(TRITON_X86_REG_DM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DS",     PyRegister(TRITON_X86_REG_DS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "DX",     PyRegister(TRITON_X86_REG_DX,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EAX",    PyRegister(TRITON_X86_REG_EAX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EBP",    PyRegister(TRITON_X86_REG_EBP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EBX",    PyRegister(TRITON_X86_REG_EBX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ECX",    PyRegister(TRITON_X86_REG_ECX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EDI",    PyRegister(TRITON_X86_REG_EDI,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EDX",    PyRegister(TRITON_X86_REG_EDX,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EFLAGS", PyRegister(TRITON_X86_REG_EFLAGS, 0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "EIP",    PyRegister(TRITON_X86_REG_EIP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ES",     PyRegister(TRITON_X86_REG_ES,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ESI",    PyRegister(TRITON_X86_REG_ESI,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ESP",    PyRegister(TRITON_X86_REG_ESP,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "FS",     PyRegister(TRITON_X86_REG_FS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "FZ",     PyRegister(TRITON_X86_REG_FZ,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "GS",     PyRegister(TRITON_X86_REG_GS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IE",     PyRegister(TRITON_X86_REG_IE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IF",     PyRegister(TRITON_X86_REG_IF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IM",     PyRegister(TRITON_X86_REG_IM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "IP",     PyRegister(TRITON_X86_REG_IP,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM0",    PyRegister(TRITON_X86_REG_MM0,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM1",    PyRegister(TRITON_X86_REG_MM1,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM2",    PyRegister(TRITON_X86_REG_MM2,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM3",    PyRegister(TRITON_X86_REG_MM3,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM4",    PyRegister(TRITON_X86_REG_MM4,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM5",    PyRegister(TRITON_X86_REG_MM5,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM6",    PyRegister(TRITON_X86_REG_MM6,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MM7",    PyRegister(TRITON_X86_REG_MM7,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "MXCSR",  PyRegister(TRITON_X86_REG_MXCSR,  0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "OE",     PyRegister(TRITON_X86_REG_OE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "OF",     PyRegister(TRITON_X86_REG_OF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "OM",     PyRegister(TRITON_X86_REG_OM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "PE",     PyRegister(TRITON_X86_REG_PE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "PF",     PyRegister(TRITON_X86_REG_PF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "PM",     PyRegister(TRITON_X86_REG_PM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RH",     PyRegister(TRITON_X86_REG_RH,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "RL",     PyRegister(TRITON_X86_REG_RL,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SF",     PyRegister(TRITON_X86_REG_SF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SI",     PyRegister(TRITON_X86_REG_SI,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SIL",    PyRegister(TRITON_X86_REG_SIL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SP",     PyRegister(TRITON_X86_REG_SP,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SPL",    PyRegister(TRITON_X86_REG_SPL,    0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "SS",     PyRegister(TRITON_X86_REG_SS,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "TF",     PyRegister(TRITON_X86_REG_TF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "UE",     PyRegister(TRITON_X86_REG_UE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "UM",     PyRegister(TRITON_X86_REG_UM,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM0",   PyRegister(TRITON_X86_REG_XMM0,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM1",   PyRegister(TRITON_X86_REG_XMM1,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM2",   PyRegister(TRITON_X86_REG_XMM2,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM3",   PyRegister(TRITON_X86_REG_XMM3,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM4",   PyRegister(TRITON_X86_REG_XMM4,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM5",   PyRegister(TRITON_X86_REG_XMM5,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM6",   PyRegister(TRITON_X86_REG_XMM6,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM7",   PyRegister(TRITON_X86_REG_XMM7,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM0",   PyRegister(TRITON_X86_REG_YMM0,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM1",   PyRegister(TRITON_X86_REG_YMM1,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM2",   PyRegister(TRITON_X86_REG_YMM2,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM3",   PyRegister(TRITON_X86_REG_YMM3,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM4",   PyRegister(TRITON_X86_REG_YMM4,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM5",   PyRegister(TRITON_X86_REG_YMM5,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM6",   PyRegister(TRITON_X86_REG_YMM6,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM7",   PyRegister(TRITON_X86_REG_YMM7,   0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZE",     PyRegister(TRITON_X86_REG_ZE,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZF",     PyRegister(TRITON_X86_REG_ZF,     0x00, triton::arch::IMMUTABLE_REGISTER));
-            PyDict_SetItemString(triton::bindings::python::registersDict, "ZM",     PyRegister(TRITON_X86_REG_ZM,     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "AX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_AX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BP",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BP),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BPL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_BPL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "BX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_BX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR0",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR0),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR1",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR1),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR10",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR10),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR11",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR11),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR12",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR12),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR13",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR13),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR14",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR14),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR15",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR15),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR2",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR2),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR3",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR3),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR4",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR4),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR5",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR5),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR6",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR6),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR7",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR7),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR8",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR8),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CR9",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_CR9),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "CX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_CX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DAZ",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_DAZ),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DI",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DI),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DIL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_DIL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "DX",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_DX),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EAX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EAX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EBP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EBP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EBX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EBX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ECX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_ECX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EDI",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EDI),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EDX",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EDX),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EFLAGS", PyRegister(api.getRegister(triton::arch::x86::ID_REG_EFLAGS), 0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "EIP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_EIP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ES",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ES),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ESI",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_ESI),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ESP",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_ESP),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "FS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_FS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "FZ",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_FZ),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "GS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_GS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "IP",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_IP),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM0",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM0),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM1",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM1),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM2",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM2),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM3",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM3),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM4",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM4),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM5",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM5),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM6",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM6),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MM7",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_MM7),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "MXCSR",  PyRegister(api.getRegister(triton::arch::x86::ID_REG_MXCSR),  0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "OE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_OE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "OF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_OF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "OM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_OM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "PE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_PE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "PF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_PF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "PM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_PM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RH",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_RH),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "RL",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_RL),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SI",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SI),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SIL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_SIL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SP",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SP),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SPL",    PyRegister(api.getRegister(triton::arch::x86::ID_REG_SPL),    0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "SS",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_SS),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "TF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_TF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "UE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_UE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "UM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_UM),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM0",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM0),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM1",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM1),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM2",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM2),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM3",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM3),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM4",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM4),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM5",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM5),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM6",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM6),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "XMM7",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_XMM7),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM0",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM0),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM1",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM1),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM2",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM2),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM3",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM3),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM4",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM4),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM5",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM5),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM6",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM6),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "YMM7",   PyRegister(api.getRegister(triton::arch::x86::ID_REG_YMM7),   0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZE",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZE),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZF",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZF),     0x00, triton::arch::IMMUTABLE_REGISTER));
+            PyDict_SetItemString(triton::bindings::python::registersDict, "ZM",     PyRegister(api.getRegister(triton::arch::x86::ID_REG_ZM),     0x00, triton::arch::IMMUTABLE_REGISTER));
             break;
         } /* switch */
 
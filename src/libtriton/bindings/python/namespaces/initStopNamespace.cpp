@@ -0,0 +1,76 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <triton/emulation.hpp>
+#include <triton/pythonBindings.hpp>
+#include <triton/pythonUtils.hpp>
+
+
+
+/*! \page py_STOP_page STOP
+    \brief [**python api**] All information about the STOP python namespace.
+
+\tableofcontents
+
+\section STOP_py_description Description
+<hr>
+
+The STOP namespace contains all the reasons why `emulate()` stops.
+
+\subsection STOP_py_example Example
+
+~~~~~~~~~~~~~{.py}
+>>> summary = emulate(0x400000, [0x400100], 1000000)
+>>> if summary['reason'] == STOP.SYSCALL:
+...     pass # emulate the system call, then call emulate(summary['pc'], ...) again
+~~~~~~~~~~~~~
+
+\section STOP_py_api Python API - Items of the STOP namespace
+<hr>
+
+- **STOP.ADDRESS**<br>
+The program counter reached a stop address, the instruction at this address is not processed.
+
+- **STOP.COUNT**<br>
+The maximum number of instructions has been processed.
+
+- **STOP.HOOK**<br>
+The hook returned true.
+
+- **STOP.SYSCALL**<br>
+A system call instruction (`syscall`, `sysenter` or `int`) has been processed.
+
+- **STOP.UNMAPPED**<br>
+The program counter points to an unmapped memory.
+
+- **STOP.UNSUPPORTED**<br>
+The instruction at the program counter is not supported.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initStopNamespace(PyObject* stopDict) {
+        PyDict_SetItemString(stopDict, "ADDRESS",      PyLong_FromUint32(triton::arch::STOP_ADDRESS));
+        PyDict_SetItemString(stopDict, "COUNT",        PyLong_FromUint32(triton::arch::STOP_COUNT));
+        PyDict_SetItemString(stopDict, "HOOK",         PyLong_FromUint32(triton::arch::STOP_HOOK));
+        PyDict_SetItemString(stopDict, "SYSCALL",      PyLong_FromUint32(triton::arch::STOP_SYSCALL));
+        PyDict_SetItemString(stopDict, "UNMAPPED",     PyLong_FromUint32(triton::arch::STOP_UNMAPPED));
+        PyDict_SetItemString(stopDict, "UNSUPPORTED",  PyLong_FromUint32(triton::arch::STOP_UNSUPPORTED));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
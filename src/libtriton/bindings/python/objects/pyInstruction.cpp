@@ -141,6 +141,9 @@ Returns the third operand of the instruction. The return may be an immediate, a
 - <b>[\ref py_SymbolicExpression_page, ...] getSymbolicExpressions(void)</b><br>
 Returns the list of symbolic expressions of the instruction.
 
+- <b>[integer, ...] getTaintLabels(void)</b><br>
+Returns the taint labels of the registers and memory cells read by the instruction. Only set with the \ref py_MODE_page `TAINT_LABELS`.
+
 - <b>integer getThreadId(void)</b><br>
 Returns the thread id of the instruction.
 
@@ -527,6 +530,24 @@ namespace triton {
       }
 
 
+      static PyObject* Instruction_getTaintLabels(PyObject* self, PyObject* noarg) {
+        try {
+          PyObject* ret;
+          triton::usize index = 0;
+          const std::set<triton::uint32>& labels = PyInstruction_AsInstruction(self)->getTaintLabels();
+
+          ret = xPyList_New(labels.size());
+          for (auto it = labels.begin(); it != labels.end(); it++)
+            PyList_SetItem(ret, index++, PyLong_FromUint32(*it));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* Instruction_getThreadId(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUint32(PyInstruction_AsInstruction(self)->getThreadId());
@@ -776,6 +797,7 @@ namespace triton {
         {"getSize",                   Instruction_getSize,                  METH_NOARGS,     ""},
         {"getStoreAccess",            Instruction_getStoreAccess,           METH_NOARGS,     ""},
         {"getSymbolicExpressions",    Instruction_getSymbolicExpressions,   METH_NOARGS,     ""},
+        {"getTaintLabels",            Instruction_getTaintLabels,           METH_NOARGS,     ""},
         {"getThirdOperand",           Instruction_getThirdOperand,          METH_NOARGS,     ""},
         {"getThreadId",               Instruction_getThreadId,              METH_NOARGS,     ""},
         {"getType",                   Instruction_getType,                  METH_NOARGS,     ""},
@@ -0,0 +1,168 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <triton/concreteMemory.hpp>
+#include <triton/pythonObjects.hpp>
+#include <triton/pythonUtils.hpp>
+#include <triton/pythonXFunctions.hpp>
+
+
+
+/*! \page py_MemoryPage_page MemoryPage
+    \brief [**python api**] All information about the MemoryPage python object.
+
+\tableofcontents
+
+\section py_MemoryPage_description Description
+<hr>
+
+This object holds a page (4 KiB) of the concrete memory, returned by `getConcreteMemoryPage()`. It supports the buffer
+protocol, thus a `memoryview` of the page reads and writes the bytes of the memory in place, without copy.
+
+~~~~~~~~~~~~~{.py}
+>>> page = getConcreteMemoryPage(0x1000)
+>>> view = memoryview(page)
+>>> view[0:4] = "\x90\x90\x90\xc3"
+>>> getConcreteMemoryAreaValue(0x1000, 4)
+'\x90\x90\x90\xc3'
+~~~~~~~~~~~~~
+
+The bytes written through the page do not go through the callbacks and do not change the symbolic and taint states.
+Unmapping the page, clearing the architecture or restoring a snapshot detaches the page: its bytes are not the ones of
+the memory anymore.
+
+\section MemoryPage_py_api Python API - Methods of the MemoryPage class
+<hr>
+
+- <b>integer getAddress(void)</b><br>
+Returns the address of the first byte of the page.
+
+- <b>integer getSize(void)</b><br>
+Returns the size of the page.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! MemoryPage destructor.
+      void MemoryPage_dealloc(PyObject* self) {
+        delete PyMemoryPage_AsPage(self);
+        PyObject_Del(self);
+      }
+
+
+      static PyObject* MemoryPage_getAddress(PyObject* self, PyObject* noarg) {
+        return PyLong_FromUint64(PyMemoryPage_AsAddress(self));
+      }
+
+
+      static PyObject* MemoryPage_getSize(PyObject* self, PyObject* noarg) {
+        return PyLong_FromUint32(triton::arch::ConcreteMemory::pageSize);
+      }
+
+
+      static int MemoryPage_getBuffer(PyObject* self, Py_buffer* view, int flags) {
+        void* data = PyMemoryPage_AsPage(self)->get();
+        return PyBuffer_FillInfo(view, self, data, triton::arch::ConcreteMemory::pageSize, 0, flags);
+      }
+
+
+      //! MemoryPage methods.
+      PyMethodDef MemoryPage_callbacks[] = {
+        {"getAddress",    MemoryPage_getAddress,    METH_NOARGS,     ""},
+        {"getSize",       MemoryPage_getSize,       METH_NOARGS,     ""},
+        {nullptr,         nullptr,                  0,               nullptr}
+      };
+
+
+      //! MemoryPage buffer protocol.
+      PyBufferProcs MemoryPage_buffer = {
+        0,                                          /* bf_getreadbuffer */
+        0,                                          /* bf_getwritebuffer */
+        0,                                          /* bf_getsegcount */
+        0,                                          /* bf_getcharbuffer */
+        (getbufferproc)MemoryPage_getBuffer,        /* bf_getbuffer */
+        0,                                          /* bf_releasebuffer */
+      };
+
+
+      PyTypeObject MemoryPage_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "MemoryPage",                               /* tp_name */
+        sizeof(MemoryPage_Object),                  /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)MemoryPage_dealloc,             /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        0,                                          /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        0,                                          /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        &MemoryPage_buffer,                         /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER, /* tp_flags */
+        "MemoryPage objects",                       /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        MemoryPage_callbacks,                       /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyMemoryPage(triton::uint64 addr, const std::shared_ptr<triton::uint8>& page) {
+        MemoryPage_Object* object;
+
+        PyType_Ready(&MemoryPage_Type);
+        object = PyObject_NEW(MemoryPage_Object, &MemoryPage_Type);
+        if (object != NULL) {
+          object->page = new std::shared_ptr<triton::uint8>(page);
+          object->addr = addr & ~static_cast<triton::uint64>(triton::arch::ConcreteMemory::pageSize - 1);
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -7,6 +7,7 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <triton/api.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/pythonObjects.hpp>
 #include <triton/pythonUtils.hpp>
@@ -158,7 +159,7 @@ namespace triton {
 
       static PyObject* Register_getParent(PyObject* self, PyObject* noarg) {
         try {
-          triton::arch::Register parent = PyRegister_AsRegister(self)->getParent();
+          triton::arch::Register parent = triton::api.getParentRegister(*PyRegister_AsRegister(self));
           return PyRegister(parent);
         }
         catch (const triton::exceptions::Exception& e) {
@@ -375,7 +376,7 @@ namespace triton {
         PyType_Ready(&Register_Type);
         Register_Object* object = PyObject_NEW(Register_Object, &Register_Type);
         if (object != NULL)
-          object->reg = new triton::arch::Register(reg.getId(), concreteValue, isImmutable);
+          object->reg = new triton::arch::Register(*triton::api.getCpu(), reg.getId(), concreteValue, isImmutable);
 
         return (PyObject*)object;
       }
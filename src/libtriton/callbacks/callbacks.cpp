@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <cstring>
+
 #include <triton/callbacks.hpp>
 #include <triton/exceptions.hpp>
 
@@ -21,19 +23,23 @@ namespace triton {
 
     Callbacks::Callbacks() {
       this->isDefined = false;
+      this->version   = 0;
     }
 
 
     Callbacks::Callbacks(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
+      this->pyGetConcreteMemoryPageCallbacks    = copy.pyGetConcreteMemoryPageCallbacks;
       this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
       this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
       this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
       #endif
+      this->getConcreteMemoryPageCallbacks      = copy.getConcreteMemoryPageCallbacks;
       this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
       this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
       this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
       this->isDefined                           = copy.isDefined;
+      this->version                             = copy.version;
     }
 
 
@@ -43,38 +49,54 @@ namespace triton {
 
     void Callbacks::operator=(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
+      this->pyGetConcreteMemoryPageCallbacks    = copy.pyGetConcreteMemoryPageCallbacks;
       this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
       this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
       this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
       #endif
+      this->getConcreteMemoryPageCallbacks      = copy.getConcreteMemoryPageCallbacks;
       this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
       this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
       this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
       this->isDefined                           = copy.isDefined;
+      this->version                             = copy.version;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+      this->getConcreteMemoryPageCallbacks.push_back(cb);
+      this->isDefined = true;
+      this->version++;
     }
 
 
     void Callbacks::addCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
       this->getConcreteMemoryValueCallbacks.push_back(cb);
       this->isDefined = true;
+      this->version++;
     }
 
 
     void Callbacks::addCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
       this->getConcreteRegisterValueCallbacks.push_back(cb);
       this->isDefined = true;
+      this->version++;
     }
 
 
     void Callbacks::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
       this->symbolicSimplificationCallbacks.push_back(cb);
       this->isDefined = true;
+      this->version++;
     }
 
 
     #ifdef TRITON_PYTHON_BINDINGS
     void Callbacks::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
       switch (kind) {
+        case GET_CONCRETE_MEMORY_PAGE:
+          this->pyGetConcreteMemoryPageCallbacks.push_back(function);
+          break;
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.push_back(function);
           break;
@@ -88,19 +110,32 @@ namespace triton {
           throw triton::exceptions::Callbacks("Callbacks::addCallback(): Invalid kind of callback.");
       };
       this->isDefined = true;
+      this->version++;
     }
     #endif
 
 
     void Callbacks::removeAllCallbacks(void) {
+      this->getConcreteMemoryPageCallbacks.clear();
       this->getConcreteMemoryValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
       #ifdef TRITON_PYTHON_BINDINGS
+      this->pyGetConcreteMemoryPageCallbacks.clear();
       this->pyGetConcreteMemoryValueCallbacks.clear();
       this->pyGetConcreteRegisterValueCallbacks.clear();
       this->pySymbolicSimplificationCallbacks.clear();
       #endif
+      this->isDefined = false;
+      this->version++;
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb) {
+      this->getConcreteMemoryPageCallbacks.remove(cb);
+      if (this->countCallbacks() == 0)
+        this->isDefined = false;
+      this->version++;
     }
 
 
@@ -108,6 +143,7 @@ namespace triton {
       this->getConcreteMemoryValueCallbacks.remove(cb);
       if (this->countCallbacks() == 0)
         this->isDefined = false;
+      this->version++;
     }
 
 
@@ -115,6 +151,7 @@ namespace triton {
       this->getConcreteRegisterValueCallbacks.remove(cb);
       if (this->countCallbacks() == 0)
         this->isDefined = false;
+      this->version++;
     }
 
 
@@ -122,12 +159,16 @@ namespace triton {
       this->symbolicSimplificationCallbacks.remove(cb);
       if (this->countCallbacks() == 0)
         this->isDefined = false;
+      this->version++;
     }
 
 
     #ifdef TRITON_PYTHON_BINDINGS
     void Callbacks::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
       switch (kind) {
+        case GET_CONCRETE_MEMORY_PAGE:
+          this->pyGetConcreteMemoryPageCallbacks.remove(function);
+          break;
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.remove(function);
           break;
@@ -143,10 +184,48 @@ namespace triton {
 
       if (this->countCallbacks() == 0)
         this->isDefined = false;
+      this->version++;
     }
     #endif
 
 
+    triton::usize Callbacks::getVersion(void) const {
+      return this->version;
+    }
+
+
+    bool Callbacks::hasCallbacks(triton::callbacks::callback_e kind) const {
+      switch (kind) {
+        case GET_CONCRETE_MEMORY_PAGE:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pyGetConcreteMemoryPageCallbacks.empty())
+            return true;
+          #endif
+          return !this->getConcreteMemoryPageCallbacks.empty();
+        case GET_CONCRETE_MEMORY_VALUE:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pyGetConcreteMemoryValueCallbacks.empty())
+            return true;
+          #endif
+          return !this->getConcreteMemoryValueCallbacks.empty();
+        case GET_CONCRETE_REGISTER_VALUE:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pyGetConcreteRegisterValueCallbacks.empty())
+            return true;
+          #endif
+          return !this->getConcreteRegisterValueCallbacks.empty();
+        case SYMBOLIC_SIMPLIFICATION:
+          #ifdef TRITON_PYTHON_BINDINGS
+          if (!this->pySymbolicSimplificationCallbacks.empty())
+            return true;
+          #endif
+          return !this->symbolicSimplificationCallbacks.empty();
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::hasCallbacks(): Invalid kind of callback.");
+      };
+    }
+
+
     triton::ast::AbstractNode* Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const {
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION: {
@@ -271,13 +350,77 @@ namespace triton {
     }
 
 
+    bool Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 addr, triton::uint8* area, triton::usize size) const {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_PAGE: {
+          // C++ callbacks
+          std::list<triton::callbacks::getConcreteMemoryPageCallback>::const_iterator it1;
+          for (it1 = this->getConcreteMemoryPageCallbacks.begin(); it1 != this->getConcreteMemoryPageCallbacks.end(); it1++) {
+            if ((*it1)(addr, area, size))
+              return true;
+          }
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyGetConcreteMemoryPageCallbacks.begin(); it2 != this->pyGetConcreteMemoryPageCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUint64(addr));
+            PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUsize(size));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+            Py_DECREF(args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_PAGE): Fail to call the python callback.");
+            }
+
+            /* None means that the callback does not provide this page */
+            if (ret == Py_None) {
+              Py_DECREF(ret);
+              continue;
+            }
+
+            /* Copy the bytes returned, the missing ones stay zero */
+            Py_buffer view;
+            if (PyObject_GetBuffer(ret, &view, PyBUF_SIMPLE) != 0) {
+              PyErr_Clear();
+              Py_DECREF(ret);
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_PAGE): You must return None or a buffer of bytes.");
+            }
+
+            std::memcpy(area, view.buf, (static_cast<triton::usize>(view.len) < size) ? static_cast<triton::usize>(view.len) : size);
+            PyBuffer_Release(&view);
+            Py_DECREF(ret);
+
+            return true;
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+
+      return false;
+    }
+
+
     triton::usize Callbacks::countCallbacks(void) const {
       triton::usize count = 0;
 
+      count += this->getConcreteMemoryPageCallbacks.size();
       count += this->getConcreteMemoryValueCallbacks.size();
       count += this->getConcreteRegisterValueCallbacks.size();
       count += this->symbolicSimplificationCallbacks.size();
       #ifdef TRITON_PYTHON_BINDINGS
+      count += this->pyGetConcreteMemoryPageCallbacks.size();
       count += this->pyGetConcreteMemoryValueCallbacks.size();
       count += this->pyGetConcreteRegisterValueCallbacks.size();
       count += this->pySymbolicSimplificationCallbacks.size();
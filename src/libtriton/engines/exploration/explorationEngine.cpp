@@ -0,0 +1,260 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/cpuSize.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/explorationEngine.hpp>
+#include <triton/solverSession.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      Input::Input() {
+        this->bound  = 0;
+        this->depth  = 0;
+        this->target = std::make_pair(0, 0);
+      }
+
+
+      ExplorationEngine::ExplorationEngine(triton::API* api) {
+        if (api == nullptr)
+          throw triton::exceptions::ExplorationEngine("ExplorationEngine::ExplorationEngine(): The API cannot be null.");
+
+        this->api             = api;
+        this->heuristic       = COVERAGE_FIRST;
+        this->entryPoint      = 0;
+        this->maxInstructions = 100000;
+      }
+
+
+      void ExplorationEngine::setHeuristic(heuristic_e heuristic) {
+        switch (heuristic) {
+          case COVERAGE_FIRST:
+          case DEPTH_FIRST:
+          case RANDOM:
+            this->heuristic = heuristic;
+            break;
+          default:
+            throw triton::exceptions::ExplorationEngine("ExplorationEngine::setHeuristic(): Invalid heuristic.");
+        }
+      }
+
+
+      void ExplorationEngine::setRandomSeed(triton::uint32 seed) {
+        this->random.seed(seed);
+      }
+
+
+      void ExplorationEngine::setEntryPoint(triton::uint64 addr) {
+        this->entryPoint = addr;
+      }
+
+
+      void ExplorationEngine::addExitPoint(triton::uint64 addr) {
+        this->exitPoints.insert(addr);
+      }
+
+
+      void ExplorationEngine::addSymbolicMemory(triton::uint64 addr, triton::usize size) {
+        this->symbolicAreas.push_back(std::make_pair(addr, size));
+      }
+
+
+      void ExplorationEngine::setMaxInstructions(triton::usize count) {
+        this->maxInstructions = count;
+      }
+
+
+      void ExplorationEngine::addSeed(const std::map<triton::uint64, triton::uint8>& memory) {
+        Input input;
+        input.memory = memory;
+        this->pushInput(input);
+      }
+
+
+      void ExplorationEngine::pushInput(const Input& input) {
+        if (this->scheduled.insert(input.memory).second)
+          this->worklist.push_back(input);
+      }
+
+
+      Input ExplorationEngine::popInput(void) {
+        triton::usize index = this->worklist.size() - 1;
+
+        switch (this->heuristic) {
+          /* A branch not covered yet, then the oldest generation, then the oldest input */
+          case COVERAGE_FIRST: {
+            bool bestNew = false;
+            for (triton::usize i = 0; i < this->worklist.size(); i++) {
+              const Input& input = this->worklist[i];
+              bool isNew = (this->coverage.find(input.target) == this->coverage.end());
+              if (i == 0 || (isNew && !bestNew) || (isNew == bestNew && input.depth < this->worklist[index].depth)) {
+                index   = i;
+                bestNew = isNew;
+              }
+            }
+            break;
+          }
+
+          /* The last input generated */
+          case DEPTH_FIRST:
+            break;
+
+          case RANDOM:
+            index = std::uniform_int_distribution<triton::usize>(0, this->worklist.size() - 1)(this->random);
+            break;
+        }
+
+        Input input = this->worklist[index];
+        this->worklist.erase(this->worklist.begin() + index);
+
+        return input;
+      }
+
+
+      std::map<triton::usize, triton::uint64> ExplorationEngine::run(Input& input) {
+        std::map<triton::usize, triton::uint64> variables;
+
+        /* Symbolize the inputs, the bytes missing keep their value */
+        for (const auto& area : this->symbolicAreas) {
+          for (triton::usize offset = 0; offset < area.second; offset++) {
+            triton::uint64 addr = area.first + offset;
+            auto it = input.memory.find(addr);
+            if (it != input.memory.end())
+              this->api->setConcreteMemoryValue(addr, it->second);
+            auto var = this->api->convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(addr, BYTE_SIZE));
+            variables[var->getId()] = addr;
+          }
+        }
+
+        /* Emulate until an exit point, the hook counts the instructions in case the emulation throws */
+        triton::arch::StopCondition stop;
+        triton::usize count = 0;
+        stop.addresses = this->exitPoints;
+        stop.hook = [&count](triton::arch::Instruction&) { count++; return false; };
+
+        try {
+          input.summary = this->api->emulate(this->entryPoint, stop, this->maxInstructions);
+        }
+        catch (const triton::exceptions::Disassembly&) {
+          /* An instruction which cannot be disassembled ends the run like an unsupported one */
+          input.summary.pc     = this->api->getConcreteRegisterValue(this->api->getProgramCounter(), false).convert_to<triton::uint64>();
+          input.summary.count  = count;
+          input.summary.reason = triton::arch::STOP_UNSUPPORTED;
+        }
+
+        return variables;
+      }
+
+
+      void ExplorationEngine::expand(const Input& input, const std::map<triton::usize, triton::uint64>& variables, triton::usize first) {
+        const auto& pathConstraints = this->api->getPathConstraints();
+        triton::engines::solver::SolverSession session(this->api->getSolverEngine());
+
+        for (triton::usize index = first; index < pathConstraints.size(); index++) {
+          const auto& pc = pathConstraints[index];
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            /* Coverage */
+            if (std::get<0>(branch)) {
+              this->coverage.insert(std::make_pair(std::get<1>(branch), std::get<2>(branch)));
+              continue;
+            }
+
+            /* Only the branches after the bound are negated, the previous ones are negated by the parents */
+            if (index - first < input.bound)
+              continue;
+
+            auto models = session.getModels(std::get<3>(branch), 1);
+            if (models.empty())
+              continue;
+
+            Input child;
+            child.memory = input.memory;
+            child.bound  = index - first + 1;
+            child.depth  = input.depth + 1;
+            child.target = std::make_pair(std::get<1>(branch), std::get<2>(branch));
+
+            for (const auto& model : models.front()) {
+              auto it = variables.find(model.first);
+              if (it != variables.end())
+                child.memory[it->second] = model.second.getValue().convert_to<triton::uint8>();
+            }
+
+            this->pushInput(child);
+          }
+
+          /* The taken branch joins the prefix of the next path constraints */
+          session.addConstraint(pc.getTakenPathConstraintAst());
+        }
+      }
+
+
+      triton::usize ExplorationEngine::explore(triton::usize maxRuns) {
+        triton::usize runs = 0;
+
+        this->api->checkArchitecture();
+
+        /* Without seed, the first run uses the initial state */
+        if (this->worklist.empty() && this->inputs.empty())
+          this->pushInput(Input());
+
+        /* Each run starts from the initial state */
+        triton::usize snapshot = this->api->takeSnapshot();
+        triton::usize first    = this->api->getPathConstraints().size();
+
+        try {
+          while (!this->worklist.empty() && (maxRuns == 0 || runs < maxRuns)) {
+            Input input = this->popInput();
+            this->api->restoreSnapshot(snapshot);
+            auto variables = this->run(input);
+            this->expand(input, variables, first);
+            this->inputs.push_back(input);
+            runs++;
+          }
+        }
+        catch (...) {
+          this->api->restoreSnapshot(snapshot);
+          this->api->removeSnapshot(snapshot);
+          throw;
+        }
+
+        this->api->restoreSnapshot(snapshot);
+        this->api->removeSnapshot(snapshot);
+
+        return runs;
+      }
+
+
+      const std::vector<Input>& ExplorationEngine::getInputs(void) const {
+        return this->inputs;
+      }
+
+
+      const std::vector<Input>& ExplorationEngine::getWorklist(void) const {
+        return this->worklist;
+      }
+
+
+      const std::set<std::pair<triton::uint64, triton::uint64>>& ExplorationEngine::getCoverage(void) const {
+        return this->coverage;
+      }
+
+
+      void ExplorationEngine::reset(void) {
+        this->worklist.clear();
+        this->inputs.clear();
+        this->scheduled.clear();
+        this->coverage.clear();
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/snapshotEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace snapshot {
+
+      SnapshotEngine::SnapshotEngine(triton::arch::Architecture* architecture,
+                                     triton::ast::AstGarbageCollector* astGarbageCollector,
+                                     triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                                     triton::engines::taint::TaintEngine* taintEngine) {
+
+        if (architecture == nullptr || astGarbageCollector == nullptr || symbolicEngine == nullptr || taintEngine == nullptr)
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::SnapshotEngine(): The engines cannot be null.");
+
+        this->architecture        = architecture;
+        this->astGarbageCollector = astGarbageCollector;
+        this->symbolicEngine      = symbolicEngine;
+        this->taintEngine         = taintEngine;
+      }
+
+
+      SnapshotEngine::~SnapshotEngine() {
+        /* The engines are deleted with their checkpoints */
+        this->deleteSnapshots(0);
+      }
+
+
+      void SnapshotEngine::deleteSnapshots(triton::usize index) {
+        for (triton::usize i = index; i < this->snapshots.size(); i++)
+          delete this->snapshots[i].cpu;
+        this->snapshots.erase(this->snapshots.begin() + index, this->snapshots.end());
+      }
+
+
+      void SnapshotEngine::closeJournals(void) {
+        /* An instruction which raised an exception during its processing left its journals opened */
+        if (this->astGarbageCollector->isJournalOpened())
+          this->astGarbageCollector->rollbackJournal();
+
+        if (this->symbolicEngine->isJournalOpened())
+          this->symbolicEngine->rollbackJournal();
+      }
+
+
+      triton::usize SnapshotEngine::takeSnapshot(void) {
+        Snapshot snapshot;
+
+        this->closeJournals();
+
+        /* The CPU and the taint engine share their pages with the snapshot */
+        snapshot.cpu = this->architecture->snapshotCpu();
+        this->taintEngine->saveState(snapshot.taint);
+
+        /* The symbolic engine and the AST nodes are journaled */
+        snapshot.symbolicCheckpoint = this->symbolicEngine->newCheckpoint();
+        snapshot.astCheckpoint      = this->astGarbageCollector->newCheckpoint();
+
+        this->snapshots.push_back(snapshot);
+
+        return this->snapshots.size() - 1;
+      }
+
+
+      void SnapshotEngine::restoreSnapshot(triton::usize id) {
+        if (id >= this->snapshots.size())
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::restoreSnapshot(): Invalid snapshot.");
+
+        this->closeJournals();
+
+        const Snapshot& snapshot = this->snapshots[id];
+
+        this->architecture->restoreCpu(snapshot.cpu);
+        this->taintEngine->restoreState(snapshot.taint);
+
+        /* The nodes are freed before the restored ASTs are initialized again */
+        this->astGarbageCollector->restoreCheckpoint(snapshot.astCheckpoint);
+        this->symbolicEngine->restoreCheckpoint(snapshot.symbolicCheckpoint);
+
+        this->deleteSnapshots(id + 1);
+      }
+
+
+      void SnapshotEngine::removeSnapshot(triton::usize id) {
+        if (id >= this->snapshots.size())
+          throw triton::exceptions::SnapshotEngine("SnapshotEngine::removeSnapshot(): Invalid snapshot.");
+
+        this->closeJournals();
+
+        this->symbolicEngine->removeCheckpoint(this->snapshots[id].symbolicCheckpoint);
+        this->astGarbageCollector->removeCheckpoint(this->snapshots[id].astCheckpoint);
+
+        this->deleteSnapshots(id);
+      }
+
+
+      triton::usize SnapshotEngine::getNumberOfSnapshots(void) const {
+        return this->snapshots.size();
+      }
+
+    }; /* snapshot namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
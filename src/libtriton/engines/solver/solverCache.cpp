@@ -0,0 +1,170 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/solverCache.hpp>
+
+
+
+/*! \page solver_cache_file_page Solver cache file
+    \brief [**internal**] The file format of the solver cache.
+
+\section solver_cache_file_description Description
+<hr>
+
+One entry per line, as space separated decimal numbers:
+
+~~~~~~~~~~~~~
+<key high> <key low> <limit> <number of models> [<number of variables> [<variable name> <value>]...]...
+~~~~~~~~~~~~~
+
+An entry with zero models is an unsat query. When an entry appears several times, the last one wins.
+
+*/
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverCache::SolverCache() {
+        this->hits   = 0;
+        this->misses = 0;
+      }
+
+
+      SolverCache::~SolverCache() {
+        if (this->file.is_open())
+          this->file.close();
+      }
+
+
+      bool SolverCache::find(const solverCacheKey& key, triton::uint32 limit, std::list<std::map<triton::uint32, SolverModel>>& models) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        auto it = this->entries.find(key);
+
+        /* Usable if solved with a greater limit or if all models have been found */
+        if (it == this->entries.end() || (it->second.first < limit && it->second.second.size() >= it->second.first)) {
+          this->misses++;
+          return false;
+        }
+
+        models.clear();
+        for (auto model = it->second.second.begin(); model != it->second.second.end() && models.size() < limit; model++)
+          models.push_back(*model);
+
+        this->hits++;
+        return true;
+      }
+
+
+      void SolverCache::insert(const solverCacheKey& key, triton::uint32 limit, const std::list<std::map<triton::uint32, SolverModel>>& models) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        auto it = this->entries.find(key);
+
+        /* Keep the most complete entry */
+        if (it != this->entries.end() && it->second.first >= limit)
+          return;
+
+        this->entries[key] = std::make_pair(limit, models);
+
+        if (this->file.is_open()) {
+          this->write(this->file, key, this->entries[key]);
+          this->file.flush();
+        }
+      }
+
+
+      void SolverCache::write(std::ostream& stream, const solverCacheKey& key, const entry& value) const {
+        stream << key.first << " " << key.second << " " << value.first << " " << value.second.size();
+        for (const auto& model : value.second) {
+          stream << " " << model.size();
+          for (const auto& item : model)
+            stream << " " << item.second.getName() << " " << item.second.getValue();
+        }
+        stream << std::endl;
+      }
+
+
+      void SolverCache::setPath(const std::string& path) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        if (this->file.is_open())
+          this->file.close();
+
+        if (path.empty())
+          return;
+
+        /* Load the previous entries */
+        std::ifstream input(path);
+        solverCacheKey key;
+        triton::uint32 limit = 0;
+        triton::usize count  = 0;
+
+        while (input >> key.first >> key.second >> limit >> count) {
+          std::list<std::map<triton::uint32, SolverModel>> models;
+
+          for (triton::usize i = 0; i < count; i++) {
+            std::map<triton::uint32, SolverModel> model;
+            triton::usize variables = 0;
+
+            if (!(input >> variables))
+              throw triton::exceptions::SolverEngine("SolverCache::setPath(): Invalid cache file.");
+
+            for (triton::usize j = 0; j < variables; j++) {
+              std::string name;
+              std::string value;
+
+              if (!(input >> name >> value))
+                throw triton::exceptions::SolverEngine("SolverCache::setPath(): Invalid cache file.");
+
+              SolverModel item(name, triton::uint512(value));
+              model[item.getId()] = item;
+            }
+
+            models.push_back(model);
+          }
+
+          this->entries[key] = std::make_pair(limit, models);
+        }
+
+        /* New entries are appended */
+        this->file.open(path, std::ios::out | std::ios::app);
+        if (!this->file.is_open())
+          throw triton::exceptions::SolverEngine("SolverCache::setPath(): Cannot open the cache file.");
+      }
+
+
+      void SolverCache::clear(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->entries.clear();
+        this->hits   = 0;
+        this->misses = 0;
+      }
+
+
+      triton::usize SolverCache::size(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->entries.size();
+      }
+
+
+      triton::usize SolverCache::getHits(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->hits;
+      }
+
+
+      triton::usize SolverCache::getMisses(void) const {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->misses;
+      }
+
+    };
+  };
+};
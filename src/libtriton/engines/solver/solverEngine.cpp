@@ -5,10 +5,20 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <thread>
+
 #include <triton/ast.hpp>
+#include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/solverEngine.hpp>
+#include <triton/solverSession.hpp>
 #include <triton/tritonToZ3Ast.hpp>
 #include <triton/z3Result.hpp>
 
@@ -68,13 +78,14 @@ For example, if there are two symbolic variables in your constraint, the triton:
 
 ~~~~~~~~~~~~~{cpp}
   // Get the symbolic id of RAX
-  auto raxSymId = api.getSymbolicRegisterId(TRITON_X86_REG_RAX);
+  auto raxSymId = api.getSymbolicRegisterId(api.getRegister(ID_REG_RAX));
 
   // Get the full AST of RAX
   auto raxFullAst = api.getFullAstFromId(raxSymId);
 
   // Modify the AST of RAX to build the constraint
-  auto constraint = triton::ast::assert_(triton::ast::equal(raxFullAst, triton::ast::bv(0, raxFullAst->getBitvectorSize())));
+  auto& astCtxt   = api.getAstContext();
+  auto constraint = astCtxt.assert_(astCtxt.equal(raxFullAst, astCtxt.bv(0, raxFullAst->getBitvectorSize())));
 
   // Ask a model
   auto model = api.getModel(constraint);
@@ -109,6 +120,9 @@ namespace triton {
         if (symbolicEngine == nullptr)
           throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): The symbolicEngine API cannot be null.");
         this->symbolicEngine = symbolicEngine;
+        this->cacheEnabled         = true;
+        this->normalizationEnabled = true;
+        this->setNumberOfThreads(0);
       }
 
 
@@ -116,34 +130,9 @@ namespace triton {
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::solve(z3::solver& solver, triton::uint32 limit) const {
         std::list<std::map<triton::uint32, SolverModel>> ret;
-        std::ostringstream formula;
-        z3::context ctx;
-        z3::solver solver(ctx);
-        triton::uint32 representationMode = triton::ast::representations::astRepresentation.getMode();
-
-        if (node == nullptr)
-          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
-
-        /* Switch into the SMT mode */
-        triton::ast::representations::astRepresentation.setMode(triton::ast::representations::SMT_REPRESENTATION);
-
-        /* First, set the QF_AUFBV flag  */
-        formula << "(set-logic QF_BV)";
-
-        /* Then, delcare all symbolic variables */
-        formula << this->symbolicEngine->getVariablesDeclaration();
-
-        /* And concat the user expression */
-        formula << this->symbolicEngine->getFullAst(node);
-
-        /* Create the context and AST */
-        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
-        z3::expr eq(ctx, ast);
-
-        /* Create a solver and add the expression */
-        solver.add(eq);
+        z3::context& ctx = solver.ctx();
 
         /* Check if it is sat */
         while (solver.check() == z3::sat && limit >= 1) {
@@ -197,13 +186,385 @@ namespace triton {
           limit--;
         }
 
+        return ret;
+      }
+
+
+      bool SolverEngine::getConjuncts(triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& conjuncts) const {
+        std::vector<triton::ast::AbstractNode*> worklist{node};
+        std::set<triton::ast::AbstractNode*> visited;
+        std::set<triton::ast::hash128> hashes;
+
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (visited.find(current) != visited.end())
+            continue;
+          visited.insert(current);
+
+          switch (current->getKind()) {
+            case triton::ast::ASSERT_NODE:
+            case triton::ast::LAND_NODE:
+              for (auto it = current->getChilds().rbegin(); it != current->getChilds().rend(); it++)
+                worklist.push_back(*it);
+              break;
+
+            case triton::ast::REFERENCE_NODE: {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+              worklist.push_back(this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst());
+              break;
+            }
+
+            default:
+              /* A constant conjunct is either useless or makes the whole conjunction false */
+              if (!current->isSymbolized()) {
+                if (current->evaluate() == 0)
+                  return false;
+                break;
+              }
+              /* The same constraint built again, e.g. by each iteration of a loop */
+              if (this->normalizationEnabled && !hashes.insert(current->getStructuralHash()).second)
+                break;
+              conjuncts.push_back(current);
+              break;
+          }
+        }
+
+        return true;
+      }
+
+
+      std::vector<std::vector<triton::ast::AbstractNode*>> SolverEngine::getIndependentClusters(const std::vector<triton::ast::AbstractNode*>& conjuncts) const {
+        std::vector<std::vector<triton::ast::AbstractNode*>> ret;
+        std::vector<triton::usize> parents(conjuncts.size());
+        std::map<triton::ast::AbstractNode*, triton::usize> owners;
+        std::map<std::string, triton::usize> variables;
+
+        /* Union-find over the conjuncts */
+        auto find = [&](triton::usize index) {
+          while (parents[index] != index)
+            index = parents[index] = parents[parents[index]];
+          return index;
+        };
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++)
+          parents[index] = index;
+
+        /*
+         * A symbolized node already met belongs to the cluster of the conjunct
+         * which met it first, so its sub-tree is not visited again.
+         */
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          std::vector<triton::ast::AbstractNode*> worklist{conjuncts[index]};
+
+          while (!worklist.empty()) {
+            triton::ast::AbstractNode* current = worklist.back();
+            worklist.pop_back();
+
+            if (!current->isSymbolized())
+              continue;
+
+            auto owner = owners.find(current);
+            if (owner != owners.end()) {
+              parents[find(owner->second)] = find(index);
+              continue;
+            }
+            owners[current] = index;
+
+            if (current->getKind() == triton::ast::VARIABLE_NODE) {
+              std::string name = reinterpret_cast<triton::ast::VariableNode*>(current)->getValue();
+              auto variable = variables.find(name);
+              if (variable != variables.end())
+                parents[find(variable->second)] = find(index);
+              else
+                variables[name] = index;
+            }
+
+            else if (current->getKind() == triton::ast::REFERENCE_NODE) {
+              triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+              worklist.push_back(this->symbolicEngine->getSymbolicExpressionFromId(id)->getAst());
+            }
+
+            else {
+              for (auto child : current->getChilds())
+                worklist.push_back(child);
+            }
+          }
+        }
+
+        /* Group the conjuncts by cluster, keeping their order */
+        std::map<triton::usize, triton::usize> clusters;
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          triton::usize root = find(index);
+          if (clusters.find(root) == clusters.end()) {
+            clusters[root] = ret.size();
+            ret.push_back(std::vector<triton::ast::AbstractNode*>());
+          }
+          ret[clusters[root]].push_back(conjuncts[index]);
+        }
+
+        return ret;
+      }
+
+
+      solverCacheKey SolverEngine::getCacheKey(const std::vector<triton::ast::AbstractNode*>& conjuncts) const {
+        std::vector<solverCacheKey> keys;
+        solverCacheKey key(0, 0);
+
+        for (auto conjunct : conjuncts)
+          keys.push_back(conjunct->getStructuralHash());
+
+        /* The same conjunction in another order is the same query */
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+        for (const auto& sub : keys) {
+          triton::ast::mixHash(key, sub.first);
+          triton::ast::mixHash(key, sub.second);
+        }
+
+        return key;
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::solveConjuncts(const std::vector<triton::ast::AbstractNode*>& conjuncts, triton::uint32 limit) const {
+        triton::ast::TritonToZ3Ast z3Ast{this->symbolicEngine, false, this->normalizationEnabled};
+        z3::solver solver(z3Ast.getContext());
+
+        for (auto conjunct : conjuncts)
+          solver.add(z3Ast.eval(*conjunct).getExpr());
+
+        return this->solve(solver, limit);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        std::vector<std::vector<triton::ast::AbstractNode*>> clusters;
+        std::vector<triton::ast::AbstractNode*> conjuncts;
+        std::map<triton::uint32, SolverModel> merged;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
+
+        /*
+         * Translate the Triton's AST directly into a Z3's AST. References are
+         * followed through the symbolic engine, so neither the full AST nor
+         * its SMT-LIB2 representation is ever built.
+         */
+        if (!this->cacheEnabled) {
+          triton::ast::TritonToZ3Ast z3Ast{this->symbolicEngine, false, this->normalizationEnabled};
+          triton::ast::Z3Result& result = z3Ast.eval(*node);
+          z3::solver solver(result.getContext());
+
+          solver.add(result.getExpr());
+
+          return this->solve(solver, limit);
+        }
+
+        /* A constant false conjunct, unsat */
+        if (!this->getConjuncts(node, conjuncts) || conjuncts.empty())
+          return ret;
+
+        /* Independent clusters are only solved on their own for a single model */
+        if (limit == 1)
+          clusters = this->getIndependentClusters(conjuncts);
+        else
+          clusters.push_back(conjuncts);
+
+        for (const auto& cluster : clusters) {
+          std::list<std::map<triton::uint32, SolverModel>> models;
+          solverCacheKey key = this->getCacheKey(cluster);
+
+          if (!this->cache.find(key, limit, models)) {
+            models = this->solveConjuncts(cluster, limit);
+            this->cache.insert(key, limit, models);
+          }
+
+          /* One unsat cluster makes the whole conjunction unsat */
+          if (models.empty())
+            return ret;
+
+          if (limit != 1)
+            return models;
+
+          merged.insert(models.front().begin(), models.front().end());
+        }
+
+        ret.push_back(merged);
+
+        return ret;
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModelsViaSmtLib(triton::ast::AbstractNode* node, triton::uint32 limit) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        std::ostringstream formula;
+        z3::context ctx;
+        triton::uint32 representationMode = 0;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModelsViaSmtLib(): node cannot be null.");
+
+        representationMode = node->getContext().getRepresentationMode();
+
+        /* Switch into the SMT mode */
+        node->getContext().setRepresentationMode(triton::ast::representations::SMT_REPRESENTATION);
+
+        /* First, set the QF_AUFBV flag  */
+        formula << "(set-logic QF_BV)";
+
+        /* Then, delcare all symbolic variables */
+        formula << this->symbolicEngine->getVariablesDeclaration();
+
+        /* And concat the user expression */
+        formula << this->symbolicEngine->getFullAst(node);
+
         /* Restore the representation mode */
-        triton::ast::representations::astRepresentation.setMode(representationMode);
+        node->getContext().setRepresentationMode(representationMode);
+
+        /* Create the context and AST */
+        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
+        z3::expr eq(ctx, ast);
+        z3::solver solver(ctx);
+
+        solver.add(eq);
+
+        return this->solve(solver, limit);
+      }
+
+
+      std::vector<SolverQueryResult> SolverEngine::getModelsBatch(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 limit, const solverQueryCallback& callback) const {
+        std::vector<SolverQueryResult> ret(nodes.size());
+        std::vector<std::thread> workers;
+        std::atomic<triton::usize> next(0);
+        std::exception_ptr error = nullptr;
+        std::mutex lock;
+
+        for (auto node : nodes) {
+          if (node == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getModelsBatch(): node cannot be null.");
+        }
+
+        /* Each worker picks the next pending query until the batch is exhausted */
+        auto worker = [&]() {
+          for (triton::usize index = next++; index < nodes.size(); index = next++) {
+            try {
+              auto start  = std::chrono::steady_clock::now();
+              auto models = this->getModels(nodes[index], limit);
+              auto time   = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+              std::lock_guard<std::mutex> guard(lock);
+              ret[index] = SolverQueryResult(index, models, time);
+              if (callback)
+                callback(ret[index]);
+            }
+            catch (...) {
+              std::lock_guard<std::mutex> guard(lock);
+              if (error == nullptr)
+                error = std::current_exception();
+              next = nodes.size();
+            }
+          }
+        };
+
+        triton::usize count = std::min<triton::usize>(this->numberOfThreads, nodes.size());
+        for (triton::usize i = 1; i < count; i++)
+          workers.push_back(std::thread(worker));
+
+        /* The calling thread works too */
+        worker();
+
+        for (auto& thread : workers)
+          thread.join();
+
+        if (error != nullptr)
+          std::rethrow_exception(error);
+
+        return ret;
+      }
+
+
+      std::vector<SolverQueryResult> SolverEngine::getModelsOfUntakenBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 limit, const solverQueryCallback& callback) const {
+        std::vector<SolverQueryResult> ret;
+        SolverSession session(this);
+
+        for (triton::usize index = 0; index < pathConstraints.size(); index++) {
+          for (const auto& branch : pathConstraints[index].getBranchConstraints()) {
+            /* Only untaken branches are interesting */
+            if (std::get<0>(branch))
+              continue;
+
+            auto start  = std::chrono::steady_clock::now();
+            auto models = session.getModels(std::get<3>(branch), limit);
+            auto time   = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+            ret.push_back(SolverQueryResult(index, models, time));
+            if (callback)
+              callback(ret.back());
+          }
+
+          /* The taken branch joins the prefix of the next path constraints */
+          session.addConstraint(pathConstraints[index].getTakenPathConstraintAst());
+        }
 
         return ret;
       }
 
 
+      void SolverEngine::enableCache(bool flag) {
+        this->cacheEnabled = flag;
+      }
+
+
+      bool SolverEngine::isCacheEnabled(void) const {
+        return this->cacheEnabled;
+      }
+
+
+      void SolverEngine::enableNormalization(bool flag) {
+        this->normalizationEnabled = flag;
+      }
+
+
+      bool SolverEngine::isNormalizationEnabled(void) const {
+        return this->normalizationEnabled;
+      }
+
+
+      void SolverEngine::setCachePath(const std::string& path) {
+        this->cache.setPath(path);
+      }
+
+
+      void SolverEngine::clearCache(void) {
+        this->cache.clear();
+      }
+
+
+      triton::usize SolverEngine::getCacheHits(void) const {
+        return this->cache.getHits();
+      }
+
+
+      triton::usize SolverEngine::getCacheMisses(void) const {
+        return this->cache.getMisses();
+      }
+
+
+      triton::uint32 SolverEngine::getNumberOfThreads(void) const {
+        return this->numberOfThreads;
+      }
+
+
+      void SolverEngine::setNumberOfThreads(triton::uint32 threads) {
+        if (threads == 0)
+          threads = std::thread::hardware_concurrency();
+        this->numberOfThreads = (threads ? threads : 1);
+      }
+
+
       std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode* node) const {
         std::map<triton::uint32, SolverModel> ret;
         std::list<std::map<triton::uint32, SolverModel>> allModels;
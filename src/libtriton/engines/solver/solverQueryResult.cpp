@@ -0,0 +1,71 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/solverQueryResult.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverQueryResult::SolverQueryResult() {
+        this->index = 0;
+        this->time  = 0;
+      }
+
+
+      SolverQueryResult::SolverQueryResult(triton::usize index, const std::list<std::map<triton::uint32, SolverModel>>& models, triton::uint64 time) {
+        this->index  = index;
+        this->models = models;
+        this->time   = time;
+      }
+
+
+      SolverQueryResult::SolverQueryResult(const SolverQueryResult& other) {
+        this->copy(other);
+      }
+
+
+      SolverQueryResult::~SolverQueryResult() {
+      }
+
+
+      void SolverQueryResult::copy(const SolverQueryResult& other) {
+        this->index  = other.index;
+        this->models = other.models;
+        this->time   = other.time;
+      }
+
+
+      triton::usize SolverQueryResult::getIndex(void) const {
+        return this->index;
+      }
+
+
+      const std::list<std::map<triton::uint32, SolverModel>>& SolverQueryResult::getModels(void) const {
+        return this->models;
+      }
+
+
+      triton::uint64 SolverQueryResult::getTime(void) const {
+        return this->time;
+      }
+
+
+      bool SolverQueryResult::isSat(void) const {
+        return !this->models.empty();
+      }
+
+
+      void SolverQueryResult::operator=(const SolverQueryResult& other) {
+        this->copy(other);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,96 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <triton/exceptions.hpp>
+#include <triton/solverSession.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverSession::SolverSession(const SolverEngine* engine)
+        : engine(engine),
+          translator(engine ? engine->symbolicEngine : nullptr, false, engine ? engine->normalizationEnabled : false),
+          solver(translator.getContext()) {
+        this->level = 0;
+        this->scopes.resize(1);
+      }
+
+
+      SolverSession::~SolverSession() {
+      }
+
+
+      void SolverSession::addConstraint(triton::ast::AbstractNode* node) {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::addConstraint(): node cannot be null.");
+
+        /* The same constraint built again, e.g. by each iteration of a loop */
+        if (this->engine->normalizationEnabled) {
+          if (!this->asserted.insert(node->getStructuralHash()).second)
+            return;
+          this->scopes.back().push_back(node->getStructuralHash());
+        }
+
+        this->solver.add(this->translator.eval(*node).getExpr());
+      }
+
+
+      void SolverSession::push(void) {
+        this->solver.push();
+        this->scopes.push_back(std::vector<triton::ast::hash128>());
+        this->level++;
+      }
+
+
+      void SolverSession::pop(void) {
+        if (this->level == 0)
+          throw triton::exceptions::SolverEngine("SolverSession::pop(): No scope to pop.");
+        this->solver.pop();
+        for (const auto& hash : this->scopes.back())
+          this->asserted.erase(hash);
+        this->scopes.pop_back();
+        this->level--;
+      }
+
+
+      triton::uint32 SolverSession::getLevel(void) const {
+        return this->level;
+      }
+
+
+      bool SolverSession::isSat(void) {
+        return (this->solver.check() == z3::sat);
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverSession::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverSession::getModels(): node cannot be null.");
+
+        /* The node and the models blocked by the enumeration only live in this scope */
+        this->push();
+        try {
+          this->solver.add(this->translator.eval(*node).getExpr());
+          ret = this->engine->solve(this->solver, limit);
+        }
+        catch (...) {
+          this->pop();
+          throw;
+        }
+        this->pop();
+
+        return ret;
+      }
+
+    };
+  };
+};
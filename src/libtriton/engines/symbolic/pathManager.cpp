@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <set>
+
 #include <triton/exceptions.hpp>
 #include <triton/pathManager.hpp>
 #include <triton/symbolicEnums.hpp>
@@ -15,10 +17,15 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
-      PathManager::PathManager(triton::modes::Modes* modes) {
+      PathManager::PathManager(triton::modes::Modes* modes, triton::ast::AstContext* astCtxt) {
         if (modes == nullptr)
           throw triton::exceptions::PathManager("PathManager::PathManager(): The modes API cannot be null.");
-        this->modes = modes;
+
+        if (astCtxt == nullptr)
+          throw triton::exceptions::PathManager("PathManager::PathManager(): The AST context API cannot be null.");
+
+        this->astCtxt = astCtxt;
+        this->modes   = modes;
       }
 
 
@@ -32,6 +39,7 @@ namespace triton {
 
 
       void PathManager::copy(const PathManager& other) {
+        this->astCtxt         = other.astCtxt;
         this->modes           = other.modes;
         this->pathConstraints = other.pathConstraints;
       }
@@ -47,16 +55,26 @@ namespace triton {
       triton::ast::AbstractNode* PathManager::getPathConstraintsAst(void) const {
         std::vector<triton::engines::symbolic::PathConstraint>::const_iterator it;
         triton::ast::AbstractNode* node = nullptr;
+        std::set<triton::ast::hash128> hashes;
 
         /* by default PC is T (top) */
-        node = triton::ast::equal(
-                 triton::ast::bvtrue(),
-                 triton::ast::bvtrue()
+        node = this->astCtxt->equal(
+                 this->astCtxt->bvtrue(),
+                 this->astCtxt->bvtrue()
                );
 
-        /* Then, we create a conjunction of pc */
+        /*
+         * Then, we create a conjunction of pc. A constraint without symbolic
+         * variable holds by construction and the same constraint taken again
+         * (e.g. by each iteration of a loop) is only added once.
+         */
         for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
-          node = triton::ast::land(node, it->getTakenPathConstraintAst());
+          triton::ast::AbstractNode* pc = it->getTakenPathConstraintAst();
+          if (!pc->isSymbolized() && pc->evaluate() != 0)
+            continue;
+          if (!hashes.insert(pc->getStructuralHash()).second)
+            continue;
+          node = this->astCtxt->land(node, pc);
         }
 
         return node;
@@ -104,11 +122,11 @@ namespace triton {
           triton::uint64 bb1 = pc->getChilds()[1]->evaluate().convert_to<triton::uint64>();
           triton::uint64 bb2 = pc->getChilds()[2]->evaluate().convert_to<triton::uint64>();
 
-          triton::ast::AbstractNode* bb1pc = (bb1 == dstAddr) ? triton::ast::equal(pc, triton::ast::bv(dstAddr, size)) :
-                                                                triton::ast::lnot(triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
+          triton::ast::AbstractNode* bb1pc = (bb1 == dstAddr) ? this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size)) :
+                                                                this->astCtxt->lnot(this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size)));
 
-          triton::ast::AbstractNode* bb2pc = (bb2 == dstAddr) ? triton::ast::equal(pc, triton::ast::bv(dstAddr, size)) :
-                                                                triton::ast::lnot(triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
+          triton::ast::AbstractNode* bb2pc = (bb2 == dstAddr) ? this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size)) :
+                                                                this->astCtxt->lnot(this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size)));
 
           pco.addBranchConstraint(bb1 == dstAddr, srcAddr, bb1, bb1pc);
           pco.addBranchConstraint(bb2 == dstAddr, srcAddr, bb2, bb2pc);
@@ -118,7 +136,7 @@ namespace triton {
 
         /* Direct branch */
         else {
-          pco.addBranchConstraint(true, srcAddr, dstAddr, triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
+          pco.addBranchConstraint(true, srcAddr, dstAddr, this->astCtxt->equal(pc, this->astCtxt->bv(dstAddr, size)));
           this->pathConstraints.push_back(pco);
         }
 
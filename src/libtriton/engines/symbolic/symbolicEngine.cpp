@@ -72,11 +72,12 @@ namespace triton {
 
       SymbolicEngine::SymbolicEngine(triton::arch::Architecture* architecture,
                                      triton::modes::Modes* modes,
+                                     triton::ast::AstContext* astCtxt,
                                      triton::callbacks::Callbacks* callbacks,
                                      bool isBackup)
 
         : triton::engines::symbolic::SymbolicSimplification(callbacks),
-          triton::engines::symbolic::PathManager(modes) {
+          triton::engines::symbolic::PathManager(modes, astCtxt) {
 
         if (architecture == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::SymbolicEngine(): The architecture pointer must be valid.");
@@ -92,12 +93,13 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
-        this->callbacks       = callbacks;
-        this->backupFlag      = isBackup;
-        this->enableFlag      = true;
-        this->modes           = modes;
-        this->uniqueSymExprId = 0;
-        this->uniqueSymVarId  = 0;
+        this->callbacks               = callbacks;
+        this->backupFlag              = isBackup;
+        this->enableFlag              = true;
+        this->journalOpened           = false;
+        this->modes                   = modes;
+        this->uniqueSymExprId         = 0;
+        this->uniqueSymVarId          = 0;
       }
 
 
@@ -117,12 +119,24 @@ namespace triton {
         this->backupFlag                  = true;
         this->callbacks                   = other.callbacks;
         this->enableFlag                  = other.enableFlag;
+        this->journalOpened               = false;
+        this->lazyFlags                   = other.lazyFlags;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicVariables           = other.symbolicVariables;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+
+        /* The checkpoints are not copied */
+        this->checkpoints.clear();
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+        this->journalAlignedMemory.clear();
+        this->journalRemovedExpressions.clear();
+        this->journalPathConstraints.clear();
+        this->journalAsts.clear();
+        this->journalAttributes.clear();
       }
 
 
@@ -151,6 +165,9 @@ namespace triton {
             delete this->symbolicVariables[it2->first];
         }
 
+        if (this->backupFlag == false)
+          this->deleteRemovedExpressions();
+
         delete[] this->symbolicReg;
         this->copy(other);
       }
@@ -174,6 +191,9 @@ namespace triton {
           /* Delete all symbolic variables */
           for (; it2 != this->symbolicVariables.end(); ++it2)
             delete it2->second;
+
+          /* Delete the expressions kept for the checkpoints */
+          this->deleteRemovedExpressions();
         }
 
         /* Delete all symbolic register */
@@ -187,19 +207,21 @@ namespace triton {
        * processing.
        */
       void SymbolicEngine::concretizeRegister(const triton::arch::Register& reg) {
-        triton::uint32 parentId = reg.getParent().getId();
+        triton::uint32 parentId = reg.getParentId();
 
         if (!this->architecture->isRegisterValid(parentId))
           return;
 
-        this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
+        this->setRegisterReference(parentId, triton::engines::symbolic::UNSET);
+        this->lazyFlags.erase(parentId);
       }
 
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
-          this->symbolicReg[i] = triton::engines::symbolic::UNSET;
+          this->setRegisterReference(i, triton::engines::symbolic::UNSET);
+        this->lazyFlags.clear();
       }
 
 
@@ -223,7 +245,7 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
-        this->memoryReference.erase(addr);
+        this->eraseMemoryReference(addr);
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->removeAlignedMemory(addr, BYTE_SIZE);
       }
@@ -231,6 +253,13 @@ namespace triton {
 
       /* Same as concretizeMemory but with all address memory */
       void SymbolicEngine::concretizeAllMemory(void) {
+        if (!this->checkpoints.empty()) {
+          for (auto it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
+            this->journalMemory.push_back(*it);
+          for (auto it = this->alignedMemoryReference.begin(); it != this->alignedMemoryReference.end(); it++)
+            this->journalAlignedMemory.push_back(*it);
+        }
+
         this->memoryReference.clear();
         this->alignedMemoryReference.clear();
       }
@@ -255,37 +284,112 @@ namespace triton {
       /* Adds an aligned memory */
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
         this->removeAlignedMemory(address, size);
+
+        if (!this->checkpoints.empty())
+          this->journalAlignedMemory.push_back(std::make_pair(std::make_pair(address, size), nullptr));
+
         this->alignedMemoryReference[std::make_pair(address, size)] = node;
       }
 
 
+      /* Removes an aligned entry and journals it */
+      void SymbolicEngine::eraseAlignedMemory(triton::uint64 address, triton::uint32 size) {
+        auto it = this->alignedMemoryReference.find(std::make_pair(address, size));
+
+        if (it == this->alignedMemoryReference.end())
+          return;
+
+        if (!this->checkpoints.empty())
+          this->journalAlignedMemory.push_back(*it);
+
+        this->alignedMemoryReference.erase(it);
+      }
+
+
+      /* Removes a memory reference and journals it */
+      void SymbolicEngine::eraseMemoryReference(triton::uint64 address) {
+        auto it = this->memoryReference.find(address);
+
+        if (it == this->memoryReference.end())
+          return;
+
+        if (!this->checkpoints.empty())
+          this->journalMemory.push_back(*it);
+
+        this->memoryReference.erase(it);
+      }
+
+
+      /* Assigns a register reference and journals it */
+      void SymbolicEngine::setRegisterReference(triton::uint32 id, triton::usize symExprId) {
+        if (!this->checkpoints.empty() && this->symbolicReg[id] != symExprId)
+          this->journalRegisters.push_back(std::make_pair(id, this->symbolicReg[id]));
+
+        this->symbolicReg[id] = symExprId;
+      }
+
+
+      /* Replaces the AST of an expression and journals the previous one */
+      void SymbolicEngine::setExpressionAst(SymbolicExpression* se, triton::ast::AbstractNode* node) {
+        if (!this->checkpoints.empty() && se->getId() < this->checkpoints.back().symExprId)
+          this->journalAsts.push_back(std::make_pair(se, se->getAst()));
+
+        se->setAst(node);
+      }
+
+
+      /* Journals the taint, the kind and the origin of an expression */
+      void SymbolicEngine::journalExpressionAttributes(SymbolicExpression* se) {
+        if (this->checkpoints.empty() || se->getId() >= this->checkpoints.back().symExprId)
+          return;
+
+        SymbolicAttributes attributes;
+        attributes.expr           = se;
+        attributes.isTainted      = se->isTainted;
+        attributes.kind           = se->getKind();
+        attributes.originMemory   = se->getOriginMemory();
+        attributes.originRegister = se->getOriginRegister();
+
+        this->journalAttributes.push_back(attributes);
+      }
+
+
+      /* Sets the taint of an expression and journals the previous one */
+      void SymbolicEngine::setExpressionTaint(SymbolicExpression* se, bool flag) {
+        if (se->isTainted != flag)
+          this->journalExpressionAttributes(se);
+
+        se->isTainted = flag;
+      }
+
+
       /* Removes an aligned memory */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
         /* Remove overloaded positive ranges */
         for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, WORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQQWORD_SIZE));
+          this->eraseAlignedMemory(address+index, BYTE_SIZE);
+          this->eraseAlignedMemory(address+index, WORD_SIZE);
+          this->eraseAlignedMemory(address+index, DWORD_SIZE);
+          this->eraseAlignedMemory(address+index, QWORD_SIZE);
+          this->eraseAlignedMemory(address+index, DQWORD_SIZE);
+          this->eraseAlignedMemory(address+index, QQWORD_SIZE);
+          this->eraseAlignedMemory(address+index, DQQWORD_SIZE);
         }
 
         /* Remove overloaded negative ranges */
         for (triton::uint32 index = 1; index < DQQWORD_SIZE; index++) {
           if (index < WORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, WORD_SIZE));
+            this->eraseAlignedMemory(address-index, WORD_SIZE);
           if (index < DWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DWORD_SIZE));
+            this->eraseAlignedMemory(address-index, DWORD_SIZE);
           if (index < QWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QWORD_SIZE));
+            this->eraseAlignedMemory(address-index, QWORD_SIZE);
           if (index < DQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQWORD_SIZE));
+            this->eraseAlignedMemory(address-index, DQWORD_SIZE);
           if (index < QQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QQWORD_SIZE));
+            this->eraseAlignedMemory(address-index, QQWORD_SIZE);
           if (index < DQQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQQWORD_SIZE));
+            this->eraseAlignedMemory(address-index, DQQWORD_SIZE);
         }
       }
 
@@ -301,6 +405,11 @@ namespace triton {
       }
 
 
+      triton::ast::AstContext& SymbolicEngine::getAstContext(void) const {
+        return *this->astCtxt;
+      }
+
+
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromId(triton::usize symVarId) const {
         if (this->symbolicVariables.find(symVarId) == this->symbolicVariables.end())
@@ -329,12 +438,16 @@ namespace triton {
 
 
       /* Returns the reg reference or UNSET */
-      triton::usize SymbolicEngine::getSymbolicRegisterId(const triton::arch::Register& reg) const {
-        triton::uint32 parentId = reg.getParent().getId();
+      triton::usize SymbolicEngine::getSymbolicRegisterId(const triton::arch::Register& reg) {
+        triton::uint32 parentId = reg.getParentId();
 
         if (!this->architecture->isRegisterValid(parentId))
           return triton::engines::symbolic::UNSET;
 
+        /* A pending flag is built when it is read */
+        if (!this->lazyFlags.empty())
+          this->buildLazyFlag(parentId, nullptr);
+
         return this->symbolicReg[parentId];
       }
 
@@ -402,27 +515,42 @@ namespace triton {
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
         std::map<triton::uint64, triton::usize>::iterator it;
-
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
-          /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
-          this->symbolicExpressions.erase(symExprId);
+        auto expr = this->symbolicExpressions.find(symExprId);
+
+        if (expr != this->symbolicExpressions.end()) {
+          /* An expression older than the last checkpoint is kept, a restore brings it back */
+          if (!this->checkpoints.empty() && symExprId < this->checkpoints.back().symExprId)
+            this->journalRemovedExpressions.push_back(expr->second);
+          else
+            delete expr->second;
+
+          /* Remove the pointer */
+          this->symbolicExpressions.erase(expr);
+
+          /* The pending flags computed from this expression are concretized */
+          for (auto flag = this->lazyFlags.begin(); flag != this->lazyFlags.end();) {
+            if (flag->second.parent == symExprId)
+              flag = this->lazyFlags.erase(flag);
+            else
+              flag++;
+          }
 
           /* Concretize the register if it exists */
           for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
             if (this->symbolicReg[i] == symExprId) {
-              this->symbolicReg[i] = triton::engines::symbolic::UNSET;
+              this->setRegisterReference(i, triton::engines::symbolic::UNSET);
               return;
             }
           }
 
-          /* Concretize the memory if it exists */
+          /* Concretize the memory if it exists, a memory range may cover several cells */
+          std::list<triton::uint64> cells;
           for (it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
-            }
+            if (it->second == symExprId)
+              cells.push_back(it->first);
           }
+          for (auto cell = cells.begin(); cell != cells.end(); cell++)
+            this->concretizeMemory(*cell);
         }
 
       }
@@ -520,20 +648,23 @@ namespace triton {
         std::stringstream stream;
 
         for(it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
-          stream << triton::ast::declareFunction(it->second->getName(), triton::ast::bvdecl(it->second->getSize()));
+          stream << this->astCtxt->declareFunction(it->second->getName(), this->astCtxt->bvdecl(it->second->getSize()));
 
         return stream.str();
       }
 
 
       /* Returns the map of symbolic registers defined */
-      std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) const {
+      std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) {
         std::map<triton::arch::Register, SymbolicExpression*> ret;
 
+        /* Build the pending flags */
+        while (!this->lazyFlags.empty())
+          this->buildLazyFlag(this->lazyFlags.begin()->first, nullptr);
+
         for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
           if (this->symbolicReg[it] != triton::engines::symbolic::UNSET) {
-            triton::arch::Register reg(it);
-            ret[reg] = this->getSymbolicExpressionFromId(this->symbolicReg[it]);
+            ret[this->architecture->getRegister(it)] = this->getSymbolicExpressionFromId(this->symbolicReg[it]);
           }
         }
 
@@ -569,10 +700,8 @@ namespace triton {
         if (expression->getAst())
             symVar->setConcreteValue(expression->getAst()->evaluate());
 
-        tmp = triton::ast::variable(*symVar);
-        tmp->setParent(expression->getAst()->getParents());
-        expression->setAst(tmp);
-        tmp->init();
+        tmp = this->astCtxt->variable(*symVar);
+        this->setExpressionAst(expression, tmp);
 
         return symVar;
       }
@@ -595,13 +724,38 @@ namespace triton {
         /* Setup the concrete value to the symbolic variable */
         symVar->setConcreteValue(cv);
         /* Create the AST node */
-        triton::ast::AbstractNode* symVarNode = triton::ast::variable(*symVar);
+        triton::ast::AbstractNode* symVarNode = this->astCtxt->variable(*symVar);
+
+        /* Symbolic optimization, the variable is kept as a single range */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_RANGES)) {
+          /* The store is converted in place only if the access matches its whole range */
+          if (memSymId != triton::engines::symbolic::UNSET) {
+            se = this->getSymbolicExpressionFromId(memSymId);
+            if (se->getOriginMemory().getAddress() != memAddr || se->getOriginMemory().getSize() != symVarSize)
+              se = nullptr;
+          }
+
+          if (se == nullptr) {
+            se = this->newSymbolicExpression(symVarNode, triton::engines::symbolic::MEM, "Memory reference");
+          }
+          else {
+            this->setExpressionAst(se, symVarNode);
+          }
+
+          this->journalExpressionAttributes(se);
+          se->setOriginMemory(triton::arch::MemoryAccess(memAddr, symVarSize, cv));
+          this->addMemoryRange(memAddr, symVarSize, se->getId());
+          if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
+            removeAlignedMemory(memAddr, symVarSize);
+
+          return symVar;
+        }
 
         /*  Split expression in bytes */
         for (triton::sint32 index = symVarSize-1; index >= 0; index--) {
 
           /* Isolate the good part of the symbolic variable */
-          tmp = triton::ast::extract(((BYTE_SIZE_BIT * (index+1)) - 1), ((BYTE_SIZE_BIT * (index+1)) - BYTE_SIZE_BIT), symVarNode);
+          tmp = this->astCtxt->extract(((BYTE_SIZE_BIT * (index+1)) - 1), ((BYTE_SIZE_BIT * (index+1)) - BYTE_SIZE_BIT), symVarNode);
 
           /* Check if the memory address is already defined */
           memSymId = this->getSymbolicMemoryId(memAddr+index);
@@ -611,9 +765,8 @@ namespace triton {
           }
           else {
             se = this->getSymbolicExpressionFromId(memSymId);
-            tmp->setParent(se->getAst()->getParents());
-            se->setAst(tmp);
-            tmp->init();
+            this->setExpressionAst(se, tmp);
+            this->journalExpressionAttributes(se);
             se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
           }
 
@@ -631,7 +784,7 @@ namespace triton {
         SymbolicVariable* symVar        = nullptr;
         SymbolicExpression* expression  = nullptr;
         triton::usize regSymId          = triton::engines::symbolic::UNSET;
-        triton::uint32 parentId         = reg.getParent().getId();
+        triton::uint32 parentId         = reg.getParentId();
         triton::uint32 symVarSize       = reg.getBitSize();
         triton::uint512 cv              = !reg.isImmutable() && reg.hasConcreteValue() ? reg.getConcreteValue() : this->architecture->getConcreteRegisterValue(reg);
 
@@ -645,11 +798,11 @@ namespace triton {
           /* Setup the concrete value to the symbolic variable */
           symVar->setConcreteValue(cv);
           /* Create the AST node */
-          triton::ast::AbstractNode* tmp = triton::ast::variable(*symVar);
+          triton::ast::AbstractNode* tmp = this->astCtxt->variable(*symVar);
           /* Create the symbolic expression */
           SymbolicExpression* se = this->newSymbolicExpression(tmp, triton::engines::symbolic::REG);
           se->setOriginRegister(reg);
-          this->symbolicReg[parentId] = se->getId();
+          this->setRegisterReference(parentId, se->getId());
         }
 
         else {
@@ -660,11 +813,9 @@ namespace triton {
           /* Setup the concrete value to the symbolic variable */
           symVar->setConcreteValue(cv);
           /* Create the AST node */
-          triton::ast::AbstractNode* tmp = triton::ast::variable(*symVar);
+          triton::ast::AbstractNode* tmp = this->astCtxt->variable(*symVar);
           /* Set the AST node */
-          tmp->setParent(expression->getAst()->getParents());
-          expression->setAst(tmp);
-          tmp->init();
+          this->setExpressionAst(expression, tmp);
         }
 
         return symVar;
@@ -674,7 +825,7 @@ namespace triton {
       /* Adds a new symbolic variable */
       SymbolicVariable* SymbolicEngine::newSymbolicVariable(triton::engines::symbolic::symkind_e kind, triton::uint64 kindValue, triton::uint32 size, const std::string& comment) {
         triton::usize uniqueId = this->getUniqueSymVarId();
-        SymbolicVariable* symVar = new(std::nothrow) SymbolicVariable(kind, kindValue, uniqueId, size, comment);
+        SymbolicVariable* symVar = new(std::nothrow) SymbolicVariable(this->astCtxt, kind, kindValue, uniqueId, size, comment);
 
         if (symVar == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
@@ -710,7 +861,7 @@ namespace triton {
 
       /* Returns a symbolic immediate */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
-        triton::ast::AbstractNode* node = triton::ast::bv(imm.getValue(), imm.getBitSize());
+        triton::ast::AbstractNode* node = this->astCtxt->bv(imm.getValue(), imm.getBitSize());
         return node;
       }
 
@@ -743,18 +894,22 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
           return this->getAlignedMemory(address, size);
 
+        /* Symbolic optimization, the stores are kept as ranges */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_RANGES))
+          return this->buildSymbolicMemoryRanges(address, size, concreteValue);
+
         /* Iterate on every memory cells to use their symbolic or concrete values */
         while (size) {
           symMem = this->getSymbolicMemoryId(address + size - 1);
           /* Check if the memory cell is already symbolic */
           if (symMem != triton::engines::symbolic::UNSET) {
-            tmp = triton::ast::reference(symMem);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            tmp = this->astCtxt->reference(symMem);
+            opVec.push_back(this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, tmp));
           }
           /* Otherwise, use the concerte value */
           else {
-            tmp = triton::ast::bv(concreteValue[size - 1], BYTE_SIZE_BIT);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            tmp = this->astCtxt->bv(concreteValue[size - 1], BYTE_SIZE_BIT);
+            opVec.push_back(this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, tmp));
           }
           size--;
         }
@@ -767,7 +922,7 @@ namespace triton {
           case QWORD_SIZE:
           case DWORD_SIZE:
           case WORD_SIZE:
-            tmp = triton::ast::concat(opVec);
+            tmp = this->astCtxt->concat(opVec);
             break;
           case BYTE_SIZE:
             tmp = opVec.front();
@@ -778,6 +933,55 @@ namespace triton {
       }
 
 
+      /*
+       * Returns a symbolic memory built from the memory ranges. The bytes are
+       * grouped while they come from the same store (or are all concrete), so a
+       * load matching a previous store returns a reference to its expression
+       * and a store is only split when the load overlaps several ranges.
+       */
+      triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemoryRanges(triton::uint64 address, triton::uint32 size, const triton::uint8* concreteValue) {
+        std::list<triton::ast::AbstractNode*> opVec;
+        triton::uint32 high = size;
+
+        /* Iterate from the most significant byte, bytes [low, high) are grouped */
+        while (high) {
+          triton::usize symMem = this->getSymbolicMemoryId(address + high - 1);
+          triton::uint32 low   = high - 1;
+
+          while (low && this->getSymbolicMemoryId(address + low - 1) == symMem)
+            low--;
+
+          /* Concrete bytes */
+          if (symMem == triton::engines::symbolic::UNSET) {
+            triton::uint512 value = 0;
+            for (triton::uint32 index = high; index > low; index--)
+              value = (value << BYTE_SIZE_BIT) | concreteValue[index - 1];
+            opVec.push_back(this->astCtxt->bv(value, (high - low) * BYTE_SIZE_BIT));
+          }
+
+          /* Bytes of a store, the origin memory of the expression gives its range */
+          else {
+            const triton::arch::MemoryAccess& range = this->getSymbolicExpressionFromId(symMem)->getOriginMemory();
+            triton::uint32 lowBit                   = static_cast<triton::uint32>((address + low) - range.getAddress()) * BYTE_SIZE_BIT;
+            triton::uint32 highBit                  = static_cast<triton::uint32>((address + high) - range.getAddress()) * BYTE_SIZE_BIT - 1;
+            triton::ast::AbstractNode* ref          = this->astCtxt->reference(symMem);
+
+            if (lowBit == 0 && highBit + 1 == ref->getBitvectorSize())
+              opVec.push_back(ref);
+            else
+              opVec.push_back(this->astCtxt->extract(highBit, lowBit, ref));
+          }
+
+          high = low;
+        }
+
+        if (opVec.size() == 1)
+          return opVec.front();
+
+        return this->astCtxt->concat(opVec);
+      }
+
+
       /* Returns a symbolic memory and defines the memory as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
         triton::ast::AbstractNode* node = this->buildSymbolicMemory(mem);
@@ -797,11 +1001,11 @@ namespace triton {
 
         /* Check if the register is already symbolic */
         if (symReg != triton::engines::symbolic::UNSET)
-          op = triton::ast::extract(high, low, triton::ast::reference(symReg));
+          op = this->astCtxt->extract(high, low, this->astCtxt->reference(symReg));
 
         /* Otherwise, use the concerte value */
         else
-          op = triton::ast::bv(this->architecture->getConcreteRegisterValue(reg), bvSize);
+          op = this->astCtxt->bv(this->architecture->getConcreteRegisterValue(reg), bvSize);
 
         return op;
       }
@@ -809,6 +1013,10 @@ namespace triton {
 
       /* Returns a symbolic register and defines the register as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+        /* A pending flag read by an instruction belongs to this instruction */
+        if (!this->lazyFlags.empty())
+          this->buildLazyFlag(reg.getParentId(), &inst);
+
         triton::ast::AbstractNode* node = this->buildSymbolicRegister(reg);
         reg.setConcreteValue(node->evaluate());
         inst.setReadRegister(reg, node);
@@ -841,13 +1049,28 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
+        /* Symbolic optimization, the whole store is kept as a single range */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_RANGES)) {
+          se = this->newSymbolicExpression(node, triton::engines::symbolic::MEM, "Memory reference - " + comment);
+          se->setOriginMemory(triton::arch::MemoryAccess(address, writeSize, node->evaluate()));
+          inst.addSymbolicExpression(se);
+          this->addMemoryRange(address, writeSize, se->getId());
+          /* Synchronize the memory operand */
+          mem.setConcreteValue(node->evaluate());
+          /* Synchronize the concrete state */
+          this->architecture->setConcreteMemoryValue(mem);
+          /* Define the memory store */
+          inst.setStoreAccess(mem, node);
+          return se;
+        }
+
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
          * memory must be assigned to an unique reference.
          */
         while (writeSize) {
           /* Extract each byte of the memory */
-          tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
+          tmp = this->astCtxt->extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
           se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
           se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
           ret.push_back(tmp);
@@ -870,7 +1093,7 @@ namespace triton {
         }
 
         /* Otherwise, we return the concatenation of all symbolic expressions */
-        tmp = triton::ast::concat(ret);
+        tmp = this->astCtxt->concat(ret);
 
         /* Synchronize the memory operand */
         mem.setConcreteValue(tmp->evaluate());
@@ -889,11 +1112,11 @@ namespace triton {
 
 
       /* Returns the new symbolic register expression */
-      SymbolicExpression* SymbolicEngine::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment) {
+      SymbolicExpression* SymbolicEngine::createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment) {
         triton::ast::AbstractNode* finalExpr      = nullptr;
         triton::ast::AbstractNode* origReg        = nullptr;
         triton::uint32 regSize                    = reg.getSize();
-        triton::arch::Register parentReg          = reg.getParent();
+        triton::arch::Register parentReg          = this->architecture->getParentRegister(reg);
 
         if (this->architecture->isFlag(reg))
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicRegisterExpression(): The register cannot be a flag.");
@@ -904,24 +1127,24 @@ namespace triton {
         switch (regSize) {
           case BYTE_SIZE:
             if (reg.getLow() == 0) {
-              finalExpr = triton::ast::concat(triton::ast::extract((this->architecture->registerBitSize() - 1), BYTE_SIZE_BIT, origReg), node);
+              finalExpr = this->astCtxt->concat(this->astCtxt->extract((this->architecture->registerBitSize() - 1), BYTE_SIZE_BIT, origReg), node);
             }
             else {
-              finalExpr = triton::ast::concat(
-                            triton::ast::extract((this->architecture->registerBitSize() - 1), WORD_SIZE_BIT, origReg),
-                            triton::ast::concat(node, triton::ast::extract((BYTE_SIZE_BIT - 1), 0, origReg))
+              finalExpr = this->astCtxt->concat(
+                            this->astCtxt->extract((this->architecture->registerBitSize() - 1), WORD_SIZE_BIT, origReg),
+                            this->astCtxt->concat(node, this->astCtxt->extract((BYTE_SIZE_BIT - 1), 0, origReg))
                           );
             }
             break;
 
           case WORD_SIZE:
-            finalExpr = triton::ast::concat(triton::ast::extract((this->architecture->registerBitSize() - 1), WORD_SIZE_BIT, origReg), node);
+            finalExpr = this->astCtxt->concat(this->astCtxt->extract((this->architecture->registerBitSize() - 1), WORD_SIZE_BIT, origReg), node);
             break;
 
           case DWORD_SIZE:
             /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register (Thx Wisk!) */
             if (this->architecture->getArchitecture() == triton::arch::ARCH_X86_64) {
-              finalExpr = triton::ast::zx(DWORD_SIZE_BIT, node);
+              finalExpr = this->astCtxt->zx(DWORD_SIZE_BIT, node);
               break;
             }
 
@@ -929,31 +1152,34 @@ namespace triton {
           case DQWORD_SIZE:
           case QQWORD_SIZE:
           case DQQWORD_SIZE:
-            finalExpr = triton::ast::zx(parentReg.getBitSize() - node->getBitvectorSize(), node);
+            finalExpr = this->astCtxt->zx(parentReg.getBitSize() - node->getBitvectorSize(), node);
             break;
         }
 
-        reg.setConcreteValue(node->evaluate());
+        /* The register given may be the one of the CPU, the written one is a copy */
+        triton::arch::Register written = reg;
+        written.setConcreteValue(node->evaluate());
         parentReg.setConcreteValue(finalExpr->evaluate());
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(finalExpr, triton::engines::symbolic::REG, comment);
         this->assignSymbolicExpressionToRegister(se, parentReg);
         inst.addSymbolicExpression(se);
-        inst.setWrittenRegister(reg, node);
+        inst.setWrittenRegister(written, node);
 
         return se;
       }
 
 
       /* Returns the new symbolic flag expression */
-      SymbolicExpression* SymbolicEngine::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment) {
+      SymbolicExpression* SymbolicEngine::createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment) {
         if (!this->architecture->isFlag(flag))
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicFlagExpression(): The register must be a flag.");
 
-        flag.setConcreteValue(node->evaluate());
+        triton::arch::Register written = flag;
+        written.setConcreteValue(node->evaluate());
         triton::engines::symbolic::SymbolicExpression *se = this->newSymbolicExpression(node, triton::engines::symbolic::REG, comment);
-        this->assignSymbolicExpressionToRegister(se, flag);
+        this->assignSymbolicExpressionToRegister(se, written);
         inst.addSymbolicExpression(se);
-        inst.setWrittenRegister(flag, node);
+        inst.setWrittenRegister(written, node);
 
         return se;
       }
@@ -969,14 +1195,24 @@ namespace triton {
 
       /* Adds and assign a new memory reference */
       void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id) {
+        if (!this->checkpoints.empty())
+          this->journalMemory.push_back(std::make_pair(mem, this->getSymbolicMemoryId(mem)));
+
         this->memoryReference[mem] = id;
       }
 
 
+      /* Adds the memory references of a whole range */
+      void SymbolicEngine::addMemoryRange(triton::uint64 address, triton::uint32 size, triton::usize id) {
+        for (triton::uint32 index = 0; index < size; index++)
+          this->addMemoryReference(address + index, id);
+      }
+
+
       /* Assigns a symbolic expression to a register */
       void SymbolicEngine::assignSymbolicExpressionToRegister(SymbolicExpression *se, const triton::arch::Register& reg) {
         triton::ast::AbstractNode* node = se->getAst();
-        triton::arch::Register parent   = reg.getParent();
+        triton::arch::Register parent   = this->architecture->getParentRegister(reg);
         triton::uint32 id               = parent.getId();
 
         /* We can assign an expression only on parent registers */
@@ -987,9 +1223,12 @@ namespace triton {
         if (node->getBitvectorSize() != reg.getBitSize())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::assignSymbolicExpressionToRegister(): The size of the symbolic expression is not equal to the target register.");
 
+        this->journalExpressionAttributes(se);
         se->setKind(triton::engines::symbolic::REG);
         se->setOriginRegister(reg);
-        this->symbolicReg[id] = se->getId();
+
+        this->setRegisterReference(id, se->getId());
+        this->lazyFlags.erase(id);
 
         /* Synchronize the concrete state */
         this->architecture->setConcreteRegisterValue(reg);
@@ -1010,13 +1249,25 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
+        /* Symbolic optimization, the whole store is kept as a single range */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_RANGES)) {
+          /* An expression already assigned to another range is referenced */
+          if (se->getKind() == triton::engines::symbolic::MEM && (se->getOriginMemory().getAddress() != address || se->getOriginMemory().getSize() != writeSize))
+            se = this->newSymbolicExpression(this->astCtxt->reference(se->getId()), triton::engines::symbolic::MEM, "Memory reference");
+          this->journalExpressionAttributes(se);
+          se->setKind(triton::engines::symbolic::MEM);
+          se->setOriginMemory(triton::arch::MemoryAccess(address, writeSize, node->evaluate()));
+          this->addMemoryRange(address, writeSize, se->getId());
+          return;
+        }
+
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
          * memory must be assigned to an unique reference.
          */
         while (writeSize) {
           /* Extract each byte of the memory */
-          triton::ast::AbstractNode* tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
+          triton::ast::AbstractNode* tmp = this->astCtxt->extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
           SymbolicExpression* byteRef = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
           byteRef->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
           /* Assign memory with little endian */
@@ -1068,8 +1319,20 @@ namespace triton {
 
       /* Returns true if the register expression contains a symbolic variable. */
       bool SymbolicEngine::isRegisterSymbolized(const triton::arch::Register& reg) const {
-        triton::usize symId = this->getSymbolicRegisterId(reg);
+        triton::uint32 parentId = reg.getParentId();
 
+        if (!this->architecture->isRegisterValid(parentId))
+          return false;
+
+        /* A pending flag is symbolized if the expression it is computed from is symbolized */
+        auto flag = this->lazyFlags.find(parentId);
+        if (flag != this->lazyFlags.end()) {
+          if (flag->second.parent == triton::engines::symbolic::UNSET)
+            return false;
+          return this->getSymbolicExpressionFromId(flag->second.parent)->isSymbolized();
+        }
+
+        triton::usize symId = this->symbolicReg[parentId];
         if (symId == triton::engines::symbolic::UNSET)
           return false;
 
@@ -1078,6 +1341,246 @@ namespace triton {
       }
 
 
+      /* Adds a checkpoint */
+      triton::usize SymbolicEngine::newCheckpoint(void) {
+        SymbolicCheckpoint checkpoint;
+
+        checkpoint.symExprId              = this->uniqueSymExprId;
+        checkpoint.symVarId               = this->uniqueSymVarId;
+        checkpoint.pathConstraints        = this->pathConstraints.size();
+        checkpoint.registers              = this->journalRegisters.size();
+        checkpoint.memory                 = this->journalMemory.size();
+        checkpoint.alignedMemory          = this->journalAlignedMemory.size();
+        checkpoint.removedExpressions     = this->journalRemovedExpressions.size();
+        checkpoint.clearedPathConstraints = this->journalPathConstraints.size();
+        checkpoint.asts                   = this->journalAsts.size();
+        checkpoint.attributes             = this->journalAttributes.size();
+        checkpoint.lazyFlags              = this->lazyFlags;
+
+        this->checkpoints.push_back(checkpoint);
+
+        return this->checkpoints.size() - 1;
+      }
+
+
+      /* Undoes all changes made since a checkpoint */
+      void SymbolicEngine::restoreCheckpoint(triton::usize index) {
+        if (index >= this->checkpoints.size())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::restoreCheckpoint(): Invalid checkpoint.");
+
+        const SymbolicCheckpoint& checkpoint = this->checkpoints[index];
+
+        /* Restore the references, the last change first */
+        for (triton::usize i = this->journalRegisters.size(); i > checkpoint.registers; i--)
+          this->symbolicReg[this->journalRegisters[i-1].first] = this->journalRegisters[i-1].second;
+        this->journalRegisters.resize(checkpoint.registers);
+
+        for (triton::usize i = this->journalMemory.size(); i > checkpoint.memory; i--) {
+          const auto& entry = this->journalMemory[i-1];
+          if (entry.second == triton::engines::symbolic::UNSET)
+            this->memoryReference.erase(entry.first);
+          else
+            this->memoryReference[entry.first] = entry.second;
+        }
+        this->journalMemory.resize(checkpoint.memory);
+
+        for (triton::usize i = this->journalAlignedMemory.size(); i > checkpoint.alignedMemory; i--) {
+          const auto& entry = this->journalAlignedMemory[i-1];
+          if (entry.second == nullptr)
+            this->alignedMemoryReference.erase(entry.first);
+          else
+            this->alignedMemoryReference[entry.first] = entry.second;
+        }
+        this->journalAlignedMemory.resize(checkpoint.alignedMemory);
+
+        /*
+         * The expressions converted since the checkpoint get their AST back. The nodes
+         * created since the checkpoint are already freed, so the old ASTs are set first
+         * and then initialized to update their parents.
+         */
+        for (triton::usize i = this->journalAsts.size(); i > checkpoint.asts; i--) {
+          SymbolicExpression* expr = this->journalAsts[i-1].first;
+          if (expr->getId() < checkpoint.symExprId)
+            expr->restoreAst(this->journalAsts[i-1].second);
+        }
+
+        for (triton::usize i = checkpoint.asts; i < this->journalAsts.size(); i++) {
+          SymbolicExpression* expr = this->journalAsts[i].first;
+          if (expr->getId() < checkpoint.symExprId)
+            expr->getAst()->init();
+        }
+        this->journalAsts.resize(checkpoint.asts);
+
+        /* The existing expressions get their taint, kind and origin back, the last change first */
+        for (triton::usize i = this->journalAttributes.size(); i > checkpoint.attributes; i--) {
+          const SymbolicAttributes& attributes = this->journalAttributes[i-1];
+          if (attributes.expr->getId() < checkpoint.symExprId) {
+            attributes.expr->isTainted = attributes.isTainted;
+            attributes.expr->setKind(attributes.kind);
+            attributes.expr->setOriginMemory(attributes.originMemory);
+            attributes.expr->setOriginRegister(attributes.originRegister);
+          }
+        }
+        this->journalAttributes.resize(checkpoint.attributes);
+
+        this->lazyFlags = checkpoint.lazyFlags;
+
+        /* The expressions removed since the checkpoint come back, unless they were created after it */
+        for (triton::usize i = checkpoint.removedExpressions; i < this->journalRemovedExpressions.size(); i++) {
+          SymbolicExpression* expr = this->journalRemovedExpressions[i];
+          if (expr->getId() < checkpoint.symExprId)
+            this->symbolicExpressions[expr->getId()] = expr;
+          else
+            delete expr;
+        }
+        this->journalRemovedExpressions.resize(checkpoint.removedExpressions);
+
+        /* Ids are increasing, the new expressions and variables are at the end of the maps */
+        auto it1 = this->symbolicExpressions.lower_bound(checkpoint.symExprId);
+        for (auto it = it1; it != this->symbolicExpressions.end(); it++)
+          delete it->second;
+        this->symbolicExpressions.erase(it1, this->symbolicExpressions.end());
+
+        auto it2 = this->symbolicVariables.lower_bound(checkpoint.symVarId);
+        for (auto it = it2; it != this->symbolicVariables.end(); it++)
+          delete it->second;
+        this->symbolicVariables.erase(it2, this->symbolicVariables.end());
+
+        /* The first clear since the checkpoint holds its path constraints */
+        if (this->journalPathConstraints.size() > checkpoint.clearedPathConstraints) {
+          this->pathConstraints.swap(this->journalPathConstraints[checkpoint.clearedPathConstraints]);
+          this->journalPathConstraints.resize(checkpoint.clearedPathConstraints);
+        }
+
+        if (this->pathConstraints.size() > checkpoint.pathConstraints)
+          this->pathConstraints.erase(this->pathConstraints.begin() + checkpoint.pathConstraints, this->pathConstraints.end());
+
+        this->uniqueSymExprId = checkpoint.symExprId;
+        this->uniqueSymVarId  = checkpoint.symVarId;
+
+        /* The later checkpoints are gone */
+        this->checkpoints.erase(this->checkpoints.begin() + index + 1, this->checkpoints.end());
+      }
+
+
+      /* Removes a checkpoint and the later ones */
+      void SymbolicEngine::removeCheckpoint(triton::usize index) {
+        if (index >= this->checkpoints.size())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::removeCheckpoint(): Invalid checkpoint.");
+
+        this->checkpoints.erase(this->checkpoints.begin() + index, this->checkpoints.end());
+
+        /* Without checkpoint, nothing can be undone */
+        if (this->checkpoints.empty()) {
+          this->deleteRemovedExpressions();
+          this->journalRegisters.clear();
+          this->journalMemory.clear();
+          this->journalAlignedMemory.clear();
+          this->journalPathConstraints.clear();
+          this->journalAsts.clear();
+          this->journalAttributes.clear();
+        }
+      }
+
+
+      /* Returns the number of checkpoints */
+      triton::usize SymbolicEngine::getNumberOfCheckpoints(void) const {
+        return this->checkpoints.size();
+      }
+
+
+      /* Deletes the expressions kept for the checkpoints */
+      void SymbolicEngine::deleteRemovedExpressions(void) {
+        for (auto it = this->journalRemovedExpressions.begin(); it != this->journalRemovedExpressions.end(); it++)
+          delete *it;
+        this->journalRemovedExpressions.clear();
+      }
+
+
+      /* Starts to journal the changes of the engine */
+      void SymbolicEngine::beginJournal(void) {
+        /* A journal left opened by an exception during the processing is undone */
+        if (this->journalOpened)
+          this->rollbackJournal();
+
+        this->newCheckpoint();
+        this->journalOpened = true;
+      }
+
+
+      /* Undoes all changes made since beginJournal() */
+      void SymbolicEngine::rollbackJournal(void) {
+        if (!this->journalOpened)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::rollbackJournal(): No journal opened.");
+
+        triton::usize index = this->checkpoints.size() - 1;
+
+        this->restoreCheckpoint(index);
+        this->removeCheckpoint(index);
+        this->journalOpened = false;
+      }
+
+
+      /* Returns true if a journal is opened */
+      bool SymbolicEngine::isJournalOpened(void) const {
+        return this->journalOpened;
+      }
+
+
+      /* Removes all path constraints and journals them */
+      void SymbolicEngine::clearPathConstraints(void) {
+        if (!this->checkpoints.empty()) {
+          this->journalPathConstraints.push_back(std::vector<triton::engines::symbolic::PathConstraint>());
+          this->journalPathConstraints.back().swap(this->pathConstraints);
+        }
+
+        triton::engines::symbolic::PathManager::clearPathConstraints();
+      }
+
+
+      /* Returns true if the flags are built when they are read */
+      bool SymbolicEngine::isLazyFlagsEnabled(void) const {
+        return this->modes->isModeEnabled(triton::modes::LAZY_FLAGS);
+      }
+
+
+      /* Defers the symbolic expression of a flag */
+      void SymbolicEngine::setLazyFlag(const triton::arch::Register& flag, const LazyFlag& lazy) {
+        triton::uint32 id = flag.getId();
+
+        if (!this->architecture->isFlag(flag))
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::setLazyFlag(): The register must be a flag.");
+
+        this->setRegisterReference(id, triton::engines::symbolic::UNSET);
+        this->lazyFlags[id] = lazy;
+
+        /* Synchronize the concrete state */
+        this->architecture->setConcreteRegisterValue(flag);
+      }
+
+
+      /* Builds the symbolic expression of a pending flag */
+      void SymbolicEngine::buildLazyFlag(triton::uint32 flagId, triton::arch::Instruction* inst) {
+        auto it = this->lazyFlags.find(flagId);
+
+        if (it == this->lazyFlags.end())
+          return;
+
+        LazyFlag lazy = it->second;
+        this->lazyFlags.erase(it);
+
+        SymbolicExpression* se = this->newSymbolicExpression(lazy.builder(), triton::engines::symbolic::REG, lazy.comment);
+        se->setOriginRegister(this->architecture->getRegister(flagId));
+        se->isTainted = lazy.isTainted;
+
+        /* The concrete state is already synchronized */
+        this->setRegisterReference(flagId, se->getId());
+
+        if (inst != nullptr)
+          inst->addSymbolicExpression(se);
+      }
+
+
       /* Enables or disables the symbolic engine */
       void SymbolicEngine::enable(bool flag) {
         this->enableFlag = flag;
@@ -1103,26 +1606,26 @@ namespace triton {
 
 
           /* Initialize the AST of the memory access (LEA) -> ((pc + base) + (index * scale) + disp) */
-          auto leaAst = triton::ast::bvadd(
-                          (mem.getPcRelative() ? triton::ast::bv(mem.getPcRelative(), bitSize) :
+          auto leaAst = this->astCtxt->bvadd(
+                          (mem.getPcRelative() ? this->astCtxt->bv(mem.getPcRelative(), bitSize) :
                             (this->architecture->isRegisterValid(base) ? this->buildSymbolicRegister(base) :
-                              triton::ast::bv(0, bitSize)
+                              this->astCtxt->bv(0, bitSize)
                             )
                           ),
-                          triton::ast::bvadd(
-                            triton::ast::bvmul(
-                              (this->architecture->isRegisterValid(index) ? this->buildSymbolicRegister(index) : triton::ast::bv(0, bitSize)),
-                              triton::ast::bv(scaleValue, bitSize)
+                          this->astCtxt->bvadd(
+                            this->astCtxt->bvmul(
+                              (this->architecture->isRegisterValid(index) ? this->buildSymbolicRegister(index) : this->astCtxt->bv(0, bitSize)),
+                              this->astCtxt->bv(scaleValue, bitSize)
                             ),
-                            triton::ast::bv(dispValue, bitSize)
+                            this->astCtxt->bv(dispValue, bitSize)
                           )
                         );
 
           /* Use segments as base address instead of selector into the GDT. */
           if (segmentValue) {
-            leaAst = triton::ast::bvadd(
-                       triton::ast::bv(segmentValue, seg.getBitSize()),
-                       triton::ast::sx((seg.getBitSize() - bitSize), leaAst)
+            leaAst = this->astCtxt->bvadd(
+                       this->astCtxt->bv(segmentValue, seg.getBitSize()),
+                       this->astCtxt->sx((seg.getBitSize() - bitSize), leaAst)
                      );
           }
 
@@ -6,6 +6,7 @@
 */
 
 #include <triton/exceptions.hpp>
+#include <triton/astContext.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/symbolicExpression.hpp>
 
@@ -53,10 +54,12 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedId(void) const {
-        if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        triton::uint32 mode = this->getAst()->getContext().getRepresentationMode();
+
+        if (mode == triton::ast::representations::SMT_REPRESENTATION)
           return "ref!" + std::to_string(this->id);
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (mode == triton::ast::representations::PYTHON_REPRESENTATION)
           return "ref_" + std::to_string(this->id);
 
         else
@@ -65,13 +68,15 @@ namespace triton {
 
 
       std::string SymbolicExpression::getFormattedComment(void) const {
+        triton::uint32 mode = this->getAst()->getContext().getRepresentationMode();
+
         if (this->getComment().empty())
           return "";
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::SMT_REPRESENTATION)
+        else if (mode == triton::ast::representations::SMT_REPRESENTATION)
           return "; " + this->getComment();
 
-        else if (triton::ast::representations::astRepresentation.getMode() == triton::ast::representations::PYTHON_REPRESENTATION)
+        else if (mode == triton::ast::representations::PYTHON_REPRESENTATION)
           return "# " + this->getComment();
 
         else
@@ -101,6 +106,11 @@ namespace triton {
       }
 
 
+      void SymbolicExpression::restoreAst(triton::ast::AbstractNode* node) {
+        this->ast = node;
+      }
+
+
       void SymbolicExpression::setComment(const std::string& comment) {
         this->comment = comment;
       }
@@ -40,7 +40,7 @@ triton::ast::AbstractNode* xor_simplification(triton::ast::AbstractNode* node) {
 
   if (node->getKind() == triton::ast::BVXOR_NODE) {
     if (*(node->getChilds()[0]) == *(node->getChilds()[1]))
-      return triton::ast::bv(0, node->getBitvectorSize());
+      return node->getContext().bv(0, node->getBitvectorSize());
   }
 
   return node;
@@ -5,7 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <triton/api.hpp>
+#include <triton/astContext.hpp>
 #include <triton/exceptions.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/symbolicVariable.hpp>
@@ -16,12 +16,14 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
-      SymbolicVariable::SymbolicVariable(symkind_e kind,
+      SymbolicVariable::SymbolicVariable(triton::ast::AstContext* astCtxt,
+                                         symkind_e kind,
                                          triton::uint64 kindValue,
                                          triton::usize id,
                                          triton::uint32 size,
                                          const std::string& comment,
                                          triton::uint512 concreteValue) {
+        this->astCtxt         = astCtxt;
         this->comment         = comment;
         this->id              = id;
         this->kind            = kind;
@@ -36,6 +38,7 @@ namespace triton {
 
 
       SymbolicVariable::SymbolicVariable(const SymbolicVariable& copy) {
+        this->astCtxt         = copy.astCtxt;
         this->comment         = copy.comment;
         this->concreteValue   = copy.concreteValue;
         this->id              = copy.id;
@@ -91,9 +94,12 @@ namespace triton {
 
 
       void SymbolicVariable::setConcreteValue(triton::uint512 value) {
-        triton::ast::AbstractNode* node = triton::api.getAstVariableNode(this->getName());
+        triton::ast::AbstractNode* node = nullptr;
 
         this->concreteValue = value;
+        if (this->astCtxt)
+          node = this->astCtxt->getAstVariableNode(this->getName());
+
         if (node)
           node->init();
       }
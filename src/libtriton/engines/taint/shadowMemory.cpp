@@ -0,0 +1,425 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <new>
+
+#include <triton/coreUtils.hpp>
+#include <triton/exceptions.hpp>
+#include <triton/shadowMemory.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      ShadowMemory::const_iterator::const_iterator(const std::map<triton::uint64, std::shared_ptr<Directory>>* directories, std::map<triton::uint64, std::shared_ptr<Directory>>::const_iterator directory) {
+        this->directories = directories;
+        this->directory   = directory;
+        this->page        = 0;
+        this->offset      = 0;
+        this->seek();
+      }
+
+
+      void ShadowMemory::const_iterator::seek(void) {
+        while (this->directory != this->directories->end()) {
+          const Directory* dir = this->directory->second.get();
+
+          for (; this->page < directorySize; this->page++, this->offset = 0) {
+            const Page* page = dir->pages[this->page].get();
+            if (page == nullptr)
+              continue;
+
+            for (triton::uint32 word = this->offset / 64; word < pageWords; word++) {
+              triton::uint64 bits = page->words[word];
+              if (word == this->offset / 64)
+                bits &= triton::utils::rangeMask(this->offset % 64, 64);
+              if (bits) {
+                this->offset = word * 64 + triton::utils::lowestBit(bits);
+                return;
+              }
+            }
+          }
+
+          this->directory++;
+          this->page   = 0;
+          this->offset = 0;
+        }
+      }
+
+
+      triton::uint64 ShadowMemory::const_iterator::operator*(void) const {
+        return (((this->directory->first << directoryBits) | this->page) << pageBits) | this->offset;
+      }
+
+
+      ShadowMemory::const_iterator& ShadowMemory::const_iterator::operator++(void) {
+        if (++this->offset == pageSize) {
+          this->page++;
+          this->offset = 0;
+        }
+        this->seek();
+        return *this;
+      }
+
+
+      ShadowMemory::const_iterator ShadowMemory::const_iterator::operator++(int) {
+        const_iterator old = *this;
+        ++(*this);
+        return old;
+      }
+
+
+      bool ShadowMemory::const_iterator::operator==(const const_iterator& other) const {
+        if (this->directory != other.directory)
+          return false;
+        if (this->directory == this->directories->end())
+          return true;
+        return this->page == other.page && this->offset == other.offset;
+      }
+
+
+      bool ShadowMemory::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
+      }
+
+
+      ShadowMemory::ShadowMemory() {
+        this->count         = 0;
+        this->labeled       = 0;
+        this->lastDirectory = nullptr;
+        this->lastRegion    = 0;
+      }
+
+
+      ShadowMemory::ShadowMemory(const ShadowMemory& other) {
+        this->count         = 0;
+        this->labeled       = 0;
+        this->lastDirectory = nullptr;
+        this->lastRegion    = 0;
+        this->copy(other);
+      }
+
+
+      ShadowMemory::~ShadowMemory() {
+        this->clear();
+      }
+
+
+      void ShadowMemory::operator=(const ShadowMemory& other) {
+        if (this != &other)
+          this->copy(other);
+      }
+
+
+      void ShadowMemory::copy(const ShadowMemory& other) {
+        /* The directories, the pages and their labels are shared, see allocatePage() and allocateLabels() */
+        this->directories   = other.directories;
+        this->count         = other.count;
+        this->labeled       = other.labeled;
+        this->lastDirectory = nullptr;
+      }
+
+
+      const ShadowMemory::Page* ShadowMemory::findPage(triton::uint64 addr) const {
+        triton::uint64 region = addr >> (pageBits + directoryBits);
+
+        if (this->lastDirectory == nullptr || this->lastRegion != region) {
+          auto it = this->directories.find(region);
+          if (it == this->directories.end())
+            return nullptr;
+          this->lastRegion    = region;
+          this->lastDirectory = it->second.get();
+        }
+
+        return this->lastDirectory->pages[(addr >> pageBits) & (directorySize - 1)].get();
+      }
+
+
+      ShadowMemory::Page* ShadowMemory::allocatePage(triton::uint64 addr) {
+        triton::uint64 region = addr >> (pageBits + directoryBits);
+        triton::uint32 index  = (addr >> pageBits) & (directorySize - 1);
+
+        std::shared_ptr<Directory>& dir = this->directories[region];
+        if (dir == nullptr) {
+          dir = std::shared_ptr<Directory>(new(std::nothrow) Directory());
+          if (dir == nullptr) {
+            this->directories.erase(region);
+            throw triton::exceptions::TaintEngine("ShadowMemory::allocatePage(): Not enough memory.");
+          }
+          dir->count = 0;
+        }
+
+        /* The directory is shared with a copy, copy it */
+        else if (dir.use_count() > 1) {
+          Directory* clone = new(std::nothrow) Directory(*dir);
+          if (clone == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::allocatePage(): Not enough memory.");
+          dir = std::shared_ptr<Directory>(clone);
+        }
+
+        this->lastRegion    = region;
+        this->lastDirectory = dir.get();
+
+        std::shared_ptr<Page>& page = dir->pages[index];
+        if (page == nullptr) {
+          page = std::shared_ptr<Page>(new(std::nothrow) Page());
+          if (page == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::allocatePage(): Not enough memory.");
+          std::memset(page->words, 0x00, sizeof(page->words));
+          page->count = 0;
+          dir->count++;
+        }
+
+        /* The page is shared with a copy, copy it */
+        else if (page.use_count() > 1) {
+          Page* clone = new(std::nothrow) Page(*page);
+          if (clone == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::allocatePage(): Not enough memory.");
+          page = std::shared_ptr<Page>(clone);
+        }
+
+        return page.get();
+      }
+
+
+      void ShadowMemory::freePage(triton::uint64 addr) {
+        triton::uint64 region = addr >> (pageBits + directoryBits);
+        triton::uint32 index  = (addr >> pageBits) & (directorySize - 1);
+
+        /* The directory is no longer shared, see allocatePage() */
+        auto it = this->directories.find(region);
+        Directory* dir = it->second.get();
+
+        dir->pages[index].reset();
+
+        if (--dir->count == 0) {
+          if (this->lastDirectory == dir)
+            this->lastDirectory = nullptr;
+          this->directories.erase(it);
+        }
+      }
+
+
+      ShadowMemory::LabelPage* ShadowMemory::allocateLabels(Page* page) {
+        if (page->labels == nullptr) {
+          page->labels = std::shared_ptr<LabelPage>(new(std::nothrow) LabelPage());
+          if (page->labels == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::allocateLabels(): Not enough memory.");
+          std::memset(page->labels->sets, 0x00, sizeof(page->labels->sets));
+          page->labels->count = 0;
+        }
+
+        /* The labels are shared with a copy, copy them */
+        else if (page->labels.use_count() > 1) {
+          LabelPage* clone = new(std::nothrow) LabelPage(*page->labels);
+          if (clone == nullptr)
+            throw triton::exceptions::TaintEngine("ShadowMemory::allocateLabels(): Not enough memory.");
+          page->labels = std::shared_ptr<LabelPage>(clone);
+        }
+
+        return page->labels.get();
+      }
+
+
+      void ShadowMemory::clearLabels(Page* page, triton::uint32 offset, triton::uint32 length) {
+        LabelPage* labels = nullptr;
+
+        if (page->labels == nullptr)
+          return;
+
+        for (triton::uint32 index = offset; index < offset + length; index++) {
+          if (page->labels->sets[index] == NO_LABELS)
+            continue;
+          if (labels == nullptr)
+            labels = this->allocateLabels(page);
+          labels->sets[index] = NO_LABELS;
+          labels->count--;
+          this->labeled--;
+        }
+
+        if (labels != nullptr && labels->count == 0)
+          page->labels.reset();
+      }
+
+
+      ShadowMemory::const_iterator ShadowMemory::begin(void) const {
+        return const_iterator(&this->directories, this->directories.begin());
+      }
+
+
+      ShadowMemory::const_iterator ShadowMemory::end(void) const {
+        return const_iterator(&this->directories, this->directories.end());
+      }
+
+
+      triton::usize ShadowMemory::size(void) const {
+        return this->count;
+      }
+
+
+      bool ShadowMemory::empty(void) const {
+        return this->count == 0;
+      }
+
+
+      bool ShadowMemory::isTainted(triton::uint64 addr) const {
+        const Page* page = this->findPage(addr);
+
+        if (page == nullptr)
+          return false;
+
+        triton::uint32 offset = addr & (pageSize - 1);
+        return (page->words[offset / 64] >> (offset % 64)) & 1;
+      }
+
+
+      bool ShadowMemory::isTainted(triton::uint64 addr, triton::usize size) const {
+        if (this->count == 0)
+          return false;
+
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+          const Page* page      = this->findPage(addr);
+
+          if (page != nullptr) {
+            for (triton::uint32 bit = offset; bit < offset + length;) {
+              triton::uint32 high = ((bit / 64) + 1) * 64;
+              if (high > offset + length)
+                high = offset + length;
+              if (page->words[bit / 64] & triton::utils::rangeMask(bit % 64, high - (bit / 64) * 64))
+                return true;
+              bit = high;
+            }
+          }
+
+          addr += length;
+          size -= length;
+        }
+
+        return false;
+      }
+
+
+      void ShadowMemory::set(triton::uint64 addr, triton::usize size, bool flag) {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+          Page* page            = nullptr;
+
+          /* Untainting never allocates a page */
+          if (flag || this->findPage(addr) != nullptr)
+            page = this->allocatePage(addr);
+
+          if (page != nullptr) {
+            for (triton::uint32 bit = offset; bit < offset + length;) {
+              triton::uint32 high = ((bit / 64) + 1) * 64;
+              if (high > offset + length)
+                high = offset + length;
+
+              triton::uint64& word = page->words[bit / 64];
+              triton::uint64 mask  = triton::utils::rangeMask(bit % 64, high - (bit / 64) * 64);
+
+              if (flag) {
+                page->count += triton::utils::popCount(mask & ~word);
+                this->count += triton::utils::popCount(mask & ~word);
+                word |= mask;
+              }
+              else {
+                page->count -= triton::utils::popCount(mask & word);
+                this->count -= triton::utils::popCount(mask & word);
+                word &= ~mask;
+              }
+
+              bit = high;
+            }
+
+            /* The untainted bytes lose their labels */
+            if (!flag)
+              this->clearLabels(page, offset, length);
+
+            if (page->count == 0)
+              this->freePage(addr);
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      void ShadowMemory::clear(void) {
+        this->directories.clear();
+        this->count         = 0;
+        this->labeled       = 0;
+        this->lastDirectory = nullptr;
+      }
+
+
+      bool ShadowMemory::hasLabels(void) const {
+        return this->labeled != 0;
+      }
+
+
+      labelSet ShadowMemory::getLabels(triton::uint64 addr) const {
+        if (this->labeled == 0)
+          return NO_LABELS;
+
+        const Page* page = this->findPage(addr);
+        if (page == nullptr || page->labels == nullptr)
+          return NO_LABELS;
+
+        return page->labels->sets[addr & (pageSize - 1)];
+      }
+
+
+      void ShadowMemory::setLabels(triton::uint64 addr, triton::usize size, labelSet set) {
+        while (size) {
+          triton::uint32 offset = addr & (pageSize - 1);
+          triton::uint32 length = (size < pageSize - offset) ? static_cast<triton::uint32>(size) : pageSize - offset;
+          const Page* found     = this->findPage(addr);
+
+          /* A page is only copied if one of its bytes loses its labels */
+          if (found != nullptr && set == NO_LABELS && found->labels != nullptr) {
+            for (triton::uint32 index = offset; index < offset + length; index++) {
+              if (found->labels->sets[index] != NO_LABELS) {
+                this->clearLabels(this->allocatePage(addr), offset, length);
+                break;
+              }
+            }
+          }
+
+          /* Only the tainted bytes have labels */
+          else if (found != nullptr && set != NO_LABELS) {
+            Page* page        = this->allocatePage(addr);
+            LabelPage* labels = this->allocateLabels(page);
+
+            for (triton::uint32 index = offset; index < offset + length; index++) {
+              if (((page->words[index / 64] >> (index % 64)) & 1) == 0)
+                continue;
+              if (labels->sets[index] == NO_LABELS) {
+                labels->count++;
+                this->labeled++;
+              }
+              labels->sets[index] = set;
+            }
+
+            if (labels->count == 0)
+              page->labels.reset();
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -81,6 +81,26 @@ That's why Triton uses **symbolic execution for precision** and an over-approxim
 tainting to know if we can ask a model to the SMT solver - Asking a model means that
 the symbolic variables are controllable by the user input.
 
+\section engine_Taint_labels Labels
+<hr>
+
+With the `TAINT_LABELS` mode, registers and memory cells also carry a set of labels, given by
+labelMemory() and labelRegister() (e.g. the offset of each byte of an input). Assignments replace
+the labels of the destination by the labels of the source and unions merge them, so each tainted
+item knows which labeled inputs flowed into it. The labels of the registers and memory cells read
+by an instruction are available through triton::arch::Instruction::getTaintLabels(). One trace
+with all input bytes labeled replaces one trace per tainted input byte.
+
+~~~~~~~~~~~~~{.py}
+>>> enableMode(MODE.TAINT_LABELS, True)
+>>> for i in range(len(packet)):
+...     labelMemory(packet_addr + i, i)
+...
+>>> # ... processing ...
+>>> inst.getTaintLabels()
+[12L, 13L, 14L, 15L]
+~~~~~~~~~~~~~
+
 */
 
 
@@ -89,17 +109,33 @@ namespace triton {
   namespace engines {
     namespace taint {
 
-      TaintEngine::TaintEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+      TaintEngine::TaintEngine(triton::arch::Architecture* architecture, triton::modes::Modes* modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (architecture == nullptr)
+          throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The architecture cannot be null.");
+
+        if (modes == nullptr)
+          throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The modes cannot be null.");
+
         if (symbolicEngine == nullptr)
           throw triton::exceptions::TaintEngine("TaintEngine::TaintEngine(): The symbolicEngine TaintEngine cannot be null.");
 
-        this->symbolicEngine = symbolicEngine;
-        this->enableFlag     = true;
+        this->architecture    = architecture;
+        this->modes           = modes;
+        this->symbolicEngine  = symbolicEngine;
+        this->enableFlag      = true;
+        this->recordingLabels = false;
+        this->recordedLabels  = NO_LABELS;
       }
 
 
       void TaintEngine::copy(const TaintEngine& other) {
+        this->architecture     = other.architecture;
         this->enableFlag       = other.enableFlag;
+        this->labels           = other.labels;
+        this->modes            = other.modes;
+        this->recordedLabels   = NO_LABELS;
+        this->recordingLabels  = false;
+        this->registerLabels   = other.registerLabels;
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
@@ -130,8 +166,177 @@ namespace triton {
       }
 
 
+      void TaintEngine::saveState(triton::engines::taint::TaintState& state) const {
+        state.enableFlag       = this->enableFlag;
+        state.registerLabels   = this->registerLabels;
+        state.taintedMemory    = this->taintedMemory;
+        state.taintedRegisters = this->taintedRegisters;
+      }
+
+
+      void TaintEngine::restoreState(const triton::engines::taint::TaintState& state) {
+        this->enableFlag       = state.enableFlag;
+        this->registerLabels   = state.registerLabels;
+        this->taintedMemory    = state.taintedMemory;
+        this->taintedRegisters = state.taintedRegisters;
+      }
+
+
+      bool TaintEngine::isLabelsEnabled(void) const {
+        return this->modes->isModeEnabled(triton::modes::TAINT_LABELS);
+      }
+
+
+      labelSet TaintEngine::getMemoryLabelSet(triton::uint64 addr, triton::usize size) const {
+        labelSet set = NO_LABELS;
+
+        if (!this->taintedMemory.hasLabels())
+          return NO_LABELS;
+
+        for (triton::usize index = 0; index < size; index++)
+          set = this->labels.merge(set, this->taintedMemory.getLabels(addr + index));
+
+        return set;
+      }
+
+
+      labelSet TaintEngine::getRegisterLabelSet(const triton::arch::Register& reg) const {
+        if (this->registerLabels.empty())
+          return NO_LABELS;
+
+        auto it = this->registerLabels.find(reg.getParentId());
+        if (it != this->registerLabels.end())
+          return it->second;
+
+        return NO_LABELS;
+      }
+
+
+      void TaintEngine::assignMemoryLabels(triton::uint64 addr, triton::usize size, labelSet set) {
+        if (set == NO_LABELS && !this->taintedMemory.hasLabels())
+          return;
+
+        this->taintedMemory.setLabels(addr, size, set);
+      }
+
+
+      void TaintEngine::assignRegisterLabels(const triton::arch::Register& reg, labelSet set) {
+        if (set == NO_LABELS) {
+          if (!this->registerLabels.empty())
+            this->registerLabels.erase(reg.getParentId());
+          return;
+        }
+
+        this->registerLabels[reg.getParentId()] = set;
+      }
+
+
+      void TaintEngine::mergeMemoryLabels(triton::uint64 addr, triton::usize size, labelSet set) {
+        if (set == NO_LABELS)
+          return;
+
+        for (triton::usize index = 0; index < size; index++)
+          this->taintedMemory.setLabels(addr + index, 1, this->labels.merge(this->taintedMemory.getLabels(addr + index), set));
+      }
+
+
+      void TaintEngine::mergeRegisterLabels(const triton::arch::Register& reg, labelSet set) {
+        if (set == NO_LABELS)
+          return;
+
+        labelSet& current = this->registerLabels[reg.getParentId()];
+        current = this->labels.merge(current, set);
+      }
+
+
+      void TaintEngine::recordLabels(labelSet set) const {
+        this->recordedLabels = this->labels.merge(this->recordedLabels, set);
+      }
+
+
+      void TaintEngine::recordMemoryLabels(const triton::arch::MemoryAccess& mem) const {
+        if (this->recordingLabels)
+          this->recordLabels(this->getMemoryLabelSet(mem.getAddress(), mem.getSize()));
+      }
+
+
+      void TaintEngine::recordRegisterLabels(const triton::arch::Register& reg) const {
+        if (this->recordingLabels)
+          this->recordLabels(this->getRegisterLabelSet(reg));
+      }
+
+
+      std::set<triton::uint32> TaintEngine::getMemoryLabels(triton::uint64 addr, triton::uint32 size) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(addr, size));
+      }
+
+
+      std::set<triton::uint32> TaintEngine::getMemoryLabels(const triton::arch::MemoryAccess& mem) const {
+        return this->labels.getLabels(this->getMemoryLabelSet(mem.getAddress(), mem.getSize()));
+      }
+
+
+      std::set<triton::uint32> TaintEngine::getRegisterLabels(const triton::arch::Register& reg) const {
+        return this->labels.getLabels(this->getRegisterLabelSet(reg));
+      }
+
+
+      bool TaintEngine::labelMemory(triton::uint64 addr, triton::uint32 label) {
+        if (!this->isLabelsEnabled())
+          throw triton::exceptions::TaintEngine("TaintEngine::labelMemory(): The TAINT_LABELS mode must be enabled.");
+
+        if (!this->isEnabled())
+          return this->isMemoryTainted(addr);
+
+        this->taintMemory(addr);
+        this->mergeMemoryLabels(addr, 1, this->labels.label(label));
+
+        return TAINTED;
+      }
+
+
+      bool TaintEngine::labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label) {
+        if (!this->isLabelsEnabled())
+          throw triton::exceptions::TaintEngine("TaintEngine::labelMemory(): The TAINT_LABELS mode must be enabled.");
+
+        if (!this->isEnabled())
+          return this->isMemoryTainted(mem);
+
+        this->taintMemory(mem);
+        this->mergeMemoryLabels(mem.getAddress(), mem.getSize(), this->labels.label(label));
+
+        return TAINTED;
+      }
+
+
+      bool TaintEngine::labelRegister(const triton::arch::Register& reg, triton::uint32 label) {
+        if (!this->isLabelsEnabled())
+          throw triton::exceptions::TaintEngine("TaintEngine::labelRegister(): The TAINT_LABELS mode must be enabled.");
+
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        this->taintRegister(reg);
+        this->mergeRegisterLabels(reg, this->labels.label(label));
+
+        return TAINTED;
+      }
+
+
+      void TaintEngine::startLabelsRecording(void) {
+        this->recordedLabels  = NO_LABELS;
+        this->recordingLabels = true;
+      }
+
+
+      std::set<triton::uint32> TaintEngine::stopLabelsRecording(void) {
+        this->recordingLabels = false;
+        return this->labels.getLabels(this->recordedLabels);
+      }
+
+
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
+      const triton::engines::taint::ShadowMemory& TaintEngine::getTaintedMemory(void) const {
         return this->taintedMemory;
       }
 
@@ -144,32 +349,21 @@ namespace triton {
 
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
-        return !TAINTED;
+        return this->isMemoryTainted(mem.getAddress(), mem.getSize());
       }
 
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
-
-        return !TAINTED;
+        if (size == 1)
+          return this->taintedMemory.isTainted(addr);
+        return this->taintedMemory.isTainted(addr, size);
       }
 
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        triton::arch::Register parent = reg.getParent();
+        triton::arch::Register parent = this->architecture->getParentRegister(reg);
 
         if (this->taintedRegisters.find(parent) != this->taintedRegisters.end())
           return TAINTED;
@@ -181,9 +375,18 @@ namespace triton {
       /* Abstract taint verification. */
       bool TaintEngine::isTainted(const triton::arch::OperandWrapper& op) const {
         switch (op.getType()) {
-          case triton::arch::OP_IMM: return triton::engines::taint::UNTAINTED;
-          case triton::arch::OP_MEM: return this->isMemoryTainted(op.getConstMemory());
-          case triton::arch::OP_REG: return this->isRegisterTainted(op.getConstRegister());
+          case triton::arch::OP_IMM:
+            return triton::engines::taint::UNTAINTED;
+
+          /* The operands checked by the semantics are sources */
+          case triton::arch::OP_MEM:
+            this->recordMemoryLabels(op.getConstMemory());
+            return this->isMemoryTainted(op.getConstMemory());
+
+          case triton::arch::OP_REG:
+            this->recordRegisterLabels(op.getConstRegister());
+            return this->isRegisterTainted(op.getConstRegister());
+
           default:
             throw triton::exceptions::TaintEngine("TaintEngine::isTainted(): Invalid operand.");
         }
@@ -192,7 +395,7 @@ namespace triton {
 
       /* Taint the register */
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
-        triton::arch::Register parent = reg.getParent();
+        triton::arch::Register parent = this->architecture->getParentRegister(reg);
 
         if (!this->isEnabled())
           return this->isRegisterTainted(parent);
@@ -204,11 +407,12 @@ namespace triton {
 
       /* Untaint the register */
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
-        triton::arch::Register parent = reg.getParent();
+        triton::arch::Register parent = this->architecture->getParentRegister(reg);
 
         if (!this->isEnabled())
           return this->isRegisterTainted(parent);
         this->taintedRegisters.erase(parent);
+        this->assignRegisterLabels(parent, NO_LABELS);
 
         return !TAINTED;
       }
@@ -243,7 +447,7 @@ namespace triton {
 
       /* Sets the flag (taint or untaint) to a register. */
       bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag) {
-        triton::arch::Register parent = reg.getParent();
+        triton::arch::Register parent = this->architecture->getParentRegister(reg);
 
         if (!this->isEnabled())
           return this->isRegisterTainted(parent);
@@ -266,8 +470,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintedMemory.set(addr, size, TAINTED);
 
         return TAINTED;
       }
@@ -277,7 +480,7 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.set(addr, 1, TAINTED);
         return TAINTED;
       }
 
@@ -290,8 +493,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+        this->taintedMemory.set(addr, size, !TAINTED);
 
         return !TAINTED;
       }
@@ -301,7 +503,7 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.set(addr, 1, !TAINTED);
         return !TAINTED;
       }
 
@@ -365,6 +567,7 @@ namespace triton {
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
+        this->recordMemoryLabels(memDst);
         flag = this->unionMemoryImmediate(memDst);
 
         /* Taint each byte of reference expression */
@@ -373,7 +576,7 @@ namespace triton {
           if (byteId == triton::engines::symbolic::UNSET)
             continue;
           triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
+          this->symbolicEngine->setExpressionTaint(byte, flag);
         }
 
         return flag;
@@ -386,6 +589,8 @@ namespace triton {
         triton::uint64 memAddrSrc = memSrc.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
+        this->recordMemoryLabels(memDst);
+        this->recordMemoryLabels(memSrc);
         flag = this->unionMemoryMemory(memDst, memSrc);
 
         /* Taint each byte of reference expression */
@@ -394,7 +599,7 @@ namespace triton {
           if (byteId == triton::engines::symbolic::UNSET)
             continue;
           triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i);
+          this->symbolicEngine->setExpressionTaint(byte, this->isMemoryTainted(memAddrDst + i) | this->isMemoryTainted(memAddrSrc + i));
         }
 
         return flag;
@@ -406,6 +611,8 @@ namespace triton {
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
+        this->recordMemoryLabels(memDst);
+        this->recordRegisterLabels(regSrc);
         flag = this->unionMemoryRegister(memDst, regSrc);
 
         /* Taint each byte of reference expression */
@@ -414,7 +621,7 @@ namespace triton {
           if (byteId == triton::engines::symbolic::UNSET)
             continue;
           triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
+          this->symbolicEngine->setExpressionTaint(byte, flag);
         }
 
         return flag;
@@ -422,16 +629,21 @@ namespace triton {
 
 
       bool TaintEngine::taintUnionRegisterImmediate(const triton::arch::Register& regDst) {
+        this->recordRegisterLabels(regDst);
         return this->unionRegisterImmediate(regDst);
       }
 
 
       bool TaintEngine::taintUnionRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+        this->recordRegisterLabels(regDst);
+        this->recordMemoryLabels(memSrc);
         return this->unionRegisterMemory(regDst, memSrc);
       }
 
 
       bool TaintEngine::taintUnionRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+        this->recordRegisterLabels(regDst);
+        this->recordRegisterLabels(regSrc);
         return this->unionRegisterRegister(regDst, regSrc);
       }
 
@@ -449,7 +661,7 @@ namespace triton {
           if (byteId == triton::engines::symbolic::UNSET)
             continue;
           triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
+          this->symbolicEngine->setExpressionTaint(byte, flag);
         }
 
         return flag;
@@ -462,6 +674,7 @@ namespace triton {
         triton::uint64 memAddrSrc = memSrc.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
+        this->recordMemoryLabels(memSrc);
         flag = this->assignmentMemoryMemory(memDst, memSrc);
 
         /* Taint each byte of reference expression */
@@ -470,7 +683,7 @@ namespace triton {
           if (byteId == triton::engines::symbolic::UNSET)
             continue;
           triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = this->isMemoryTainted(memAddrSrc + i);
+          this->symbolicEngine->setExpressionTaint(byte, this->isMemoryTainted(memAddrSrc + i));
         }
 
         return flag;
@@ -482,6 +695,7 @@ namespace triton {
         triton::uint64 memAddrDst = memDst.getAddress();
         triton::uint32 writeSize  = memDst.getSize();
 
+        this->recordRegisterLabels(regSrc);
         flag = this->assignmentMemoryRegister(memDst, regSrc);
 
         /* Taint each byte of reference expression */
@@ -490,7 +704,7 @@ namespace triton {
           if (byteId == triton::engines::symbolic::UNSET)
             continue;
           triton::engines::symbolic::SymbolicExpression* byte = this->symbolicEngine->getSymbolicExpressionFromId(byteId);
-          byte->isTainted = flag;
+          this->symbolicEngine->setExpressionTaint(byte, flag);
         }
 
         return flag;
@@ -503,11 +717,13 @@ namespace triton {
 
 
       bool TaintEngine::taintAssignmentRegisterMemory(const triton::arch::Register& regDst, const triton::arch::MemoryAccess& memSrc) {
+        this->recordMemoryLabels(memSrc);
         return this->assignmentRegisterMemory(regDst, memSrc);
       }
 
 
       bool TaintEngine::taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc) {
+        this->recordRegisterLabels(regSrc);
         return this->assignmentRegisterRegister(regDst, regSrc);
       }
 
@@ -519,6 +735,7 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          this->assignRegisterLabels(regDst, this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -543,6 +760,7 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          this->assignRegisterLabels(regDst, this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           return TAINTED;
         }
 
@@ -561,9 +779,16 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
+        /* Most copies are not tainted at all */
+        if (!this->taintedMemory.isTainted(addrSrc, readSize)) {
+          this->untaintMemory(memDst);
+          return !TAINTED;
+        }
+
         for (triton::uint32 offset = 0; offset < readSize; offset++) {
           if (this->isMemoryTainted(addrSrc+offset)) {
             this->taintMemory(addrDst+offset);
+            this->assignMemoryLabels(addrDst+offset, 1, this->getMemoryLabelSet(addrSrc+offset, 1));
             isTainted = TAINTED;
           }
           else
@@ -591,6 +816,7 @@ namespace triton {
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          this->assignMemoryLabels(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -615,6 +841,7 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          this->mergeRegisterLabels(regDst, this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -633,10 +860,13 @@ namespace triton {
           return this->isMemoryTainted(memDst);
 
         /* Check source */
-        for (triton::uint32 offset = 0; offset < writeSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            tainted = TAINTED;
+        if (this->taintedMemory.isTainted(addrSrc, writeSize)) {
+          for (triton::uint32 offset = 0; offset < writeSize; offset++) {
+            if (this->isMemoryTainted(addrSrc+offset)) {
+              this->taintMemory(addrDst+offset);
+              this->mergeMemoryLabels(addrDst+offset, 1, this->getMemoryLabelSet(addrSrc+offset, 1));
+              tainted = TAINTED;
+            }
           }
         }
 
@@ -656,6 +886,7 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          this->mergeRegisterLabels(regDst, this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           return TAINTED;
         }
 
@@ -683,6 +914,7 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          this->mergeMemoryLabels(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <triton/exceptions.hpp>
+#include <triton/taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      labelSet TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        /* Sets of small labels stay inline */
+        if (labels.empty() || labels.back() < TaintLabels::inlineLabels) {
+          labelSet set = NO_LABELS;
+          for (auto it = labels.begin(); it != labels.end(); it++)
+            set |= (static_cast<labelSet>(1) << *it);
+          return set;
+        }
+
+        auto it = this->handles.find(labels);
+        if (it != this->handles.end())
+          return it->second;
+
+        labelSet set = (TaintLabels::interned | this->sets.size());
+        this->sets.push_back(labels);
+        this->handles[labels] = set;
+
+        return set;
+      }
+
+
+      std::vector<triton::uint32> TaintLabels::expand(labelSet set) const {
+        std::vector<triton::uint32> labels;
+
+        if (set & TaintLabels::interned) {
+          triton::usize index = static_cast<triton::usize>(set & ~TaintLabels::interned);
+          if (index >= this->sets.size())
+            throw triton::exceptions::TaintEngine("TaintLabels::expand(): Invalid set of labels.");
+          return this->sets[index];
+        }
+
+        for (triton::uint32 label = 0; set; label++, set >>= 1) {
+          if (set & 1)
+            labels.push_back(label);
+        }
+
+        return labels;
+      }
+
+
+      labelSet TaintLabels::label(triton::uint32 label) {
+        return this->intern(std::vector<triton::uint32>(1, label));
+      }
+
+
+      labelSet TaintLabels::merge(labelSet set1, labelSet set2) {
+        if (set1 == set2 || set2 == NO_LABELS)
+          return set1;
+
+        if (set1 == NO_LABELS)
+          return set2;
+
+        if (((set1 | set2) & TaintLabels::interned) == 0)
+          return set1 | set2;
+
+        std::pair<labelSet, labelSet> key = std::make_pair(std::min(set1, set2), std::max(set1, set2));
+        auto it = this->unions.find(key);
+        if (it != this->unions.end())
+          return it->second;
+
+        std::vector<triton::uint32> labels1 = this->expand(set1);
+        std::vector<triton::uint32> labels2 = this->expand(set2);
+        std::vector<triton::uint32> labels;
+
+        std::set_union(labels1.begin(), labels1.end(), labels2.begin(), labels2.end(), std::back_inserter(labels));
+
+        labelSet set = this->intern(labels);
+        this->unions[key] = set;
+
+        return set;
+      }
+
+
+      std::set<triton::uint32> TaintLabels::getLabels(labelSet set) const {
+        std::vector<triton::uint32> labels = this->expand(set);
+        return std::set<triton::uint32>(labels.begin(), labels.end());
+      }
+
+
+      triton::usize TaintLabels::getNumberOfInternedSets(void) const {
+        return this->sets.size();
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->sets.clear();
+        this->handles.clear();
+        this->unions.clear();
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
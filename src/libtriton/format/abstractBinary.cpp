@@ -24,10 +24,10 @@ namespace triton {
     }
 
 
-    AbstractBinary::AbstractBinary(const std::string& path) {
+    AbstractBinary::AbstractBinary(const std::string& path, bool lazy) {
       this->format = triton::format::BINARY_INVALID;
       this->binary = nullptr;
-      this->loadBinary(path);
+      this->loadBinary(path, lazy);
     }
 
 
@@ -41,7 +41,7 @@ namespace triton {
     }
 
 
-    void AbstractBinary::loadBinary(const std::string& path) {
+    void AbstractBinary::loadBinary(const std::string& path, bool lazy) {
       FILE* fd = nullptr;
       triton::uint8 raw[8] = {0};
       triton::usize size = 0;
@@ -83,22 +83,22 @@ namespace triton {
         this->format = triton::format::BINARY_INVALID;
 
       // Parse the binary according to the format
-      this->parseBinary(path);
+      this->parseBinary(path, lazy);
     }
 
 
-    void AbstractBinary::parseBinary(const std::string& path) {
+    void AbstractBinary::parseBinary(const std::string& path, bool lazy) {
       switch (this->format) {
         case triton::format::BINARY_ELF:
           delete this->binary;
-          this->binary = new(std::nothrow) triton::format::elf::Elf(path);
+          this->binary = new(std::nothrow) triton::format::elf::Elf(path, lazy);
           if (!this->binary)
             throw triton::exceptions::Format("AbstractBinary::parseBinary(): Not enough memory.");
           break;
 
         case triton::format::BINARY_PE:
           delete this->binary;
-          this->binary = new(std::nothrow) triton::format::pe::Pe(path);
+          this->binary = new(std::nothrow) triton::format::pe::Pe(path, lazy);
           if (!this->binary)
             throw triton::exceptions::Format("AbstractBinary::parseBinary(): Not enough memory.");
           break;
@@ -5,9 +5,6 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <cstdio>
-#include <new>
-
 #include <triton/elf.hpp>
 #include <triton/exceptions.hpp>
 
@@ -17,52 +14,41 @@ namespace triton {
   namespace format {
     namespace elf {
 
-      Elf::Elf(const std::string& path) {
-        this->path      = path;
-        this->raw       = nullptr;
-        this->totalSize = 0;
+      Elf::Elf(const std::string& path, bool lazy) {
+        this->path              = path;
+        this->raw               = nullptr;
+        this->totalSize         = 0;
+        this->lazy              = lazy;
+        this->symbolsParsed     = false;
+        this->relocationsParsed = false;
 
         this->open();
         this->parse();
         this->initMemoryMapping();
         this->initDynamicTable();
         this->initSharedLibraries();
-        this->initSymbolsTableViaProgramHeaders();  // .dyntab
-        this->initSymbolsTableViaSectionHeaders();  // .symtab
-        this->initRelTable();                       // DT_REL
-        this->initRelaTable();                      // DT_RELA
-        this->initJmprelTable();                    // DT_JMPREL
+
+        /* In the lazy mode, the tables are parsed on their first use */
+        if (!this->lazy) {
+          this->parseSymbolsTable();
+          this->parseRelocationsTable();
+        }
       }
 
 
       Elf::~Elf() {
-        delete[] this->raw;
       }
 
 
       void Elf::open(void) {
-        FILE* fd = nullptr;
-
-        // Open the file
-        fd = fopen(this->path.c_str(), "rb");
-        if (fd == nullptr)
-          throw triton::exceptions::Elf("Elf::open(): Cannot open the binary file.");
-
-        // Get the binary size
-        fseek(fd, 0, SEEK_END);
-        this->totalSize = ftell(fd);
-        rewind(fd);
-
-        this->raw = new(std::nothrow) triton::uint8[this->totalSize];
-        if(!this->raw)
-          throw triton::exceptions::Elf("Elf::open(): Not enough memory.");
-
-        // Read only the magic number
-        if (fread(this->raw, 1, this->totalSize, fd) != this->totalSize)
-          throw triton::exceptions::Elf("Elf::open(): Cannot read the file binary.");
-
-        // Close the file
-        fclose(fd);
+        try {
+          this->file.open(this->path, this->lazy);
+        }
+        catch (const triton::exceptions::Format& e) {
+          throw triton::exceptions::Elf(std::string("Elf::open(): ") + e.what());
+        }
+        this->raw       = this->file.getData();
+        this->totalSize = this->file.getSize();
       }
 
 
@@ -139,7 +125,7 @@ namespace triton {
 
       void Elf::initMemoryMapping(void) {
         for (auto it = this->programHeaders.begin(); it != this->programHeaders.end(); it++) {
-          triton::format::MemoryMapping area(this->raw);
+          triton::format::MemoryMapping area(this->file.getSharedData());
 
           if (this->totalSize < (it->getOffset() + it->getFilesz())) {
             std::cerr << "Warning Elf::initMemoryMapping(): Some ELF Program Headers of the binary file are corrupted." << std::endl;
@@ -150,6 +136,10 @@ namespace triton {
           area.setSize(it->getFilesz());
           area.setVirtualAddress(it->getVaddr());
 
+          /* Only the loadable segments have a zero-filled part, e.g. .bss */
+          if (it->getType() == triton::format::elf::PT_LOAD)
+            area.setMemorySize(it->getMemsz());
+
           this->memoryMapping.push_back(area);
         }
       }
@@ -198,7 +188,7 @@ namespace triton {
       }
 
 
-      void Elf::initSymbolsTableViaProgramHeaders(void) {
+      void Elf::initSymbolsTableViaProgramHeaders(void) const {
         triton::uint64 strTabOffset = 0;
         triton::uint64 strTabSize   = 0;
         triton::uint64 symTabOffset = 0;
@@ -241,7 +231,7 @@ namespace triton {
       }
 
 
-      void Elf::initSymbolsTableViaSectionHeaders(void) {
+      void Elf::initSymbolsTableViaSectionHeaders(void) const {
         triton::uint64 strTabOffset = 0;
         triton::uint64 symTabOffset = 0;
         triton::uint64 symTabSize   = 0;
@@ -280,7 +270,7 @@ namespace triton {
       }
 
 
-      void Elf::initRelTable(void) {
+      void Elf::initRelTable(void) const {
         triton::uint64 relTabOffset = 0;
         triton::uint64 relTabSize   = 0;
 
@@ -301,7 +291,7 @@ namespace triton {
       }
 
 
-      void Elf::initRelaTable(void) {
+      void Elf::initRelaTable(void) const {
         triton::uint64 relaTabOffset = 0;
         triton::uint64 relaTabSize   = 0;
 
@@ -322,7 +312,7 @@ namespace triton {
       }
 
 
-      void Elf::initJmprelTable(void) {
+      void Elf::initJmprelTable(void) const {
         triton::uint64 jmprelTabOffset = 0;
         triton::uint64 jmprelTabSize   = 0;
 
@@ -348,6 +338,42 @@ namespace triton {
       }
 
 
+      void Elf::parseSymbolsTable(void) const {
+        if (this->symbolsParsed)
+          return;
+
+        /* A table which fails to parse is dropped, the next call parses it again */
+        try {
+          this->initSymbolsTableViaProgramHeaders();  // .dyntab
+          this->initSymbolsTableViaSectionHeaders();  // .symtab
+        }
+        catch (const triton::exceptions::Elf&) {
+          this->symbolsTable.clear();
+          throw;
+        }
+
+        this->symbolsParsed = true;
+      }
+
+
+      void Elf::parseRelocationsTable(void) const {
+        if (this->relocationsParsed)
+          return;
+
+        try {
+          this->initRelTable();                       // DT_REL
+          this->initRelaTable();                      // DT_RELA
+          this->initJmprelTable();                    // DT_JMPREL
+        }
+        catch (const triton::exceptions::Elf&) {
+          this->relocationsTable.clear();
+          throw;
+        }
+
+        this->relocationsParsed = true;
+      }
+
+
       triton::uint64 Elf::getOffsetFromAddress(triton::uint64 vaddr) const {
         for (auto it = this->programHeaders.begin(); it != this->programHeaders.end(); it++) {
           if (it->getType() == triton::format::elf::PT_LOAD) {
@@ -421,11 +447,31 @@ namespace triton {
 
 
       const std::vector<triton::format::elf::ElfSymbolTable>& Elf::getSymbolsTable(void) const {
+        this->parseSymbolsTable();
         return this->symbolsTable;
       }
 
 
+      const triton::format::elf::ElfSymbolTable* Elf::getSymbol(const std::string& name) const {
+        this->parseSymbolsTable();
+
+        if (this->symbolsIndex.empty()) {
+          this->symbolsIndex.reserve(this->symbolsTable.size());
+          /* The first symbol of a name is kept, the dynamic symbols come first */
+          for (triton::usize index = 0; index < this->symbolsTable.size(); index++)
+            this->symbolsIndex.insert(std::make_pair(this->symbolsTable[index].getName(), index));
+        }
+
+        auto it = this->symbolsIndex.find(name);
+        if (it == this->symbolsIndex.end())
+          return nullptr;
+
+        return &this->symbolsTable[it->second];
+      }
+
+
       const std::vector<triton::format::elf::ElfRelocationTable>& Elf::getRelocationTable(void) const {
+        this->parseRelocationsTable();
         return this->relocationsTable;
       }
 
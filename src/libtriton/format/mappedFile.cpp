@@ -0,0 +1,132 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdio>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <triton/exceptions.hpp>
+#include <triton/mappedFile.hpp>
+
+
+
+namespace triton {
+  namespace format {
+
+    MappedFile::MappedFile() {
+      this->size   = 0;
+      this->mapped = false;
+    }
+
+
+    MappedFile::~MappedFile() {
+      this->close();
+    }
+
+
+    void MappedFile::open(const std::string& path, bool map) {
+      this->close();
+
+      #if defined(__unix__) || defined(__APPLE__)
+      if (map) {
+        struct stat st;
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+          throw triton::exceptions::Format("MappedFile::open(): Cannot open the binary file.");
+
+        if (fstat(fd, &st) != 0) {
+          ::close(fd);
+          throw triton::exceptions::Format("MappedFile::open(): Cannot read the binary file.");
+        }
+
+        /* An empty file cannot be mapped */
+        if (st.st_size > 0) {
+          /* Private, the pages are never written back to the file */
+          void* area = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (area == MAP_FAILED) {
+            ::close(fd);
+            throw triton::exceptions::Format("MappedFile::open(): Cannot map the binary file.");
+          }
+          triton::usize length = st.st_size;
+          this->data   = std::shared_ptr<triton::uint8>(static_cast<triton::uint8*>(area), [length](triton::uint8* bytes) { munmap(bytes, length); });
+          this->mapped = true;
+        }
+
+        /* The mapping stays valid without the descriptor */
+        this->size = st.st_size;
+        ::close(fd);
+        return;
+      }
+      #endif
+
+      FILE* fd = nullptr;
+
+      // Open the file
+      fd = fopen(path.c_str(), "rb");
+      if (fd == nullptr)
+        throw triton::exceptions::Format("MappedFile::open(): Cannot open the binary file.");
+
+      // Get the binary size
+      fseek(fd, 0, SEEK_END);
+      triton::usize total = ftell(fd);
+      rewind(fd);
+
+      triton::uint8* bytes = new(std::nothrow) triton::uint8[total];
+      if (!bytes) {
+        fclose(fd);
+        throw triton::exceptions::Format("MappedFile::open(): Not enough memory.");
+      }
+      this->data = std::shared_ptr<triton::uint8>(bytes, [](triton::uint8* bytes) { delete[] bytes; });
+
+      // Read the file contents
+      if (fread(bytes, 1, total, fd) != total) {
+        fclose(fd);
+        this->close();
+        throw triton::exceptions::Format("MappedFile::open(): Cannot read the binary file.");
+      }
+
+      // Close the file
+      fclose(fd);
+      this->size = total;
+    }
+
+
+    void MappedFile::close(void) {
+      this->data.reset();
+      this->size   = 0;
+      this->mapped = false;
+    }
+
+
+    triton::uint8* MappedFile::getData(void) const {
+      return this->data.get();
+    }
+
+
+    std::shared_ptr<const triton::uint8> MappedFile::getSharedData(void) const {
+      return this->data;
+    }
+
+
+    triton::usize MappedFile::getSize(void) const {
+      return this->size;
+    }
+
+
+    bool MappedFile::isMapped(void) const {
+      return this->mapped;
+    }
+
+  }; /* format namespace */
+}; /* triton namespace */
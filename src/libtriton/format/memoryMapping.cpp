@@ -18,6 +18,20 @@ namespace triton {
       this->offset          = 0;
       this->virtualAddress  = 0;
       this->size            = 0;
+      this->memorySize      = 0;
+
+      if (!this->binary)
+        throw triton::exceptions::Format("MemoryMapping::MemoryMapping(): The binary pointer cannot be null");
+    }
+
+
+    MemoryMapping::MemoryMapping(const std::shared_ptr<const triton::uint8>& file) {
+      this->binary          = file.get();
+      this->file            = file;
+      this->offset          = 0;
+      this->virtualAddress  = 0;
+      this->size            = 0;
+      this->memorySize      = 0;
 
       if (!this->binary)
         throw triton::exceptions::Format("MemoryMapping::MemoryMapping(): The binary pointer cannot be null");
@@ -26,9 +40,11 @@ namespace triton {
 
     MemoryMapping::MemoryMapping(const MemoryMapping& copy) {
       this->binary          = copy.binary;
+      this->file            = copy.file;
       this->offset          = copy.offset;
       this->virtualAddress  = copy.virtualAddress;
       this->size            = copy.size;
+      this->memorySize      = copy.memorySize;
     }
 
 
@@ -38,9 +54,11 @@ namespace triton {
 
     void MemoryMapping::operator=(const MemoryMapping& copy) {
       this->binary          = copy.binary;
+      this->file            = copy.file;
       this->offset          = copy.offset;
       this->virtualAddress  = copy.virtualAddress;
       this->size            = copy.size;
+      this->memorySize      = copy.memorySize;
     }
 
 
@@ -49,6 +67,11 @@ namespace triton {
     }
 
 
+    const std::shared_ptr<const triton::uint8>& MemoryMapping::getFile(void) const {
+      return this->file;
+    }
+
+
     triton::uint64 MemoryMapping::getOffset(void) const {
       return this->offset;
     }
@@ -69,6 +92,11 @@ namespace triton {
     }
 
 
+    triton::uint64 MemoryMapping::getMemorySize(void) const {
+      return (this->memorySize > this->size) ? this->memorySize : this->size;
+    }
+
+
     void MemoryMapping::setOffset(triton::uint64 offset) {
       this->offset = offset;
     }
@@ -83,5 +111,10 @@ namespace triton {
       this->size = size;
     }
 
+
+    void MemoryMapping::setMemorySize(triton::uint64 memorySize) {
+      this->memorySize = memorySize;
+    }
+
   }; /* format namespace */
 }; /* triton namespace */
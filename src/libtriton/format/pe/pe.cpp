@@ -5,9 +5,6 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <cstdio>
-#include <new>
-
 #include <triton/exceptions.hpp>
 #include <triton/pe.hpp>
 
@@ -17,47 +14,39 @@ namespace triton {
   namespace format {
     namespace pe {
 
-      Pe::Pe(const std::string& path) {
-        this->path      = path;
-        this->raw       = nullptr;
-        this->totalSize = 0;
+      Pe::Pe(const std::string& path, bool lazy) {
+        this->path          = path;
+        this->raw           = nullptr;
+        this->totalSize     = 0;
+        this->lazy          = lazy;
+        this->importsParsed = false;
+        this->exportsParsed = false;
 
         this->open();
         this->parse();
         this->initMemoryMapping();
-        this->initImportTable();
-        this->initExportTable();
+
+        /* In the lazy mode, the tables are parsed on their first use */
+        if (!this->lazy) {
+          this->initImportTable();
+          this->initExportTable();
+        }
       }
 
 
       Pe::~Pe() {
-        delete[] this->raw;
       }
 
 
       void Pe::open(void) {
-        FILE* fd = nullptr;
-
-        // Open the file
-        fd = fopen(this->path.c_str(), "rb");
-        if (fd == nullptr)
-          throw triton::exceptions::Pe("Pe::open(): Cannot open the binary file.");
-
-        // Get the binary size
-        fseek(fd, 0, SEEK_END);
-        this->totalSize = ftell(fd);
-        rewind(fd);
-
-        this->raw = new(std::nothrow) triton::uint8[this->totalSize];
-        if(!this->raw)
-          throw triton::exceptions::Pe("Pe::open(): Not enough memory.");
-
-        // Read the file contents
-        if (fread(this->raw, 1, this->totalSize, fd) != this->totalSize)
-          throw triton::exceptions::Pe("Pe::open(): Cannot read the binary file.");
-
-        // Close the file
-        fclose(fd);
+        try {
+          this->file.open(this->path, this->lazy);
+        }
+        catch (const triton::exceptions::Format& e) {
+          throw triton::exceptions::Pe(std::string("Pe::open(): ") + e.what());
+        }
+        this->raw       = this->file.getData();
+        this->totalSize = this->file.getSize();
       }
 
 
@@ -69,7 +58,7 @@ namespace triton {
 
       void Pe::initMemoryMapping(void) {
         for (auto&& section : this->header.getSectionHeaders()) {
-          triton::format::MemoryMapping area(this->raw);
+          triton::format::MemoryMapping area(this->file.getSharedData());
 
           triton::uint32 rawAddr  = section.getRawAddress();
           triton::uint32 rawSize  = section.getRawSize();
@@ -81,6 +70,7 @@ namespace triton {
           area.setOffset(rawAddr);
           area.setSize(rawSize);
           area.setVirtualAddress(virtAddr);
+          area.setMemorySize(section.getVirtualSize());
 
           this->memoryMapping.push_back(area);
         }
@@ -106,7 +96,11 @@ namespace triton {
       }
 
 
-      void Pe::initExportTable(void) {
+      void Pe::initExportTable(void) const {
+        if (this->exportsParsed)
+          return;
+
+        this->exportsParsed = true;
         triton::uint32 exportStart = this->header.getDataDirectory().getExportTable_rva();
         triton::uint32 exportSize  = this->header.getDataDirectory().getExportTable_size();
 
@@ -162,7 +156,11 @@ namespace triton {
       }
 
 
-      void Pe::initImportTable(void) {
+      void Pe::initImportTable(void) const {
+        if (this->importsParsed)
+          return;
+
+        this->importsParsed = true;
         triton::uint32 importStart = this->header.getDataDirectory().getImportTable_rva();
 
         if (importStart == 0)
@@ -231,16 +229,19 @@ namespace triton {
 
 
       const PeExportDirectory& Pe::getExportTable(void) const {
+        this->initExportTable();
         return this->exportTable;
       }
 
 
       const std::vector<PeImportDirectory>& Pe::getImportTable(void) const {
+        this->initImportTable();
         return this->importTable;
       }
 
 
       const std::vector<std::string>& Pe::getSharedLibraries(void) const {
+        this->initImportTable();
         return this->dlls;
       }
 
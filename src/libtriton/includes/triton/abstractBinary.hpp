@@ -61,14 +61,14 @@ namespace triton {
         triton::format::BinaryInterface* binary;
 
         //! Parse the binary
-        void parseBinary(const std::string& path);
+        void parseBinary(const std::string& path, bool lazy);
 
       public:
         //! Constructor.
         AbstractBinary();
 
-        //! Constructor.
-        AbstractBinary(const std::string& path);
+        //! Constructor. In the lazy mode, the file is mapped and its tables are parsed on their first use.
+        AbstractBinary(const std::string& path, bool lazy=false);
 
         //! Destructor.
         virtual ~AbstractBinary();
@@ -76,8 +76,8 @@ namespace triton {
         //! Returns the binary format.
         triton::format::binary_e getFormat(void) const;
 
-        //! Load a binary.
-        void loadBinary(const std::string& path);
+        //! Load a binary. In the lazy mode, the file is mapped and its tables are parsed on their first use.
+        void loadBinary(const std::string& path, bool lazy=false);
 
         //! Returns the abstract binary.
         triton::format::BinaryInterface* getBinary(void);
@@ -8,19 +8,27 @@
 #ifndef TRITON_API_H
 #define TRITON_API_H
 
+#include <list>
+#include <memory>
+
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
+#include <triton/astArena.hpp>
+#include <triton/astContext.hpp>
 #include <triton/astGarbageCollector.hpp>
 #include <triton/astRepresentation.hpp>
 #include <triton/callbacks.hpp>
+#include <triton/emulation.hpp>
 #include <triton/immediate.hpp>
 #include <triton/instruction.hpp>
 #include <triton/irBuilder.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/memoryMapping.hpp>
 #include <triton/modes.hpp>
 #include <triton/operandWrapper.hpp>
 #include <triton/register.hpp>
 #include <triton/registerSpecification.hpp>
+#include <triton/snapshotEngine.hpp>
 #include <triton/solverEngine.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
@@ -41,7 +49,12 @@ namespace triton {
  */
 
     /*! \class API
-     *  \brief This is used as C++ API. */
+     *  \brief This is used as C++ API.
+     *
+     *  \description Each instance is an independent context which owns its architecture, engines and AST nodes.
+     *  The registers are built from its CPU (see getRegister()) and the AST nodes from its AST context (see
+     *  getAstContext()), every node keeps the context which has built it. Running several analyses in parallel
+     *  means one instance per thread. */
     class API {
 
       protected:
@@ -66,12 +79,21 @@ namespace triton {
         //! The AST garbage collector interface.
         triton::ast::AstGarbageCollector* astGarbageCollector;
 
+        //! The AST arena used by the `AST_ARENA` mode. It must outlive the AST garbage collector.
+        triton::ast::AstArena* astArena;
+
         //! The IR builder.
         triton::arch::IrBuilder* irBuilder;
 
+        //! The snapshot engine.
+        triton::engines::snapshot::SnapshotEngine* snapshot;
+
         //! The Z3 interface between Triton and Z3
         triton::ast::Z3Interface* z3Interface;
 
+        //! The AST context, it builds the nodes of this instance.
+        triton::ast::AstContext astCtxt;
+
 
       public:
         //! Constructor of the API.
@@ -80,6 +102,19 @@ namespace triton {
         //! Destructor of the API.
         virtual ~API();
 
+        //! An API owns its engines and cannot be copied.
+        API(const API& copy) = delete;
+
+        //! An API owns its engines and cannot be copied.
+        API& operator=(const API& copy) = delete;
+
+
+
+        /* AST Context API =============================================================================== */
+
+        //! [**AST context api**] - Returns the AST context which builds the nodes of this instance.
+        triton::ast::AstContext& getAstContext(void);
+
 
 
         /* Architecture API ============================================================================== */
@@ -133,10 +168,25 @@ namespace triton {
         triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
 
         //! [**architecture api**] - Returns all registers. \sa triton::arch::x86::registers_e.
-        std::set<triton::arch::Register*> getAllRegisters(void) const;
+        std::set<const triton::arch::Register*> getAllRegisters(void) const;
 
         //! [**architecture api**] - Returns all parent registers. \sa triton::arch::x86::registers_e.
-        std::set<triton::arch::Register*> getParentRegisters(void) const;
+        std::set<const triton::arch::Register*> getParentRegisters(void) const;
+
+        //! [**architecture api**] - Returns the register of the CPU from its id. \sa triton::arch::x86::registers_e.
+        const triton::arch::Register& getRegister(triton::uint32 regId) const;
+
+        //! [**architecture api**] - Returns the parent register of the CPU from a register id.
+        const triton::arch::Register& getParentRegister(triton::uint32 regId) const;
+
+        //! [**architecture api**] - Returns the parent register of the CPU from a register.
+        const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
+
+        //! [**architecture api**] - Returns the program counter register of the CPU.
+        const triton::arch::Register& getProgramCounter(void) const;
+
+        //! [**architecture api**] - Returns the stack pointer register of the CPU.
+        const triton::arch::Register& getStackPointer(void) const;
 
         //! [**architecture api**] - Returns the concrete value of a memory cell.
         triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
@@ -147,6 +197,9 @@ namespace triton {
         //! [**architecture api**] - Returns the concrete value of a memory area.
         std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Reads the concrete value of a memory area into `area`, which holds at least `size` bytes.
+        void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! [**architecture api**] - Returns the concrete value of a register.
         triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -196,9 +249,45 @@ namespace triton {
         //! [**architecture api**] - Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
 
+        //! [**architecture api**] - Maps all the bytes of the pages (4 KiB) overlapping the range `[baseAddr:size]`, the bytes not mapped yet are zero. \sa unmapMemoryPages().
+        void mapMemoryPages(triton::uint64 baseAddr, triton::usize size);
+
+        //! [**architecture api**] - Removes the pages (4 KiB) overlapping the range `[baseAddr:size]` from the internal memory representation. \sa mapMemoryPages().
+        void unmapMemoryPages(triton::uint64 baseAddr, triton::usize size);
+
+        /*!
+         * \brief [**architecture api**] - Returns the 4 KiB of the page of `addr` to be read and written in place, without copy. The page is mapped.
+         *
+         * \description The bytes written through the page do not go through the callbacks and do not change the symbolic
+         * and taint states. Unmapping the page, clearing the architecture or restoring a snapshot detaches the page from
+         * the memory. The page is not shared with the snapshots taken while it is alive.
+         */
+        std::shared_ptr<triton::uint8> getConcreteMemoryPage(triton::uint64 addr);
+
+        /*!
+         * \brief [**architecture api**] - Maps the range `[baseAddr:memorySize]` as a copy-on-write view of `data`, the bytes after `size` are zero.
+         *
+         * \description The bytes are copied from `data` page per page (4 KiB), on the first access of each page, and
+         * `data` is kept alive as long as a page still needs it. The snapshots share the pages not accessed yet. Like
+         * the memory loaded from the GET_CONCRETE_MEMORY_PAGE callbacks, the view is not symbolic nor tainted.
+         */
+        void mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize);
+
+        //! [**architecture api**] - Maps a segment of a binary at its virtual address, zero-filled up to its memory size (e.g. `.bss`). \sa mapMemoryView().
+        void mapMemoryMapping(const triton::format::MemoryMapping& area);
+
+        //! [**architecture api**] - Maps all the segments of a binary, see triton::format::AbstractBinary::getMemoryMapping(). \sa mapMemoryView().
+        void mapMemoryMapping(const std::list<triton::format::MemoryMapping>& areas);
+
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! [**architecture api**] - Returns true if the instruction disassembled is a system call. \sa emulate().
+        bool isSyscall(const triton::arch::Instruction& inst) const;
+
+        //! [**architecture api**] - Returns the statistics of the decode cache (entries, hits, invalidations and misses).
+        std::map<std::string, triton::usize> getDecodeCacheStats(void) const;
+
 
 
         /* Processing API ================================================================================ */
@@ -206,6 +295,15 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Emulates from `pc` until a stop condition or `maxInstructions` instructions (0 for no limit).
+         *
+         * \description The opcodes are fetched from the concrete memory and the program counter is followed without
+         * leaving the library. The stop addresses are checked before processing an instruction, the hook and the
+         * system calls after. An instruction which cannot be disassembled raises an exception.
+         */
+        triton::arch::EmulationSummary emulate(triton::uint64 pc, const triton::arch::StopCondition& stop, triton::usize maxInstructions=0);
+
         //! [**proccesing api**] - Initialize everything.
         void initEngines(void);
 
@@ -253,6 +351,9 @@ namespace triton {
         //! [**AST garbage collector api**] - Returns all stats about AST Dictionaries.
         std::map<std::string, triton::usize> getAstDictionariesStats(void) const;
 
+        //! [**AST garbage collector api**] - Returns the AST arena used by the `AST_ARENA` mode.
+        triton::ast::AstArena* getAstArena(void) const;
+
         //! [**AST garbage collector api**] - Returns all variable nodes recorded.
         const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
 
@@ -279,6 +380,9 @@ namespace triton {
 
         /* Callbacks API ================================================================================= */
 
+        //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_PAGE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_VALUE callback.
         void addCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
@@ -296,6 +400,9 @@ namespace triton {
         //! [**callbacks api**] - Removes all recorded callbacks.
         void removeAllCallbacks(void);
 
+        //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_PAGE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
@@ -415,10 +522,10 @@ namespace triton {
         triton::engines::symbolic::SymbolicExpression* createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment="");
 
         //! [**symbolic api**] - Returns the new symbolic register expression and links this expression to the instruction.
-        triton::engines::symbolic::SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment="");
+        triton::engines::symbolic::SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment="");
 
         //! [**symbolic api**] - Returns the new symbolic flag expression and links this expression to the instruction.
-        triton::engines::symbolic::SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment="");
+        triton::engines::symbolic::SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment="");
 
         //! [**symbolic api**] - Returns the new symbolic volatile expression and links this expression to the instruction.
         triton::engines::symbolic::SymbolicExpression* createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment="");
@@ -444,7 +551,7 @@ namespace triton {
         //! [**symbolic api**] - Returns the logical conjunction vector of path constraints.
         const std::vector<triton::engines::symbolic::PathConstraint>& getPathConstraints(void) const;
 
-        //! [**symbolic api**] - Returns the logical conjunction AST of path constraints.
+        //! [**symbolic api**] - Returns the logical conjunction AST of path constraints. Constraints structurally identical to a previous one or without symbolic variable are skipped.
         triton::ast::AbstractNode* getPathConstraintsAst(void);
 
         //! [**symbolic api**] - Adds a path constraint.
@@ -514,6 +621,9 @@ namespace triton {
         //! [**solver api**] - Raises an exception if the solver engine is not initialized.
         void checkSolver(void) const;
 
+        //! [**solver api**] - Returns the instance of the solver engine.
+        triton::engines::solver::SolverEngine* getSolverEngine(void);
+
         /*!
          * \brief [**solver api**] - Computes and returns a model from a symbolic constraint.
          *
@@ -532,6 +642,52 @@ namespace triton {
          */
         std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
 
+        /*!
+         * \brief [**solver api**] - Solves a batch of independent symbolic constraints in parallel. The `limit` is the number of models returned per query.
+         *
+         * \description Each result is given to the `callback` (if any) as soon as its query is solved. All results are
+         * returned ordered as the `nodes`. \sa setSolverThreads().
+         */
+        std::vector<triton::engines::solver::SolverQueryResult> getModelsBatch(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 limit, const triton::engines::solver::solverQueryCallback& callback=nullptr) const;
+
+        /*!
+         * \brief [**solver api**] - Solves, for each path constraint, its branches not taken under the prefix of the path constraints taken before it.
+         *
+         * \description The prefix is asserted incrementally in a single solver session (see triton::engines::solver::SolverSession).
+         * The index of a result is the index of its path constraint in getPathConstraints().
+         */
+        std::vector<triton::engines::solver::SolverQueryResult> getModelsOfUntakenBranches(triton::uint32 limit, const triton::engines::solver::solverQueryCallback& callback=nullptr) const;
+
+        //! [**solver api**] - Returns the number of threads used by getModelsBatch().
+        triton::uint32 getSolverThreads(void) const;
+
+        //! [**solver api**] - Sets the number of threads used by getModelsBatch(). 0 means the number of hardware threads.
+        void setSolverThreads(triton::uint32 threads);
+
+        //! [**solver api**] - Enables or disables the solver's query cache and its independence slicing. Enabled by default.
+        void enableSolverCache(bool flag);
+
+        //! [**solver api**] - Returns true if the solver's query cache is enabled.
+        bool isSolverCacheEnabled(void) const;
+
+        //! [**solver api**] - Enables or disables the normalization (deduplication and local rewrites) of the constraints before solving them. Enabled by default.
+        void enableSolverNormalization(bool flag);
+
+        //! [**solver api**] - Returns true if the constraints are normalized before solving them.
+        bool isSolverNormalizationEnabled(void) const;
+
+        //! [**solver api**] - Loads the solver's query cache from `path` and appends the new queries to it. \sa solver_cache_file_page.
+        void setSolverCachePath(const std::string& path);
+
+        //! [**solver api**] - Clears the solver's query cache and its counters.
+        void clearSolverCache(void);
+
+        //! [**solver api**] - Returns the number of queries found in the solver's cache.
+        triton::usize getSolverCacheHits(void) const;
+
+        //! [**solver api**] - Returns the number of queries not found in the solver's cache.
+        triton::usize getSolverCacheMisses(void) const;
+
 
 
         /* Z3 interface API ============================================================================== */
@@ -556,7 +712,7 @@ namespace triton {
         triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        const std::set<triton::uint64>& getTaintedMemory(void) const;
+        const triton::engines::taint::ShadowMemory& getTaintedMemory(void) const;
 
         //! [**taint api**] - Returns the tainted registers.
         const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
@@ -579,6 +735,24 @@ namespace triton {
         //! [**taint api**] - Returns true if the register is tainted.
         bool isRegisterTainted(const triton::arch::Register& reg) const;
 
+        //! [**taint api**] - Returns the labels of the address:size. \sa triton::modes::TAINT_LABELS.
+        std::set<triton::uint32> getMemoryLabels(triton::uint64 addr, triton::uint32 size=1) const;
+
+        //! [**taint api**] - Returns the labels of the memory. \sa triton::modes::TAINT_LABELS.
+        std::set<triton::uint32> getMemoryLabels(const triton::arch::MemoryAccess& mem) const;
+
+        //! [**taint api**] - Returns the labels of the register. \sa triton::modes::TAINT_LABELS.
+        std::set<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
+        //! [**taint api**] - Taints an address and adds a label to it. The `TAINT_LABELS` mode must be enabled.
+        bool labelMemory(triton::uint64 addr, triton::uint32 label);
+
+        //! [**taint api**] - Taints a memory and adds a label to each of its bytes. The `TAINT_LABELS` mode must be enabled.
+        bool labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register and adds a label to it. The `TAINT_LABELS` mode must be enabled.
+        bool labelRegister(const triton::arch::Register& reg, triton::uint32 label);
+
         //! [**taint api**] - Sets the flag (taint or untaint) to an abstract operand (Register or Memory).
         bool setTaint(const triton::arch::OperandWrapper& op, bool flag);
 
@@ -647,9 +821,34 @@ namespace triton {
 
         //! [**taint api**] - Taints RegisterRegister with assignment. Returns true if the regDst is tainted.
         bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
+
+
+
+        /* Snapshot engine API =========================================================================== */
+
+        //! [**snapshot api**] - Raises an exception if the snapshot engine is not initialized.
+        void checkSnapshot(void) const;
+
+        //! [**snapshot api**] - Returns the instance of the snapshot engine.
+        triton::engines::snapshot::SnapshotEngine* getSnapshotEngine(void);
+
+        //! [**snapshot api**] - Takes a snapshot of the CPU, the taint and the symbolic states and returns its id.
+        triton::usize takeSnapshot(void);
+
+        //! [**snapshot api**] - Restores the snapshot `id`. The snapshot is kept, the later ones are removed.
+        void restoreSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Removes the snapshot `id` and the later ones.
+        void removeSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Returns the number of snapshots.
+        triton::usize getNumberOfSnapshots(void) const;
     };
 
-    //! The API can be accessed everywhere (WIP: will be removed).
+    //! An analysis context.
+    typedef API Context;
+
+    //! The API can be accessed everywhere (WIP: will be removed). This is the default context of every thread.
     extern triton::API api;
 
 /*! @} End of triton namespace */
@@ -8,7 +8,10 @@
 #ifndef TRITON_ARCHITECTURE_H
 #define TRITON_ARCHITECTURE_H
 
+#include <map>
+#include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 #include <triton/callbacks.hpp>
@@ -107,18 +110,45 @@ namespace triton {
         //! Clears the architecture states (registers and memory).
         void clearArchitecture(void);
 
+        //! Returns a new copy of the registers and the memory of the CPU. The memory pages are shared until written.
+        triton::arch::CpuInterface* snapshotCpu(void) const;
+
+        //! Restores the registers and the memory of the CPU from a copy returned by snapshotCpu().
+        void restoreCpu(const triton::arch::CpuInterface* cpu);
+
         //! Returns all information about the register.
         triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
 
         //! Returns all registers.
-        std::set<triton::arch::Register*> getAllRegisters(void) const;
+        std::set<const triton::arch::Register*> getAllRegisters(void) const;
 
         //! Returns all parent registers.
-        std::set<triton::arch::Register*> getParentRegisters(void) const;
+        std::set<const triton::arch::Register*> getParentRegisters(void) const;
+
+        //! Returns the register of the CPU from its id.
+        const triton::arch::Register& getRegister(triton::uint32 regId) const;
+
+        //! Returns the parent register of the CPU from a register id.
+        const triton::arch::Register& getParentRegister(triton::uint32 regId) const;
+
+        //! Returns the parent register of the CPU from a register.
+        const triton::arch::Register& getParentRegister(const triton::arch::Register& reg) const;
+
+        //! Returns the program counter register of the CPU.
+        const triton::arch::Register& getProgramCounter(void) const;
+
+        //! Returns the stack pointer register of the CPU.
+        const triton::arch::Register& getStackPointer(void) const;
 
         //! Disassembles the instruction according to the architecture.
         void disassembly(triton::arch::Instruction& inst) const;
 
+        //! Returns true if the instruction disassembled is a system call.
+        bool isSyscall(const triton::arch::Instruction& inst) const;
+
+        //! Returns the statistics of the decode cache.
+        std::map<std::string, triton::usize> getDecodeCacheStats(void) const;
+
         //! Builds the instruction semantics according to the architecture. Returns true if the instruction is supported.
         bool buildSemantics(triton::arch::Instruction& inst);
 
@@ -131,6 +161,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! Reads the concrete value of a memory area into `area`, which holds at least `size` bytes.
+        void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! Returns the concrete value of a register.
         triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -179,6 +212,18 @@ namespace triton {
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Maps all the bytes of the pages overlapping the range `[baseAddr:size]`, the bytes not mapped yet are zero.
+        void mapMemoryPages(triton::uint64 baseAddr, triton::usize size);
+
+        //! Removes the pages overlapping the range `[baseAddr:size]` from the internal memory representation.
+        void unmapMemoryPages(triton::uint64 baseAddr, triton::usize size);
+
+        //! Returns the bytes of the page of `addr` to be read and written in place.
+        std::shared_ptr<triton::uint8> getConcreteMemoryPage(triton::uint64 addr);
+
+        //! Maps the range `[baseAddr:memorySize]` as a copy-on-write view of `data`, the bytes after `size` are zero.
+        void mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize);
     };
 
   /*! @} End of arch namespace */
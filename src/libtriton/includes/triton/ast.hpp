@@ -8,16 +8,20 @@
 #ifndef TRITON_AST_H
 #define TRITON_AST_H
 
+#include <cstddef>
 #include <list>
 #include <map>
+#include <new>
 #include <ostream>
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <triton/astEnums.hpp>
 #include <triton/astVisitor.hpp>
+#include <triton/smallBitvector.hpp>
 #include <triton/symbolicVariable.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -38,9 +42,17 @@ namespace triton {
    *  @{
    */
 
+    class AstContext;
+
+    //! A 128-bits structural hash, see AbstractNode::getStructuralHash().
+    typedef std::pair<triton::uint64, triton::uint64> hash128;
+
     //! Abstract node
     class AbstractNode {
       protected:
+        //! The context which has built the node.
+        AstContext& ctxt;
+
         //! The kind of the node.
         enum kind_e kind;
 
@@ -54,24 +66,48 @@ namespace triton {
         triton::uint32 size;
 
         //! The value of the tree from this root node.
-        triton::uint512 eval;
+        triton::SmallBitvector eval;
 
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! True if the node has been allocated from an AST arena, see destroy().
+        bool arenaAllocated;
+
+        //! The structural hash of the tree from this root node.
+        triton::ast::hash128 structuralHash;
+
+        //! Computes the structural hash from the kind, size, payload and childs' hashes. Called by init().
+        void initHash(void);
+
+        //! Only used by the deleting destructors, a node must be freed with destroy().
+        static void operator delete(void* ptr) noexcept;
+
       public:
         //! Constructor.
-        AbstractNode(enum kind_e kind);
+        AbstractNode(enum kind_e kind, AstContext& ctxt);
 
         //! Constructor by copy.
         AbstractNode(const AbstractNode& copy);
 
-        //! Constructor.
-        AbstractNode();
-
         //! Destructor.
         virtual ~AbstractNode();
 
+        //! Allocates a node from the AST arena bound to `ctxt`, or from the heap if there is none. Returns nullptr on failure.
+        static void* operator new(std::size_t size, AstContext& ctxt) noexcept;
+
+        //! Frees a node whose constructor has thrown.
+        static void operator delete(void* ptr, AstContext& ctxt) noexcept;
+
+        //! Destroys a node and gives its memory back to where it has been allocated from.
+        static void destroy(AbstractNode* node);
+
+        //! Returns the context which has built the node.
+        AstContext& getContext(void) const;
+
+        //! Returns true if the node has been allocated from an AST arena.
+        bool isArenaAllocated(void) const;
+
         //! Returns the kind of the node.
         enum kind_e getKind(void) const;
 
@@ -90,6 +126,9 @@ namespace triton {
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
+        //! Returns the value of the tree without converting it, see triton::SmallBitvector.
+        const triton::SmallBitvector& getEvaluation(void) const;
+
         //! Returns the childs of the node.
         std::vector<AbstractNode*>& getChilds(void);
 
@@ -127,6 +166,14 @@ namespace triton {
 
         //! Returns the has of the tree. The hash is computed recursively on the whole tree.
         virtual triton::uint512 hash(triton::uint32 deep) = 0;
+
+        /*!
+         * \brief Returns the structural hash of the tree.
+         *
+         * \description Computed by init() from the node and the hashes of its childs, so it costs nothing to get.
+         * Two trees with the same structure have the same hash. A reference has the hash of the expression it points to.
+         */
+        const triton::ast::hash128& getStructuralHash(void) const;
     };
 
 
@@ -181,7 +228,7 @@ namespace triton {
     //! `(_ BitVec x)` node
     class BvdeclNode : public AbstractNode {
       public:
-        BvdeclNode(triton::uint32 size);
+        BvdeclNode(AstContext& ctxt, triton::uint32 size);
         BvdeclNode(const BvdeclNode& copy);
         virtual ~BvdeclNode();
         virtual void init(void);
@@ -507,7 +554,7 @@ namespace triton {
     //! `(_ bv<value> <size>)` node
     class BvNode : public AbstractNode {
       public:
-        BvNode(triton::uint512 value, triton::uint32 size);
+        BvNode(AstContext& ctxt, triton::uint512 value, triton::uint32 size);
         BvNode(const BvNode& copy);
         virtual ~BvNode();
         virtual void init(void);
@@ -519,7 +566,7 @@ namespace triton {
     //! compound node
     class CompoundNode : public AbstractNode {
       public:
-        CompoundNode(std::vector<AbstractNode*> exprs);
+        CompoundNode(AstContext& ctxt, std::vector<AbstractNode*> exprs);
         CompoundNode(const CompoundNode& copy);
         virtual ~CompoundNode();
         virtual void init(void);
@@ -532,8 +579,8 @@ namespace triton {
     class ConcatNode : public AbstractNode {
       public:
         ConcatNode(AbstractNode* expr1, AbstractNode* expr2);
-        ConcatNode(std::vector<AbstractNode* > exprs);
-        ConcatNode(std::list<AbstractNode* > exprs);
+        ConcatNode(AstContext& ctxt, std::vector<AbstractNode* > exprs);
+        ConcatNode(AstContext& ctxt, std::list<AbstractNode* > exprs);
         ConcatNode(const ConcatNode& copy);
         virtual ~ConcatNode();
         virtual void init(void);
@@ -548,7 +595,7 @@ namespace triton {
         triton::uint512 value;
 
       public:
-        DecimalNode(triton::uint512 value);
+        DecimalNode(AstContext& ctxt, triton::uint512 value);
         DecimalNode(const DecimalNode& copy);
         virtual ~DecimalNode();
         virtual void init(void);
@@ -671,9 +718,10 @@ namespace triton {
     class ReferenceNode : public AbstractNode {
       protected:
         triton::usize value;
+        std::set<AbstractNode*> targets;
 
       public:
-        ReferenceNode(triton::usize value);
+        ReferenceNode(AstContext& ctxt, triton::usize value);
         ReferenceNode(const ReferenceNode& copy);
         virtual ~ReferenceNode();
         virtual void init(void);
@@ -681,6 +729,12 @@ namespace triton {
         virtual triton::uint512 hash(triton::uint32 deep);
 
         triton::usize getValue(void);
+
+        //! Removes the reference from the parents of the ASTs it has pointed to.
+        void detach(void);
+
+        //! Forgets an AST which is about to be freed.
+        void removeTarget(AbstractNode* node);
     };
 
 
@@ -690,7 +744,7 @@ namespace triton {
         std::string value;
 
       public:
-        StringNode(std::string value);
+        StringNode(AstContext& ctxt, std::string value);
         StringNode(const StringNode& copy);
         virtual ~StringNode();
         virtual void init(void);
@@ -719,7 +773,7 @@ namespace triton {
         std::string value;
 
       public:
-        VariableNode(triton::engines::symbolic::SymbolicVariable& symVar);
+        VariableNode(AstContext& ctxt, triton::engines::symbolic::SymbolicVariable& symVar);
         VariableNode(const VariableNode& copy);
         virtual ~VariableNode();
         virtual void init(void);
@@ -750,171 +804,6 @@ namespace triton {
     bool operator==(AbstractNode& node1, AbstractNode& node2);
 
 
-    //! AST C++ API - bv node builder
-    AbstractNode* bv(triton::uint512 value, triton::uint32 size);
-
-    //! AST C++ API - bvadd node builder
-    AbstractNode* bvadd(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvand node builder
-    AbstractNode* bvand(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvashr node builder
-    AbstractNode* bvashr(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvdecl node builder
-    AbstractNode* bvdecl(triton::uint32 size);
-
-    //! AST C++ API - bvfalse node builder
-    AbstractNode* bvfalse(void);
-
-    //! AST C++ API - bvlshr node builder
-    AbstractNode* bvlshr(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvmul node builder
-    AbstractNode* bvmul(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvnand node builder
-    AbstractNode* bvnand(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvneg node builder
-    AbstractNode* bvneg(AbstractNode* expr);
-
-    //! AST C++ API - bvnor node builder
-    AbstractNode* bvnor(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvnot node builder
-    AbstractNode* bvnot(AbstractNode* expr);
-
-    //! AST C++ API - bvor node builder
-    AbstractNode* bvor(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvrol node builder
-    AbstractNode* bvrol(triton::uint32 rot, AbstractNode* expr);
-
-    //! AST C++ API - bvrol node builder
-    AbstractNode* bvrol(AbstractNode* rot, AbstractNode* expr);
-
-    //! AST C++ API - bvror node builder
-    AbstractNode* bvror(triton::uint32 rot, AbstractNode* expr);
-
-    //! AST C++ API - bvror node builder
-    AbstractNode* bvror(AbstractNode* rot, AbstractNode* expr);
-
-    //! AST C++ API - bvsdiv node builder
-    AbstractNode* bvsdiv(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvsge node builder
-    AbstractNode* bvsge(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvsgt node builder
-    AbstractNode* bvsgt(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvshl node builder
-    AbstractNode* bvshl(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvsle node builder
-    AbstractNode* bvsle(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvslt node builder
-    AbstractNode* bvslt(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvsmod node builder
-    AbstractNode* bvsmod(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvsrem node builder
-    AbstractNode* bvsrem(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvsub node builder
-    AbstractNode* bvsub(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvtrue node builder
-    AbstractNode* bvtrue(void);
-
-    //! AST C++ API - bvudiv node builder
-    AbstractNode* bvudiv(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvuge node builder
-    AbstractNode* bvuge(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvugt node builder
-    AbstractNode* bvugt(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvule node builder
-    AbstractNode* bvule(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvult node builder
-    AbstractNode* bvult(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvurem node builder
-    AbstractNode* bvurem(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvxnor node builder
-    AbstractNode* bvxnor(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - bvxor node builder
-    AbstractNode* bvxor(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - compound node builder
-    AbstractNode* compound(std::vector<AbstractNode* > exprs);
-
-    //! AST C++ API - concat node builder
-    AbstractNode* concat(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - concat node builder
-    AbstractNode* concat(std::vector<AbstractNode* > exprs);
-
-    //! AST C++ API - concat node builder
-    AbstractNode* concat(std::list<AbstractNode* > exprs);
-
-    //! AST C++ API - decimal node builder
-    AbstractNode* decimal(triton::uint512 value);
-
-    //! AST C++ API - declare node builder
-    AbstractNode* declareFunction(std::string name, AbstractNode* bvDecl);
-
-    //! AST C++ API - distinct node builder
-    AbstractNode* distinct(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - equal node builder
-    AbstractNode* equal(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - extract node builder
-    AbstractNode* extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr);
-
-    //! AST C++ API - ite node builder
-    AbstractNode* ite(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr);
-
-    //! AST C++ API - land node builder
-    AbstractNode* land(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - let node builder
-    AbstractNode* let(std::string alias, AbstractNode* expr2, AbstractNode* expr3);
-
-    //! AST C++ API - lnot node builder
-    AbstractNode* lnot(AbstractNode* expr);
-
-    //! AST C++ API - lor node builder
-    AbstractNode* lor(AbstractNode* expr1, AbstractNode* expr2);
-
-    //! AST C++ API - reference node builder
-    AbstractNode* reference(triton::usize value);
-
-    //! AST C++ API - assert node builder
-    AbstractNode* assert_(AbstractNode* expr);
-
-    //! AST C++ API - string node builder
-    AbstractNode* string(std::string value);
-
-    //! AST C++ API - sx node builder
-    AbstractNode* sx(triton::uint32 sizeExt, AbstractNode* expr);
-
-    //! AST C++ API - variable node builder
-    AbstractNode* variable(triton::engines::symbolic::SymbolicVariable& symVar);
-
-    //! AST C++ API - zx node builder
-    AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr);
-
     //! AST C++ API - Duplicates the AST
     AbstractNode* newInstance(AbstractNode* node);
 
@@ -924,6 +813,12 @@ namespace triton {
     //! Custom rotate left function for hash routine.
     triton::uint512 rotl(triton::uint512 value, triton::uint32 shift);
 
+    //! Mixes a 64-bits value into a lane of a structural hash.
+    triton::uint64 mixHash(triton::uint64 h, triton::uint64 v);
+
+    //! Mixes a 64-bits value into both lanes of a structural hash, the second lane mixes its complement.
+    void mixHash(triton::ast::hash128& h, triton::uint64 v);
+
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
@@ -0,0 +1,152 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTARENA_H
+#define TRITON_ASTARENA_H
+
+#include <cstddef>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    class AbstractNode;
+
+    //! \class AstArena
+    /*! \brief The AST arena class
+     *
+     * \description Used by the `AST_ARENA` mode. AST nodes are carved out of large slabs, one list of slabs
+     * per size of node (thus per kind of node), and a freed node goes back to the free list of its size.
+     * Nodes adopted by the arena (see adopt()) are not tracked one by one by the garbage collector, they are
+     * destroyed at once by releaseScope() (every node built since beginScope()) or releaseAll().
+     *
+     * Every block starts with a small header, so a node too large for a slab, allocated from the heap, can be
+     * freed through the same path. Nodes built while the mode is disabled do not go through the arena at all,
+     * see AbstractNode::destroy().
+     */
+    class AstArena {
+      private:
+        //! The header of a block.
+        struct header {
+          //! The arena of the block, nullptr if it comes from the heap.
+          AstArena* arena;
+
+          //! The index of its size class.
+          triton::uint32 sizeClass;
+
+          //! True if the block holds a node.
+          bool live;
+
+          //! True if the node is owned by the arena.
+          bool owned;
+        };
+
+        //! A list of slabs of blocks of the same size.
+        struct sizeClass {
+          //! The slabs and the number of bytes carved out of each one.
+          std::vector<std::pair<triton::uint8*, triton::usize>> slabs;
+
+          //! The freed blocks.
+          std::vector<header*> freeBlocks;
+        };
+
+        //! The size of a header, keeps the nodes aligned.
+        static const triton::usize headerSize = 16;
+
+        //! The size granularity of blocks.
+        static const triton::usize granularity = 16;
+
+        //! Larger nodes are allocated from the heap.
+        static const triton::usize maxBlockSize = 512;
+
+        //! The size of a slab.
+        static const triton::usize slabSize = 64 * 1024;
+
+        //! The size classes.
+        std::vector<sizeClass> classes;
+
+        //! The blocks allocated since beginScope().
+        std::vector<header*> scope;
+
+        //! True if a scope is open.
+        bool scopeOpened;
+
+        //! The number of live blocks.
+        triton::usize liveBlocks;
+
+        //! Returns a block of the size class `index`.
+        header* allocateBlock(triton::uint32 index);
+
+        //! Destroys the node of a block and puts the block back in its free list.
+        void destroyBlock(header* block);
+
+        //! Puts a block back in its free list.
+        void releaseBlock(header* block);
+
+      public:
+        //! Constructor.
+        AstArena();
+
+        //! Destructor. Destroys every node still alive.
+        ~AstArena();
+
+        //! Allocates `size` bytes, from the heap if it does not fit in a block. Returns nullptr if there is not enough memory.
+        void* allocate(std::size_t size);
+
+        //! Frees an object returned by allocate().
+        static void release(void* object);
+
+        //! Gives the ownership of a node allocated from an arena to the arena. Does nothing for a node too large for a slab or not allocated from an arena.
+        static bool adopt(AbstractNode* node);
+
+        //! Returns true if a node allocated from an arena is alive and owned by the arena.
+        static bool isOwned(const AbstractNode* node);
+
+        //! Opens a scope, every node allocated until releaseScope() or endScope() is recorded.
+        void beginScope(void);
+
+        //! Closes the scope and keeps its nodes.
+        void endScope(void);
+
+        //! Closes the scope and destroys at once all its nodes owned by the arena.
+        void releaseScope(void);
+
+        //! Returns true if a scope is open.
+        bool isScopeOpened(void) const;
+
+        //! Destroys all nodes owned by the arena. Slabs are freed if no node is left.
+        void releaseAll(void);
+
+        //! Returns the number of nodes alive in the arena.
+        triton::usize getNumberOfLiveNodes(void) const;
+
+        //! Returns the number of slabs allocated.
+        triton::usize getNumberOfSlabs(void) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTARENA_H */
@@ -10,8 +10,11 @@
 
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <triton/ast.hpp>
+#include <triton/astArena.hpp>
 #include <triton/astDictionaries.hpp>
 #include <triton/modes.hpp>
 #include <triton/tritonTypes.hpp>
@@ -43,8 +46,26 @@ namespace triton {
         //! Defines if this instance is used as a backup.
         bool backupFlag;
 
+        //! The AST arena, owned by the API. Null for a backup.
+        triton::ast::AstArena* arena;
+
+        //! True if a journal is opened by beginJournal().
+        bool journalOpened;
+
+        //! The checkpoints, the sizes of the journals when they were added. The nodes are journaled while there is one.
+        std::vector<std::pair<triton::usize, triton::usize>> checkpoints;
+
+        //! The nodes recorded since the first checkpoint.
+        std::vector<triton::ast::AbstractNode*> journal;
+
+        //! The nodes adopted by the AST arena since the first checkpoint.
+        std::vector<triton::ast::AbstractNode*> arenaJournal;
+
+        //! Removes a set of nodes about to be freed from the parents of the nodes they point to.
+        void detachAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) const;
+
       protected:
-        //! This container contains all allocated nodes.
+        //! This container contains all allocated nodes, except the nodes adopted by the AST arena.
         std::set<triton::ast::AbstractNode*> allocatedNodes;
 
         //! This map maintains a link between symbolic variables and their nodes.
@@ -52,7 +73,7 @@ namespace triton {
 
       public:
         //! Constructor.
-        AstGarbageCollector(triton::modes::Modes* modes, bool isBackup=false);
+        AstGarbageCollector(triton::modes::Modes* modes, bool isBackup=false, triton::ast::AstArena* arena=nullptr);
 
         //! Constructor by copy.
         AstGarbageCollector(const AstGarbageCollector& other);
@@ -81,6 +102,35 @@ namespace triton {
         //! Records a variable AST node.
         void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
 
+        //! Adds a checkpoint and returns its index. The nodes recorded are journaled while there is a checkpoint.
+        triton::usize newCheckpoint(void);
+
+        /*!
+         * \brief Frees every node recorded since the checkpoint `index` which is still allocated. The later checkpoints are removed.
+         *
+         * \description The remaining nodes no longer point to the freed ones. It must be called before
+         * SymbolicEngine::restoreCheckpoint() which initializes the restored ASTs again.
+         */
+        void restoreCheckpoint(triton::usize index);
+
+        //! Removes the checkpoint `index` and the later ones, the nodes are kept.
+        void removeCheckpoint(triton::usize index);
+
+        //! Returns the number of checkpoints.
+        triton::usize getNumberOfCheckpoints(void) const;
+
+        //! Starts to journal the recorded nodes, adds a checkpoint restored and removed by rollbackJournal().
+        void beginJournal(void);
+
+        //! Frees every node recorded since beginJournal() which is still allocated.
+        void rollbackJournal(void);
+
+        //! Returns true if a journal is opened by beginJournal().
+        bool isJournalOpened(void) const;
+
+        //! Returns the AST arena.
+        triton::ast::AstArena* getAstArena(void) const;
+
         //! Returns all allocated nodes.
         const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
 
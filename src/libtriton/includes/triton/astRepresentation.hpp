@@ -73,9 +73,6 @@ namespace triton {
           std::ostream& print(std::ostream& stream, AbstractNode* node);
       };
 
-      //! The AST representation interface as global for all instances of API.
-      extern triton::ast::representations::AstRepresentation astRepresentation;
-
     /*! @} End of representations namespace */
     };
   /*! @} End of ast namespace */
@@ -41,8 +41,17 @@ namespace triton {
       GET_CONCRETE_MEMORY_VALUE,    /*!< Get concrete memory value callback */
       GET_CONCRETE_REGISTER_VALUE,  /*!< Get concrete register value callback */
       SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_PAGE,     /*!< Get concrete memory page callback */
     };
 
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_PAGE callback.
+     *
+     * \description The callback takes as arguments the address of a page which is not in the memory yet and
+     * a zeroed buffer of `size` bytes to fill. It returns true if it has filled the page, which is then mapped
+     * and the callbacks are not called anymore for it. Callbacks are called in order until one returns true.
+     */
+    typedef bool (*getConcreteMemoryPageCallback)(triton::uint64 addr, triton::uint8* area, triton::usize size);
+
     /*! \brief The prototype of a GET_CONCRETE_MEMORY_VALUE callback.
      *
      * \description The callback takes as unique argument a memory access. Callbacks will
@@ -69,6 +78,9 @@ namespace triton {
     class Callbacks {
       protected:
         #ifdef TRITON_PYTHON_BINDINGS
+        //! [python] Callbacks for all concrete memory pages needs.
+        std::list<PyObject*> pyGetConcreteMemoryPageCallbacks;
+
         //! [python] Callbacks for all concrete memory needs.
         std::list<PyObject*> pyGetConcreteMemoryValueCallbacks;
 
@@ -79,6 +91,9 @@ namespace triton {
         std::list<PyObject*> pySymbolicSimplificationCallbacks;
         #endif
 
+        //! [c++] Callbacks for all concrete memory pages needs.
+        std::list<triton::callbacks::getConcreteMemoryPageCallback> getConcreteMemoryPageCallbacks;
+
         //! [c++] Callbacks for all concrete memory needs.
         std::list<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
 
@@ -88,6 +103,9 @@ namespace triton {
         //! [c++] Callbacks for all symbolic simplifications.
         std::list<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
 
+        //! Incremented each time a callback is added or removed.
+        triton::usize version;
+
         //! Returns the number of callbacks recorded.
         triton::usize countCallbacks(void) const;
 
@@ -107,6 +125,9 @@ namespace triton {
         //! Copies a Callbacks class
         void operator=(const Callbacks& copy);
 
+        //! Adds a GET_CONCRETE_MEMORY_PAGE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! Adds a GET_CONCRETE_MEMORY_VALUE callback.
         void addCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
@@ -124,6 +145,9 @@ namespace triton {
         //! Removes all recorded callbacks.
         void removeAllCallbacks(void);
 
+        //! Deletes a GET_CONCRETE_MEMORY_PAGE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryPageCallback cb);
+
         //! Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
@@ -138,6 +162,12 @@ namespace triton {
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
         #endif
 
+        //! Returns a number which changes each time a callback is added or removed.
+        triton::usize getVersion(void) const;
+
+        //! Returns true if there is at least one callback of this kind.
+        bool hasCallbacks(triton::callbacks::callback_e kind) const;
+
         //! Processes callbacks according to the kind and the C++ polymorphism.
         triton::ast::AbstractNode* processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const;
 
@@ -146,6 +176,9 @@ namespace triton {
 
         //! Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism. Returns true if a callback has filled `area`.
+        bool processCallbacks(triton::callbacks::callback_e kind, triton::uint64 addr, triton::uint8* area, triton::usize size) const;
     };
 
   /*! @} End of callbacks namespace */
@@ -0,0 +1,243 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_CONCRETEMEMORY_H
+#define TRITON_CONCRETEMEMORY_H
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <triton/callbacks.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! \class ConcreteMemory
+    /*! \brief The concrete memory of a CPU.
+     *
+     * \description The memory is split into pages of 4 KiB allocated on the first write, an area is read and
+     * written with one `memcpy` per page. Each page also records which of its bytes are mapped, a page is
+     * freed when all its bytes are unmapped. Copying a ConcreteMemory shares its pages, a shared page is
+     * copied by the first write on it (copy-on-write), so copies of a large memory are cheap.
+     *
+     * A page may also be exported (see getPage()) to be read and written in place. An exported page is
+     * never shared: copying the memory copies it, so writes through the export do not reach the copies.
+     *
+     * When GET_CONCRETE_MEMORY_PAGE callbacks are defined, a page which is not allocated is asked to them on
+     * its first access (read, write or mapping test), like a page fault. A page provided is fully mapped and
+     * the callbacks are not called again for it until it is unmapped. A page declined by all the callbacks is
+     * not asked again until it is mapped or unmapped, or until a callback is added or removed.
+     *
+     * An area may also be mapped as a view of a file (see mapView()): its pages are read from the file in place
+     * and copied on their first write only, and the copies of the memory share the views of the pages not written yet.
+     */
+    class ConcreteMemory {
+      public:
+        //! The number of bits of the offset in a page.
+        static const triton::uint32 pageBits = 12;
+
+        //! The size of a page in bytes.
+        static const triton::uint32 pageSize = (1 << pageBits);
+
+      private:
+        //! A page of memory.
+        class Page {
+          public:
+            //! The bytes of the page, unmapped bytes are zero.
+            triton::uint8 data[pageSize];
+
+            //! The mapped bytes, one bit per byte.
+            triton::uint64 mapped[pageSize / 64];
+
+            //! The number of mapped bytes.
+            triton::uint32 count;
+
+            //! The number of exports of the page.
+            triton::uint32 exported;
+        };
+
+        //! A part of a page mapped as a view of a file.
+        class Chunk {
+          public:
+            //! The bytes of the file, nullptr for a zero-filled part.
+            const triton::uint8* data;
+
+            //! The offset of the part in the page.
+            triton::uint32 offset;
+
+            //! The size of the part.
+            triton::uint32 length;
+        };
+
+        //! The views of the pages not written yet, shared by the copies of the memory.
+        class Views {
+          public:
+            //! The map of page number -> parts of the page, in the order of the mappings.
+            std::unordered_map<triton::uint64, std::vector<Chunk>> chunks;
+
+            //! The owners of the file bytes.
+            std::vector<std::shared_ptr<const triton::uint8>> files;
+        };
+
+        //! The map of page number -> page. Mutable as the pages provided by the callbacks are loaded on read.
+        mutable std::unordered_map<triton::uint64, std::shared_ptr<Page>> pages;
+
+        //! The views of the pages not written yet, nullptr if there is none.
+        std::shared_ptr<Views> views;
+
+        //! The callbacks which provide the pages not allocated, may be nullptr.
+        triton::callbacks::Callbacks* callbacks;
+
+        //! True while the callbacks provide a page, the memory accessed by the callbacks is not provided.
+        mutable bool loading;
+
+        //! The pages declined by the callbacks, they are not asked again.
+        mutable std::unordered_set<triton::uint64> declined;
+
+        //! The version of the callbacks which declined the pages, see Callbacks::getVersion().
+        mutable triton::usize declinedVersion;
+
+        //! Forgets the pages `[first:last]` declined by the callbacks.
+        void forgetDeclined(triton::uint64 first, triton::uint64 last);
+
+        //! The number of the last page read.
+        mutable triton::uint64 lastNumber;
+
+        //! The last page read, nullptr if unknown.
+        mutable const Page* lastPage;
+
+        //! The number of the last view read.
+        mutable triton::uint64 lastViewNumber;
+
+        //! The last view read, nullptr if unknown. Its page is not allocated.
+        mutable const std::vector<Chunk>* lastView;
+
+        //! Returns the page of an address, nullptr if the page is not allocated, is a view or is not provided by the callbacks.
+        const Page* findPage(triton::uint64 addr) const;
+
+        //! Returns the view of the page of an address which is not allocated, nullptr if there is none.
+        const std::vector<Chunk>* findView(triton::uint64 addr) const;
+
+        //! Reads the bytes `[offset:length]` of a view into `area`, the bytes out of the view are zero.
+        static void readView(const std::vector<Chunk>& view, triton::uint32 offset, triton::uint8* area, triton::uint32 length);
+
+        //! Returns true if all the bytes `[offset:length]` of a page are in its view.
+        static bool isViewMapped(const std::vector<Chunk>& view, triton::uint32 offset, triton::uint32 length);
+
+        //! Asks the callbacks for the page `number` and records it. Returns nullptr if no callback provides it.
+        Page* loadPage(triton::uint64 number) const;
+
+        //! Copies the views of the page `number` into a new page and records it. Returns nullptr if there is no view.
+        Page* loadView(triton::uint64 number) const;
+
+        //! Returns the page `number` from the views or the callbacks, nullptr if none of them has it.
+        Page* faultPage(triton::uint64 number) const;
+
+        //! Forgets the views of the pages `[first:last]`.
+        void dropViews(triton::uint64 first, triton::uint64 last);
+
+        //! Returns a new page, all its bytes are zero and unmapped.
+        static std::shared_ptr<Page> newPage(void);
+
+        //! Returns the page of an address to write it. The page is allocated or copied if needed.
+        Page* writablePage(triton::uint64 addr);
+
+        //! Returns true if the page is shared with another ConcreteMemory.
+        static bool isShared(const std::shared_ptr<Page>& page);
+
+        //! Marks the bytes `[offset:size]` of a page as mapped.
+        static void mapBytes(Page* page, triton::uint32 offset, triton::uint32 size);
+
+        //! Copies a ConcreteMemory.
+        void copy(const ConcreteMemory& other);
+
+      public:
+        //! Constructor.
+        ConcreteMemory(triton::callbacks::Callbacks* callbacks=nullptr);
+
+        //! Constructor by copy. The pages and the callbacks are shared.
+        ConcreteMemory(const ConcreteMemory& other);
+
+        //! Copies a ConcreteMemory. The pages are shared, the callbacks are kept.
+        ConcreteMemory& operator=(const ConcreteMemory& other);
+
+        //! Sets the callbacks which provide the pages not allocated.
+        void setCallbacks(triton::callbacks::Callbacks* callbacks);
+
+        //! Returns the byte at `addr`, zero if it is not mapped.
+        triton::uint8 read(triton::uint64 addr) const;
+
+        //! Reads the area `[addr:size]` into `area`, unmapped bytes are zero.
+        void read(triton::uint64 addr, triton::uint8* area, triton::usize size) const;
+
+        //! Writes the byte at `addr`.
+        void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Writes `area` into the area `[addr:size]`.
+        void write(triton::uint64 addr, const triton::uint8* area, triton::usize size);
+
+        //! Returns true if all bytes of the area `[addr:size]` are mapped.
+        bool isMapped(triton::uint64 addr, triton::usize size) const;
+
+        //! Unmaps the area `[addr:size]`.
+        void unmap(triton::uint64 addr, triton::usize size);
+
+        //! Maps all the bytes of the pages overlapping the area `[addr:size]`, the bytes not mapped yet are zero.
+        void mapPages(triton::uint64 addr, triton::usize size);
+
+        //! Unmaps the pages overlapping the area `[addr:size]`.
+        void unmapPages(triton::uint64 addr, triton::usize size);
+
+        /*!
+         * \brief Maps the area `[addr:memorySize]` as a view of `data`, the bytes after `size` are zero (e.g. `.bss`).
+         *
+         * \description The pages already allocated are written now, the others are read from `data` in place and
+         * copied on their first write. `data` is kept alive as long as a page still needs it.
+         */
+        void mapView(triton::uint64 addr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize);
+
+        /*!
+         * \brief Returns the `pageSize` bytes of the page of `addr` to be read and written in place. The page is mapped.
+         *
+         * \description The page stays alive as long as the returned pointer. Unmapping the page, clearing the memory
+         * or assigning another memory to this one detaches the page: its bytes are not the ones of the memory anymore.
+         */
+        std::shared_ptr<triton::uint8> getPage(triton::uint64 addr);
+
+        //! Returns the number of allocated pages.
+        triton::usize getNumberOfPages(void) const;
+
+        //! Returns the number of pages shared with another ConcreteMemory.
+        triton::usize getNumberOfSharedPages(void) const;
+
+        //! Unmaps all the memory.
+        void clear(void);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_CONCRETEMEMORY_H */
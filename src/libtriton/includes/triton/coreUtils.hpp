@@ -38,6 +38,37 @@ namespace triton {
     //! Returns the value located into the buffer.
     template <typename T> T fromBufferToUint(const triton::uint8* buffer);
 
+    //! Returns the number of bits set. Inlined, the paged memories call it per word.
+    inline triton::uint32 popCount(triton::uint64 value) {
+      #if defined(__GNUC__)
+      return __builtin_popcountll(value);
+      #else
+      triton::uint32 count = 0;
+      for (; value; value &= value - 1)
+        count++;
+      return count;
+      #endif
+    }
+
+    //! Returns the index of the lowest bit set, `value` must not be zero.
+    inline triton::uint32 lowestBit(triton::uint64 value) {
+      #if defined(__GNUC__)
+      return __builtin_ctzll(value);
+      #else
+      triton::uint32 index = 0;
+      for (; (value & 1) == 0; value >>= 1)
+        index++;
+      return index;
+      #endif
+    }
+
+    //! Returns the mask of the bits `[low:high[` of a word.
+    inline triton::uint64 rangeMask(triton::uint32 low, triton::uint32 high) {
+      if (high - low == 64)
+        return static_cast<triton::uint64>(-1);
+      return ((static_cast<triton::uint64>(1) << (high - low)) - 1) << low;
+    }
+
   /*! @} End of triton namespace */
   };
 /*! @} End of triton namespace */
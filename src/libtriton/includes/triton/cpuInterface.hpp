@@ -8,7 +8,10 @@
 #ifndef TRITON_CPUINTERFACE_HPP
 #define TRITON_CPUINTERFACE_HPP
 
+#include <map>
+#include <memory>
 #include <set>
+#include <string>
 #include <vector>
 
 #include <triton/instruction.hpp>
@@ -69,14 +72,32 @@ namespace triton {
         virtual triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const = 0;
 
         //! Returns all registers.
-        virtual std::set<triton::arch::Register*> getAllRegisters(void) const = 0;
+        virtual std::set<const triton::arch::Register*> getAllRegisters(void) const = 0;
 
         //! Returns all parent registers.
-        virtual std::set<triton::arch::Register*> getParentRegisters(void) const = 0;
+        virtual std::set<const triton::arch::Register*> getParentRegisters(void) const = 0;
+
+        //! Returns the register of this CPU from its id. Returns an invalid register if the id is not valid.
+        virtual const triton::arch::Register& getRegister(triton::uint32 regId) const = 0;
+
+        //! Returns the parent register of this CPU from a register id.
+        virtual const triton::arch::Register& getParentRegister(triton::uint32 regId) const = 0;
+
+        //! Returns the program counter register.
+        virtual const triton::arch::Register& getProgramCounter(void) const = 0;
+
+        //! Returns the stack pointer register.
+        virtual const triton::arch::Register& getStackPointer(void) const = 0;
 
         //! Disassembles the instruction according to the architecture.
         virtual void disassembly(triton::arch::Instruction& inst) const = 0;
 
+        //! Returns true if the instruction disassembled is a system call.
+        virtual bool isSyscall(const triton::arch::Instruction& inst) const = 0;
+
+        //! Returns the statistics of the decode cache.
+        virtual std::map<std::string, triton::usize> getDecodeCacheStats(void) const = 0;
+
         //! Returns the concrete value of a memory cell.
         virtual triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const = 0;
 
@@ -86,6 +107,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         virtual std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const = 0;
 
+        //! Reads the concrete value of a memory area into `area`, which holds at least `size` bytes.
+        virtual void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const = 0;
+
         //! Returns the concrete value of a register.
         virtual triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
 
@@ -134,6 +158,18 @@ namespace triton {
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         virtual void unmapMemory(triton::uint64 baseAddr, triton::usize size=1) = 0;
+
+        //! Maps all the bytes of the pages overlapping the range `[baseAddr:size]`, the bytes not mapped yet are zero.
+        virtual void mapMemoryPages(triton::uint64 baseAddr, triton::usize size) = 0;
+
+        //! Removes the pages overlapping the range `[baseAddr:size]` from the internal memory representation.
+        virtual void unmapMemoryPages(triton::uint64 baseAddr, triton::usize size) = 0;
+
+        //! Returns the bytes of the page of `addr` to be read and written in place. \sa triton::arch::ConcreteMemory::getPage().
+        virtual std::shared_ptr<triton::uint8> getConcreteMemoryPage(triton::uint64 addr) = 0;
+
+        //! Maps the range `[baseAddr:memorySize]` as a copy-on-write view of `data`. \sa triton::arch::ConcreteMemory::mapView().
+        virtual void mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize) = 0;
     };
 
   /*! @} End of arch namespace */
@@ -0,0 +1,117 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DECODECACHE_H
+#define TRITON_DECODECACHE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <triton/instruction.hpp>
+#include <triton/operandWrapper.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! \class DecodeCache
+    /*! \brief The cache of the decoded instructions of a CPU.
+     *
+     * \description Keeps what the disassembler returns for an instruction (type, prefix, size, operands,
+     * disassembly) keyed by its address and its opcodes. An entry is only used if the opcodes of the
+     * instruction match the cached ones, and the entries overlapping a memory write are removed, so
+     * self-modifying code is decoded again.
+     */
+    class DecodeCache {
+      private:
+        //! A decoded instruction.
+        class Entry {
+          public:
+            //! The opcodes of the instruction, their size is the size of the instruction.
+            std::vector<triton::uint8> opcodes;
+
+            //! The disassembly of the instruction.
+            std::string disassembly;
+
+            //! The type of the instruction.
+            triton::uint32 type;
+
+            //! The prefix of the instruction.
+            triton::uint32 prefix;
+
+            //! True if the instruction is a branch.
+            bool branch;
+
+            //! True if the instruction modifies the control flow.
+            bool controlFlow;
+
+            //! The operands of the instruction, the concrete values of the registers are not used.
+            std::vector<triton::arch::OperandWrapper> operands;
+        };
+
+        //! The maximum number of entries, the cache is flushed when it is reached.
+        static const triton::usize maxEntries = 0x10000;
+
+        //! The map of address -> decoded instruction.
+        std::map<triton::uint64, Entry> entries;
+
+        //! The lowest address of the cached instructions.
+        triton::uint64 lowest;
+
+        //! The highest address (excluded) of the cached instructions.
+        triton::uint64 highest;
+
+        //! The number of instructions found in the cache.
+        triton::usize hits;
+
+        //! The number of instructions decoded.
+        triton::usize misses;
+
+        //! The number of entries removed by a memory write.
+        triton::usize invalidations;
+
+      public:
+        //! Constructor.
+        DecodeCache();
+
+        //! Initializes `inst` from the cache. Returns false if the instruction must be decoded.
+        bool load(triton::arch::Instruction& inst);
+
+        //! Records a decoded instruction.
+        void store(triton::arch::Instruction& inst);
+
+        //! Removes the instructions overlapping the range `[addr:size]`.
+        void invalidate(triton::uint64 addr, triton::usize size);
+
+        //! Removes all instructions, the statistics are kept.
+        void clear(void);
+
+        //! Returns the statistics of the cache (hits, misses, invalidations and entries).
+        std::map<std::string, triton::usize> getStats(void) const;
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODECACHE_H */
@@ -9,6 +9,7 @@
 #define TRITON_ELF_H
 
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 #include <triton/binaryInterface.hpp>
@@ -19,6 +20,7 @@
 #include <triton/elfRelocationTable.hpp>
 #include <triton/elfSectionHeader.hpp>
 #include <triton/elfSymbolTable.hpp>
+#include <triton/mappedFile.hpp>
 #include <triton/memoryMapping.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -48,18 +50,34 @@ namespace triton {
      */
 
       /*! \class Elf
-       *  \brief The ELF format class. */
+       *  \brief The ELF format class.
+       *
+       * \description In the lazy mode, the file is mapped instead of read and the symbols and relocations tables
+       * are parsed on their first use, so opening a large binary only parses its headers.
+       */
       class Elf : public BinaryInterface {
         protected:
           //! Path file of the binary.
           std::string path;
 
+          //! The bytes of the binary file.
+          triton::format::MappedFile file;
+
           //! Total size of the binary file.
           triton::usize totalSize;
 
           //! The raw binary.
           triton::uint8* raw;
 
+          //! True if the symbols and relocations tables are parsed on their first use.
+          bool lazy;
+
+          //! True if the symbols table is parsed.
+          mutable bool symbolsParsed;
+
+          //! True if the relocations table is parsed.
+          mutable bool relocationsParsed;
+
           //! The ELF Header
           triton::format::elf::ElfHeader header;
 
@@ -72,11 +90,14 @@ namespace triton {
           //! The dynamic table.
           std::vector<triton::format::elf::ElfDynamicTable> dynamicTable;
 
-          //! The symbols table.
-          std::vector<triton::format::elf::ElfSymbolTable> symbolsTable;
+          //! The symbols table, parsed on its first use in the lazy mode.
+          mutable std::vector<triton::format::elf::ElfSymbolTable> symbolsTable;
 
-          //! The relocations table.
-          std::vector<triton::format::elf::ElfRelocationTable> relocationsTable;
+          //! The map of symbol name -> index in the symbols table, built on the first lookup.
+          mutable std::unordered_map<std::string, triton::usize> symbolsIndex;
+
+          //! The relocations table, parsed on its first use in the lazy mode.
+          mutable std::vector<triton::format::elf::ElfRelocationTable> relocationsTable;
 
           //! The shared libraries dependency.
           std::vector<std::string> sharedLibraries;
@@ -103,19 +124,25 @@ namespace triton {
           void initSharedLibraries(void);
 
           //! Init the symbols table via the program headers.
-          void initSymbolsTableViaProgramHeaders(void);
+          void initSymbolsTableViaProgramHeaders(void) const;
 
           //! Init the symbols table via the section headers.
-          void initSymbolsTableViaSectionHeaders(void);
+          void initSymbolsTableViaSectionHeaders(void) const;
 
           //! Init the relocations table (DT_REL).
-          void initRelTable(void);
+          void initRelTable(void) const;
 
           //! Init the relocations table (DT_RELA).
-          void initRelaTable(void);
+          void initRelaTable(void) const;
 
           //! Init the relocations table (DT_JMPREL).
-          void initJmprelTable(void);
+          void initJmprelTable(void) const;
+
+          //! Parses the symbols table if not parsed yet.
+          void parseSymbolsTable(void) const;
+
+          //! Parses the relocations table if not parsed yet.
+          void parseRelocationsTable(void) const;
 
           //! Returns the offset in the file corresponding to the virtual address.
           triton::uint64 getOffsetFromAddress(triton::uint64 vaddr) const;
@@ -127,8 +154,8 @@ namespace triton {
           triton::uint64 getDTValue(triton::format::elf::elf_e dt) const;
 
         public:
-          //! Constructor.
-          Elf(const std::string& path);
+          //! Constructor. In the lazy mode, the file is mapped and the tables are parsed on their first use.
+          Elf(const std::string& path, bool lazy=false);
 
           //! Destructor.
           virtual ~Elf();
@@ -157,6 +184,9 @@ namespace triton {
           //! Returns Symbols Table.
           const std::vector<triton::format::elf::ElfSymbolTable>& getSymbolsTable(void) const;
 
+          //! Returns the symbol named `name`, nullptr if there is no such symbol. The first lookup indexes the symbols table.
+          const triton::format::elf::ElfSymbolTable* getSymbol(const std::string& name) const;
+
           //! Returns Relocations Table.
           const std::vector<triton::format::elf::ElfRelocationTable>& getRelocationTable(void) const;
 
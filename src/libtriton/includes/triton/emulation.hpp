@@ -0,0 +1,92 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_EMULATION_H
+#define TRITON_EMULATION_H
+
+#include <functional>
+#include <set>
+
+#include <triton/instruction.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! The reasons why an emulation stops. */
+    enum stop_e {
+      STOP_ADDRESS = 0,   /*!< The program counter reached a stop address. */
+      STOP_COUNT,         /*!< The maximum number of instructions has been processed. */
+      STOP_HOOK,          /*!< The hook asked to stop. */
+      STOP_SYSCALL,       /*!< A system call instruction has been processed. */
+      STOP_UNMAPPED,      /*!< The instruction at the program counter is not entirely mapped. */
+      STOP_UNSUPPORTED,   /*!< The instruction is not supported. */
+    };
+
+    /*! \brief The prototype of an emulation hook.
+     *
+     * \description The hook is called after each instruction processed by triton::API::emulate(). Returning
+     * true stops the emulation.
+     */
+    typedef std::function<bool(triton::arch::Instruction& inst)> emulationHook;
+
+
+    //! \class StopCondition
+    /*! \brief When triton::API::emulate() stops, besides the maximum number of instructions. */
+    class StopCondition {
+      public:
+        //! The addresses where the emulation stops, before processing the instruction.
+        std::set<triton::uint64> addresses;
+
+        //! True to stop after a system call instruction, as told by the architecture. \sa triton::API::isSyscall().
+        bool syscall;
+
+        //! Called after each instruction if defined.
+        triton::arch::emulationHook hook;
+
+        //! Constructor.
+        StopCondition();
+    };
+
+
+    //! \class EmulationSummary
+    /*! \brief What triton::API::emulate() has done. */
+    class EmulationSummary {
+      public:
+        //! The program counter when the emulation stops, the address of the next instruction to process.
+        triton::uint64 pc;
+
+        //! The number of instructions processed.
+        triton::usize count;
+
+        //! Why the emulation stops. \sa triton::arch::stop_e.
+        triton::arch::stop_e reason;
+
+        //! Constructor.
+        EmulationSummary();
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EMULATION_H */
@@ -155,6 +155,30 @@ namespace triton {
     };
 
 
+    /*! \class ExplorationEngine
+     *  \brief The exception class used by the exploration engine. */
+    class ExplorationEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        ExplorationEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        ExplorationEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
+    /*! \class SnapshotEngine
+     *  \brief The exception class used by the snapshot engine. */
+    class SnapshotEngine : public triton::exceptions::Engines {
+      public:
+        //! Constructor.
+        SnapshotEngine(const char* message) : triton::exceptions::Engines(message) {};
+
+        //! Constructor.
+        SnapshotEngine(const std::string& message) : triton::exceptions::Engines(message) {};
+    };
+
+
     /*! \class SolverEngine
      *  \brief The exception class used by the solver engine. */
     class SolverEngine : public triton::exceptions::Engines {
@@ -371,6 +395,18 @@ namespace triton {
     };
 
 
+    /*! \class SmallBitvector
+     *  \brief The exception class used by concrete bit-vector values. */
+    class SmallBitvector : public triton::exceptions::Exception {
+      public:
+        //! Constructor.
+        SmallBitvector(const char* message) : triton::exceptions::Exception(message) {};
+
+        //! Constructor.
+        SmallBitvector(const std::string& message) : triton::exceptions::Exception(message) {};
+    };
+
+
     /*! \class Bindings
      *  \brief The exception class used by bindings. */
     class Bindings : public triton::exceptions::Exception {
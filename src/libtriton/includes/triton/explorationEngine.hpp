@@ -0,0 +1,191 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_EXPLORATIONENGINE_H
+#define TRITON_EXPLORATIONENGINE_H
+
+#include <map>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <triton/api.hpp>
+#include <triton/emulation.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! The search heuristics, they choose the next input of the worklist.
+      enum heuristic_e {
+        COVERAGE_FIRST = 0, /*!< The inputs which reach a branch not covered yet first, then the oldest generations. */
+        DEPTH_FIRST,        /*!< The last input generated first. */
+        RANDOM,             /*!< An input of the worklist at random. */
+      };
+
+
+      //! \class Input
+      /*! \brief An input of the exploration. */
+      class Input {
+        public:
+          //! The values of the symbolic bytes, the bytes missing keep the value they have in the initial state.
+          std::map<triton::uint64, triton::uint8> memory;
+
+          //! The index of the first path constraint which may be negated from this input (generational search).
+          triton::usize bound;
+
+          //! The generation of the input, 0 for the seeds.
+          triton::usize depth;
+
+          //! The branch (source, destination) this input was generated to take.
+          std::pair<triton::uint64, triton::uint64> target;
+
+          //! How the run of this input has stopped, set once the input has been run.
+          triton::arch::EmulationSummary summary;
+
+          //! Constructor.
+          Input();
+      };
+
+
+      //! \class ExplorationEngine
+      /*! \brief The exploration engine class.
+       *
+       * \description The exploration engine runs a dynamic symbolic execution (concolic) loop. Each input of the
+       * worklist is emulated from the entry point with the bytes of the symbolic areas symbolized, then, as in a
+       * generational search, the branches not taken by the path constraints found after the bound of the input
+       * are negated to produce new inputs. All the constraints of a run are solved in one incremental solver
+       * session. The initial state is saved with a snapshot and restored before each run.
+       *
+       * A run stops on an exit point, after the maximum number of instructions, or on an unmapped, unsupported or
+       * undecodable instruction, see Input::summary. Any other exception stops the exploration and is raised again.
+       */
+      class ExplorationEngine {
+        private:
+          //! The API of Triton.
+          triton::API* api;
+
+          //! The search heuristic.
+          heuristic_e heuristic;
+
+          //! The random generator of the RANDOM heuristic.
+          std::mt19937 random;
+
+          //! The address where each run starts.
+          triton::uint64 entryPoint;
+
+          //! The addresses where a run stops.
+          std::set<triton::uint64> exitPoints;
+
+          //! The areas (address, size) of the symbolic bytes.
+          std::vector<std::pair<triton::uint64, triton::usize>> symbolicAreas;
+
+          //! The maximum number of instructions of a run.
+          triton::usize maxInstructions;
+
+          //! The inputs which are not run yet.
+          std::vector<Input> worklist;
+
+          //! The inputs already run, in order.
+          std::vector<Input> inputs;
+
+          //! The inputs already scheduled, to not run an input twice.
+          std::set<std::map<triton::uint64, triton::uint8>> scheduled;
+
+          //! The branches (source, destination) taken by the runs.
+          std::set<std::pair<triton::uint64, triton::uint64>> coverage;
+
+          //! Removes and returns the next input of the worklist according to the heuristic.
+          Input popInput(void);
+
+          //! Schedules an input if it has never been scheduled.
+          void pushInput(const Input& input);
+
+          //! Emulates an input and records how the run has stopped. Returns the map of symbolic variable id -> address.
+          std::map<triton::usize, triton::uint64> run(Input& input);
+
+          //! Records the branches taken by a run and generates the new inputs from its path constraints.
+          void expand(const Input& input, const std::map<triton::usize, triton::uint64>& variables, triton::usize first);
+
+        public:
+          //! Constructor.
+          ExplorationEngine(triton::API* api);
+
+          //! Sets the search heuristic. Default COVERAGE_FIRST.
+          void setHeuristic(heuristic_e heuristic);
+
+          //! Seeds the random generator of the RANDOM heuristic.
+          void setRandomSeed(triton::uint32 seed);
+
+          //! Sets the address where each run starts.
+          void setEntryPoint(triton::uint64 addr);
+
+          //! Adds an address where a run stops.
+          void addExitPoint(triton::uint64 addr);
+
+          //! Symbolizes each byte of the area `[addr:size]` at the beginning of each run.
+          void addSymbolicMemory(triton::uint64 addr, triton::usize size);
+
+          //! Sets the maximum number of instructions of a run (0 for no limit). Default 100000.
+          void setMaxInstructions(triton::usize count);
+
+          //! Adds a seed to the worklist. Without seed, the exploration starts from the initial state.
+          void addSeed(const std::map<triton::uint64, triton::uint8>& memory);
+
+          /*!
+           * \brief Explores from the current state and returns the number of runs.
+           *
+           * \description The exploration stops when the worklist is empty or after `maxRuns` runs (0 for no limit),
+           * the remaining inputs are kept for the next call. The state of Triton is restored once done.
+           */
+          triton::usize explore(triton::usize maxRuns=0);
+
+          //! Returns the inputs already run, in order.
+          const std::vector<Input>& getInputs(void) const;
+
+          //! Returns the inputs which are not run yet.
+          const std::vector<Input>& getWorklist(void) const;
+
+          //! Returns the branches (source, destination) taken by the runs.
+          const std::set<std::pair<triton::uint64, triton::uint64>>& getCoverage(void) const;
+
+          //! Clears the worklist, the inputs and the coverage.
+          void reset(void);
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORATIONENGINE_H */
@@ -92,6 +92,9 @@ namespace triton {
         //! True if this instruction is tainted. This field is set at the semantics level.
         bool tainted;
 
+        //! The taint labels read by this instruction. This field is set at the semantics level with the `TAINT_LABELS` mode.
+        std::set<triton::uint32> taintLabels;
+
         //! Copies an Instruction
         void copy(const Instruction& other);
 
@@ -162,14 +165,17 @@ namespace triton {
         //! Returns the list of all implicit and explicit register (flags includes) inputs (read)
         const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getReadRegisters(void) const;
 
+        //! Returns the taint labels of the registers and memory cells read by the instruction. Only set with the `TAINT_LABELS` mode.
+        const std::set<triton::uint32>& getTaintLabels(void) const;
+
         //! Returns the list of all implicit and explicit register (flags includes) outputs (write)
         const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getWrittenRegisters(void) const;
 
         //! Returns the list of all implicit and explicit immediate inputs (read)
         const std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& getReadImmediates(void) const;
 
-        //! Returns the register state which has been recorded.
-        triton::arch::Register getRegisterState(triton::uint32 regId);
+        //! Returns the register state which has been recorded, or `reg` if there is none.
+        triton::arch::Register getRegisterState(const triton::arch::Register& reg);
 
         //! Sets the opcodes of the instruction.
         void setOpcodes(const triton::uint8* opcodes, triton::uint32 size);
@@ -225,6 +231,9 @@ namespace triton {
         //! Sets the taint of the instruction based on its expressions.
         void setTaint(void);
 
+        //! Sets the taint labels read by the instruction.
+        void setTaintLabels(const std::set<triton::uint32>& labels);
+
         //! Records an instruction context for a memory access.
         void updateContext(const triton::arch::MemoryAccess& mem);
 
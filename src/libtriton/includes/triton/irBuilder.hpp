@@ -9,6 +9,7 @@
 #define TRITON_IRBUILDER_H
 
 #include <triton/architecture.hpp>
+#include <triton/astContext.hpp>
 #include <triton/astGarbageCollector.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
@@ -42,23 +43,23 @@ namespace triton {
         //! AST garbage collector API
         triton::ast::AstGarbageCollector* astGarbageCollector;
 
-        //! Backup AST garbage collector
-        triton::ast::AstGarbageCollector* backupAstGarbageCollector;
-
         //! Modes API
         triton::modes::Modes* modes;
 
         //! Symbolic engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
-        //! Backup symbolic engine
-        triton::engines::symbolic::SymbolicEngine* backupSymbolicEngine;
-
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
-        //! Removes all symbolic expressions of an instruction.
-        void removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes);
+        //! Removes all symbolic expressions of an instruction and collects the roots of their ASTs into garbage.
+        void removeSymbolicExpressions(triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& garbage);
+
+        //! Removes the nodes of an instruction from its accesses and its memory operands, the accesses are kept.
+        void clearNodes(triton::arch::Instruction& inst);
+
+        //! Emulates the instruction and spreads its taint without building any node. Returns false if the instruction has no taint-only semantics.
+        bool buildTaintSemantics(triton::arch::Instruction& inst);
 
       protected:
         //! x86 ISA builder.
@@ -69,6 +70,7 @@ namespace triton {
         IrBuilder(triton::arch::Architecture* architecture,
                   triton::modes::Modes* modes,
                   triton::ast::AstGarbageCollector* astGarbageCollector,
+                  triton::ast::AstContext* astCtxt,
                   triton::engines::symbolic::SymbolicEngine* symbolicEngine,
                   triton::engines::taint::TaintEngine* taintEngine);
 
@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_MAPPEDFILE_H
+#define TRITON_MAPPEDFILE_H
+
+#include <memory>
+#include <string>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    /*! \class MappedFile
+     *  \brief The bytes of a binary file, read into memory or mapped read-only.
+     *
+     * \description A mapped file is not read: the system loads its pages when they are accessed and may drop
+     * them under memory pressure, so opening a large file is immediate and does not count it twice in memory.
+     * Where mapping is not supported, the file is read. The bytes are shared: they stay valid as long as a
+     * pointer returned by getSharedData() exists, even after the MappedFile is closed.
+     */
+    class MappedFile {
+      protected:
+        //! The bytes of the file, unmapped or freed with the last pointer.
+        std::shared_ptr<triton::uint8> data;
+
+        //! The size of the file.
+        triton::usize size;
+
+        //! True if the file is mapped, false if it is read.
+        bool mapped;
+
+      public:
+        //! Constructor.
+        MappedFile();
+
+        //! Destructor.
+        virtual ~MappedFile();
+
+        //! A MappedFile owns its bytes and cannot be copied.
+        MappedFile(const MappedFile& copy) = delete;
+
+        //! A MappedFile owns its bytes and cannot be copied.
+        MappedFile& operator=(const MappedFile& copy) = delete;
+
+        //! Opens a file, mapped if `map` is true and mapping is supported, read otherwise.
+        void open(const std::string& path, bool map);
+
+        //! Closes the file.
+        void close(void);
+
+        //! Returns the bytes of the file.
+        triton::uint8* getData(void) const;
+
+        //! Returns the bytes of the file, valid as long as the returned pointer.
+        std::shared_ptr<const triton::uint8> getSharedData(void) const;
+
+        //! Returns the size of the file.
+        triton::usize getSize(void) const;
+
+        //! Returns true if the file is mapped.
+        bool isMapped(void) const;
+    };
+
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MAPPEDFILE_H */
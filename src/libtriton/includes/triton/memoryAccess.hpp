@@ -13,6 +13,7 @@
 #include <triton/cpuSize.hpp>
 #include <triton/immediate.hpp>
 #include <triton/operandInterface.hpp>
+#include <triton/smallBitvector.hpp>
 #include <triton/register.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -42,7 +43,7 @@ namespace triton {
         triton::uint64 address;
 
         //! The concrete value (content of the access)
-        triton::uint512 concreteValue;
+        triton::SmallBitvector concreteValue;
 
         //! True if this memory contains a concrete value.
         bool concreteValueDefined;
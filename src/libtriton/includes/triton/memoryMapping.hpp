@@ -8,6 +8,8 @@
 #ifndef TRITON_MEMORYMAPPING_H
 #define TRITON_MEMORYMAPPING_H
 
+#include <memory>
+
 #include <triton/tritonTypes.hpp>
 
 
@@ -34,19 +36,28 @@ namespace triton {
         //! The binary file.
         const triton::uint8* binary;
 
+        //! The owner of the binary file bytes, nullptr if they are not shared.
+        std::shared_ptr<const triton::uint8> file;
+
         //! The offset of the area into the binary file.
         triton::uint64 offset;
 
         //! The virtual address where the area must be mapped into the memory.
         triton::uint64 virtualAddress;
 
-        //! The size of the area.
+        //! The size of the area into the binary file.
         triton::uint64 size;
 
+        //! The size of the area into the memory, the bytes after `size` are zero (e.g. `.bss`).
+        triton::uint64 memorySize;
+
       public:
         //! Constructor.
         MemoryMapping(const triton::uint8* binary);
 
+        //! Constructor. The area keeps the bytes of the file alive.
+        MemoryMapping(const std::shared_ptr<const triton::uint8>& file);
+
         //! Constructor by copy.
         MemoryMapping(const MemoryMapping& copy);
 
@@ -59,6 +70,9 @@ namespace triton {
         //! Returns the binary.
         const triton::uint8* getBinary(void) const;
 
+        //! Returns the owner of the binary file bytes, nullptr if they are not shared.
+        const std::shared_ptr<const triton::uint8>& getFile(void) const;
+
         //! Returns the offset.
         triton::uint64 getOffset(void) const;
 
@@ -68,17 +82,23 @@ namespace triton {
         //! Returns the memory area into the binary file.
         const triton::uint8* getMemoryArea(void) const;
 
-        //! Returns the size.
+        //! Returns the size into the binary file.
         triton::uint64 getSize(void) const;
 
+        //! Returns the size into the memory, at least the size into the binary file.
+        triton::uint64 getMemorySize(void) const;
+
         //! Sets the offset.
         void setOffset(triton::uint64 offset);
 
         //! Sets the virtual address.
         void setVirtualAddress(triton::uint64 virtualAddress);
 
-        //! Sets the size.
+        //! Sets the size into the binary file.
         void setSize(triton::uint64 size);
+
+        //! Sets the size into the memory.
+        void setMemorySize(triton::uint64 memorySize);
     };
 
   /*! @} End of format namespace */
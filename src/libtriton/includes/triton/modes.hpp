@@ -31,12 +31,18 @@ namespace triton {
     enum mode_e {
       /* AST */
       AST_DICTIONARIES,      //!< [ast mode] Abstract Syntax Tree dictionaries.
+      AST_ARENA,             //!< [ast mode] Allocate AST nodes from slabs and free the nodes of an instruction at once.
 
       /* Symbolic */
       ALIGNED_MEMORY,        //!< [symbolic mode] Keep a map of aligned memory.
+      LAZY_FLAGS,            //!< [symbolic mode] Build the symbolic expressions of the flags only when they are read.
+      MEMORY_RANGES,         //!< [symbolic mode] Keep whole memory stores as ranges instead of one expression per byte.
       ONLY_ON_SYMBOLIZED,    //!< [symbolic mode] Perform symbolic execution only on symbolized expressions.
       ONLY_ON_TAINTED,       //!< [symbolic mode] Perform symbolic execution only on tainted instructions.
       PC_TRACKING_SYMBOLIC,  //!< [symbolic mode] Track path constraints only if they are symbolized.
+
+      /* Taint */
+      TAINT_LABELS,          //!< [taint mode] Spread sets of labels with the taint.
     };
 
 
@@ -10,6 +10,7 @@
 
 #include <vector>
 
+#include <triton/astContext.hpp>
 #include <triton/instruction.hpp>
 #include <triton/modes.hpp>
 #include <triton/pathConstraint.hpp>
@@ -49,12 +50,15 @@ namespace triton {
           triton::modes::Modes* modes;
 
         protected:
+          //! AST context API.
+          triton::ast::AstContext* astCtxt;
+
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
 
         public:
           //! Constructor.
-          PathManager(triton::modes::Modes* modes);
+          PathManager(triton::modes::Modes* modes, triton::ast::AstContext* astCtxt);
 
           //! Constructor by copy.
           PathManager(const PathManager& copy);
@@ -68,7 +72,7 @@ namespace triton {
           //! Returns the logical conjunction vector of path constraints.
           const std::vector<triton::engines::symbolic::PathConstraint>& getPathConstraints(void) const;
 
-          //! Returns the logical conjunction AST of path constraints.
+          //! Returns the logical conjunction AST of path constraints. The constraints structurally identical to a previous one or without symbolic variable are skipped.
           triton::ast::AbstractNode* getPathConstraintsAst(void) const;
 
           //! Returns the number of constraints.
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include <triton/binaryInterface.hpp>
+#include <triton/mappedFile.hpp>
 #include <triton/memoryMapping.hpp>
 #include <triton/peExportDirectory.hpp>
 #include <triton/peHeader.hpp>
@@ -44,32 +45,48 @@ namespace triton {
      */
 
       /*! \class Pe
-       *  \brief The PE format class. */
+       *  \brief The PE format class.
+       *
+       * \description In the lazy mode, the file is mapped instead of read and the import and export tables are
+       * parsed on their first use.
+       */
       class Pe : public BinaryInterface {
         protected:
           //! Path file of the binary.
           std::string path;
 
+          //! The bytes of the binary file.
+          triton::format::MappedFile file;
+
           //! Total size of the binary file.
           triton::usize totalSize;
 
           //! The raw binary.
           triton::uint8* raw;
 
+          //! True if the import and export tables are parsed on their first use.
+          bool lazy;
+
+          //! True if the import table is parsed.
+          mutable bool importsParsed;
+
+          //! True if the export table is parsed.
+          mutable bool exportsParsed;
+
           //! The PE Header.
           triton::format::pe::PeHeader header;
 
           //! The list of memory areas which may be mapped into the Triton memory. In the PE context, this is basically all segments.
           std::list<triton::format::MemoryMapping> memoryMapping;
 
-          //! The import table.
-          std::vector<PeImportDirectory> importTable;
+          //! The import table, parsed on its first use in the lazy mode.
+          mutable std::vector<PeImportDirectory> importTable;
 
-          //! DLL Dependencies.
-          std::vector<std::string> dlls;
+          //! DLL Dependencies, parsed with the import table.
+          mutable std::vector<std::string> dlls;
 
-          //! Export table.
-          PeExportDirectory exportTable;
+          //! Export table, parsed on its first use in the lazy mode.
+          mutable PeExportDirectory exportTable;
 
           //! Open the binary.
           void open(void);
@@ -81,17 +98,17 @@ namespace triton {
           void initMemoryMapping(void);
 
           //! Init the export table.
-          void initExportTable(void);
+          void initExportTable(void) const;
 
           //! Init the import table.
-          void initImportTable(void);
+          void initImportTable(void) const;
 
           //! Returns the offset in the file corresponding to the virtual address.
           triton::uint64 getOffsetFromAddress(triton::uint64 vaddr) const;
 
         public:
-          //! Constructor.
-          Pe(const std::string& path);
+          //! Constructor. In the lazy mode, the file is mapped and the tables are parsed on their first use.
+          Pe(const std::string& path, bool lazy=false);
 
           //! Destructor.
           virtual ~Pe();
@@ -11,6 +11,8 @@
 #ifndef TRITON_PYOBJECT_H
 #define TRITON_PYOBJECT_H
 
+#include <memory>
+
 #include <triton/ast.hpp>
 #include <triton/bitsVector.hpp>
 #include <triton/elf.hpp>
@@ -129,6 +131,9 @@ namespace triton {
       //! Creates the Memory python class.
       PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem);
 
+      //! Creates the MemoryPage python class.
+      PyObject* PyMemoryPage(triton::uint64 addr, const std::shared_ptr<triton::uint8>& page);
+
       //! Creates the PathConstraint python class.
       PyObject* PyPathConstraint(const triton::engines::symbolic::PathConstraint& pc);
 
@@ -360,6 +365,18 @@ namespace triton {
       //! pyMemory type.
       extern PyTypeObject MemoryAccess_Type;
 
+      /* MemoryPage ===================================================== */
+
+      //! pyMemoryPage object.
+      typedef struct {
+        PyObject_HEAD
+        std::shared_ptr<triton::uint8>* page;
+        triton::uint64 addr;
+      } MemoryPage_Object;
+
+      //! pyMemoryPage type.
+      extern PyTypeObject MemoryPage_Type;
+
       /* PathConstraint ================================================= */
 
       //! pyPathConstraint object.
@@ -537,6 +554,15 @@ namespace triton {
 /*! Returns the triton::arch::MemoryAccess. */
 #define PyMemoryAccess_AsMemoryAccess(v) (((triton::bindings::python::MemoryAccess_Object*)(v))->mem)
 
+/*! Checks if the pyObject is a MemoryPage. */
+#define PyMemoryPage_Check(v) ((v)->ob_type == &triton::bindings::python::MemoryPage_Type)
+
+/*! Returns the page of a MemoryPage. */
+#define PyMemoryPage_AsPage(v) (((triton::bindings::python::MemoryPage_Object*)(v))->page)
+
+/*! Returns the address of a MemoryPage. */
+#define PyMemoryPage_AsAddress(v) (((triton::bindings::python::MemoryPage_Object*)(v))->addr)
+
 /*! Checks if the pyObject is a triton::engines::symbolic::PathConstraint. */
 #define PyPathConstraint_Check(v) ((v)->ob_type == &triton::bindings::python::PathConstraint_Type)
 
@@ -14,6 +14,7 @@
 #include <triton/bitsVector.hpp>
 #include <triton/cpuSize.hpp>
 #include <triton/operandInterface.hpp>
+#include <triton/smallBitvector.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -33,6 +34,8 @@ namespace triton {
    *  @{
    */
 
+    class CpuInterface;
+
     /*! \class Register
      *  \brief This class is used when an instruction has a register operand.
      */
@@ -49,7 +52,7 @@ namespace triton {
         triton::uint32 parent;
 
         //! The concrete value (content of the register)
-        triton::uint512 concreteValue;
+        triton::SmallBitvector concreteValue;
 
         //! True if this register contains a concrete value.
         bool concreteValueDefined;
@@ -60,8 +63,8 @@ namespace triton {
         //! Copies a Register.
         void copy(const Register& other);
 
-        //! Setup everything.
-        void setup(triton::uint32 regId);
+        //! Setup everything from the specification of the register in `cpu`.
+        void setup(const triton::arch::CpuInterface& cpu, triton::uint32 regId);
 
         //! Resets information.
         void clear(void);
@@ -70,14 +73,14 @@ namespace triton {
         //! Constructor.
         Register();
 
-        //! Constructor.
-        Register(triton::uint32 regId);
+        //! Constructor, the register `regId` of `cpu`.
+        Register(const triton::arch::CpuInterface& cpu, triton::uint32 regId);
 
-        //! Constructor.
-        Register(triton::uint32 regId, triton::uint512 concreteValue);
+        //! Constructor, the register `regId` of `cpu` with a concrete value.
+        Register(const triton::arch::CpuInterface& cpu, triton::uint32 regId, triton::uint512 concreteValue);
 
-        //! Constructor.
-        Register(triton::uint32 regId, triton::uint512 concreteValue, bool immutable);
+        //! Constructor, the register `regId` of `cpu` with a concrete value.
+        Register(const triton::arch::CpuInterface& cpu, triton::uint32 regId, triton::uint512 concreteValue, bool immutable);
 
         //! Constructor by copy.
         Register(const Register& other);
@@ -88,8 +91,8 @@ namespace triton {
         //! Destructor.
         virtual ~Register();
 
-        //! Returns the parent id of the register.
-        Register getParent(void) const;
+        //! Returns the parent id of the register, see CpuInterface::getParentRegister().
+        triton::uint32 getParentId(void) const;
 
         //! Returns true if the register is immutable.
         bool isImmutable(void) const;
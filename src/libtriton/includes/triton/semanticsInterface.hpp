@@ -36,6 +36,14 @@ namespace triton {
 
         //! Builds the semantics of the instruction. Returns true if the instruction is supported.
         virtual bool buildSemantics(triton::arch::Instruction& inst) = 0;
+
+        /*!
+         * \brief Emulates the instruction and spreads its taint without building any node.
+         *
+         * \description Returns false if the instruction has no taint-only semantics, nothing is done then
+         * and the instruction must be built by buildSemantics().
+         */
+        virtual bool buildTaintSemantics(triton::arch::Instruction& inst) = 0;
     };
 
   /*! @} End of arch namespace */
@@ -0,0 +1,230 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SHADOWMEMORY_H
+#define TRITON_SHADOWMEMORY_H
+
+#include <iterator>
+#include <map>
+#include <memory>
+
+#include <triton/taintLabels.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! \class ShadowMemory
+      /*! \brief The tainted addresses of the taint engine.
+       *
+       * \description The state of each byte is a bit in a page of 4 KiB, pages are allocated when their first byte
+       * is tainted and freed when their last byte is untainted. Pages are found through a two-level table, the first
+       * level maps the 4 MiB regions of the address space to directories of 1024 pages. An access is checked and
+       * updated a 64-bit word at a time. Iterating a ShadowMemory returns the tainted addresses in ascending order.
+       * A page may also hold the labels of its tainted bytes (`TAINT_LABELS` mode), only its bytes which have labels
+       * allocate them and untainting a byte removes its labels. Copying a ShadowMemory shares its directories, pages
+       * and labels, they are copied by the first write on them.
+       */
+      class ShadowMemory {
+        private:
+          //! The number of bits of the offset in a page.
+          static const triton::uint32 pageBits = 12;
+
+          //! The number of bits of the page index in a directory.
+          static const triton::uint32 directoryBits = 10;
+
+          //! The size of a page in bytes.
+          static const triton::uint32 pageSize = (1 << pageBits);
+
+          //! The number of pages of a directory.
+          static const triton::uint32 directorySize = (1 << directoryBits);
+
+          //! The number of 64-bit words of a page.
+          static const triton::uint32 pageWords = pageSize / 64;
+
+          //! The labels of a page, one set per byte.
+          class LabelPage {
+            public:
+              //! The labels of the bytes, NO_LABELS if a byte has none.
+              triton::engines::taint::labelSet sets[pageSize];
+
+              //! The number of bytes which have labels.
+              triton::uint32 count;
+          };
+
+          //! A page, one bit per byte.
+          class Page {
+            public:
+              //! The bits of the page.
+              triton::uint64 words[pageWords];
+
+              //! The number of tainted bytes.
+              triton::uint32 count;
+
+              //! The labels of the page, nullptr if none of its bytes has labels.
+              std::shared_ptr<LabelPage> labels;
+          };
+
+          //! A directory of pages, a page is nullptr if none of its bytes is tainted.
+          class Directory {
+            public:
+              //! The pages of the directory.
+              std::shared_ptr<Page> pages[directorySize];
+
+              //! The number of allocated pages.
+              triton::uint32 count;
+          };
+
+          //! The map of region -> directory.
+          std::map<triton::uint64, std::shared_ptr<Directory>> directories;
+
+          //! The number of tainted bytes.
+          triton::usize count;
+
+          //! The number of bytes which have labels.
+          triton::usize labeled;
+
+          //! The region of the last directory found.
+          mutable triton::uint64 lastRegion;
+
+          //! The last directory found, nullptr if unknown.
+          mutable const Directory* lastDirectory;
+
+          //! Returns the page of an address, nullptr if the page is not allocated.
+          const Page* findPage(triton::uint64 addr) const;
+
+          //! Returns the page of an address to write it, the page is allocated or copied if needed.
+          Page* allocatePage(triton::uint64 addr);
+
+          //! Frees the page of an address.
+          void freePage(triton::uint64 addr);
+
+          //! Returns the labels of a page to write them, they are allocated or copied if needed.
+          LabelPage* allocateLabels(Page* page);
+
+          //! Removes the labels of the bytes `[offset:offset+length]` of a page.
+          void clearLabels(Page* page, triton::uint32 offset, triton::uint32 length);
+
+          //! Copies a ShadowMemory.
+          void copy(const ShadowMemory& other);
+
+        public:
+          //! \class const_iterator
+          /*! \brief Iterates over the tainted addresses in ascending order. */
+          class const_iterator : public std::iterator<std::forward_iterator_tag, triton::uint64> {
+            private:
+              //! The directories iterated.
+              const std::map<triton::uint64, std::shared_ptr<Directory>>* directories;
+
+              //! The current directory.
+              std::map<triton::uint64, std::shared_ptr<Directory>>::const_iterator directory;
+
+              //! The index of the current page in the directory.
+              triton::uint32 page;
+
+              //! The index of the current byte in the page.
+              triton::uint32 offset;
+
+              //! Moves to the first tainted byte from the current position (included).
+              void seek(void);
+
+            public:
+              //! Constructor.
+              const_iterator(const std::map<triton::uint64, std::shared_ptr<Directory>>* directories, std::map<triton::uint64, std::shared_ptr<Directory>>::const_iterator directory);
+
+              //! Returns the current address.
+              triton::uint64 operator*(void) const;
+
+              //! Moves to the next address.
+              const_iterator& operator++(void);
+
+              //! Moves to the next address.
+              const_iterator operator++(int);
+
+              //! Returns true if both iterators are at the same position.
+              bool operator==(const const_iterator& other) const;
+
+              //! Returns true if the iterators are at different positions.
+              bool operator!=(const const_iterator& other) const;
+          };
+
+          //! Constructor.
+          ShadowMemory();
+
+          //! Constructor by copy. The pages are shared.
+          ShadowMemory(const ShadowMemory& other);
+
+          //! Destructor.
+          ~ShadowMemory();
+
+          //! Copies a ShadowMemory. The pages are shared.
+          void operator=(const ShadowMemory& other);
+
+          //! Returns the first tainted address.
+          const_iterator begin(void) const;
+
+          //! Returns the end of the tainted addresses.
+          const_iterator end(void) const;
+
+          //! Returns the number of tainted bytes.
+          triton::usize size(void) const;
+
+          //! Returns true if no byte is tainted.
+          bool empty(void) const;
+
+          //! Returns true if the byte at `addr` is tainted.
+          bool isTainted(triton::uint64 addr) const;
+
+          //! Returns true if a byte of the range `[addr:size]` is tainted.
+          bool isTainted(triton::uint64 addr, triton::usize size) const;
+
+          //! Taints (`flag` true) or untaints the range `[addr:size]`.
+          void set(triton::uint64 addr, triton::usize size, bool flag);
+
+          //! Untaints all bytes.
+          void clear(void);
+
+          //! Returns true if a byte has labels.
+          bool hasLabels(void) const;
+
+          //! Returns the labels of the byte at `addr`, NO_LABELS if it has none.
+          triton::engines::taint::labelSet getLabels(triton::uint64 addr) const;
+
+          //! Replaces the labels of the tainted bytes of the range `[addr:size]`, the untainted bytes have no labels.
+          void setLabels(triton::uint64 addr, triton::usize size, triton::engines::taint::labelSet set);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SHADOWMEMORY_H */
@@ -0,0 +1,212 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SMALLBITVECTOR_H
+#define TRITON_SMALLBITVECTOR_H
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! \class SmallBitvector
+  /*! \brief A concrete bit-vector value of a fixed size.
+   *
+   * \description Values up to 64 bits are kept in a native `uint64` and every operation on them
+   * is done with native arithmetic. Wider values (e.g. SSE and AVX registers) are kept in a `uint512`
+   * allocated on demand and fall back to the multiprecision arithmetic. Values are always masked to
+   * their size and operations follow the SMT2-LIB semantics of the bit-vector theory. The result of a
+   * binary operation has the size of its left operand, both operands must have the same size.
+   */
+  class SmallBitvector {
+    private:
+      //! The value if the size is lower than or equal to 64 bits.
+      triton::uint64 narrow;
+
+      //! The value if the size is greater than 64 bits, nullptr otherwise.
+      triton::uint512* wide;
+
+      //! The size of the value in bits.
+      triton::uint32 size;
+
+      //! Returns the mask of a narrow value of `size` bits.
+      static triton::uint64 narrowMask(triton::uint32 size);
+
+      //! Returns the mask of a wide value of `size` bits.
+      static triton::uint512 wideMask(triton::uint32 size);
+
+      //! Returns a value of `size` bits all set.
+      static SmallBitvector ones(triton::uint32 size);
+
+      //! Returns the value sign extended to 64 bits. The value must be narrow.
+      triton::sint64 toSint64(void) const;
+
+      //! Copies another value.
+      void copy(const SmallBitvector& other);
+
+    public:
+      //! Constructor. A zero of zero bit.
+      SmallBitvector();
+
+      //! Constructor. The value is masked to `size` bits.
+      SmallBitvector(triton::uint64 value, triton::uint32 size);
+
+      //! Constructor. The value is masked to `size` bits.
+      SmallBitvector(const triton::uint512& value, triton::uint32 size);
+
+      //! Constructor by copy.
+      SmallBitvector(const SmallBitvector& other);
+
+      //! Constructor by move.
+      SmallBitvector(SmallBitvector&& other);
+
+      //! Destructor.
+      ~SmallBitvector();
+
+      //! Copies another value.
+      SmallBitvector& operator=(const SmallBitvector& other);
+
+      //! Moves another value.
+      SmallBitvector& operator=(SmallBitvector&& other);
+
+      //! Returns true if both values are equal, whatever their sizes.
+      bool operator==(const SmallBitvector& other) const;
+
+      //! Returns true if the values are different, whatever their sizes.
+      bool operator!=(const SmallBitvector& other) const;
+
+      //! Returns the size of the value in bits.
+      triton::uint32 getSize(void) const;
+
+      //! Returns true if the value is kept in a `uint512`.
+      bool isWide(void) const;
+
+      //! Returns true if the value is zero.
+      bool isZero(void) const;
+
+      //! Returns true if the most significant bit is set.
+      bool isSigned(void) const;
+
+      //! Returns the 64 lower bits of the value.
+      triton::uint64 toUint64(void) const;
+
+      //! Returns the value.
+      triton::uint512 toUint512(void) const;
+
+      //! Returns the value sign extended.
+      triton::sint512 toSint512(void) const;
+
+      //! Returns `this + other`.
+      SmallBitvector bvadd(const SmallBitvector& other) const;
+
+      //! Returns `this & other`.
+      SmallBitvector bvand(const SmallBitvector& other) const;
+
+      //! Returns `this >> other`, the shift is arithmetic.
+      SmallBitvector bvashr(const SmallBitvector& other) const;
+
+      //! Returns `this >> other`, the shift is logical.
+      SmallBitvector bvlshr(const SmallBitvector& other) const;
+
+      //! Returns `this * other`.
+      SmallBitvector bvmul(const SmallBitvector& other) const;
+
+      //! Returns `~(this & other)`.
+      SmallBitvector bvnand(const SmallBitvector& other) const;
+
+      //! Returns `-this`.
+      SmallBitvector bvneg(void) const;
+
+      //! Returns `~(this | other)`.
+      SmallBitvector bvnor(const SmallBitvector& other) const;
+
+      //! Returns `~this`.
+      SmallBitvector bvnot(void) const;
+
+      //! Returns `this | other`.
+      SmallBitvector bvor(const SmallBitvector& other) const;
+
+      //! Returns `this` rotated to the left by `rot` bits.
+      SmallBitvector bvrol(triton::uint32 rot) const;
+
+      //! Returns `this` rotated to the right by `rot` bits.
+      SmallBitvector bvror(triton::uint32 rot) const;
+
+      //! Returns `this / other`, the division is signed.
+      SmallBitvector bvsdiv(const SmallBitvector& other) const;
+
+      //! Returns `this << other`.
+      SmallBitvector bvshl(const SmallBitvector& other) const;
+
+      //! Returns `this % other`, the sign follows the divisor.
+      SmallBitvector bvsmod(const SmallBitvector& other) const;
+
+      //! Returns `this % other`, the sign follows the dividend.
+      SmallBitvector bvsrem(const SmallBitvector& other) const;
+
+      //! Returns `this - other`.
+      SmallBitvector bvsub(const SmallBitvector& other) const;
+
+      //! Returns `this / other`, the division is unsigned.
+      SmallBitvector bvudiv(const SmallBitvector& other) const;
+
+      //! Returns `this % other`, the division is unsigned.
+      SmallBitvector bvurem(const SmallBitvector& other) const;
+
+      //! Returns `~(this ^ other)`.
+      SmallBitvector bvxnor(const SmallBitvector& other) const;
+
+      //! Returns `this ^ other`.
+      SmallBitvector bvxor(const SmallBitvector& other) const;
+
+      //! Returns true if `this >= other`, signed.
+      bool bvsge(const SmallBitvector& other) const;
+
+      //! Returns true if `this > other`, signed.
+      bool bvsgt(const SmallBitvector& other) const;
+
+      //! Returns true if `this <= other`, signed.
+      bool bvsle(const SmallBitvector& other) const;
+
+      //! Returns true if `this < other`, signed.
+      bool bvslt(const SmallBitvector& other) const;
+
+      //! Returns true if `this >= other`, unsigned.
+      bool bvuge(const SmallBitvector& other) const;
+
+      //! Returns true if `this > other`, unsigned.
+      bool bvugt(const SmallBitvector& other) const;
+
+      //! Returns true if `this <= other`, unsigned.
+      bool bvule(const SmallBitvector& other) const;
+
+      //! Returns true if `this < other`, unsigned.
+      bool bvult(const SmallBitvector& other) const;
+
+      //! Returns the concatenation of `this` (high part) and `other` (low part).
+      SmallBitvector concat(const SmallBitvector& other) const;
+
+      //! Returns the bits from `high` to `low` (both included).
+      SmallBitvector extract(triton::uint32 high, triton::uint32 low) const;
+
+      //! Returns the value sign extended by `sizeExt` bits.
+      SmallBitvector sx(triton::uint32 sizeExt) const;
+
+      //! Returns the value zero extended by `sizeExt` bits.
+      SmallBitvector zx(triton::uint32 sizeExt) const;
+  };
+
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SMALLBITVECTOR_H */
@@ -0,0 +1,130 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SNAPSHOTENGINE_H
+#define TRITON_SNAPSHOTENGINE_H
+
+#include <vector>
+
+#include <triton/architecture.hpp>
+#include <triton/astGarbageCollector.hpp>
+#include <triton/cpuInterface.hpp>
+#include <triton/symbolicEngine.hpp>
+#include <triton/taintEngine.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Snapshot namespace
+    namespace snapshot {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup snapshot
+     *  @{
+     */
+
+      //! \class Snapshot
+      /*! \brief A snapshot of the state of Triton, see SnapshotEngine. */
+      class Snapshot {
+        public:
+          //! The copy of the registers and the memory, the memory pages are shared with the CPU.
+          triton::arch::CpuInterface* cpu;
+
+          //! The taint of the registers and of the memory, the tainted pages are shared with the taint engine.
+          triton::engines::taint::TaintState taint;
+
+          //! The checkpoint of the symbolic engine.
+          triton::usize symbolicCheckpoint;
+
+          //! The checkpoint of the AST garbage collector.
+          triton::usize astCheckpoint;
+      };
+
+
+      //! \class SnapshotEngine
+      /*! \brief The snapshot engine class.
+       *
+       * \description A snapshot saves the state of the CPU, the taint engine, the symbolic engine and the
+       * AST nodes. The CPU memory and the tainted memory are copied by sharing their pages, a page is only
+       * copied by its first write (copy-on-write); the labels of the memory live in the tainted pages and the
+       * sets of labels are only added, so they are not copied. The symbolic engine and the AST garbage collector
+       * journal their changes since the snapshot, including the taint of the existing expressions, see
+       * triton::engines::symbolic::SymbolicEngine::newCheckpoint(). Thus neither taking nor restoring a snapshot
+       * depends on the size of the memory, of the taint or of the symbolic state.
+       *
+       * Snapshots are nested: restoring a snapshot keeps it (it may be restored again) and removes the
+       * snapshots taken after it.
+       */
+      class SnapshotEngine {
+        private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
+          //! AST garbage collector API
+          triton::ast::AstGarbageCollector* astGarbageCollector;
+
+          //! Symbolic engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! Taint engine API
+          triton::engines::taint::TaintEngine* taintEngine;
+
+          //! The snapshots, from the oldest to the last one.
+          std::vector<Snapshot> snapshots;
+
+          //! Deletes the copies of the snapshots from `index`.
+          void deleteSnapshots(triton::usize index);
+
+          //! Undoes the journals left opened by an instruction which raised an exception.
+          void closeJournals(void);
+
+        public:
+          //! Constructor.
+          SnapshotEngine(triton::arch::Architecture* architecture,
+                         triton::ast::AstGarbageCollector* astGarbageCollector,
+                         triton::engines::symbolic::SymbolicEngine* symbolicEngine,
+                         triton::engines::taint::TaintEngine* taintEngine);
+
+          //! Destructor.
+          ~SnapshotEngine();
+
+          //! Takes a snapshot and returns its id.
+          triton::usize takeSnapshot(void);
+
+          //! Restores the snapshot `id`. The snapshot is kept, the later ones are removed.
+          void restoreSnapshot(triton::usize id);
+
+          //! Removes the snapshot `id` and the later ones.
+          void removeSnapshot(triton::usize id);
+
+          //! Returns the number of snapshots.
+          triton::usize getNumberOfSnapshots(void) const;
+      };
+
+    /*! @} End of snapshot namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SNAPSHOTENGINE_H */
@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERCACHE_H
+#define TRITON_SOLVERCACHE_H
+
+#include <fstream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <triton/ast.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The key of a query, a 128-bits structural hash of its constraints.
+      typedef triton::ast::hash128 solverCacheKey;
+
+      /*! \class SolverCache
+       *  \brief The cache of the solver engine.
+       *
+       *  \description Maps a query to the models it has produced (an empty list means unsat) and to the limit
+       *  of models it has been solved with. The cache is thread-safe. If a path is defined, entries are loaded
+       *  from it and new entries are appended to it, so the cache survives across runs.
+       */
+      class SolverCache {
+        private:
+          //! A cache entry: the limit used to solve the query and the models found.
+          typedef std::pair<triton::uint32, std::list<std::map<triton::uint32, SolverModel>>> entry;
+
+          //! The entries.
+          std::map<solverCacheKey, entry> entries;
+
+          //! The file where new entries are appended. Not opened if there is no path.
+          std::ofstream file;
+
+          //! The number of queries found in the cache.
+          triton::usize hits;
+
+          //! The number of queries not found in the cache.
+          triton::usize misses;
+
+          //! Protects the entries, the counters and the file.
+          mutable std::mutex lock;
+
+          //! Writes an entry.
+          void write(std::ostream& stream, const solverCacheKey& key, const entry& value) const;
+
+        public:
+          //! Constructor.
+          SolverCache();
+
+          //! Destructor.
+          virtual ~SolverCache();
+
+          /*!
+           * \brief Looks for the models of a query solved with at least `limit` models (or with all its models).
+           *
+           * \description Returns true and fills `models` with at most `limit` models on a hit.
+           */
+          bool find(const solverCacheKey& key, triton::uint32 limit, std::list<std::map<triton::uint32, SolverModel>>& models);
+
+          //! Records the models of a query solved with `limit` models.
+          void insert(const solverCacheKey& key, triton::uint32 limit, const std::list<std::map<triton::uint32, SolverModel>>& models);
+
+          //! Loads the entries of `path` and appends the new entries to it. An empty path only keeps the cache in memory.
+          void setPath(const std::string& path);
+
+          //! Removes all entries (not the ones on disk) and resets the counters.
+          void clear(void);
+
+          //! Returns the number of entries.
+          triton::usize size(void) const;
+
+          //! Returns the number of queries found in the cache.
+          triton::usize getHits(void) const;
+
+          //! Returns the number of queries not found in the cache.
+          triton::usize getMisses(void) const;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERCACHE_H */
+
@@ -9,14 +9,19 @@
 #define TRITON_SOLVERENGINE_H
 
 #include <cstdlib>
+#include <functional>
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include <z3++.h>
 
 #include <triton/ast.hpp>
 #include <triton/solverModel.hpp>
+#include <triton/pathConstraint.hpp>
+#include <triton/solverCache.hpp>
+#include <triton/solverQueryResult.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -43,6 +48,12 @@ namespace triton {
      *  @{
      */
 
+      /*! \brief The prototype of the callback called each time a query of a batch is solved.
+       *
+       * \description Callbacks are called from the solver threads, one at a time and in completion order.
+       */
+      typedef std::function<void(const SolverQueryResult&)> solverQueryCallback;
+
       //! \class SolverEngine
       /*! \brief The solver engine class. */
       class SolverEngine {
@@ -50,6 +61,41 @@ namespace triton {
           //! Symbolic Engine API
           triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+          //! The number of threads used to solve a batch of queries.
+          triton::uint32 numberOfThreads;
+
+          //! The cache of queries.
+          mutable SolverCache cache;
+
+          //! True if queries go through the cache and the independence slicing.
+          bool cacheEnabled;
+
+          //! True if the constraints are normalized before being solved, see enableNormalization().
+          bool normalizationEnabled;
+
+          /*!
+           * \brief Flattens the conjunction `node` into `conjuncts`.
+           *
+           * \description Conjuncts without symbolic variable are evaluated and dropped. Returns false if one of them is false.
+           * With the normalization, the conjuncts structurally identical to a previous one are dropped too.
+           */
+          bool getConjuncts(triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& conjuncts) const;
+
+          //! Splits conjuncts into independent clusters, two conjuncts sharing a symbolic variable are in the same cluster.
+          std::vector<std::vector<triton::ast::AbstractNode*>> getIndependentClusters(const std::vector<triton::ast::AbstractNode*>& conjuncts) const;
+
+          //! Returns the cache key of a conjunction from the structural hashes of its conjuncts, independent of their order.
+          solverCacheKey getCacheKey(const std::vector<triton::ast::AbstractNode*>& conjuncts) const;
+
+          //! Solves a conjunction and returns at most `limit` models.
+          std::list<std::map<triton::uint32, SolverModel>> solveConjuncts(const std::vector<triton::ast::AbstractNode*>& conjuncts, triton::uint32 limit) const;
+
+          //! Returns at most `limit` models of the assertions of a Z3's solver. Models found are blocked in the solver.
+          std::list<std::map<triton::uint32, SolverModel>> solve(z3::solver& solver, triton::uint32 limit) const;
+
+          //! Solver sessions use the engine's symbolic engine and models enumeration.
+          friend class SolverSession;
+
         public:
           //! Constructor.
           SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -74,6 +120,75 @@ namespace triton {
            * **item2**: model
            */
           std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
+
+          //! Same as getModels() but the constraint is sent to the solver as an SMT-LIB2 script. Slower, mainly kept for comparison.
+          /*! \brief list of map of symbolic variable id -> model
+           *
+           * \description
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          std::list<std::map<triton::uint32, SolverModel>> getModelsViaSmtLib(triton::ast::AbstractNode* node, triton::uint32 limit) const;
+
+          /*!
+           * \brief Solves a batch of independent symbolic constraints in parallel. The `limit` is the number of models returned per query.
+           *
+           * \description Queries are dispatched to getNumberOfThreads() threads. Each result is given to the `callback`
+           * (if any) as soon as its query is solved, and all results are returned ordered as the `nodes`. The AST nodes and
+           * the symbolic engine must not be modified while the batch is running.
+           */
+          std::vector<SolverQueryResult> getModelsBatch(const std::vector<triton::ast::AbstractNode*>& nodes, triton::uint32 limit, const solverQueryCallback& callback=nullptr) const;
+
+          /*!
+           * \brief Solves, for each path constraint, its branches not taken under the prefix of the path constraints taken before it.
+           *
+           * \description This is the query sequence of a generational search. The prefix is asserted once in a SolverSession and each
+           * untaken branch is checked in its own scope, so a whole sweep translates each path constraint only once. The index of a
+           * result is the index of its path constraint. The `callback` (if any) is called after each query.
+           */
+          std::vector<SolverQueryResult> getModelsOfUntakenBranches(const std::vector<triton::engines::symbolic::PathConstraint>& pathConstraints, triton::uint32 limit, const solverQueryCallback& callback=nullptr) const;
+
+          /*!
+           * \brief Enables or disables the query cache.
+           *
+           * \description When enabled (default), getModels() splits a conjunction into clusters of constraints sharing no
+           * symbolic variable. With a limit of one model each cluster is solved (or found in the cache) on its own and the
+           * models are merged. Otherwise the whole conjunction is one cache entry.
+           */
+          void enableCache(bool flag);
+
+          //! Returns true if the query cache is enabled.
+          bool isCacheEnabled(void) const;
+
+          /*!
+           * \brief Enables or disables the normalization of the constraints.
+           *
+           * \description When enabled (default), the conjuncts structurally identical to a previous one (e.g. the same branch
+           * of a loop taken at each iteration) are asserted once, and the constraints are simplified by cheap local rewrites
+           * while translated into Z3, see triton::ast::TritonToZ3Ast::normalize.
+           */
+          void enableNormalization(bool flag);
+
+          //! Returns true if the constraints are normalized.
+          bool isNormalizationEnabled(void) const;
+
+          //! Loads the cache entries of `path` and appends the new ones to it. An empty path keeps the cache in memory only.
+          void setCachePath(const std::string& path);
+
+          //! Removes the cache entries from memory and resets the counters.
+          void clearCache(void);
+
+          //! Returns the number of queries found in the cache.
+          triton::usize getCacheHits(void) const;
+
+          //! Returns the number of queries not found in the cache.
+          triton::usize getCacheMisses(void) const;
+
+          //! Returns the number of threads used to solve a batch of queries.
+          triton::uint32 getNumberOfThreads(void) const;
+
+          //! Sets the number of threads used to solve a batch of queries. 0 means the number of hardware threads.
+          void setNumberOfThreads(triton::uint32 threads);
       };
 
     /*! @} End of solver namespace */
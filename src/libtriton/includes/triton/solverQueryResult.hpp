@@ -0,0 +1,94 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERQUERYRESULT_H
+#define TRITON_SOLVERQUERYRESULT_H
+
+#include <list>
+#include <map>
+
+#include <triton/solverModel.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverQueryResult
+      /*! \brief This class is used to represent the result of a query solved in a batch. */
+      class SolverQueryResult
+      {
+        protected:
+          //! The index of the query in its batch.
+          triton::usize index;
+
+          //! The models of the query (symbolic variable id -> model). Empty if the query is unsat.
+          std::list<std::map<triton::uint32, SolverModel>> models;
+
+          //! The time spent to translate and solve the query, in microseconds.
+          triton::uint64 time;
+
+        public:
+          //! Returns the index of the query in its batch.
+          triton::usize getIndex(void) const;
+
+          //! Returns the models of the query.
+          const std::list<std::map<triton::uint32, SolverModel>>& getModels(void) const;
+
+          //! Returns the time spent to translate and solve the query, in microseconds.
+          triton::uint64 getTime(void) const;
+
+          //! Returns true if at least one model has been found.
+          bool isSat(void) const;
+
+          //! Copies a SolverQueryResult
+          void copy(const SolverQueryResult& other);
+
+          //! Constructor.
+          SolverQueryResult();
+
+          //! Constructor.
+          SolverQueryResult(triton::usize index, const std::list<std::map<triton::uint32, SolverModel>>& models, triton::uint64 time);
+
+          //! Constructor by copy.
+          SolverQueryResult(const SolverQueryResult& other);
+
+          //! Destructor.
+          virtual ~SolverQueryResult();
+
+          //! Copies a SolverQueryResult
+          void operator=(const SolverQueryResult& other);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERQUERYRESULT_H */
+
@@ -0,0 +1,114 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERSESSION_H
+#define TRITON_SOLVERSESSION_H
+
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <z3++.h>
+
+#include <triton/ast.hpp>
+#include <triton/solverEngine.hpp>
+#include <triton/solverModel.hpp>
+#include <triton/tritonToZ3Ast.hpp>
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      /*! \class SolverSession
+       *  \brief An incremental solver session.
+       *
+       *  \description Constraints added to a session stay asserted in the same Z3 solver until the scope they belong to
+       *  is popped, and the Z3 expressions of the AST nodes are shared by all the queries of the session. The AST nodes
+       *  given to a session must stay alive and unchanged as long as the session is used.
+       */
+      class SolverSession {
+        private:
+          //! The solver engine.
+          const SolverEngine* engine;
+
+          //! The translator of the session. It owns the Z3's context and keeps the nodes already translated.
+          triton::ast::TritonToZ3Ast translator;
+
+          //! The Z3's solver. Declared after the translator as it uses its context.
+          z3::solver solver;
+
+          //! The number of scopes pushed.
+          triton::uint32 level;
+
+          //! The structural hashes of the constraints asserted, a constraint already asserted is not asserted again.
+          std::set<triton::ast::hash128> asserted;
+
+          //! The hashes asserted in each scope, removed from `asserted` when the scope is popped.
+          std::vector<std::vector<triton::ast::hash128>> scopes;
+
+        public:
+          //! Constructor.
+          SolverSession(const SolverEngine* engine);
+
+          //! Destructor.
+          virtual ~SolverSession();
+
+          //! Asserts a constraint in the current scope. With the normalization, a constraint already asserted is skipped.
+          void addConstraint(triton::ast::AbstractNode* node);
+
+          //! Opens a new scope.
+          void push(void);
+
+          //! Removes the constraints of the current scope and closes it.
+          void pop(void);
+
+          //! Returns the number of scopes pushed.
+          triton::uint32 getLevel(void) const;
+
+          //! Returns true if the constraints asserted are satisfiable.
+          bool isSat(void);
+
+          /*!
+           * \brief Computes and returns several models of the constraints asserted and `node`. The `limit` is the number of models returned.
+           *
+           * \description `node` is only asserted in a temporary scope, the session is left unchanged.
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERSESSION_H */
+
@@ -8,9 +8,12 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <functional>
 #include <list>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <triton/architecture.hpp>
 #include <triton/ast.hpp>
@@ -50,6 +53,84 @@ namespace triton {
      *  @{
      */
 
+      //! \class LazyFlag
+      /*! \brief A flag whose symbolic expression is only built when the flag is read (LAZY_FLAGS mode). */
+      class LazyFlag {
+        public:
+          //! Builds the AST of the flag.
+          std::function<triton::ast::AbstractNode*(void)> builder;
+
+          //! The comment of the symbolic expression.
+          std::string comment;
+
+          //! The id of the symbolic expression the flag is computed from.
+          triton::usize parent;
+
+          //! True if the flag is tainted.
+          bool isTainted;
+      };
+
+
+      //! \class SymbolicAttributes
+      /*! \brief The taint, the kind and the origin of an expression before a change, see SymbolicEngine::newCheckpoint(). */
+      class SymbolicAttributes {
+        public:
+          //! The expression changed.
+          SymbolicExpression* expr;
+
+          //! True if the expression was tainted.
+          bool isTainted;
+
+          //! The kind of the expression.
+          symkind_e kind;
+
+          //! The origin memory of the expression.
+          triton::arch::MemoryAccess originMemory;
+
+          //! The origin register of the expression.
+          triton::arch::Register originRegister;
+      };
+
+
+      //! \class SymbolicCheckpoint
+      /*! \brief A state of the symbolic engine, see SymbolicEngine::newCheckpoint(). */
+      class SymbolicCheckpoint {
+        public:
+          //! The first symbolic expression id created since the checkpoint.
+          triton::usize symExprId;
+
+          //! The first symbolic variable id created since the checkpoint.
+          triton::usize symVarId;
+
+          //! The number of path constraints.
+          triton::usize pathConstraints;
+
+          //! The size of the journal of registers.
+          triton::usize registers;
+
+          //! The size of the journal of memory cells.
+          triton::usize memory;
+
+          //! The size of the journal of aligned memory.
+          triton::usize alignedMemory;
+
+          //! The size of the journal of removed expressions.
+          triton::usize removedExpressions;
+
+          //! The size of the journal of cleared path constraints.
+          triton::usize clearedPathConstraints;
+
+          //! The size of the journal of replaced ASTs.
+          triton::usize asts;
+
+          //! The size of the journal of expression attributes.
+          triton::usize attributes;
+
+          //! The pending flags.
+          std::map<triton::uint32, LazyFlag> lazyFlags;
+      };
+
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -89,7 +170,9 @@ namespace triton {
            *
            * \description
            * **item1**: memory address<br>
-           * **item2**: symbolic reference id
+           * **item2**: symbolic reference id<br>
+           * With the MEMORY_RANGES mode, all bytes of a store point to the same expression and the
+           * origin memory of this expression gives the range covered by the store.
            */
           std::map<triton::uint64, triton::usize> memoryReference;
 
@@ -101,6 +184,41 @@ namespace triton {
            */
           std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
 
+          //! True if a journal is opened by beginJournal().
+          bool journalOpened;
+
+          //! The checkpoints, the changes are journaled while there is one. See newCheckpoint().
+          std::vector<SymbolicCheckpoint> checkpoints;
+
+          //! The previous references of the registers assigned since the first checkpoint.
+          std::vector<std::pair<triton::uint32, triton::usize>> journalRegisters;
+
+          //! The previous references of the memory cells assigned since the first checkpoint, UNSET if there was none.
+          std::vector<std::pair<triton::uint64, triton::usize>> journalMemory;
+
+          //! The previous aligned memory entries changed since the first checkpoint, nullptr if there was none.
+          std::vector<std::pair<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*>> journalAlignedMemory;
+
+          //! The symbolic expressions removed since the first checkpoint, they are deleted once there is no checkpoint.
+          std::vector<SymbolicExpression*> journalRemovedExpressions;
+
+          //! The path constraints cleared since the first checkpoint.
+          std::vector<std::vector<triton::engines::symbolic::PathConstraint>> journalPathConstraints;
+
+          //! The previous ASTs of the expressions converted to symbolic variables since the first checkpoint.
+          std::vector<std::pair<SymbolicExpression*, triton::ast::AbstractNode*>> journalAsts;
+
+          //! The previous taint, kind and origin of the expressions changed since the first checkpoint.
+          std::vector<SymbolicAttributes> journalAttributes;
+
+          /*! \brief map of flag -> pending flag (LAZY_FLAGS mode).
+           *
+           * \description
+           * **item1**: flag id<br>
+           * **item2**: the flag to build when it is read
+           */
+          std::map<triton::uint32, LazyFlag> lazyFlags;
+
         private:
           //! Architecture API
           triton::arch::Architecture* architecture;
@@ -117,10 +235,38 @@ namespace triton {
           //! Slices all expressions from a given node.
           void sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs);
 
+          //! Removes an aligned entry and journals it if needed.
+          void eraseAlignedMemory(triton::uint64 address, triton::uint32 size);
+
+          //! Removes a memory reference and journals it if needed.
+          void eraseMemoryReference(triton::uint64 address);
+
+          //! Assigns a register reference and journals it if needed.
+          void setRegisterReference(triton::uint32 id, triton::usize symExprId);
+
+          //! Replaces the AST of an expression and journals it if needed.
+          void setExpressionAst(SymbolicExpression* se, triton::ast::AbstractNode* node);
+
+          //! Journals the taint, the kind and the origin of an expression before they change, if needed.
+          void journalExpressionAttributes(SymbolicExpression* se);
+
+          //! Deletes the expressions removed while there was a checkpoint.
+          void deleteRemovedExpressions(void);
+
+          //! Builds the symbolic expression of a pending flag, the expression is added to `inst` if not null.
+          void buildLazyFlag(triton::uint32 flagId, triton::arch::Instruction* inst);
+
+          //! Assigns all bytes of a memory range to the same symbolic expression (MEMORY_RANGES mode).
+          void addMemoryRange(triton::uint64 address, triton::uint32 size, triton::usize id);
+
+          //! Returns a symbolic memory built from the memory ranges (MEMORY_RANGES mode).
+          triton::ast::AbstractNode* buildSymbolicMemoryRanges(triton::uint64 address, triton::uint32 size, const triton::uint8* concreteValue);
+
         public:
           //! Constructor. If you use this class as backup or copy you should define the `isBackup` flag as true.
           SymbolicEngine(triton::arch::Architecture* architecture,
                          triton::modes::Modes* modes,
+                         triton::ast::AstContext* astCtxt,
                          triton::callbacks::Callbacks* callbacks=nullptr,
                          bool isBackup=false);
 
@@ -169,6 +315,9 @@ namespace triton {
           //! Converts a symbolic register expression to a symbolic variable.
           SymbolicVariable* convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment="");
 
+          //! Returns the AST context which builds the nodes of the symbolic engine.
+          triton::ast::AstContext& getAstContext(void) const;
+
           //! Returns the symbolic variable corresponding to the symbolic variable id.
           SymbolicVariable* getSymbolicVariableFromId(triton::usize symVarId) const;
 
@@ -182,13 +331,13 @@ namespace triton {
           SymbolicExpression* getSymbolicExpressionFromId(triton::usize symExprId) const;
 
           //! Returns the map of symbolic registers defined.
-          std::map<triton::arch::Register, SymbolicExpression*> getSymbolicRegisters(void) const;
+          std::map<triton::arch::Register, SymbolicExpression*> getSymbolicRegisters(void);
 
           //! Returns the map (addr:expr) of all symbolic memory defined.
           std::map<triton::uint64, SymbolicExpression*> getSymbolicMemory(void) const;
 
           //! Returns the symbolic expression id corresponding to the register.
-          triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
+          triton::usize getSymbolicRegisterId(const triton::arch::Register& reg);
 
           //! Returns the symbolic memory value.
           triton::uint8 getSymbolicMemoryValue(triton::uint64 address);
@@ -233,10 +382,10 @@ namespace triton {
           SymbolicExpression* createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment="");
 
           //! Returns the new symbolic register expression expression and links this expression to the instruction.
-          SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& reg, const std::string& comment="");
+          SymbolicExpression* createSymbolicRegisterExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& reg, const std::string& comment="");
 
           //! Returns the new symbolic flag expression expression and links this expression to the instruction.
-          SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment="");
+          SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const triton::arch::Register& flag, const std::string& comment="");
 
           //! Returns the new symbolic volatile expression expression and links this expression to the instruction.
           SymbolicExpression* createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment="");
@@ -253,6 +402,9 @@ namespace triton {
           //! Assigns a symbolic expression to a memory.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem);
 
+          //! Sets the taint of an expression, the previous one is journaled if needed. Used by the taint engine.
+          void setExpressionTaint(SymbolicExpression* se, bool flag);
+
           //! Returns the full AST of a root node.
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
 
@@ -312,6 +464,57 @@ namespace triton {
 
           //! Initializes the memory access AST (LOAD and STORE).
           void initLeaAst(triton::arch::MemoryAccess& mem, bool force=false);
+
+          /*!
+           * \brief Adds a checkpoint and returns its index.
+           *
+           * \description While there is a checkpoint, every expression, variable and path constraint created and
+           * every reference assigned or removed is journaled, as well as the ASTs replaced by a conversion to a
+           * symbolic variable and the taint, the kind and the origin of the existing expressions. Restoring a checkpoint
+           * undoes the journal up to it, its cost only depends on the changes made since the checkpoint, not on the size
+           * of the engine. The other attributes of the existing expressions and variables (comments, concrete values, ...)
+           * are not journaled. The AST nodes must be restored first,
+           * see AstGarbageCollector::restoreCheckpoint().
+           */
+          triton::usize newCheckpoint(void);
+
+          //! Undoes all changes made since the checkpoint `index`. The checkpoint is kept, the later ones are removed.
+          void restoreCheckpoint(triton::usize index);
+
+          //! Removes the checkpoint `index` and the later ones, the changes are kept.
+          void removeCheckpoint(triton::usize index);
+
+          //! Returns the number of checkpoints.
+          triton::usize getNumberOfCheckpoints(void) const;
+
+          /*!
+           * \brief Starts to journal the changes of the engine.
+           *
+           * \description Adds a checkpoint which is restored and removed by rollbackJournal(). Used by the
+           * taint-only processing, the cost of a rollback only depends on the changes of the instruction.
+           */
+          void beginJournal(void);
+
+          //! Undoes all changes made since beginJournal() and deletes the expressions and variables created.
+          void rollbackJournal(void);
+
+          //! Returns true if a journal is opened by beginJournal().
+          bool isJournalOpened(void) const;
+
+          //! Removes all path constraints, they are journaled while there is a checkpoint.
+          void clearPathConstraints(void);
+
+          //! Returns true if the symbolic expressions of the flags are built when the flags are read.
+          bool isLazyFlagsEnabled(void) const;
+
+          /*!
+           * \brief Defers the symbolic expression of a flag until the flag is read.
+           *
+           * \description The concrete value of `flag` is synchronized at once. The expression is built by
+           * getSymbolicRegisterId() and by the functions using it, so a flag overwritten before being read
+           * never gets an expression.
+           */
+          void setLazyFlag(const triton::arch::Register& flag, const LazyFlag& lazy);
       };
 
     /*! @} End of symbolic namespace */
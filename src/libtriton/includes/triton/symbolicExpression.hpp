@@ -107,6 +107,9 @@ namespace triton {
           //! Sets a root node.
           void setAst(triton::ast::AbstractNode* node);
 
+          //! Sets back a previous root node, its parents are not updated. Used to restore a checkpoint.
+          void restoreAst(triton::ast::AbstractNode* node);
+
           //! Sets a comment to the symbolic expression.
           void setComment(const std::string& comment);
 
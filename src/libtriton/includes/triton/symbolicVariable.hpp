@@ -22,6 +22,10 @@ namespace triton {
  *  @{
  */
 
+  namespace ast {
+    class AstContext;
+  };
+
   //! The Engines namespace
   namespace engines {
   /*!
@@ -42,6 +46,9 @@ namespace triton {
           \brief The symbolic variable class. */
       class SymbolicVariable {
         protected:
+          //! The AST context which builds the node of the symbolic variable.
+          triton::ast::AstContext* astCtxt;
+
           //! The symbolic variable kind. \sa triton::engines::symbolic::symkind_e
           symkind_e kind;
 
@@ -70,7 +77,8 @@ namespace triton {
 
         public:
           //! Constructor.
-          SymbolicVariable(symkind_e kind,
+          SymbolicVariable(triton::ast::AstContext* astCtxt,
+                           symkind_e kind,
                            triton::uint64 kindValue,
                            triton::usize id,
                            triton::uint32 size,
@@ -8,11 +8,16 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <map>
 #include <set>
 
+#include <triton/architecture.hpp>
 #include <triton/memoryAccess.hpp>
+#include <triton/modes.hpp>
 #include <triton/register.hpp>
+#include <triton/shadowMemory.hpp>
 #include <triton/symbolicEngine.hpp>
+#include <triton/taintLabels.hpp>
 #include <triton/tritonTypes.hpp>
 
 
@@ -46,29 +51,65 @@ namespace triton {
       //! Defines an untainted item.
       const bool UNTAINTED = !TAINTED;
 
+      //! \class TaintState
+      /*! \brief The taint of the registers and of the memory, see TaintEngine::saveState(). */
+      class TaintState {
+        public:
+          //! True if the taint engine is enabled.
+          bool enableFlag;
+
+          //! The tainted addresses and their labels, the pages are shared with the taint engine.
+          triton::engines::taint::ShadowMemory taintedMemory;
+
+          //! The tainted registers.
+          std::set<triton::arch::Register> taintedRegisters;
+
+          //! The labels of the registers.
+          std::map<triton::uint32, triton::engines::taint::labelSet> registerLabels;
+      };
+
+
       /*! \class TaintEngine
           \brief The taint engine class. */
       class TaintEngine {
         private:
+          //! Architecture API
+          triton::arch::Architecture* architecture;
+
           //! Symbolic Engine API
           triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+          //! Modes API
+          triton::modes::Modes* modes;
+
         protected:
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The tainted addresses and their labels.
+          triton::engines::taint::ShadowMemory taintedMemory;
 
           //! The set of tainted registers. Currently it is an over approximation of the taint.
           std::set<triton::arch::Register> taintedRegisters;
 
+          //! The sets of labels, mutable as a union of labels may intern a new set.
+          mutable triton::engines::taint::TaintLabels labels;
+
+          //! The map of parent register id -> labels. Only labeled registers are kept, they are always tainted.
+          std::map<triton::uint32, triton::engines::taint::labelSet> registerLabels;
+
+          //! True if the labels read are recorded, see startLabelsRecording().
+          bool recordingLabels;
+
+          //! The labels read since startLabelsRecording().
+          mutable triton::engines::taint::labelSet recordedLabels;
+
           //! Copies a TaintEngine.
           void copy(const TaintEngine& other);
 
         public:
           //! Constructor.
-          TaintEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+          TaintEngine(triton::arch::Architecture* architecture, triton::modes::Modes* modes, triton::engines::symbolic::SymbolicEngine* symbolicEngine);
 
           //! Constructor by copy.
           TaintEngine(const TaintEngine& copy);
@@ -82,8 +123,19 @@ namespace triton {
           //! Enables or disables the taint engine.
           void enable(bool flag);
 
-          //! Returns the tainted addresses.
-          const std::set<triton::uint64>& getTaintedMemory(void) const;
+          /*!
+           * \brief Saves the taint of the registers and of the memory into `state`.
+           *
+           * \description The tainted pages are shared with the state, a page is only copied by its first write.
+           * The sets of labels are not saved: they are only added, so the labels saved stay valid.
+           */
+          void saveState(triton::engines::taint::TaintState& state) const;
+
+          //! Restores the taint of the registers and of the memory saved by saveState().
+          void restoreState(const triton::engines::taint::TaintState& state);
+
+          //! Returns the tainted addresses, iterating over them returns the addresses in ascending order.
+          const triton::engines::taint::ShadowMemory& getTaintedMemory(void) const;
 
           //! Returns the tainted registers.
           const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
@@ -91,6 +143,38 @@ namespace triton {
           //! Returns true if the taint engine is enabled.
           bool isEnabled(void) const;
 
+          //! Returns true if the `TAINT_LABELS` mode is enabled. Labels can only be set and recorded with this mode.
+          bool isLabelsEnabled(void) const;
+
+          //! Returns the labels of the range `[addr:size]`.
+          std::set<triton::uint32> getMemoryLabels(triton::uint64 addr, triton::uint32 size=1) const;
+
+          //! Returns the labels of the memory.
+          std::set<triton::uint32> getMemoryLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Returns the labels of the register.
+          std::set<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
+          //! Taints an address and adds a label to it. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelMemory(triton::uint64 addr, triton::uint32 label);
+
+          //! Taints a memory and adds a label to each of its bytes. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelMemory(const triton::arch::MemoryAccess& mem, triton::uint32 label);
+
+          //! Taints a register and adds a label to it. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelRegister(const triton::arch::Register& reg, triton::uint32 label);
+
+          /*!
+           * \brief Starts to record the labels of the registers and memory cells read as sources.
+           *
+           * \description The sources are the operands checked by isTainted() and the operands read by the
+           * taintUnion*() and taintAssignment*() methods. isMemoryTainted() and isRegisterTainted() do not record.
+           */
+          void startLabelsRecording(void);
+
+          //! Stops the recording and returns the labels read since startLabelsRecording().
+          std::set<triton::uint32> stopLabelsRecording(void);
+
           //! Returns true if the addr is tainted.
           bool isMemoryTainted(triton::uint64 addr, triton::uint32 size=1) const;
 
@@ -173,6 +257,33 @@ namespace triton {
           bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
         private:
+          //! Returns the labels of the range `[addr:size]`.
+          triton::engines::taint::labelSet getMemoryLabelSet(triton::uint64 addr, triton::usize size) const;
+
+          //! Returns the labels of the register.
+          triton::engines::taint::labelSet getRegisterLabelSet(const triton::arch::Register& reg) const;
+
+          //! Replaces the labels of the range `[addr:size]`.
+          void assignMemoryLabels(triton::uint64 addr, triton::usize size, triton::engines::taint::labelSet set);
+
+          //! Replaces the labels of the register.
+          void assignRegisterLabels(const triton::arch::Register& reg, triton::engines::taint::labelSet set);
+
+          //! Adds labels to the range `[addr:size]`.
+          void mergeMemoryLabels(triton::uint64 addr, triton::usize size, triton::engines::taint::labelSet set);
+
+          //! Adds labels to the register.
+          void mergeRegisterLabels(const triton::arch::Register& reg, triton::engines::taint::labelSet set);
+
+          //! Records labels read, see startLabelsRecording().
+          void recordLabels(triton::engines::taint::labelSet set) const;
+
+          //! Records the labels of a memory read as a source, see startLabelsRecording().
+          void recordMemoryLabels(const triton::arch::MemoryAccess& mem) const;
+
+          //! Records the labels of a register read as a source, see startLabelsRecording().
+          void recordRegisterLabels(const triton::arch::Register& reg) const;
+
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -0,0 +1,104 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <triton/tritonTypes.hpp>
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! A set of labels, see TaintLabels.
+      typedef triton::uint64 labelSet;
+
+      //! The empty set of labels.
+      const labelSet NO_LABELS = 0;
+
+      //! \class TaintLabels
+      /*! \brief The sets of labels of the taint engine.
+       *
+       * \description A set of labels is a 64-bit handle. Labels lower than 63 are kept inline as the bits of the
+       * handle, so most unions are a single `or`. Sets holding a larger label are interned: the handle has its
+       * highest bit set and the other bits are the index of the set. An interned set is stored once and the
+       * unions of interned sets are cached, so the same union is computed once.
+       */
+      class TaintLabels {
+        private:
+          //! The interned sets, sorted.
+          std::vector<std::vector<triton::uint32>> sets;
+
+          //! The map of interned set -> handle.
+          std::map<std::vector<triton::uint32>, labelSet> handles;
+
+          //! The cache of the unions of interned sets.
+          std::map<std::pair<labelSet, labelSet>, labelSet> unions;
+
+          //! Returns the handle of a sorted set of labels.
+          labelSet intern(const std::vector<triton::uint32>& labels);
+
+          //! Returns the sorted labels of a set.
+          std::vector<triton::uint32> expand(labelSet set) const;
+
+        public:
+          //! The highest bit of the handles of interned sets.
+          static const labelSet interned = (static_cast<labelSet>(1) << 63);
+
+          //! The number of labels kept inline.
+          static const triton::uint32 inlineLabels = 63;
+
+          //! Returns the set containing only `label`.
+          labelSet label(triton::uint32 label);
+
+          //! Returns the union of two sets.
+          labelSet merge(labelSet set1, labelSet set2);
+
+          //! Returns the labels of a set.
+          std::set<triton::uint32> getLabels(labelSet set) const;
+
+          //! Returns the number of interned sets.
+          triton::usize getNumberOfInternedSets(void) const;
+
+          //! Removes the interned sets. The handles of interned sets are no longer valid.
+          void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
@@ -50,9 +50,44 @@ namespace triton {
         //! The result.
         Z3Result result;
 
+        /*!
+         * \brief Nodes already translated, shared nodes are translated only once.
+         *
+         * \description Declared after the result as expressions must be released before their context.
+         */
+        std::map<triton::ast::AbstractNode*, z3::expr> translatedNodes;
+
+        //! Symbolic expressions already translated (symbolic expression id -> expression).
+        std::map<triton::usize, z3::expr> translatedReferences;
+
+        //! The depth of let bindings. Nodes under a let depend on its symbols and are not cached.
+        triton::uint32 letDepth;
+
+        /*!
+         * \brief True if the nodes are rewritten into cheaper equivalent expressions while translated.
+         *
+         * \description Sub-trees without symbolic variable are folded into constants, an `ite` whose condition is
+         * constant or whose branches are the same is collapsed, `(= (ite c x y) z)` with constant `x`, `y` and `z`
+         * becomes `c`, `(not c)` or a constant, and an `extract` of an `extract`, a `concat` or a `zero_extend`
+         * only translates the bits it selects.
+         */
+        bool normalize;
+
+        //! Returns true if the node is translated into a Z3's boolean.
+        static bool isLogical(const triton::ast::AbstractNode& e);
+
+        //! Returns the AST of a reference, the node itself otherwise.
+        triton::ast::AbstractNode* resolve(triton::ast::AbstractNode* node) const;
+
+        //! Translates a cheaper equivalent of the node into the result. Returns false if there is none.
+        bool normalizeNode(triton::ast::AbstractNode& e);
+
+        //! Translates `((_ extract hv lv) node)` into the result. Returns false if no bit can be skipped.
+        bool normalizeExtract(triton::uint32 hv, triton::uint32 lv, triton::ast::AbstractNode* node);
+
       public:
         //! Constructor.
-        TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true);
+        TritonToZ3Ast(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true, bool normalize=false);
 
         //! Destructor.
         virtual ~TritonToZ3Ast();
@@ -60,6 +95,9 @@ namespace triton {
         //! Evaluates a Triton AST.
         virtual Z3Result& eval(triton::ast::AbstractNode& e);
 
+        //! Returns the Z3's context of the translated expressions.
+        z3::context& getContext(void);
+
         //! Evaluate operator.
         virtual void operator()(triton::ast::AbstractNode& e);
         //! Evaluate operator.
@@ -9,11 +9,14 @@
 #define TRITON_X8664CPU_HPP
 
 #include <map>
+#include <memory>
 #include <set>
 #include <vector>
 
 #include <triton/callbacks.hpp>
+#include <triton/concreteMemory.hpp>
 #include <triton/cpuInterface.hpp>
+#include <triton/decodeCache.hpp>
 #include <triton/instruction.hpp>
 #include <triton/memoryAccess.hpp>
 #include <triton/register.hpp>
@@ -53,14 +56,18 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The capstone handle (csh), opened by the first disassembly.
+          mutable triton::usize handle;
+
+          //! The decoded instructions.
+          mutable triton::arch::DecodeCache decodeCache;
+
+          //! The registers of this CPU, indexed by their id. Defined by init().
+          triton::arch::Register registers[triton::arch::x86::ID_REG_LAST_ITEM];
+
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory, see ConcreteMemory.
+          triton::arch::ConcreteMemory memory;
 
           //! Concrete value of rax
           triton::uint8 rax[QWORD_SIZE];
@@ -305,6 +312,9 @@ namespace triton {
           //! Copies a x8664Cpu class.
           void copy(const x8664Cpu& other);
 
+          //! Copies the registers and the memory of another CPU, the callbacks and the decode cache are kept.
+          void copyState(const x8664Cpu& other);
+
           //! Returns true if regId is a GRP.
           bool isGPR(triton::uint32 regId) const;
 
@@ -331,8 +341,15 @@ namespace triton {
           bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1);
           bool isRegister(triton::uint32 regId) const;
           bool isRegisterValid(triton::uint32 regId) const;
-          std::set<triton::arch::Register*> getAllRegisters(void) const;
-          std::set<triton::arch::Register*> getParentRegisters(void) const;
+          bool isSyscall(const triton::arch::Instruction& inst) const;
+          std::map<std::string, triton::usize> getDecodeCacheStats(void) const;
+          const triton::arch::Register& getParentRegister(triton::uint32 regId) const;
+          const triton::arch::Register& getProgramCounter(void) const;
+          const triton::arch::Register& getRegister(triton::uint32 regId) const;
+          const triton::arch::Register& getStackPointer(void) const;
+          std::set<const triton::arch::Register*> getAllRegisters(void) const;
+          std::set<const triton::arch::Register*> getParentRegisters(void) const;
+          std::shared_ptr<triton::uint8> getConcreteMemoryPage(triton::uint64 addr);
           std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
           triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
           triton::uint32 numberOfRegisters(void) const;
@@ -343,13 +360,17 @@ namespace triton {
           triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
           void clear(void);
           void disassembly(triton::arch::Instruction& inst) const;
+          void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
           void init(void);
+          void mapMemoryPages(triton::uint64 baseAddr, triton::usize size);
+          void mapMemoryView(triton::uint64 baseAddr, const std::shared_ptr<const triton::uint8>& data, triton::usize size, triton::usize memorySize);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
           void setConcreteMemoryValue(const triton::arch::MemoryAccess& mem);
           void setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value);
           void setConcreteRegisterValue(const triton::arch::Register& reg);
           void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
+          void unmapMemoryPages(triton::uint64 baseAddr, triton::usize size);
           /* End of virtual pure inheritance ========================================== */
       };
 
@@ -9,8 +9,10 @@
 #define TRITON_X86SEMANTICS_H
 
 #include <triton/architecture.hpp>
+#include <triton/astContext.hpp>
 #include <triton/instruction.hpp>
 #include <triton/semanticsInterface.hpp>
+#include <triton/smallBitvector.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/taintEngine.hpp>
 
@@ -52,11 +54,15 @@ namespace triton {
           //! Taint Engine API
           triton::engines::taint::TaintEngine* taintEngine;
 
+          //! AST context API
+          triton::ast::AstContext* astCtxt;
+
         public:
           //! Constructor.
           x86Semantics(triton::arch::Architecture* architecture,
                        triton::engines::symbolic::SymbolicEngine* symbolicEngine,
-                       triton::engines::taint::TaintEngine* taintEngine);
+                       triton::engines::taint::TaintEngine* taintEngine,
+                       triton::ast::AstContext* astCtxt);
 
           //! Destructor.
           virtual ~x86Semantics();
@@ -64,6 +70,9 @@ namespace triton {
           //! Builds the semantics of the instruction. Returns true if the instruction is supported.
           bool buildSemantics(triton::arch::Instruction& inst);
 
+          //! Emulates the instruction and spreads its taint without building any node. Returns false if the instruction has no taint-only semantics.
+          bool buildTaintSemantics(triton::arch::Instruction& inst);
+
           //! Aligns the stack (add). Returns the new stack value.
           triton::uint64 alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta);
 
@@ -71,10 +80,24 @@ namespace triton {
           triton::uint64 alignSubStack_s(triton::arch::Instruction& inst, triton::uint32 delta);
 
           //! Clears a flag.
-          void clearFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment="");
+          void clearFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment="");
+
+          /*!
+           * \brief Creates the symbolic expression of a flag and spreads the taint.
+           *
+           * \description `value` is the concrete value of `node`. With the LAZY_FLAGS mode, only the concrete
+           * value is synchronized and `node` is called when the flag is read.
+           */
+          void flag_s(triton::arch::Instruction& inst,
+                      triton::engines::symbolic::SymbolicExpression* parent,
+                      const triton::arch::Register& flag,
+                      bool value,
+                      const std::function<triton::ast::AbstractNode*(void)>& node,
+                      bool taint,
+                      const std::string& comment);
 
           //! Sets a flag.
-          void setFlag_s(triton::arch::Instruction& inst, triton::arch::Register& flag, std::string comment="");
+          void setFlag_s(triton::arch::Instruction& inst, const triton::arch::Register& flag, std::string comment="");
 
           //! Control flow semantics. Used to represent IP.
           void controlFlow_s(triton::arch::Instruction& inst);
@@ -1222,6 +1245,74 @@ namespace triton {
 
           //! The XORPS semantics.
           void xorps_s(triton::arch::Instruction& inst);
+
+          /* Taint-only semantics ===================================================== */
+
+          //! Aligns the stack (add) without building any node. Returns the new stack value.
+          triton::uint64 alignAddStack_t(triton::arch::Instruction& inst, triton::uint32 delta);
+
+          //! Aligns the stack (sub) without building any node. Returns the new stack value.
+          triton::uint64 alignSubStack_t(triton::arch::Instruction& inst, triton::uint32 delta);
+
+          //! Control flow without building any node. Used to represent IP.
+          void controlFlow_t(triton::arch::Instruction& inst);
+
+          //! Sets the concrete value and the taint of a flag.
+          void flag_t(triton::arch::Instruction& inst, triton::uint32 flagId, bool value, bool taint);
+
+          //! Sets PF, SF and ZF from the result of an operation.
+          void resultFlags_t(triton::arch::Instruction& inst, const triton::SmallBitvector& res, bool taint);
+
+          //! Initializes the address of a memory operand without building its LEA.
+          void initAddress_t(triton::arch::MemoryAccess& mem, bool force=false);
+
+          //! Returns the concrete value of an immediate read by the instruction.
+          triton::SmallBitvector readImmediate_t(triton::arch::Instruction& inst, triton::arch::Immediate& imm);
+
+          //! Returns the concrete value of a memory read by the instruction.
+          triton::SmallBitvector readMemory_t(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem);
+
+          //! Returns the concrete value of a register read by the instruction.
+          triton::SmallBitvector readRegister_t(triton::arch::Instruction& inst, triton::arch::Register& reg);
+
+          //! Returns the concrete value of an operand read by the instruction.
+          triton::SmallBitvector read_t(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op);
+
+          //! Writes the concrete value of an operand written by the instruction. `taint` is the taint of the operand.
+          void write_t(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op, const triton::SmallBitvector& value, bool taint);
+
+          //! The taint-only ADD, AND, CMP, OR, SUB, TEST and XOR semantics.
+          void binary_t(triton::arch::Instruction& inst);
+
+          //! The taint-only CALL semantics.
+          void call_t(triton::arch::Instruction& inst);
+
+          //! The taint-only Jcc semantics.
+          void jcc_t(triton::arch::Instruction& inst);
+
+          //! The taint-only JMP semantics.
+          void jmp_t(triton::arch::Instruction& inst);
+
+          //! The taint-only LEA semantics.
+          void lea_t(triton::arch::Instruction& inst);
+
+          //! The taint-only MOV, MOVABS, MOVSX, MOVSXD and MOVZX semantics.
+          void mov_t(triton::arch::Instruction& inst);
+
+          //! The taint-only NOP semantics.
+          void nop_t(triton::arch::Instruction& inst);
+
+          //! The taint-only POP semantics.
+          void pop_t(triton::arch::Instruction& inst);
+
+          //! The taint-only PUSH semantics.
+          void push_t(triton::arch::Instruction& inst);
+
+          //! The taint-only RET semantics.
+          void ret_t(triton::arch::Instruction& inst);
+
+          //! The taint-only DEC, INC, NEG and NOT semantics.
+          void unary_t(triton::arch::Instruction& inst);
       };
 
     /*! @} End of x86 namespace */
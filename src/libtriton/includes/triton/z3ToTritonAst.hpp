@@ -11,6 +11,7 @@
 #include <z3++.h>
 
 #include <triton/ast.hpp>
+#include <triton/astContext.hpp>
 #include <triton/symbolicEngine.hpp>
 #include <triton/tritonTypes.hpp>
 
@@ -38,6 +39,12 @@ namespace triton {
         //! Symbolic Engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+        //! AST context API, the context of the symbolic engine.
+        triton::ast::AstContext* astCtxt;
+
+        //! Nodes already converted during the current conversion (Z3's AST id -> Triton's node).
+        std::map<triton::uint32, triton::ast::AbstractNode*> translatedNodes;
+
         //! Vists and converts
         triton::ast::AbstractNode* visit(z3::expr const& expr);
 
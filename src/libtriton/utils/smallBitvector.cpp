@@ -0,0 +1,506 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <new>
+
+#include <triton/exceptions.hpp>
+#include <triton/smallBitvector.hpp>
+
+
+
+namespace triton {
+
+  SmallBitvector::SmallBitvector() {
+    this->narrow = 0;
+    this->wide   = nullptr;
+    this->size   = 0;
+  }
+
+
+  SmallBitvector::SmallBitvector(triton::uint64 value, triton::uint32 size) {
+    this->narrow = 0;
+    this->wide   = nullptr;
+    this->size   = size;
+
+    if (size <= 64) {
+      this->narrow = value & SmallBitvector::narrowMask(size);
+      return;
+    }
+
+    this->wide = new(std::nothrow) triton::uint512(value);
+    if (this->wide == nullptr)
+      throw triton::exceptions::SmallBitvector("SmallBitvector::SmallBitvector(): Not enough memory.");
+  }
+
+
+  SmallBitvector::SmallBitvector(const triton::uint512& value, triton::uint32 size) {
+    this->narrow = 0;
+    this->wide   = nullptr;
+    this->size   = size;
+
+    if (size <= 64) {
+      /* Mask before the conversion, convert_to() saturates */
+      this->narrow = (value & SmallBitvector::narrowMask(size)).convert_to<triton::uint64>();
+      return;
+    }
+
+    this->wide = new(std::nothrow) triton::uint512(value & SmallBitvector::wideMask(size));
+    if (this->wide == nullptr)
+      throw triton::exceptions::SmallBitvector("SmallBitvector::SmallBitvector(): Not enough memory.");
+  }
+
+
+  SmallBitvector::SmallBitvector(const SmallBitvector& other) {
+    this->wide = nullptr;
+    this->copy(other);
+  }
+
+
+  SmallBitvector::SmallBitvector(SmallBitvector&& other) {
+    this->narrow = other.narrow;
+    this->wide   = other.wide;
+    this->size   = other.size;
+    other.wide   = nullptr;
+  }
+
+
+  SmallBitvector::~SmallBitvector() {
+    delete this->wide;
+  }
+
+
+  SmallBitvector& SmallBitvector::operator=(const SmallBitvector& other) {
+    if (this != &other)
+      this->copy(other);
+    return *this;
+  }
+
+
+  SmallBitvector& SmallBitvector::operator=(SmallBitvector&& other) {
+    if (this != &other) {
+      delete this->wide;
+      this->narrow = other.narrow;
+      this->wide   = other.wide;
+      this->size   = other.size;
+      other.wide   = nullptr;
+    }
+    return *this;
+  }
+
+
+  void SmallBitvector::copy(const SmallBitvector& other) {
+    this->narrow = other.narrow;
+    this->size   = other.size;
+
+    if (other.wide == nullptr) {
+      delete this->wide;
+      this->wide = nullptr;
+      return;
+    }
+
+    /* Reuse the storage if any */
+    if (this->wide != nullptr) {
+      *this->wide = *other.wide;
+      return;
+    }
+
+    this->wide = new(std::nothrow) triton::uint512(*other.wide);
+    if (this->wide == nullptr)
+      throw triton::exceptions::SmallBitvector("SmallBitvector::copy(): Not enough memory.");
+  }
+
+
+  triton::uint64 SmallBitvector::narrowMask(triton::uint32 size) {
+    if (size >= 64)
+      return static_cast<triton::uint64>(-1);
+    return (static_cast<triton::uint64>(1) << size) - 1;
+  }
+
+
+  triton::uint512 SmallBitvector::wideMask(triton::uint32 size) {
+    triton::uint512 mask = -1;
+    mask = mask >> (512 - size);
+    return mask;
+  }
+
+
+  SmallBitvector SmallBitvector::ones(triton::uint32 size) {
+    if (size <= 64)
+      return SmallBitvector(static_cast<triton::uint64>(-1), size);
+    return SmallBitvector(SmallBitvector::wideMask(size), size);
+  }
+
+
+  triton::sint64 SmallBitvector::toSint64(void) const {
+    if (this->size < 64 && this->isSigned())
+      return static_cast<triton::sint64>(this->narrow | ~SmallBitvector::narrowMask(this->size));
+    return static_cast<triton::sint64>(this->narrow);
+  }
+
+
+  bool SmallBitvector::operator==(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return this->narrow == other.narrow;
+    return this->toUint512() == other.toUint512();
+  }
+
+
+  bool SmallBitvector::operator!=(const SmallBitvector& other) const {
+    return !(*this == other);
+  }
+
+
+  triton::uint32 SmallBitvector::getSize(void) const {
+    return this->size;
+  }
+
+
+  bool SmallBitvector::isWide(void) const {
+    return (this->wide != nullptr);
+  }
+
+
+  bool SmallBitvector::isZero(void) const {
+    if (this->wide == nullptr)
+      return this->narrow == 0;
+    return this->wide->is_zero();
+  }
+
+
+  bool SmallBitvector::isSigned(void) const {
+    if (this->size == 0)
+      return false;
+    if (this->wide == nullptr)
+      return ((this->narrow >> (this->size - 1)) & 1);
+    return bit_test(*this->wide, this->size - 1);
+  }
+
+
+  triton::uint64 SmallBitvector::toUint64(void) const {
+    if (this->wide == nullptr)
+      return this->narrow;
+    return (*this->wide & static_cast<triton::uint64>(-1)).convert_to<triton::uint64>();
+  }
+
+
+  triton::uint512 SmallBitvector::toUint512(void) const {
+    if (this->wide == nullptr)
+      return this->narrow;
+    return *this->wide;
+  }
+
+
+  triton::sint512 SmallBitvector::toSint512(void) const {
+    if (this->wide == nullptr)
+      return this->toSint64();
+
+    if (!this->isSigned())
+      return this->wide->convert_to<triton::sint512>();
+
+    /* The magnitude of a negative value always fits in size-1 bits */
+    triton::uint512 magnitude = ((~*this->wide) & SmallBitvector::wideMask(this->size)) + 1;
+    return -(magnitude.convert_to<triton::sint512>());
+  }
+
+
+  SmallBitvector SmallBitvector::bvadd(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow + other.narrow, this->size);
+    return SmallBitvector(this->toUint512() + other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvand(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow & other.narrow, this->size);
+    return SmallBitvector(this->toUint512() & other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvashr(const SmallBitvector& other) const {
+    bool sign = this->isSigned();
+
+    if (other.bvuge(SmallBitvector(static_cast<triton::uint64>(this->size), other.size)))
+      return sign ? SmallBitvector::ones(this->size) : SmallBitvector(static_cast<triton::uint64>(0), this->size);
+
+    triton::uint32 shift = static_cast<triton::uint32>(other.toUint64());
+    if (shift == 0)
+      return *this;
+
+    if (this->wide == nullptr) {
+      triton::uint64 value = this->narrow >> shift;
+      if (sign)
+        value |= SmallBitvector::narrowMask(this->size) << (this->size - shift);
+      return SmallBitvector(value, this->size);
+    }
+
+    triton::uint512 value = *this->wide >> shift;
+    if (sign)
+      value |= SmallBitvector::wideMask(this->size) << (this->size - shift);
+    return SmallBitvector(value, this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvlshr(const SmallBitvector& other) const {
+    if (other.bvuge(SmallBitvector(static_cast<triton::uint64>(this->size), other.size)))
+      return SmallBitvector(static_cast<triton::uint64>(0), this->size);
+
+    triton::uint32 shift = static_cast<triton::uint32>(other.toUint64());
+    if (this->wide == nullptr)
+      return SmallBitvector(this->narrow >> shift, this->size);
+    return SmallBitvector(*this->wide >> shift, this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvmul(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow * other.narrow, this->size);
+    return SmallBitvector(this->toUint512() * other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvnand(const SmallBitvector& other) const {
+    return this->bvand(other).bvnot();
+  }
+
+
+  SmallBitvector SmallBitvector::bvneg(void) const {
+    if (this->wide == nullptr)
+      return SmallBitvector(static_cast<triton::uint64>(0) - this->narrow, this->size);
+    return SmallBitvector((~*this->wide) + 1, this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvnor(const SmallBitvector& other) const {
+    return this->bvor(other).bvnot();
+  }
+
+
+  SmallBitvector SmallBitvector::bvnot(void) const {
+    if (this->wide == nullptr)
+      return SmallBitvector(~this->narrow, this->size);
+    return SmallBitvector(~*this->wide, this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvor(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow | other.narrow, this->size);
+    return SmallBitvector(this->toUint512() | other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvrol(triton::uint32 rot) const {
+    if (this->size == 0 || (rot %= this->size) == 0)
+      return *this;
+
+    if (this->wide == nullptr)
+      return SmallBitvector((this->narrow << rot) | (this->narrow >> (this->size - rot)), this->size);
+    return SmallBitvector((*this->wide << rot) | (*this->wide >> (this->size - rot)), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvror(triton::uint32 rot) const {
+    if (this->size == 0 || (rot %= this->size) == 0)
+      return *this;
+
+    if (this->wide == nullptr)
+      return SmallBitvector((this->narrow >> rot) | (this->narrow << (this->size - rot)), this->size);
+    return SmallBitvector((*this->wide >> rot) | (*this->wide << (this->size - rot)), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvsdiv(const SmallBitvector& other) const {
+    if (other.isZero())
+      return this->isSigned() ? SmallBitvector(static_cast<triton::uint64>(1), this->size) : SmallBitvector::ones(this->size);
+
+    if (this->wide == nullptr && other.wide == nullptr) {
+      triton::sint64 op2 = other.toSint64();
+      /* Also avoids the overflow of INT64_MIN / -1 */
+      if (op2 == -1)
+        return this->bvneg();
+      return SmallBitvector(static_cast<triton::uint64>(this->toSint64() / op2), this->size);
+    }
+
+    return SmallBitvector((this->toSint512() / other.toSint512()).convert_to<triton::uint512>(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvshl(const SmallBitvector& other) const {
+    if (other.bvuge(SmallBitvector(static_cast<triton::uint64>(this->size), other.size)))
+      return SmallBitvector(static_cast<triton::uint64>(0), this->size);
+
+    triton::uint32 shift = static_cast<triton::uint32>(other.toUint64());
+    if (this->wide == nullptr)
+      return SmallBitvector(this->narrow << shift, this->size);
+    return SmallBitvector(*this->wide << shift, this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvsmod(const SmallBitvector& other) const {
+    if (other.isZero())
+      return *this;
+
+    if (this->wide == nullptr && other.wide == nullptr) {
+      triton::sint64 op2 = other.toSint64();
+      if (op2 == -1)
+        return SmallBitvector(static_cast<triton::uint64>(0), this->size);
+      triton::sint64 rem = this->toSint64() % op2;
+      /* Same as ((rem + op2) % op2) without overflow */
+      if (rem != 0 && ((rem < 0) != (op2 < 0)))
+        rem += op2;
+      return SmallBitvector(static_cast<triton::uint64>(rem), this->size);
+    }
+
+    triton::sint512 op1 = this->toSint512();
+    triton::sint512 op2 = other.toSint512();
+    return SmallBitvector((((op1 % op2) + op2) % op2).convert_to<triton::uint512>(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvsrem(const SmallBitvector& other) const {
+    if (other.isZero())
+      return *this;
+
+    if (this->wide == nullptr && other.wide == nullptr) {
+      triton::sint64 op2 = other.toSint64();
+      if (op2 == -1)
+        return SmallBitvector(static_cast<triton::uint64>(0), this->size);
+      return SmallBitvector(static_cast<triton::uint64>(this->toSint64() % op2), this->size);
+    }
+
+    triton::sint512 op1 = this->toSint512();
+    triton::sint512 op2 = other.toSint512();
+    return SmallBitvector((op1 - ((op1 / op2) * op2)).convert_to<triton::uint512>(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvsub(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow - other.narrow, this->size);
+    return SmallBitvector(this->toUint512() - other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvudiv(const SmallBitvector& other) const {
+    if (other.isZero())
+      return SmallBitvector::ones(this->size);
+
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow / other.narrow, this->size);
+    return SmallBitvector(this->toUint512() / other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvurem(const SmallBitvector& other) const {
+    if (other.isZero())
+      return *this;
+
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow % other.narrow, this->size);
+    return SmallBitvector(this->toUint512() % other.toUint512(), this->size);
+  }
+
+
+  SmallBitvector SmallBitvector::bvxnor(const SmallBitvector& other) const {
+    return this->bvxor(other).bvnot();
+  }
+
+
+  SmallBitvector SmallBitvector::bvxor(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return SmallBitvector(this->narrow ^ other.narrow, this->size);
+    return SmallBitvector(this->toUint512() ^ other.toUint512(), this->size);
+  }
+
+
+  bool SmallBitvector::bvsge(const SmallBitvector& other) const {
+    return !this->bvslt(other);
+  }
+
+
+  bool SmallBitvector::bvsgt(const SmallBitvector& other) const {
+    return other.bvslt(*this);
+  }
+
+
+  bool SmallBitvector::bvsle(const SmallBitvector& other) const {
+    return !other.bvslt(*this);
+  }
+
+
+  bool SmallBitvector::bvslt(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return this->toSint64() < other.toSint64();
+    return this->toSint512() < other.toSint512();
+  }
+
+
+  bool SmallBitvector::bvuge(const SmallBitvector& other) const {
+    return !this->bvult(other);
+  }
+
+
+  bool SmallBitvector::bvugt(const SmallBitvector& other) const {
+    return other.bvult(*this);
+  }
+
+
+  bool SmallBitvector::bvule(const SmallBitvector& other) const {
+    return !other.bvult(*this);
+  }
+
+
+  bool SmallBitvector::bvult(const SmallBitvector& other) const {
+    if (this->wide == nullptr && other.wide == nullptr)
+      return this->narrow < other.narrow;
+    return this->toUint512() < other.toUint512();
+  }
+
+
+  SmallBitvector SmallBitvector::concat(const SmallBitvector& other) const {
+    triton::uint32 size = this->size + other.size;
+
+    if (size <= 64) {
+      triton::uint64 high = (other.size < 64) ? (this->narrow << other.size) : 0;
+      return SmallBitvector(high | other.narrow, size);
+    }
+
+    return SmallBitvector((this->toUint512() << other.size) | other.toUint512(), size);
+  }
+
+
+  SmallBitvector SmallBitvector::extract(triton::uint32 high, triton::uint32 low) const {
+    triton::uint32 size = (high - low) + 1;
+
+    if (this->wide == nullptr)
+      return SmallBitvector((low < 64) ? (this->narrow >> low) : 0, size);
+    return SmallBitvector(*this->wide >> low, size);
+  }
+
+
+  SmallBitvector SmallBitvector::sx(triton::uint32 sizeExt) const {
+    triton::uint32 size = this->size + sizeExt;
+
+    if (!this->isSigned())
+      return this->zx(sizeExt);
+
+    if (size <= 64)
+      return SmallBitvector(this->narrow | ~SmallBitvector::narrowMask(this->size), size);
+    return SmallBitvector(this->toUint512() | ~SmallBitvector::wideMask(this->size), size);
+  }
+
+
+  SmallBitvector SmallBitvector::zx(triton::uint32 sizeExt) const {
+    triton::uint32 size = this->size + sizeExt;
+
+    if (size <= 64)
+      return SmallBitvector(this->narrow, size);
+    return SmallBitvector(this->toUint512(), size);
+  }
+
+}; /* triton namespace */
@@ -67,3 +67,16 @@ class TestAstConversion(unittest.TestCase):
         for n in self.node:
             self.assertEqual(n.evaluate(), simplify(n, True).evaluate())
 
+
+    def test_shared_nodes(self):
+        # Each level uses its child twice. Without sharing the translation
+        # would visit 2^64 nodes.
+        n = self.v1
+        c = bv(0xaa, 8)
+        for _ in range(64):
+            n = n + n
+            c = c + c
+        self.assertEqual(n.evaluate(), simplify(n, True).evaluate())
+        # evaluateAstViaZ3 only concretizes the variables of registers and memory
+        self.assertEqual(c.evaluate(), evaluateAstViaZ3(c))
+
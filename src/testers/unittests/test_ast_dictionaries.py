@@ -0,0 +1,62 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test AST dictionaries."""
+
+import unittest
+
+from triton     import *
+from triton.ast import *
+
+
+class TestAstDictionaries(unittest.TestCase):
+
+    """Testing the hash-consing of AST nodes."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.AST_DICTIONARIES, True)
+
+        self.v1 = variable(newSymbolicVariable(8))
+        self.v2 = variable(newSymbolicVariable(8))
+
+    def test_sharing(self):
+        """Check the same node is recorded once."""
+        before = getAstDictionariesStats()
+
+        for _ in range(10):
+            n = bvadd(self.v1, bv(1, 8))
+            bvsub(n, self.v2)
+
+        after = getAstDictionariesStats()
+        self.assertEqual(after["bvadd"] - before["bvadd"], 1)
+        self.assertEqual(after["bvsub"] - before["bvsub"], 1)
+        self.assertEqual(after["bv"] - before["bv"], 1)
+        self.assertEqual(after["allocatedNodes"] - before["allocatedNodes"], 10 * 5)
+
+    def test_childs_order(self):
+        """Check the order of the childs matters."""
+        before = getAstDictionariesStats()
+        bvsub(self.v1, self.v2)
+        bvsub(self.v2, self.v1)
+        after = getAstDictionariesStats()
+        self.assertEqual(after["bvsub"] - before["bvsub"], 2)
+
+    def test_payload(self):
+        """Check leaves are recorded by value."""
+        before = getAstDictionariesStats()
+        for i in range(100):
+            bv(i % 10, 8)
+            string("s%d" % (i % 5))
+        after = getAstDictionariesStats()
+        self.assertEqual(after["bv"] - before["bv"], 10)
+        self.assertEqual(after["string"] - before["string"], 5)
+
+    def test_stats(self):
+        """Check the keys of the stats."""
+        stats = getAstDictionariesStats()
+        for key in ["assert", "bvadd", "bv", "decimal", "reference", "string",
+                    "variable", "zx", "allocatedDictionaries", "allocatedNodes"]:
+            self.assertIn(key, stats)
+        self.assertEqual(sum(v for k, v in stats.items() if k not in ["allocatedDictionaries", "allocatedNodes"]),
+                         stats["allocatedDictionaries"])
@@ -79,3 +79,17 @@ class TestAstDuplication(unittest.TestCase):
         for n in self.node:
             self.assertEqual(n.getHash(), duplicate(n).getHash())
 
+
+    def test_structural_hash(self):
+        """Check duplicates share the structural hash."""
+        for n in self.node:
+            self.assertEqual(hash(n), hash(duplicate(n)))
+
+    def test_shared_dag_hash(self):
+        """Check hashing does not walk shared subtrees."""
+        n = m = self.v1
+        for _ in range(200):
+            n = n + n
+            m = m + m
+        self.assertEqual(hash(n), hash(m))
+        self.assertNotEqual(hash(n), hash(n + self.v2))
@@ -7,7 +7,8 @@ import unittest
 from triton import setArchitecture, ARCH, evaluateAstViaZ3
 from triton.ast import (bv, bvsub, bvadd, bvxor, bvor, bvand, bvnand, bvnor,
                         bvxnor, bvmul, bvneg, bvnot, bvsdiv, sx, zx, bvudiv,
-                        bvashr, bvlshr, bvshl, bvrol, bvror, bvsmod, bvsrem)
+                        bvashr, bvlshr, bvshl, bvrol, bvror, bvsmod, bvsrem,
+                        concat, extract)
 
 
 class TestAstEval(unittest.TestCase):
@@ -802,3 +803,23 @@ class TestAstEval(unittest.TestCase):
             bvsrem(zx(64, bv(9223372036854775808, 64)), sx(64, bv(18446744073709551615, 64))),
         ]
         self.check_ast(tests)
+
+    def test_wide(self):
+        """Check operations around the 64 bits boundary."""
+        tests = []
+        for size in [63, 64, 65, 128, 256]:
+            m = (1 << size) - 1
+            a = bv(m - 0x1234, size)
+            b = bv(0x1f, size)
+            tests += [
+                bvadd(a, b), bvsub(b, a), bvmul(a, a), bvneg(b), bvnot(a),
+                bvudiv(a, b), bvsdiv(a, b), bvsmod(a, b), bvsrem(a, b),
+                bvshl(a, b), bvlshr(a, b), bvashr(a, b), bvrol(3, a), bvror(3, a),
+                sx(16, a), zx(16, a), extract(size - 1, 1, a),
+            ]
+        tests += [
+            concat([bv(0xffffffffffffffff, 64), bv(1, 1)]),
+            concat([bv(0x12345678, 32), bv(0x9abcdef0, 32)]),
+            extract(71, 8, bv(0xff00ff00ff00ff00ff, 72)),
+        ]
+        self.check_ast(tests)
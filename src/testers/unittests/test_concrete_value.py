@@ -7,7 +7,10 @@ import unittest
 from triton import (setArchitecture, ARCH, REG, getAllRegisters, getParentRegisters,
                     setConcreteRegisterValue, Register, getConcreteRegisterValue,
                     isMemoryMapped, setConcreteMemoryValue, getConcreteMemoryValue,
-                    unmapMemory, setConcreteMemoryAreaValue, getConcreteMemoryAreaValue)
+                    unmapMemory, setConcreteMemoryAreaValue, getConcreteMemoryAreaValue,
+                    MemoryAccess, CPUSIZE, getConcreteMemoryPage, mapMemoryPages,
+                    unmapMemoryPages, takeSnapshot, restoreSnapshot, addCallback,
+                    removeAllCallbacks, CALLBACK, Instruction, processing)
 
 
 class TestX86ConcreteRegisterValue(unittest.TestCase):
@@ -175,3 +178,147 @@ class TestX8664ConcreteMemoryValue(unittest.TestCase):
         setConcreteMemoryAreaValue(0x1000, "\x11\x22\x33\x44\x55\x66")
         setConcreteMemoryAreaValue(0x1006, [0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc])
         self.assertEqual(getConcreteMemoryAreaValue(0x1000, 12), "\x11\x22\x33\x44\x55\x66\x77\x88\x99\xaa\xbb\xcc")
+
+    def test_pages(self):
+        """Check accesses crossing the pages of the memory."""
+        base = 0x10000 - 0x10
+        data = "".join(chr(x & 0xff) for x in range(0x2020))
+
+        setConcreteMemoryAreaValue(base, data)
+        self.assertTrue(isMemoryMapped(base, len(data)))
+        self.assertEqual(getConcreteMemoryAreaValue(base, len(data)), data)
+
+        setConcreteMemoryValue(MemoryAccess(0xfffc, CPUSIZE.QWORD, 0x1122334455667788))
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0xfffc, CPUSIZE.QWORD)), 0x1122334455667788)
+        self.assertEqual(getConcreteMemoryValue(0x10000), 0x44)
+
+        setConcreteMemoryValue(MemoryAccess(0xffe0, CPUSIZE.DQQWORD, (1 << 511) | 0x42))
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0xffe0, CPUSIZE.DQQWORD)), (1 << 511) | 0x42)
+
+        # Unmap a part of a page, the rest stays mapped
+        unmapMemory(0x10100, 0x10)
+        self.assertFalse(isMemoryMapped(0x10100, 1))
+        self.assertTrue(isMemoryMapped(0x10110, 0x100))
+        self.assertEqual(getConcreteMemoryValue(0x10100), 0)
+        self.assertEqual(getConcreteMemoryAreaValue(0x100fe, 4), "\x0e\x0f\x00\x00")
+
+        unmapMemory(base, len(data))
+        self.assertFalse(isMemoryMapped(base, 1))
+        self.assertEqual(getConcreteMemoryAreaValue(base, 4), "\x00\x00\x00\x00")
+
+    def test_page_view(self):
+        """Check a page is read and written in place through a memoryview."""
+        page = getConcreteMemoryPage(0x1234)
+        self.assertEqual(page.getAddress(), 0x1000)
+        self.assertEqual(page.getSize(), 0x1000)
+        self.assertTrue(isMemoryMapped(0x1000, 0x1000))
+
+        view = memoryview(page)
+        self.assertEqual(len(view), 0x1000)
+        view[0x234:0x238] = "\x11\x22\x33\x44"
+        self.assertEqual(getConcreteMemoryAreaValue(0x1234, 4), "\x11\x22\x33\x44")
+
+        setConcreteMemoryValue(0x1000, 0x41)
+        self.assertEqual(view[0], "A")
+
+        # The page is not shared with a snapshot
+        sid = takeSnapshot()
+        view[0] = "B"
+        self.assertEqual(getConcreteMemoryValue(0x1000), 0x42)
+        restoreSnapshot(sid)
+        self.assertEqual(getConcreteMemoryValue(0x1000), 0x41)
+
+        # The view is detached by the restore
+        view[0] = "C"
+        self.assertEqual(getConcreteMemoryValue(0x1000), 0x41)
+
+    def test_buffer(self):
+        """Check an area is set from any buffer."""
+        data = bytearray("\x01\x02\x03\x04\x05\x06\x07\x08")
+        setConcreteMemoryAreaValue(0x5ffc, memoryview(data)[2:6])
+        self.assertEqual(getConcreteMemoryAreaValue(0x5ffc, 4), "\x03\x04\x05\x06")
+
+    def test_map_pages(self):
+        """Check pages are mapped and unmapped at once."""
+        setConcreteMemoryValue(0x10010, 0x41)
+        mapMemoryPages(0x10000, 0x2001)
+        self.assertTrue(isMemoryMapped(0x10000, 0x3000))
+        self.assertFalse(isMemoryMapped(0x13000, 1))
+        self.assertEqual(getConcreteMemoryValue(0x10010), 0x41)
+
+        unmapMemoryPages(0x11fff, 2)
+        self.assertTrue(isMemoryMapped(0x10000, 0x1000))
+        self.assertFalse(isMemoryMapped(0x11000, 1))
+        self.assertFalse(isMemoryMapped(0x12000, 1))
+
+
+class TestX8664ConcreteMemoryPageProvider(unittest.TestCase):
+
+    """Testing the GET_CONCRETE_MEMORY_PAGE callbacks."""
+
+    def setUp(self):
+        """Define the arch and a provider of two pages."""
+        setArchitecture(ARCH.X86_64)
+        self.calls = []
+        self.image = "\x48\xC7\xC0\x01\x00\x00\x00" + "\x90" * 0x1ff9 # mov rax, 1
+
+        def provider(addr, size):
+            self.calls.append(addr)
+            if 0x400000 <= addr < 0x400000 + len(self.image):
+                return self.image[addr - 0x400000:addr - 0x400000 + size]
+            return None
+
+        # addCallback does not keep a reference on the function
+        self.provider = provider
+        addCallback(self.provider, CALLBACK.GET_CONCRETE_MEMORY_PAGE)
+
+    def tearDown(self):
+        """Remove the provider."""
+        removeAllCallbacks()
+
+    def test_once_per_page(self):
+        """Check the provider is called once per page."""
+        self.assertEqual(getConcreteMemoryAreaValue(0x400000, 3), "\x48\xC7\xC0")
+        self.assertEqual(getConcreteMemoryValue(0x400ff0), 0x90)
+        self.assertTrue(isMemoryMapped(0x400000, 0x2000))
+        self.assertEqual(self.calls, [0x400000, 0x401000])
+
+    def test_not_provided(self):
+        """Check a page not provided stays unmapped and is not asked again."""
+        self.assertFalse(isMemoryMapped(0x500000, 1))
+        self.assertEqual(getConcreteMemoryValue(0x500000), 0)
+        self.assertEqual(self.calls, [0x500000])
+
+        # An unmapped page is asked again
+        unmapMemoryPages(0x500000, 1)
+        self.assertFalse(isMemoryMapped(0x500000, 1))
+        self.assertEqual(self.calls, [0x500000, 0x500000])
+
+    def test_new_provider(self):
+        """Check a page declined is asked to a provider added later."""
+        self.assertFalse(isMemoryMapped(0x500000, 1))
+        provider = lambda addr, size: "\x41" * size
+        addCallback(provider, CALLBACK.GET_CONCRETE_MEMORY_PAGE)
+        self.assertEqual(getConcreteMemoryValue(0x500000), 0x41)
+        self.assertEqual(self.calls, [0x500000, 0x500000])
+
+    def test_write(self):
+        """Check a write keeps the rest of the page provided."""
+        setConcreteMemoryValue(0x400001, 0xff)
+        self.assertEqual(getConcreteMemoryAreaValue(0x400000, 3), "\x48\xff\xC0")
+        self.assertEqual(self.calls, [0x400000])
+
+    def test_processing(self):
+        """Check the instructions are fetched from the pages provided."""
+        inst = Instruction()
+        inst.setOpcodes(getConcreteMemoryAreaValue(0x400000, 16))
+        inst.setAddress(0x400000)
+        processing(inst)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 1)
+
+    def test_unmap(self):
+        """Check an unmapped page is provided again."""
+        getConcreteMemoryValue(0x400000)
+        unmapMemoryPages(0x400000, 1)
+        getConcreteMemoryValue(0x400000)
+        self.assertEqual(self.calls, [0x400000, 0x400000])
@@ -0,0 +1,109 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the decode cache."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, Instruction, processing, disassembly,
+                    getDecodeCacheStats, setConcreteMemoryValue, setConcreteMemoryAreaValue,
+                    OPCODE, OPERAND)
+
+
+class TestDecodeCache(unittest.TestCase):
+
+    """Testing the decode cache."""
+
+    def setUp(self):
+        """Define the arch."""
+        setArchitecture(ARCH.X86_64)
+
+    def decode(self, opcodes, addr=0x400000):
+        """Disassemble an instruction."""
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        inst.setAddress(addr)
+        disassembly(inst)
+        return inst
+
+    def test_hit(self):
+        """Check that the same instruction at the same address is decoded once."""
+        self.decode("\x48\x01\xd8")
+        stats = getDecodeCacheStats()
+        self.decode("\x48\x01\xd8")
+        self.assertEqual(getDecodeCacheStats()["hits"], stats["hits"] + 1)
+        self.assertEqual(getDecodeCacheStats()["misses"], stats["misses"])
+
+    def test_other_opcodes(self):
+        """Check that other opcodes at the same address are decoded again."""
+        self.decode("\x48\x01\xd8")
+        stats = getDecodeCacheStats()
+        inst = self.decode("\x48\x31\xd8")
+        self.assertEqual(getDecodeCacheStats()["misses"], stats["misses"] + 1)
+        self.assertEqual(inst.getType(), OPCODE.XOR)
+
+    def test_same_result(self):
+        """Check that a hit returns the same instruction as a miss."""
+        code = "\x48\x8b\x44\x88\x10"  # mov rax, qword ptr [rax + rcx*4 + 0x10]
+        inst1 = self.decode(code, 0x1000)
+        inst2 = self.decode(code + "\x90\x90", 0x1000)
+
+        self.assertEqual(inst1.getDisassembly(), inst2.getDisassembly())
+        self.assertEqual(inst1.getSize(), inst2.getSize())
+        self.assertEqual(inst1.getType(), inst2.getType())
+        self.assertEqual(inst1.getPrefix(), inst2.getPrefix())
+        self.assertEqual(len(inst1.getOperands()), len(inst2.getOperands()))
+
+        op1 = inst1.getOperands()
+        op2 = inst2.getOperands()
+        self.assertEqual(op2[0].getType(), OPERAND.REG)
+        self.assertEqual(op2[0].getName(), "rax")
+        self.assertEqual(op2[1].getType(), OPERAND.MEM)
+        self.assertEqual(op1[1].getBaseRegister().getName(), op2[1].getBaseRegister().getName())
+        self.assertEqual(op1[1].getIndexRegister().getName(), op2[1].getIndexRegister().getName())
+        self.assertEqual(op1[1].getDisplacement().getValue(), op2[1].getDisplacement().getValue())
+        self.assertEqual(op1[1].getScale().getValue(), op2[1].getScale().getValue())
+
+    def test_branch(self):
+        """Check that the control flow flags are cached."""
+        for _ in range(2):
+            inst = self.decode("\x74\x10")  # je
+            self.assertTrue(inst.isBranch())
+            self.assertTrue(inst.isControlFlow())
+
+    def test_invalidation(self):
+        """Check that writing over a decoded instruction invalidates it."""
+        self.decode("\x48\x01\xd8", 0x2000)
+        stats = getDecodeCacheStats()
+
+        # Writes around the instruction do not invalidate it
+        setConcreteMemoryValue(0x1fff, 0x90)
+        setConcreteMemoryValue(0x2003, 0x90)
+        self.assertEqual(getDecodeCacheStats()["invalidations"], stats["invalidations"])
+
+        # A write in its last byte does
+        setConcreteMemoryValue(0x2002, 0xc0)
+        self.assertEqual(getDecodeCacheStats()["invalidations"], stats["invalidations"] + 1)
+
+        self.decode("\x48\x01\xd8", 0x2000)
+        self.assertEqual(getDecodeCacheStats()["misses"], stats["misses"] + 1)
+
+        # So does an area overlapping its first byte
+        setConcreteMemoryAreaValue(0x1ffe, [0x90, 0x90, 0x90])
+        self.assertEqual(getDecodeCacheStats()["invalidations"], stats["invalidations"] + 2)
+
+    def test_processing(self):
+        """Check that a hit gives the same semantics."""
+        for _ in range(2):
+            inst = Instruction()
+            inst.setOpcodes("\x48\x01\xd8")
+            inst.setAddress(0x3000)
+            processing(inst)
+            self.assertEqual(inst.getDisassembly(), "add rax, rbx")
+            self.assertEqual(len(inst.getReadRegisters()), 2)
+            self.assertEqual(len(inst.getSymbolicExpressions()), 8)
+
+    def test_architecture(self):
+        """Check that setting the architecture resets the entries."""
+        self.decode("\x48\x01\xd8")
+        setArchitecture(ARCH.X86)
+        self.assertEqual(getDecodeCacheStats()["entries"], 0)
@@ -0,0 +1,115 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the native emulation loop."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, STOP, Instruction, processing,
+                    emulate, setConcreteMemoryAreaValue, getConcreteMemoryAreaValue,
+                    getConcreteRegisterValue)
+
+
+CODE = [
+    (0x1000, "\x48\xC7\xC1\x05\x00\x00\x00"), # mov rcx, 5
+    (0x1007, "\x48\xFF\xC0"),                 # inc rax
+    (0x100a, "\x48\xFF\xC9"),                 # dec rcx
+    (0x100d, "\x75\xF8"),                     # jne 0x1007
+    (0x100f, "\x0F\x05"),                     # syscall
+    (0x1011, "\x90"),                         # nop
+]
+
+
+class TestEmulate(unittest.TestCase):
+
+    """Testing emulate()."""
+
+    def setUp(self):
+        """Define the arch and map a loop."""
+        setArchitecture(ARCH.X86_64)
+        for addr, opcodes in CODE:
+            setConcreteMemoryAreaValue(addr, opcodes)
+
+    def test_address(self):
+        """Check the emulation stops before a stop address."""
+        summary = emulate(0x1000, [0x100f], 0)
+        self.assertEqual(summary['reason'], STOP.ADDRESS)
+        self.assertEqual(summary['pc'], 0x100f)
+        self.assertEqual(summary['count'], 16)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 5)
+        self.assertEqual(getConcreteRegisterValue(REG.RIP), 0x100f)
+
+    def test_count(self):
+        """Check the emulation stops after the maximum number of instructions."""
+        summary = emulate(0x1000, [], 4)
+        self.assertEqual(summary['reason'], STOP.COUNT)
+        self.assertEqual(summary['pc'], 0x1007)
+        self.assertEqual(summary['count'], 4)
+
+    def test_syscall(self):
+        """Check the emulation stops after a system call and may be resumed."""
+        summary = emulate(0x1000, [], 0, True)
+        self.assertEqual(summary['reason'], STOP.SYSCALL)
+        self.assertEqual(summary['pc'], 0x1011)
+        self.assertEqual(summary['count'], 17)
+
+        summary = emulate(summary['pc'], [], 0, True)
+        self.assertEqual(summary['reason'], STOP.UNMAPPED)
+        self.assertEqual(summary['pc'], 0x1012)
+        self.assertEqual(summary['count'], 1)
+
+    def test_unmapped(self):
+        """Check an instruction which runs into unmapped memory is not processed."""
+        setConcreteMemoryAreaValue(0x2000, "\x48\xC7\xC1\x05")  # mov rcx, 5 without its last bytes
+        summary = emulate(0x2000, [], 0)
+        self.assertEqual(summary['reason'], STOP.UNMAPPED)
+        self.assertEqual(summary['pc'], 0x2000)
+        self.assertEqual(summary['count'], 0)
+        self.assertEqual(getConcreteRegisterValue(REG.RCX), 0)
+
+    def test_hook(self):
+        """Check the hook is called after each instruction and may stop the emulation."""
+        seen = []
+
+        def hook(inst):
+            seen.append(inst.getAddress())
+            return len(seen) == 6
+
+        summary = emulate(0x1000, [], 0, False, hook)
+        self.assertEqual(summary['reason'], STOP.HOOK)
+        self.assertEqual(summary['count'], 6)
+        self.assertEqual(seen, [0x1000, 0x1007, 0x100a, 0x100d, 0x1007, 0x100a])
+        self.assertEqual(getConcreteRegisterValue(REG.RCX), 3)
+
+        def fail(inst):
+            raise ValueError()
+
+        with self.assertRaises(TypeError):
+            emulate(0x1000, [], 0, False, fail)
+
+    def test_same_state(self):
+        """Check the state is the one of a loop over processing()."""
+        emulate(0x1000, [0x1011], 0)
+        native = [getConcreteRegisterValue(r) for r in [REG.RAX, REG.RCX, REG.RIP, REG.ZF]]
+
+        setArchitecture(ARCH.X86_64)
+        for addr, opcodes in CODE:
+            setConcreteMemoryAreaValue(addr, opcodes)
+
+        pc = 0x1000
+        while pc != 0x1011:
+            inst = Instruction()
+            inst.setOpcodes(getConcreteMemoryAreaValue(pc, 16))
+            inst.setAddress(pc)
+            processing(inst)
+            pc = getConcreteRegisterValue(REG.RIP)
+
+        self.assertEqual([getConcreteRegisterValue(r) for r in [REG.RAX, REG.RCX, REG.RIP, REG.ZF]], native)
+
+    def test_arguments(self):
+        """Check the arguments."""
+        with self.assertRaises(TypeError):
+            emulate(0x1000, 0x100f, 0)
+        with self.assertRaises(TypeError):
+            emulate(0x1000, ["a"], 0)
+        with self.assertRaises(TypeError):
+            emulate(0x1000, [], 0, False, 1)
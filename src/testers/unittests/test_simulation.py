@@ -371,6 +371,39 @@ class TestSymboliqueEngineAligned(BaseTestSimulation, unittest.TestCase):
         super(TestSymboliqueEngineAligned, self).setUp()
 
 
+class TestSymboliqueEngineRanges(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic emulation engine with MEMORY_RANGES."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.MEMORY_RANGES, True)
+        super(TestSymboliqueEngineRanges, self).setUp()
+
+
+class TestSymboliqueEngineLazyFlags(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic emulation engine with LAZY_FLAGS."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.LAZY_FLAGS, True)
+        super(TestSymboliqueEngineLazyFlags, self).setUp()
+
+
+class TestSymboliqueEngineArena(BaseTestSimulation, unittest.TestCase):
+
+    """Testing the symbolic engine with AST_ARENA."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.AST_ARENA, True)
+        super(TestSymboliqueEngineArena, self).setUp()
+
+
 class TestSymboliqueEngineAlignedAst(BaseTestSimulation, unittest.TestCase):
 
     """Testing the symbolic engine with ALIGNED_MEMORY and AST Dict."""
@@ -0,0 +1,213 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test the snapshots."""
+
+import unittest
+
+from triton import (setArchitecture, ARCH, REG, Instruction, processing,
+                    MemoryAccess, CPUSIZE, setConcreteMemoryValue,
+                    getConcreteMemoryValue, setConcreteRegisterValue,
+                    getConcreteRegisterValue, Register, isMemoryMapped,
+                    taintRegister, isRegisterTainted, isMemoryTainted,
+                    convertRegisterToSymbolicVariable, getSymbolicExpressions,
+                    getSymbolicVariables, getSymbolicRegisterId,
+                    getPathConstraints, takeSnapshot, restoreSnapshot,
+                    removeSnapshot, getNumberOfSnapshots, SYMEXPR,
+                    convertMemoryToSymbolicVariable, getSymbolicMemoryId,
+                    getSymbolicExpressionFromId, enableMode, MODE,
+                    labelMemory, getMemoryLabels, untaintRegister,
+                    taintAssignmentMemoryImmediate,
+                    assignSymbolicExpressionToRegister)
+
+
+class TestSnapshot(unittest.TestCase):
+
+    """Testing the snapshots."""
+
+    def setUp(self):
+        """Define the arch and a symbolic and tainted state."""
+        setArchitecture(ARCH.X86_64)
+        setConcreteRegisterValue(Register(REG.RAX, 0x1234))
+        setConcreteRegisterValue(Register(REG.RBX, 0x1000))
+        setConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD, 0x1122334455667788))
+        taintRegister(REG.RAX)
+        convertRegisterToSymbolicVariable(REG.RAX)
+
+    def emulate(self):
+        """Process a few instructions which change every engine."""
+        for opcodes in ["\x48\xFF\xC0",          # inc rax
+                        "\x48\x89\x03",          # mov [rbx], rax
+                        "\x48\x89\x43\x08",      # mov [rbx+8], rax
+                        "\x48\x3B\x03",          # cmp rax, [rbx]
+                        "\x75\x00"]:             # jne $+2
+            inst = Instruction()
+            inst.setOpcodes(opcodes)
+            processing(inst)
+
+    def ast(self, exprId):
+        """Return the AST of an expression as string."""
+        return str(getSymbolicExpressionFromId(exprId).getAst())
+
+    def test_restore(self):
+        """Check that restoring a snapshot restores every engine."""
+        convertMemoryToSymbolicVariable(MemoryAccess(0x1000, CPUSIZE.QWORD))
+        exprs = len(getSymbolicExpressions())
+        varss = len(getSymbolicVariables())
+        pcs = len(getPathConstraints())
+        rax = getSymbolicRegisterId(REG.RAX)
+        mem = getSymbolicMemoryId(0x1000)
+        raxAst = self.ast(rax)
+        memAst = self.ast(mem)
+
+        sid = takeSnapshot()
+        self.assertEqual(getNumberOfSnapshots(), 1)
+
+        # The conversions of existing expressions replace their ASTs
+        convertRegisterToSymbolicVariable(REG.RAX)
+        convertMemoryToSymbolicVariable(MemoryAccess(0x1000, CPUSIZE.BYTE))
+        self.assertNotEqual(self.ast(rax), raxAst)
+        self.assertNotEqual(self.ast(mem), memAst)
+
+        self.emulate()
+        convertRegisterToSymbolicVariable(REG.RCX)
+        setConcreteMemoryValue(0x5000, 0x41)
+        self.assertNotEqual(getSymbolicRegisterId(REG.RCX), SYMEXPR.UNSET)
+
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1235)
+        self.assertTrue(isMemoryTainted(MemoryAccess(0x1008, CPUSIZE.QWORD)))
+        self.assertNotEqual(len(getSymbolicExpressions()), exprs)
+        self.assertNotEqual(len(getPathConstraints()), pcs)
+
+        restoreSnapshot(sid)
+
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1234)
+        self.assertEqual(getConcreteMemoryValue(MemoryAccess(0x1000, CPUSIZE.QWORD)), 0x1122334455667788)
+        self.assertFalse(isMemoryMapped(0x5000))
+        self.assertFalse(isMemoryMapped(0x1008))
+        self.assertTrue(isRegisterTainted(REG.RAX))
+        self.assertFalse(isMemoryTainted(MemoryAccess(0x1000, CPUSIZE.QWORD)))
+        self.assertEqual(len(getSymbolicExpressions()), exprs)
+        self.assertEqual(len(getSymbolicVariables()), varss)
+        self.assertEqual(len(getPathConstraints()), pcs)
+        self.assertEqual(getSymbolicRegisterId(REG.RAX), rax)
+        self.assertEqual(getSymbolicRegisterId(REG.RCX), SYMEXPR.UNSET)
+        self.assertEqual(getSymbolicMemoryId(0x1000), mem)
+        self.assertEqual(self.ast(rax), raxAst)
+        self.assertEqual(self.ast(mem), memAst)
+        self.assertEqual(getNumberOfSnapshots(), 1)
+
+    def test_taint(self):
+        """Check that restoring a snapshot restores the taint and the labels."""
+        enableMode(MODE.TAINT_LABELS, True)
+        labelMemory(0x2000, 5)
+
+        sid = takeSnapshot()
+        labelMemory(0x2000, 6)
+        labelMemory(0x2001, 7)
+        untaintRegister(REG.RAX)
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x2000, CPUSIZE.WORD)), [5, 6, 7])
+
+        restoreSnapshot(sid)
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x2000, CPUSIZE.WORD)), [5])
+        self.assertFalse(isMemoryTainted(0x2001))
+        self.assertTrue(isRegisterTainted(REG.RAX))
+        enableMode(MODE.TAINT_LABELS, False)
+
+    def test_expression_attributes(self):
+        """Check that restoring a snapshot restores the taint, the kind and the origin of the expressions."""
+        self.emulate()
+        mem = getSymbolicMemoryId(0x1000)
+        rax = getSymbolicRegisterId(REG.RAX)
+        self.assertTrue(getSymbolicExpressionFromId(mem).isTainted())
+
+        sid = takeSnapshot()
+        taintAssignmentMemoryImmediate(MemoryAccess(0x1000, CPUSIZE.QWORD))
+        assignSymbolicExpressionToRegister(getSymbolicExpressionFromId(rax), REG.RCX)
+        self.assertFalse(getSymbolicExpressionFromId(mem).isTainted())
+        self.assertEqual(getSymbolicExpressionFromId(rax).getOriginRegister().getName(), "rcx")
+
+        restoreSnapshot(sid)
+        self.assertTrue(getSymbolicExpressionFromId(mem).isTainted())
+        self.assertEqual(getSymbolicExpressionFromId(rax).getOriginRegister().getName(), "rax")
+
+    def test_convert_after_restore(self):
+        """Check that the expressions restored by a snapshot may be converted and used again."""
+        varss = len(getSymbolicVariables())
+        rax = getSymbolicRegisterId(REG.RAX)
+        raxAst = self.ast(rax)
+
+        sid = takeSnapshot()
+        for _ in range(10):
+            # The nodes built here point to the AST of RAX, they are freed by the restore
+            self.emulate()
+            convertRegisterToSymbolicVariable(REG.RAX)
+            self.emulate()
+            restoreSnapshot(sid)
+            self.assertEqual(self.ast(rax), raxAst)
+
+            # Change the symbolic input and run again from the restored state
+            convertRegisterToSymbolicVariable(REG.RAX)
+            self.assertEqual(len(getSymbolicVariables()), varss + 1)
+            self.emulate()
+
+            ast = getSymbolicExpressionFromId(getSymbolicRegisterId(REG.RAX)).getAst()
+            self.assertEqual(ast.evaluate(), 0x1235)
+            self.assertTrue(ast.isSymbolized())
+            self.assertEqual(len(getPathConstraints()), 1)
+            restoreSnapshot(sid)
+
+    def test_restore_twice(self):
+        """Check that a snapshot may be restored several times."""
+        sid = takeSnapshot()
+        for _ in range(10):
+            self.emulate()
+            restoreSnapshot(sid)
+            self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1234)
+            self.assertEqual(len(getPathConstraints()), 0)
+
+        # The ids of the expressions built after a restore start again
+        self.emulate()
+        ids = sorted(getSymbolicExpressions().keys())
+        restoreSnapshot(sid)
+        self.emulate()
+        self.assertEqual(sorted(getSymbolicExpressions().keys()), ids)
+
+    def test_nested(self):
+        """Check that restoring a snapshot removes the later ones."""
+        first = takeSnapshot()
+        self.emulate()
+        second = takeSnapshot()
+        self.emulate()
+        self.assertEqual(getNumberOfSnapshots(), 2)
+
+        restoreSnapshot(second)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1235)
+        self.assertEqual(len(getPathConstraints()), 1)
+
+        restoreSnapshot(first)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1234)
+        self.assertEqual(len(getPathConstraints()), 0)
+        self.assertEqual(getNumberOfSnapshots(), 1)
+
+        with self.assertRaises(TypeError):
+            restoreSnapshot(second)
+
+    def test_remove(self):
+        """Check that removing a snapshot keeps the current state."""
+        sid = takeSnapshot()
+        self.emulate()
+        exprs = len(getSymbolicExpressions())
+        removeSnapshot(sid)
+
+        self.assertEqual(getNumberOfSnapshots(), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.RAX), 0x1235)
+        self.assertEqual(len(getSymbolicExpressions()), exprs)
+
+        with self.assertRaises(TypeError):
+            restoreSnapshot(sid)
+
+    def test_architecture(self):
+        """Check that setting the architecture removes the snapshots."""
+        takeSnapshot()
+        setArchitecture(ARCH.X86)
+        self.assertEqual(getNumberOfSnapshots(), 0)
@@ -0,0 +1,246 @@
+#!/usr/bin/env python2
+# coding: utf-8
+"""Test Solver."""
+
+import os
+import tempfile
+import unittest
+
+from triton import (setArchitecture, ARCH, ast, newSymbolicVariable, getModel,
+                    getModelsBatch, getSolverThreads, setSolverThreads,
+                    Instruction, processing, REG, convertRegisterToSymbolicVariable,
+                    getPathConstraints, getModelsOfUntakenBranches, getModels,
+                    clearSolverCache, enableSolverCache, isSolverCacheEnabled,
+                    setSolverCachePath, getSolverCacheHits, getSolverCacheMisses,
+                    enableSolverNormalization, isSolverNormalizationEnabled,
+                    getPathConstraintsAst)
+
+
+class TestSolverBatch(unittest.TestCase):
+
+    """Testing batches of queries solved in parallel."""
+
+    def setUp(self):
+        """Define the arch and the constraints."""
+        setArchitecture(ARCH.X86_64)
+
+        self.v = ast.variable(newSymbolicVariable(8))
+        self.nodes = [ast.assert_(ast.equal(self.v, ast.bv(i, 8))) for i in range(32)]
+        # unsat
+        self.nodes.append(ast.assert_(ast.land(ast.equal(self.v, ast.bv(1, 8)), ast.equal(self.v, ast.bv(2, 8)))))
+
+    def test_threads(self):
+        """Check the number of threads can be configured."""
+        self.assertGreater(getSolverThreads(), 0)
+        setSolverThreads(3)
+        self.assertEqual(getSolverThreads(), 3)
+        setSolverThreads(0)
+        self.assertGreater(getSolverThreads(), 0)
+
+    def test_batch(self):
+        """Check results are ordered as the queries and match getModel."""
+        for threads in [1, 4]:
+            setSolverThreads(threads)
+            results = getModelsBatch(self.nodes, 1)
+            self.assertEqual(len(results), len(self.nodes))
+
+            for i in range(32):
+                models, time = results[i]
+                self.assertEqual(len(models), 1)
+                self.assertEqual(models[0].values()[0].getValue(), i)
+                self.assertEqual(models[0].values()[0].getValue(), getModel(self.nodes[i]).values()[0].getValue())
+                self.assertGreaterEqual(time, 0)
+
+            models, time = results[32]
+            self.assertEqual(models, [])
+
+
+class TestSolverUntakenBranches(unittest.TestCase):
+
+    """Testing the incremental sweep over the path constraints."""
+
+    def setUp(self):
+        """Define the arch and a trace with two conditional branches on RAX."""
+        setArchitecture(ARCH.X86_64)
+        convertRegisterToSymbolicVariable(REG.RAX)
+
+        trace = [
+            (0x400000, "\x48\x83\xF8\x10"), # cmp rax, 0x10
+            (0x400004, "\x74\x10"),         # je  0x400016
+            (0x400006, "\x48\x83\xF8\x20"), # cmp rax, 0x20
+            (0x40000a, "\x75\x10"),         # jne 0x40001c
+        ]
+
+        for addr, opcodes in trace:
+            inst = Instruction()
+            inst.setAddress(addr)
+            inst.setOpcodes(opcodes)
+            processing(inst)
+
+    def test_sweep(self):
+        """Check each untaken branch is solved under the prefix taken before it."""
+        pcs = getPathConstraints()
+        results = getModelsOfUntakenBranches(1)
+        self.assertEqual(len(results), 2)
+
+        prefix = ast.equal(ast.bvtrue(), ast.bvtrue())
+        for i, (index, models, time) in enumerate(results):
+            self.assertEqual(index, i)
+            self.assertEqual(len(models), 1)
+            self.assertGreaterEqual(time, 0)
+
+            for branch in pcs[index].getBranchConstraints():
+                if not branch['isTaken']:
+                    expected = getModel(ast.assert_(ast.land(prefix, branch['constraint'])))
+                    self.assertEqual(models[0].values()[0].getValue(), expected.values()[0].getValue())
+
+            prefix = ast.land(prefix, pcs[index].getTakenPathConstraintAst())
+
+        self.assertEqual(results[0][1][0].values()[0].getValue(), 0x10)
+        self.assertEqual(results[1][1][0].values()[0].getValue(), 0x20)
+
+
+
+class TestSolverNormalization(unittest.TestCase):
+
+    """Testing the simplification and the deduplication of the path constraints."""
+
+    def setUp(self):
+        """Define the arch and a loop which checks RAX at each iteration."""
+        setArchitecture(ARCH.X86_64)
+        enableSolverNormalization(True)
+        clearSolverCache()
+        convertRegisterToSymbolicVariable(REG.RAX)
+
+        trace = [
+            (0x400000, "\x48\x83\xF8\x10"), # cmp rax, 0x10
+            (0x400004, "\x74\x10"),         # je  0x400016
+        ] * 8 + [
+            (0x400006, "\x48\x83\xF8\x20"), # cmp rax, 0x20
+            (0x40000a, "\x74\x10"),         # je  0x40001c
+        ]
+
+        for addr, opcodes in trace:
+            inst = Instruction()
+            inst.setAddress(addr)
+            inst.setOpcodes(opcodes)
+            processing(inst)
+
+    def tearDown(self):
+        """Keep the normalization enabled."""
+        enableSolverNormalization(True)
+
+    def test_enable(self):
+        """Check the normalization can be disabled."""
+        self.assertTrue(isSolverNormalizationEnabled())
+        enableSolverNormalization(False)
+        self.assertFalse(isSolverNormalizationEnabled())
+
+    def test_dedup(self):
+        """Check the same constraint of each iteration is kept once."""
+        pcs = getPathConstraints()
+        self.assertEqual(len(pcs), 9)
+
+        full = ast.equal(ast.bvtrue(), ast.bvtrue())
+        for pc in pcs:
+            full = ast.land(full, pc.getTakenPathConstraintAst())
+
+        self.assertLess(len(str(getPathConstraintsAst())), len(str(full)))
+
+    def test_models(self):
+        """Check the models are the same with and without normalization."""
+        pcs = getPathConstraints()
+
+        # The constraints of the loop, each one repeated
+        prefix = ast.equal(ast.bvtrue(), ast.bvtrue())
+        for pc in pcs[:8]:
+            prefix = ast.land(prefix, pc.getTakenPathConstraintAst())
+
+        queries = []
+        for index in [7, 8]:
+            for branch in pcs[index].getBranchConstraints():
+                if not branch['isTaken']:
+                    queries.append(ast.assert_(ast.land(prefix, branch['constraint'])))
+
+        results = []
+        for enabled in [True, False]:
+            enableSolverNormalization(enabled)
+            clearSolverCache()
+            results.append([{k: v.getValue() for k, v in getModel(q).items()} for q in queries])
+
+        self.assertEqual(results[0], results[1])
+        # The loop never takes its branch, the last branch is taken with 0x20
+        self.assertEqual(results[0][0], {})
+        self.assertEqual(results[0][1].values(), [0x20])
+
+
+
+class TestSolverCache(unittest.TestCase):
+
+    """Testing the query cache and the independence slicing."""
+
+    def setUp(self):
+        """Define the arch and two independent variables."""
+        setArchitecture(ARCH.X86_64)
+        enableSolverCache(True)
+        setSolverCachePath("")
+        clearSolverCache()
+
+        self.x = newSymbolicVariable(8)
+        self.y = newSymbolicVariable(8)
+        self.cx = ast.equal(ast.variable(self.x), ast.bv(0x11, 8))
+        self.cy = ast.equal(ast.variable(self.y), ast.bv(0x22, 8))
+
+    def tearDown(self):
+        """Leave the cache in memory only."""
+        setSolverCachePath("")
+
+    def test_enable(self):
+        """Check the cache can be disabled."""
+        self.assertTrue(isSolverCacheEnabled())
+        enableSolverCache(False)
+        self.assertFalse(isSolverCacheEnabled())
+        getModel(ast.assert_(self.cx))
+        self.assertEqual(getSolverCacheHits() + getSolverCacheMisses(), 0)
+        enableSolverCache(True)
+
+    def test_hits(self):
+        """Check the same query is solved once."""
+        m1 = getModel(ast.assert_(self.cx))
+        self.assertEqual((getSolverCacheHits(), getSolverCacheMisses()), (0, 1))
+        m2 = getModel(ast.assert_(self.cx))
+        self.assertEqual((getSolverCacheHits(), getSolverCacheMisses()), (1, 1))
+        self.assertEqual(m1[self.x.getId()].getValue(), m2[self.x.getId()].getValue())
+
+    def test_slicing(self):
+        """Check independent constraints are cached on their own."""
+        getModel(ast.assert_(self.cx))
+        model = getModel(ast.assert_(ast.land(self.cy, self.cx)))
+        self.assertEqual(model[self.x.getId()].getValue(), 0x11)
+        self.assertEqual(model[self.y.getId()].getValue(), 0x22)
+        self.assertEqual((getSolverCacheHits(), getSolverCacheMisses()), (1, 2))
+
+    def test_unsat(self):
+        """Check an unsat part makes the whole query unsat."""
+        cz = ast.equal(ast.variable(self.y), ast.bv(0x33, 8))
+        self.assertEqual(getModel(ast.assert_(ast.land(self.cx, ast.land(self.cy, cz)))), {})
+        self.assertEqual(getModels(ast.assert_(ast.land(self.cy, cz)), 4), [])
+
+    def test_file(self):
+        """Check queries are kept in the cache file."""
+        fd, path = tempfile.mkstemp()
+        os.close(fd)
+        try:
+            setSolverCachePath(path)
+            getModels(ast.assert_(self.cx), 2)
+            setSolverCachePath("")
+            clearSolverCache()
+
+            setSolverCachePath(path)
+            models = getModels(ast.assert_(self.cx), 2)
+            self.assertEqual(len(models), 1)
+            self.assertEqual(models[0][self.x.getId()].getValue(), 0x11)
+            self.assertEqual((getSolverCacheHits(), getSolverCacheMisses()), (1, 0))
+        finally:
+            setSolverCachePath("")
+            os.remove(path)
@@ -11,7 +11,13 @@ from triton import (setArchitecture, ARCH, processing, REG, Instruction,
                     getSymbolicExpressionFromId, getSymbolicMemoryId,
                     getSymbolicMemoryValue, assignSymbolicExpressionToMemory,
                     assignSymbolicExpressionToRegister, buildSymbolicImmediate,
-                    buildSymbolicRegister, Immediate)
+                    buildSymbolicRegister, Immediate, getSymbolicExpressions,
+                    getPathConstraints, taintRegister, isMemoryTainted,
+                    enableMode, MODE, AST_NODE, Register, buildSymbolicMemory,
+                    setConcreteRegisterValue, convertMemoryToSymbolicVariable,
+                    getSymbolicRegisterId, isRegisterTainted,
+                    setConcreteMemoryAreaValue, getConcreteMemoryAreaValue,
+                    taintMemory, concretizeRegister)
 
 
 class TestSymbolic(unittest.TestCase):
@@ -49,6 +55,116 @@ class TestSymbolic(unittest.TestCase):
         # Try to reset engine after a backup to test if the bug #385 is fixed.
         resetEngines()
 
+    def test_taint_only(self):
+        """Check the taint-only processing leaves the symbolic state untouched."""
+        inst = Instruction()
+        # inc rax
+        inst.setOpcodes("\x48\xFF\xC0")
+        processing(inst)
+
+        exprs = len(getSymbolicExpressions())
+        rax = getSymbolicRegisterValue(REG.RAX)
+        pcs = len(getPathConstraints())
+
+        enableSymbolicEngine(False)
+        taintRegister(REG.RAX)
+
+        for _ in range(100):
+            for opcodes in ["\x48\xFF\xC0",          # inc rax
+                            "\x48\x89\x03",          # mov [rbx], rax
+                            "\x48\x3B\x03",          # cmp rax, [rbx]
+                            "\x75\x00"]:              # jne $+2
+                inst = Instruction()
+                inst.setOpcodes(opcodes)
+                processing(inst)
+                self.assertEqual(len(inst.getSymbolicExpressions()), 0)
+
+        self.assertTrue(isMemoryTainted(MemoryAccess(0, CPUSIZE.QWORD)))
+        self.assertEqual(len(getSymbolicExpressions()), exprs)
+        self.assertEqual(len(getPathConstraints()), pcs)
+        self.assertEqual(getSymbolicRegisterValue(REG.RAX), rax)
+        self.assertEqual(getSymbolicMemoryId(0), 0xffffffffffffffff)
+
+        enableSymbolicEngine(True)
+        resetEngines()
+
+    def test_taint_only_semantics(self):
+        """Check the taint-only semantics give the state of the symbolic ones."""
+        code = ["\x48\xB8\x88\x77\x66\x55\x44\x33\x22\x11", # movabs rax, 0x1122334455667788
+                "\x48\x89\x03",                             # mov [rbx], rax
+                "\x8B\x4B\x08",                             # mov ecx, [rbx + 8]
+                "\x48\x01\xC8",                             # add rax, rcx
+                "\x48\x29\xD8",                             # sub rax, rbx
+                "\x48\x21\xC1",                             # and rcx, rax
+                "\x48\x09\xD9",                             # or rcx, rbx
+                "\x48\x31\xC8",                             # xor rax, rcx
+                "\x48\x39\xC8",                             # cmp rax, rcx
+                "\x48\x85\xC0",                             # test rax, rax
+                "\xFE\xC1",                                 # inc cl
+                "\xFF\xC9",                                 # dec ecx
+                "\x48\xF7\xD8",                             # neg rax
+                "\x48\xF7\xD1",                             # not rcx
+                "\x0F\xB6\xD0",                             # movzx edx, al
+                "\x48\x0F\xBE\xF1",                         # movsx rsi, cl
+                "\x48\x63\xF9",                             # movsxd rdi, ecx
+                "\x48\x8D\x44\x8B\x10",                     # lea rax, [rbx + rcx * 4 + 0x10]
+                "\x50",                                     # push rax
+                "\x5A",                                     # pop rdx
+                "\x88\x63\x02",                             # mov [rbx + 2], ah
+                "\x48\xD1\xE0",                             # shl rax, 1 (symbolic semantics)
+                "\x3C\x05",                                 # cmp al, 5
+                "\x74\x01",                                 # je $+3
+                "\x90",                                     # nop
+                "\xE8\x02\x00\x00\x00",                     # call $+7
+                "\xEB\x01",                                 # jmp $+3
+                "\xC3",                                     # ret
+                "\x90"]                                     # nop
+        regs = [REG.RAX, REG.RBX, REG.RCX, REG.RDX, REG.RSI, REG.RDI, REG.RSP,
+                REG.RIP, REG.AF, REG.CF, REG.OF, REG.PF, REG.SF, REG.ZF]
+
+        def run(symbolic):
+            resetEngines()
+            setArchitecture(ARCH.X86_64)
+            enableSymbolicEngine(symbolic)
+            setConcreteMemoryAreaValue(0x1000, "".join(code))
+            setConcreteMemoryAreaValue(0x2000, "\xA5" * 0x10)
+            setConcreteRegisterValue(Register(REG.RBX, 0x2000))
+            setConcreteRegisterValue(Register(REG.RSP, 0x3000))
+            setConcreteRegisterValue(Register(REG.RIP, 0x1000))
+            taintMemory(MemoryAccess(0x2008, CPUSIZE.DWORD))
+            taintRegister(REG.RBX)
+
+            trace = list()
+            end = 0x1000 + len("".join(code))
+            while getConcreteRegisterValue(REG.RIP) != end:
+                inst = Instruction()
+                inst.setOpcodes(getConcreteMemoryAreaValue(getConcreteRegisterValue(REG.RIP), 16))
+                inst.setAddress(getConcreteRegisterValue(REG.RIP))
+                processing(inst)
+                nodes = [node for _, node in inst.getLoadAccess() + inst.getReadRegisters() + inst.getWrittenRegisters()]
+                trace.append((inst.getAddress(), inst.isTainted(), inst.isConditionTaken(), nodes))
+
+            state = {
+                'regs': [(getConcreteRegisterValue(r), isRegisterTainted(r)) for r in regs],
+                'memory': [(getConcreteMemoryAreaValue(addr, 1), isMemoryTainted(addr)) for addr in range(0x2000, 0x2010) + range(0x2fe0, 0x3000)],
+                'trace': [t[:3] for t in trace],
+                'expressions': len(getSymbolicExpressions()),
+            }
+            return state, trace
+
+        symbolic, _ = run(True)
+        taintOnly, trace = run(False)
+
+        self.assertEqual(symbolic['regs'], taintOnly['regs'])
+        self.assertEqual(symbolic['memory'], taintOnly['memory'])
+        self.assertEqual(symbolic['trace'], taintOnly['trace'])
+        self.assertTrue(any(tainted for _, tainted, _, _ in trace))
+        self.assertTrue(all(node is None for _, _, _, nodes in trace for node in nodes))
+        self.assertEqual(taintOnly['expressions'], 0)
+
+        enableSymbolicEngine(True)
+        resetEngines()
+
     def test_bind_expr_to_memory(self):
         """Check symbolic expression binded to memory can be retrieve."""
         # Bind expr1 to 0x100
@@ -132,3 +248,153 @@ class TestSymbolicBuilding(unittest.TestCase):
         node = buildSymbolicRegister(REG.AL)
         self.assertEqual(node.evaluate(), 0x88)
         self.assertEqual(node.getBitvectorSize(), CPUSIZE.BYTE_BIT)
+
+
+class TestSymbolicMemoryRanges(unittest.TestCase):
+
+    """Testing the symbolic memory with MEMORY_RANGES."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.MEMORY_RANGES, True)
+        setConcreteRegisterValue(Register(REG.RSP, 0x1000))
+
+    def test_store(self):
+        """Check a store creates a single expression."""
+        inst = Instruction()
+        inst.setOpcodes("\x50")                # push rax
+        processing(inst)
+
+        memId = getSymbolicMemoryId(0xff8)
+        self.assertNotEqual(memId, 0xffffffffffffffff)
+        for addr in range(0xff8, 0x1000):
+            self.assertEqual(getSymbolicMemoryId(addr), memId)
+        self.assertEqual(getSymbolicExpressionFromId(memId).getAst().getBitvectorSize(), CPUSIZE.QWORD_BIT)
+        self.assertEqual(len([e for e in inst.getSymbolicExpressions() if e.getId() == memId]), 1)
+
+    def test_load_matching_store(self):
+        """Check a load matching a store returns a reference to its expression."""
+        expr = newSymbolicExpression(ast.bv(0x1122334455667788, CPUSIZE.QWORD_BIT))
+        assignSymbolicExpressionToMemory(expr, MemoryAccess(0x100, CPUSIZE.QWORD))
+
+        node = buildSymbolicMemory(MemoryAccess(0x100, CPUSIZE.QWORD))
+        self.assertEqual(node.getKind(), AST_NODE.REFERENCE)
+        self.assertEqual(node.evaluate(), 0x1122334455667788)
+
+    def test_load_overlapping_stores(self):
+        """Check a load overlapping several stores only extracts the needed bytes."""
+        expr1 = newSymbolicExpression(ast.bv(0x11223344, CPUSIZE.DWORD_BIT))
+        expr2 = newSymbolicExpression(ast.bv(0x55667788, CPUSIZE.DWORD_BIT))
+        assignSymbolicExpressionToMemory(expr1, MemoryAccess(0x200, CPUSIZE.DWORD))
+        assignSymbolicExpressionToMemory(expr2, MemoryAccess(0x204, CPUSIZE.DWORD))
+
+        self.assertEqual(getSymbolicMemoryValue(MemoryAccess(0x200, CPUSIZE.QWORD)), 0x5566778811223344)
+        self.assertEqual(getSymbolicMemoryValue(MemoryAccess(0x202, CPUSIZE.DWORD)), 0x77881122)
+        self.assertEqual(getSymbolicMemoryValue(MemoryAccess(0x203, CPUSIZE.WORD)), 0x8811)
+        self.assertEqual(getSymbolicMemoryValue(MemoryAccess(0x206, CPUSIZE.QWORD)), 0x5566)
+
+        node = buildSymbolicMemory(MemoryAccess(0x202, CPUSIZE.DWORD))
+        self.assertEqual(node.getKind(), AST_NODE.CONCAT)
+        self.assertEqual(len(node.getChilds()), 2)
+
+    def test_push_pop(self):
+        """Check a push/pop sequence keeps its value with fewer expressions."""
+        setConcreteRegisterValue(Register(REG.RAX, 0xdeadbeefcafebabe))
+        exprs = len(getSymbolicExpressions())
+
+        for opcodes in ["\x50",                # push rax
+                        "\x5B"]:               # pop rbx
+            inst = Instruction()
+            inst.setOpcodes(opcodes)
+            processing(inst)
+
+        self.assertEqual(getSymbolicRegisterValue(REG.RBX), 0xdeadbeefcafebabe)
+        # push: rsp, rip and the store ; pop: rbx, rsp, rip
+        self.assertEqual(len(getSymbolicExpressions()) - exprs, 6)
+
+    def test_convert_memory(self):
+        """Check a symbolic variable keeps a single range."""
+        expr = newSymbolicExpression(ast.bv(0x11223344, CPUSIZE.DWORD_BIT))
+        assignSymbolicExpressionToMemory(expr, MemoryAccess(0x300, CPUSIZE.DWORD))
+
+        convertMemoryToSymbolicVariable(MemoryAccess(0x300, CPUSIZE.DWORD))
+        self.assertEqual(getSymbolicMemoryId(0x300), expr.getId())
+        self.assertTrue(getSymbolicExpressionFromId(expr.getId()).getAst().isSymbolized())
+
+        convertMemoryToSymbolicVariable(MemoryAccess(0x302, CPUSIZE.WORD))
+        self.assertEqual(getSymbolicMemoryId(0x300), expr.getId())
+        self.assertNotEqual(getSymbolicMemoryId(0x302), expr.getId())
+        self.assertTrue(getSymbolicExpressionFromId(getSymbolicMemoryId(0x302)).getAst().isSymbolized())
+
+
+class TestSymbolicLazyFlags(unittest.TestCase):
+
+    """Testing the flags with LAZY_FLAGS."""
+
+    def setUp(self):
+        """Define the arch and modes."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.LAZY_FLAGS, True)
+
+    def process(self, opcodes):
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        processing(inst)
+        return inst
+
+    def test_overwritten_flags(self):
+        """Check flags overwritten before being read get no expression."""
+        exprs = len(getSymbolicExpressions())
+        self.process("\x48\x01\xD8")         # add rax, rbx
+        self.process("\x48\x29\xD8")         # sub rax, rbx
+        # add: rax, rip ; sub: rax, rip
+        self.assertEqual(len(getSymbolicExpressions()) - exprs, 4)
+
+    def test_concrete_flags(self):
+        """Check the concrete values of the flags are synchronized."""
+        setConcreteRegisterValue(Register(REG.RAX, 0xffffffffffffffff))
+        setConcreteRegisterValue(Register(REG.RBX, 1))
+        self.process("\x48\x01\xD8")         # add rax, rbx
+
+        self.assertEqual(getConcreteRegisterValue(REG.AF), 1)
+        self.assertEqual(getConcreteRegisterValue(REG.CF), 1)
+        self.assertEqual(getConcreteRegisterValue(REG.OF), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.PF), 1)
+        self.assertEqual(getConcreteRegisterValue(REG.SF), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.ZF), 1)
+
+        # RAX has an expression since the add, its new value must be concrete
+        concretizeRegister(REG.RAX)
+        setConcreteRegisterValue(Register(REG.RAX, 0x7fffffffffffffff))
+        self.process("\x48\x29\xD8")         # sub rax, rbx
+
+        self.assertEqual(getConcreteRegisterValue(REG.CF), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.OF), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.PF), 0)
+        self.assertEqual(getConcreteRegisterValue(REG.ZF), 0)
+
+    def test_read_by_user(self):
+        """Check a flag read by the user gets its expression."""
+        setConcreteRegisterValue(Register(REG.RAX, 0x80))
+        setConcreteRegisterValue(Register(REG.RBX, 0x80))
+        self.process("\x00\xD8")              # add al, bl
+
+        for flag in [REG.AF, REG.CF, REG.OF, REG.PF, REG.SF, REG.ZF]:
+            flagId = getSymbolicRegisterId(flag)
+            self.assertNotEqual(flagId, 0xffffffffffffffff)
+            ast = getSymbolicExpressionFromId(flagId).getAst()
+            self.assertEqual(ast.evaluate(), getConcreteRegisterValue(flag))
+
+    def test_read_by_instruction(self):
+        """Check a flag read by an instruction belongs to this instruction."""
+        self.process("\x48\x39\xD8")         # cmp rax, rbx
+        inst = self.process("\x74\x02")       # jz +2
+        self.assertIn("Zero flag", [e.getComment() for e in inst.getSymbolicExpressions()])
+
+    def test_taint(self):
+        """Check the taint is spread to the pending flags."""
+        taintRegister(REG.RAX)
+        self.process("\x48\x01\xD8")         # add rax, rbx
+        self.assertTrue(isRegisterTainted(REG.ZF))
+        self.assertTrue(getSymbolicExpressionFromId(getSymbolicRegisterId(REG.ZF)).isTainted())
@@ -13,7 +13,10 @@ from triton import (setArchitecture, ARCH, REG, taintRegister, processing,
                     taintUnionMemoryImmediate, taintUnionMemoryMemory,
                     taintUnionMemoryRegister, taintUnionRegisterImmediate,
                     taintUnionRegisterMemory, taintUnionRegisterRegister,
-                    getTaintedRegisters, getTaintedMemory)
+                    getTaintedRegisters, getTaintedMemory, enableMode, MODE,
+                    labelMemory, labelRegister, getMemoryLabels, getRegisterLabels,
+                    setConcreteRegisterValue, Register, addCallback,
+                    removeAllCallbacks, CALLBACK)
 
 
 class TestTaint(unittest.TestCase):
@@ -421,3 +424,122 @@ class TestTaint(unittest.TestCase):
         self.assertTrue(0x4003 in m)
         self.assertFalse(0x5000 in m)
 
+
+    def test_taint_memory_pages(self):
+        """Taint memory across pages"""
+        setArchitecture(ARCH.X86_64)
+
+        # The access crosses a 4 KiB page and a 4 MiB directory
+        taintMemory(MemoryAccess(0x3ffffe, 4))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0x3ffff8, 8)))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0x400001, 8)))
+        self.assertFalse(isMemoryTainted(MemoryAccess(0x3ffff6, 8)))
+        self.assertFalse(isMemoryTainted(MemoryAccess(0x400002, 8)))
+        self.assertEqual(getTaintedMemory(), [0x3ffffe, 0x3fffff, 0x400000, 0x400001])
+
+        # Addresses are returned in ascending order
+        taintMemory(0xfffffffffffffff0)
+        taintMemory(0x10)
+        self.assertEqual(getTaintedMemory(), [0x10, 0x3ffffe, 0x3fffff, 0x400000, 0x400001, 0xfffffffffffffff0])
+
+        untaintMemory(MemoryAccess(0x3ffffe, 4))
+        self.assertEqual(getTaintedMemory(), [0x10, 0xfffffffffffffff0])
+
+        # Copies of an untainted area untaint the destination at once
+        taintMemory(MemoryAccess(0x1000, 32))
+        taintAssignmentMemoryMemory(MemoryAccess(0x1008, 16), MemoryAccess(0x2000, 16))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0x1000, 8)))
+        self.assertFalse(isMemoryTainted(MemoryAccess(0x1008, 16)))
+        self.assertTrue(isMemoryTainted(MemoryAccess(0x1018, 8)))
+
+
+class TestTaintLabels(unittest.TestCase):
+
+    """Testing the taint labels."""
+
+    def setUp(self):
+        """Define the arch and label a packet."""
+        setArchitecture(ARCH.X86_64)
+        enableMode(MODE.TAINT_LABELS, True)
+        setConcreteRegisterValue(Register(REG.RDI, 0x1000))
+        setConcreteRegisterValue(Register(REG.RSI, 0x2000))
+        for i in range(16):
+            labelMemory(0x1000 + i, i)
+
+    def process(self, opcodes):
+        """Process an instruction."""
+        inst = Instruction()
+        inst.setOpcodes(opcodes)
+        processing(inst)
+        return inst
+
+    def test_mode(self):
+        """Labels need the TAINT_LABELS mode."""
+        enableMode(MODE.TAINT_LABELS, False)
+        with self.assertRaises(TypeError):
+            labelMemory(0x3000, 1)
+
+    def test_memory(self):
+        """Check the labels of the memory."""
+        self.assertTrue(isMemoryTainted(0x1000))
+        self.assertEqual(getMemoryLabels(0x1003), [3])
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x1004, 4)), [4, 5, 6, 7])
+        self.assertEqual(getMemoryLabels(0x1010), [])
+
+        labelMemory(MemoryAccess(0x1000, 2), 100)
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x1000, 2)), [0, 1, 100])
+
+        untaintMemory(0x1000)
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x1000, 2)), [1, 100])
+
+    def test_flow(self):
+        """Check that the labels flow to the instructions."""
+        inst = self.process("\x8b\x47\x0c")          # mov eax, dword ptr [rdi + 0xc]
+        self.assertEqual(inst.getTaintLabels(), [12, 13, 14, 15])
+        self.assertEqual(getRegisterLabels(REG.RAX), [12, 13, 14, 15])
+
+        inst = self.process("\x3d\x34\x12\x00\x00")  # cmp eax, 0x1234
+        self.assertTrue(inst.isTainted())
+        self.assertEqual(inst.getTaintLabels(), [12, 13, 14, 15])
+
+        labelRegister(REG.EBX, 100)
+        inst = self.process("\x01\xd8")              # add eax, ebx
+        self.assertEqual(getRegisterLabels(REG.EAX), [12, 13, 14, 15, 100])
+
+        inst = self.process("\x89\x06")              # mov dword ptr [rsi], eax
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x2000, 4)), [12, 13, 14, 15, 100])
+        self.assertEqual(getMemoryLabels(0x2004), [])
+
+        inst = self.process("\xb8\x01\x00\x00\x00")  # mov eax, 1
+        self.assertEqual(inst.getTaintLabels(), [])
+        self.assertFalse(isRegisterTainted(REG.RAX))
+        self.assertEqual(getRegisterLabels(REG.RAX), [])
+
+    def test_sources(self):
+        """Check that only the sources read give their labels."""
+        labelRegister(REG.RCX, 100)
+
+        # A check of the taint during the processing is not a source
+        addCallback(lambda reg: isRegisterTainted(REG.RCX), CALLBACK.GET_CONCRETE_REGISTER_VALUE)
+        inst = self.process("\x89\xd8")              # mov eax, ebx
+        removeAllCallbacks()
+        self.assertEqual(inst.getTaintLabels(), [])
+
+        # Neither is the check of the destination after its write
+        inst = self.process("\x89\x4f\x00")          # mov dword ptr [rdi], ecx
+        self.assertEqual(inst.getTaintLabels(), [100])
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x1000, 4)), [100])
+
+    def test_large_labels(self):
+        """Check the union of labels which are not inline."""
+        labelMemory(0x3000, 1000)
+        labelMemory(0x3001, 70)
+        labelMemory(0x3002, 5)
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x3000, 4)), [5, 70, 1000])
+        taintUnionMemoryMemory(MemoryAccess(0x1000, 4), MemoryAccess(0x3000, 4))
+        self.assertEqual(getMemoryLabels(0x1000), [0, 1000])
+        self.assertEqual(getMemoryLabels(0x1001), [1, 70])
+        self.assertEqual(getMemoryLabels(0x1003), [3])
+        taintAssignmentMemoryMemory(MemoryAccess(0x1000, 4), MemoryAccess(0x3000, 4))
+        self.assertEqual(getMemoryLabels(MemoryAccess(0x1000, 4)), [5, 70, 1000])
+        self.assertFalse(isMemoryTainted(0x1003))
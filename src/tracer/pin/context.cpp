@@ -32,7 +32,7 @@ namespace tracer {
         triton::uint512 value = 0;
 
         #if defined(__x86_64__) || defined(_M_X64)
-          switch (reg.getParent().getId()) {
+          switch (reg.getParentId()) {
             case triton::arch::x86::ID_REG_RAX:     PIN_GetContextRegval(tracer::pintool::context::lastContext, LEVEL_BASE::REG_RAX,    reinterpret_cast<triton::uint8*>(buffer)); break;
             case triton::arch::x86::ID_REG_RBX:     PIN_GetContextRegval(tracer::pintool::context::lastContext, LEVEL_BASE::REG_RBX,    reinterpret_cast<triton::uint8*>(buffer)); break;
             case triton::arch::x86::ID_REG_RCX:     PIN_GetContextRegval(tracer::pintool::context::lastContext, LEVEL_BASE::REG_RCX,    reinterpret_cast<triton::uint8*>(buffer)); break;
@@ -159,15 +159,15 @@ namespace tracer {
         /* Sync with the libTriton */
         triton::arch::Register syncReg;
         if (reg.getId() >= triton::arch::x86::ID_REG_AF && reg.getId() <= triton::arch::x86::ID_REG_ZF)
-          syncReg = TRITON_X86_REG_EFLAGS;
+          syncReg = triton::api.getRegister(triton::arch::x86::ID_REG_EFLAGS);
         else if (reg.getId() >= triton::arch::x86::ID_REG_IE && reg.getId() <= triton::arch::x86::ID_REG_FZ)
-          syncReg = TRITON_X86_REG_MXCSR;
+          syncReg = triton::api.getRegister(triton::arch::x86::ID_REG_MXCSR);
         else
-          syncReg = reg.getParent();
+          syncReg = triton::api.getParentRegister(reg);
         #endif
 
         #if defined(__i386) || defined(_M_IX86)
-          switch (reg.getParent().getId()) {
+          switch (reg.getParentId()) {
             case triton::arch::x86::ID_REG_EAX:     PIN_GetContextRegval(tracer::pintool::context::lastContext, LEVEL_BASE::REG_EAX,    reinterpret_cast<triton::uint8*>(buffer)); break;
             case triton::arch::x86::ID_REG_EBX:     PIN_GetContextRegval(tracer::pintool::context::lastContext, LEVEL_BASE::REG_EBX,    reinterpret_cast<triton::uint8*>(buffer)); break;
             case triton::arch::x86::ID_REG_ECX:     PIN_GetContextRegval(tracer::pintool::context::lastContext, LEVEL_BASE::REG_ECX,    reinterpret_cast<triton::uint8*>(buffer)); break;
@@ -238,11 +238,11 @@ namespace tracer {
         /* Sync with the libTriton */
         triton::arch::Register syncReg;
         if (reg.getId() >= triton::arch::x86::ID_REG_AF && reg.getId() <= triton::arch::x86::ID_REG_ZF)
-          syncReg = TRITON_X86_REG_EFLAGS;
+          syncReg = triton::api.getRegister(triton::arch::x86::ID_REG_EFLAGS);
         else if (reg.getId() >= triton::arch::x86::ID_REG_IE && reg.getId() <= triton::arch::x86::ID_REG_FZ)
-          syncReg = TRITON_X86_REG_MXCSR;
+          syncReg = triton::api.getRegister(triton::arch::x86::ID_REG_MXCSR);
         else
-          syncReg = reg.getParent();
+          syncReg = triton::api.getParentRegister(reg);
         #endif
 
         value = triton::utils::fromBufferToUint<triton::uint512>(buffer);
@@ -296,7 +296,7 @@ namespace tracer {
       void setCurrentRegisterValue(triton::arch::Register& reg, triton::uint512 value) {
         triton::uint8 buffer[DQQWORD_SIZE] = {0};
 
-        if (reg.getId() != reg.getParent().getId() || triton::api.isFlag(reg))
+        if (reg.getId() != reg.getParentId() || triton::api.isFlag(reg))
           throw std::runtime_error("tracer::pintool::context::setCurrentRegisterValue(): You cannot set a Pin register value on a sub-register or a flag.");
 
         triton::utils::fromUintToBuffer(value, buffer);
@@ -469,7 +469,7 @@ namespace tracer {
 
       void needConcreteRegisterValue(triton::arch::Register& reg) {
         triton::uint512 value = tracer::pintool::context::getCurrentRegisterValue(reg);
-        triton::arch::Register tmp(reg.getId(), value);
+        triton::arch::Register tmp(*triton::api.getCpu(), reg.getId(), value);
         triton::api.setConcreteRegisterValue(tmp);
       }
 
@@ -478,7 +478,7 @@ namespace tracer {
         if (triton::api.isSymbolicEngineEnabled() == false)
           return;
 
-        for (triton::arch::Register* reg : triton::api.getParentRegisters()) {
+        for (const triton::arch::Register* reg : triton::api.getParentRegisters()) {
           if (reg->getId() > triton::arch::x86::ID_REG_EFLAGS)
             continue;
 
@@ -490,7 +490,7 @@ namespace tracer {
 
           if (sv != cv) {
             triton::api.concretizeRegister(*reg);
-            triton::api.setConcreteRegisterValue(triton::arch::Register(reg->getId(), cv));
+            triton::api.setConcreteRegisterValue(triton::arch::Register(*triton::api.getCpu(), reg->getId(), cv));
           }
         }
       }